@@ -0,0 +1 @@
+0x1,0x0,0x26,0x0,0x0,0x0,0x0,0x0,0x70,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2A,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x39,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x47,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x54,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x6D,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x74,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8A,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x92,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xAE,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xC9,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD5,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xE9,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x1E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x7,0x1,0x0,0x0,0x0,0x0,0x0,0xA0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x13,0x1,0x0,0x0,0x0,0x0,0x0,0xD0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2B,0x1,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x2D,0x1,0x0,0x0,0x0,0x0,0x0,0xB0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x45,0x1,0x0,0x0,0x0,0x0,0x0,0x60,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x46,0x1,0x0,0x0,0x0,0x0,0x0,0xC0,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x62,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7C,0x1,0x0,0x0,0x0,0x0,0x0,0x10,0x1D,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x99,0x1,0x0,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xA4,0x1,0x0,0x0,0x0,0x0,0x0,0x20,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xBC,0x1,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC1,0x1,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xC5,0x1,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xC9,0x1,0x0,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xCD,0x1,0x0,0x0,0x0,0x0,0x0,0xF0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xD1,0x1,0x0,0x0,0x0,0x0,0x0,0x70,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD4,0x1,0x0,0x0,0x0,0x0,0x0,0xD0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xEA,0x1,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF0,0x1,0x0,0x0,0x0,0x0,0x0,0x80,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x3,0x2,0x0,0x0,0x0,0x0,0x0,0xB0,0x1F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC8,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1,0x0,0x0,0x20,0x7,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x4C,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x2,0x0,0x0,0x30,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB1,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1,0x0,0x0,0x20,0x7,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x1D,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x56,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x4,0x0,0x0,0x60,0x12,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x2,0x0,0x0,0x60,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x6E,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5,0x0,0x0,0x50,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x4C,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x90,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x25,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x82,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x3,0x0,0x0,0x20,0xF,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2E,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x1E,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x32,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x0,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3D,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x2E,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x30,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x22,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8A,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0xA0,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xCA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x10,0xC,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x10,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x10,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x10,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x82,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x91,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xFE,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0xE0,0x8,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x70,0x3,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x8C,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x3,0x0,0x0,0x30,0xF,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xDA,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x10,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1D,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xE2,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x20,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x3,0x0,0x0,0xF0,0xF,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2E,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x4E,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x14,0x2,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x38,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0xF0,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x4,0x0,0x0,0x80,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE4,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x2,0x0,0x0,0xB0,0x8,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xCE,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x3,0x0,0x0,0xE0,0xD,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x2B,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xA6,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x33,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1,0x0,0x0,0x20,0x7,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x37,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xDA,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x5,0x0,0x0,0x10,0x15,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x43,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x47,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x9A,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x10,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xC2,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x0,0x0,0x0,0x20,0x3,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x5F,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x4,0x0,0x0,0xD0,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x69,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x2,0x0,0x0,0x60,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xA,0x71,0x48,0x7F,0xBC,0x67,0x3E,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFE,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xA,0x71,0x48,0x7F,0xBC,0x67,0x3E,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xA,0x71,0x48,0x7F,0xBC,0x67,0x3E,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xA,0x71,0x48,0x7F,0xBC,0x67,0x3E,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xA,0x71,0x48,0x7F,0xBC,0x67,0x3E,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xA,0x71,0x48,0x7F,0xBC,0x67,0x3E,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x3,0x7F,0xBC,0x0,0xA,0x71,0x48,0x7F,0xBC,0x67,0x3E,0xFF,0xFE,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x3,0x7F,0xBC,0x0,0xA,0x71,0x48,0x7F,0xBC,0x67,0x3E,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xA,0x71,0x48,0x7F,0xBC,0x67,0x3E,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xA,0x71,0x48,0x7F,0xBC,0x67,0x3E,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0x7B,0x0,0x0,0x0,0x0,0xB0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x89,0x0,0x0,0x0,0x0,0xE0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x8E,0x0,0x0,0x0,0x0,0xF0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x72,0x0,0x0,0x0,0x0,0x0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x89,0x0,0x0,0x0,0x0,0xE0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x80,0x0,0x0,0x0,0x0,0x10,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x77,0x0,0x0,0x0,0x0,0x20,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x7B,0x0,0x0,0x0,0x0,0xB0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA1,0x0,0x0,0x0,0x0,0x50,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x72,0x0,0x0,0x0,0x0,0x0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x80,0x0,0x0,0x0,0x0,0x10,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x89,0x0,0x0,0x0,0x0,0xE0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x85,0x0,0x0,0x0,0x0,0x70,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x98,0x0,0x0,0x0,0x0,0x80,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x14,0x2,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6F,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x72,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x2,0x0,0x0,0x70,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x79,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x5E,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0xE0,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x81,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x34,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xE,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x87,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xE,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x4,0x0,0x0,0xE0,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x91,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x70,0x3,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x93,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xBC,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x98,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x82,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x90,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9F,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x34,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x5,0x0,0x0,0xB0,0x15,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xAB,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xB2,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xB1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xC4,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0xB0,0x16,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xBE,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x8A,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0xA0,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xC4,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xA8,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF1,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xCF,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xF4,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x40,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xD2,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x4,0x0,0x0,0xD0,0x12,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x8E,0x0,0x0,0x0,0x0,0xE0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x52,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x2,0x0,0x0,0x60,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xC4,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x2,0x0,0x0,0x40,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xB6,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD1,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x2E,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xAA,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x10,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x22,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF4,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x2E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xC2,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x20,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x39,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x3,0x0,0x0,0x90,0xC,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xD4,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB1,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x49,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x4,0x0,0x0,0x40,0x12,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x4,0x0,0x0,0xF0,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5D,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x6E,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6A,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xBE,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0xE0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0x3E,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x39,0x0,0x0,0x0,0x0,0xA0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x85,0x0,0x0,0x0,0x0,0xB0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x30,0x0,0x0,0x0,0x0,0xC0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x2B,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x13,0x0,0x0,0x0,0x0,0xE0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x2B,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x26,0x0,0x0,0x0,0x0,0xF0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x39,0x0,0x0,0x0,0x0,0xA0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x35,0x0,0x0,0x0,0x0,0x10,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x3E,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x1D,0x0,0x0,0x0,0x0,0x20,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x30,0x0,0x0,0x0,0x0,0xC0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB6,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0xD0,0x4,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xE4,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB1,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x68,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x1,0x0,0x0,0x80,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xE2,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x5,0x0,0x0,0x20,0x15,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x22,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xB6,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x2,0x0,0x0,0x60,0x8,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x27,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x76,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x31,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x3A,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xCC,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0xC0,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x3D,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x46,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD1,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4A,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA6,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x3,0x0,0x0,0x60,0xF,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0xC0,0x4,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x55,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF1,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0x1D,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x30,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x5A,0x0,0x0,0x0,0x0,0xA0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x30,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x18,0x0,0x0,0x0,0x0,0xB0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x6D,0x0,0x0,0x0,0x0,0xC0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xB6,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x60,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x7A,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x1,0x0,0x0,0x60,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x10,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x24,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x5C,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x26,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0xD0,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x32,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x1,0x0,0x0,0x80,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x37,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x9C,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x30,0x8,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3B,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x2,0x0,0x0,0xD0,0x9,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x72,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x44,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xFA,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x2,0x0,0x0,0xA0,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x4A,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x98,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x3,0x0,0x0,0x80,0xD,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x71,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5D,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xBC,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x3,0x0,0x0,0xC0,0xD,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x65,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x36,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0xD0,0xC,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x6C,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x7A,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x64,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0xB0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x77,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x70,0x3,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x79,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x46,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x6A,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x10,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x82,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xF6,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0xD0,0x8,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x87,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xFA,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x8B,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xDA,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x5,0x0,0x0,0x10,0x15,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x97,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0xF0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xA0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x58,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF1,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA4,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x5E,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x2,0x0,0x0,0x50,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC2,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x90,0xF,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x3,0x0,0x0,0x0,0xF,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x3C,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x2,0x0,0x0,0x0,0x9,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xDA,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x5,0x0,0x0,0x10,0x15,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x2C,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x2A,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x6A,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x10,0x16,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFE,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x4C,0xA4,0xFF,0xFE,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1,0x27,0x10,0x0,0x1E,0x27,0x10,0x0,0x1E,0x7F,0xBC,0xFF,0xFE,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x32,0xD0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x10,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x6A,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x10,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x71,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xB4,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x3,0x0,0x0,0xB0,0xD,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x62,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x90,0x9,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF1,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xBE,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0xE0,0x4,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x25,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x60,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x71,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x38,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5,0x0,0x0,0x70,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x43,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x3C,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0xC0,0x15,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x4F,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5C,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x40,0x17,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x69,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0xC0,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x74,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x5C,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x76,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x98,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x3,0x0,0x0,0x80,0xD,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x7E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x38,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0xF0,0x3,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x9A,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x83,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x56,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0xD0,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x8B,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x60,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x8E,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x8C,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x97,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x36,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x4,0x0,0x0,0x60,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xA0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x8C,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x0,0x0,0x0,0xC0,0x2,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xA1,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB1,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xDC,0x1,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x64,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xE5,0x1,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xF4,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0xB0,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xEF,0x1,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xDC,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x3,0x0,0x0,0xC0,0xF,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x76,0x1,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x56,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x4,0x0,0x0,0x60,0x12,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xB4,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0xF0,0x8,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x75,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xA4,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x79,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x20,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x81,0x1,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xC4,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x1D,0x3F,0x13,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xC0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x7F,0xA,0x0,0x0,0x0,0x0,0xE0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xF0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x80,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xDC,0x1,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x64,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xE5,0x1,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xF4,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0xB0,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xEF,0x1,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xDC,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x3,0x0,0x0,0xC0,0xF,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xE,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x50,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x76,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5,0x0,0x0,0x60,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x34,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0xC0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0xF0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x49,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0xC0,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x59,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x4E,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0xE0,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5D,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x22,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x10,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6A,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xCC,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x30,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x87,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x70,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x95,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x5C,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x99,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0xF0,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9D,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x9C,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0xC0,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x60,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xFB,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x1,0x0,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x15,0x2,0x0,0x0,0x0,0x0,0x0,0x30,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x1,0x0,0x0,0x40,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xCD,0x6,0x73,0x0,0xD3,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xCD,0x6,0x73,0x0,0xD3,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xCD,0x6,0x73,0x0,0xD3,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xCD,0x6,0x73,0x0,0xD3,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x37,0x7F,0xBC,0x0,0x7F,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x67,0x5E,0x30,0x1,0x99,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x1D,0x3F,0x13,0x0,0x0,0x0,0x0,0x60,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x1D,0x3D,0x18,0x0,0x0,0x0,0x0,0x70,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x1D,0x3D,0x26,0x0,0x0,0x0,0x0,0x80,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x1D,0x3D,0x26,0x0,0x0,0x0,0x0,0x90,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x1D,0x3D,0x26,0x0,0x0,0x0,0x0,0xA0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x1D,0x3D,0x26,0x0,0x0,0x0,0x0,0xB0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xC0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x72,0x0,0x0,0x0,0x0,0xD0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xE0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0x1C,0xA,0x0,0x0,0x0,0x0,0x0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x12,0x7F,0xA,0x0,0x0,0x0,0x0,0x10,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3C,0x3C,0xD0,0x0,0x0,0x0,0x0,0x20,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x70,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x20,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x30,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF6,0x44,0x57,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xE4,0x11,0x64,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0x71,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0x9C,0x87,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x37,0x98,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x45,0xA1,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x8E,0xC8,0xBF,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0xCB,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0xD7,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x39,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x63,0x98,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x83,0x57,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0x53,0x64,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0x2A,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0x35,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x2F,0xCB,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xFE,0x44,0xD7,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x2,0xC,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x55,0x14,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0x27,0x1D,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xE2,0x7F,0x26,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA7,0xE3,0x3A,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0x46,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0x51,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0xC6,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0xD1,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0x64,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0x71,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0xA0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x60,0x16,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xB6,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD1,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1E,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x36,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0xD0,0xC,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x25,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x2,0x0,0x0,0xC0,0x9,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x2A,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xBE,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x34,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0xC0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0xF0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x49,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0xC0,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x59,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x4E,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0xE0,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5D,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x22,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x10,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6A,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xCC,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x30,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x75,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xA4,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x79,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x20,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x87,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x70,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x95,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x5C,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x99,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0xF0,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9D,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x9C,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0xC0,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x82,0x13,0x5A,0x2,0xB,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x82,0x13,0x5A,0x2,0xB,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xCD,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x37,0x7F,0xBC,0x0,0x7F,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x29,0x7F,0x64,0x0,0x0,0x0,0x0,0x70,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x29,0x7F,0x64,0x0,0x0,0x0,0x0,0x80,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xB4,0x0,0x0,0x0,0x0,0x90,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x4C,0x0,0x0,0x0,0x0,0xB0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x35,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x7F,0xA,0x0,0x0,0x0,0x0,0xF0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x20,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0x1C,0xA,0x0,0x0,0x0,0x0,0x0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x80,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x12,0x7F,0xA,0x0,0x0,0x0,0x0,0x10,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xC0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF6,0x44,0x57,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xE4,0x11,0x64,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0x71,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0x9C,0x87,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x37,0x98,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x45,0xA1,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x8E,0xC8,0xBF,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0xCB,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0xD7,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x39,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x63,0x98,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x83,0x57,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0x53,0x64,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0x2A,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0x35,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x2F,0xCB,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xFE,0x44,0xD7,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x2,0xC,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x55,0x14,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0x27,0x1D,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xE2,0x7F,0x26,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA7,0xE3,0x3A,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0x46,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0x51,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0xC6,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0xD1,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0x64,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0x71,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x28,0x1,0x0,0x0,0x0,0x0,0x0,0xC0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2C,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2E,0x1,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xA2,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x20,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x37,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0xB0,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x29,0x2,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x16,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x36,0x2,0x0,0x0,0x0,0x0,0x0,0x60,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x7E,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x74,0x1,0x0,0x0,0x0,0x0,0x0,0xF0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x9A,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0xA0,0x4,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0xA0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF1,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x88,0x0,0x0,0x7F,0xBC,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x1,0x2A,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x3,0x7F,0xBC,0x1,0x2A,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0xB0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x2F,0x2B,0x0,0x0,0x0,0x0,0xE0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x77,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x10,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5E,0x1,0x0,0x0,0x0,0x0,0x0,0xB0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC8,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0xF0,0x4,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x61,0x1,0x0,0x0,0x0,0x0,0x0,0x60,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xBC,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x3,0x0,0x0,0xC0,0xD,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x68,0x1,0x0,0x0,0x0,0x0,0x0,0x10,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1B,0x1,0x0,0x0,0x0,0x0,0x0,0xA0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0xF0,0x16,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x4F,0x1,0x0,0x0,0x0,0x0,0x0,0x50,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xC2,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x90,0xF,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xC6,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x4E,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x4,0x0,0x0,0x50,0x12,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xBB,0x0,0x0,0x7F,0xBC,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x37,0x38,0x64,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x90,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x5A,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x80,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xF8,0x1,0x0,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xFB,0x1,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xBE,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0xE0,0x4,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xFE,0x1,0x0,0x0,0x0,0x0,0x0,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xC6,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x60,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x34,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0xC0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0xF0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x49,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0xC0,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x59,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x4E,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0xE0,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5D,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x22,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x10,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6A,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xCC,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x30,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x91,0x1D,0xAD,0x1,0x57,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x9A,0x1D,0xAD,0x1,0x27,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x91,0x20,0x41,0x1,0x45,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xB0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0xD0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0xE0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xF6,0x44,0x57,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE4,0x11,0x64,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0x71,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0x9C,0x87,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x37,0x98,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x45,0xA1,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x8E,0xC8,0xBF,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0xCB,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0xD7,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x39,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x63,0x98,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x83,0x57,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0x53,0x64,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0x2A,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0x35,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x2F,0xCB,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xFE,0x44,0xD7,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x2,0xC,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x55,0x14,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0x27,0x1D,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xE2,0x7F,0x26,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA7,0xE3,0x3A,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0x46,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0x51,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0xC6,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0xD1,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0x64,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0x71,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xE,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x80,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xBF,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xEE,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x49,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xE,0x1,0x0,0x0,0x0,0x0,0x0,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x50,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0x1,0x0,0x0,0x0,0x0,0x0,0xD0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x26,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD1,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x3F,0x2,0x0,0x0,0x0,0x0,0x0,0x60,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xE,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x50,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xCA,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xD5,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x9E,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xE2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xC8,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0xF0,0x4,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x34,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0xC0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0xF0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0xC0,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x59,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x4E,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0xE0,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5D,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x22,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x10,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6A,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xCC,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x30,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x75,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA4,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x79,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x20,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x87,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x70,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x95,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x5C,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x99,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0xF0,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9D,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x9C,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0xC0,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x60,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xFB,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x1,0x0,0x0,0x0,0x0,0x0,0xA0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xCD,0x4D,0x6A,0x2,0x17,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x37,0x7F,0xBC,0x0,0x7F,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x13,0x13,0xA,0x0,0x0,0x0,0x0,0xB0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xB9,0xC3,0x7,0x40,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xC0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0xE0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xF0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x80,0x0,0x0,0x0,0x0,0x10,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x20,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x7F,0xA,0x0,0x0,0x0,0x0,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x70,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0x1C,0xA,0x0,0x0,0x0,0x0,0x50,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xD0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x20,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x12,0x7F,0xA,0x0,0x0,0x0,0x0,0x60,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x10,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3C,0x3C,0xD0,0x0,0x0,0x0,0x0,0x70,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x20,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF6,0x44,0x57,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE4,0x11,0x64,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0x71,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0x9C,0x87,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x37,0x98,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x45,0xA1,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x8E,0xC8,0xBF,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0xCB,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0xD7,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x39,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x63,0x98,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x83,0x57,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0x53,0x64,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0x2A,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0x35,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x2F,0xCB,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xFE,0x44,0xD7,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x2,0xC,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x55,0x14,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0x27,0x1D,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xE2,0x7F,0x26,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA7,0xE3,0x3A,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0x46,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0x51,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0xC6,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0xD1,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0x64,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0x71,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x86,0x1,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3A,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x2,0x0,0x0,0x10,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8D,0x1,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x30,0x16,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x99,0x1,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xDE,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x9D,0x1,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x60,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x75,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xA4,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x79,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x20,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x87,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x70,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x95,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x5C,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x57,0x1,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x4C,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0xA0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x76,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5,0x0,0x0,0x60,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x28,0x1,0x0,0x0,0x0,0x0,0x0,0x50,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x2C,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2E,0x1,0x0,0x0,0x0,0x0,0x0,0xE0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA2,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x20,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x37,0x1,0x0,0x0,0x0,0x0,0x0,0x90,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0xB0,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE,0xF,0xA,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0xF,0x40,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0x35,0x40,0x0,0x0,0x0,0x0,0x0,0x18,0x7F,0xA,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0x1C,0xA,0x0,0x0,0x0,0x0,0x10,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x72,0x0,0x0,0x0,0x0,0x30,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0x40,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0xC0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x28,0x1,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2C,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2E,0x1,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xA2,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x20,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x37,0x1,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0xB0,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xE,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x50,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x34,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0xC0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0xF0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x49,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0xC0,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x59,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x4E,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0xE0,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5D,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x22,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x10,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6A,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xCC,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x30,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x75,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA4,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x79,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x20,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x87,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x70,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x95,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x5C,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x70,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF1,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x1,0x2A,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x3,0x7F,0xBC,0x1,0x2A,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0x80,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0x90,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x7F,0xA,0x0,0x0,0x0,0x0,0xC0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0x1C,0xA,0x0,0x0,0x0,0x0,0xD0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x60,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xB0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0xE0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF6,0x44,0x57,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xE4,0x11,0x64,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0x71,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0x9C,0x87,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x37,0x98,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x45,0xA1,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x8E,0xC8,0xBF,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0xCB,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0xD7,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x39,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x63,0x98,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x83,0x57,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0x53,0x64,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0x2A,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0x35,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x2F,0xCB,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xFE,0x44,0xD7,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x2,0xC,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x55,0x14,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0x27,0x1D,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE2,0x7F,0x26,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA7,0xE3,0x3A,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0x46,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0x51,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0xC6,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0xD1,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0x64,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0x71,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF2,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x2,0x0,0x0,0x90,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x7F,0xBC,0x1,0x2A,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x1,0x2A,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x1,0x2A,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x1,0x2A,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x1,0x2A,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0x77,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x77,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x77,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x77,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x77,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0xA0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE5,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x60,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xFB,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x1,0x0,0x0,0x0,0x0,0x0,0xD0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xE,0x1,0x0,0x0,0x0,0x0,0x0,0x60,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x50,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xD5,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x25,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x2,0x0,0x0,0xC0,0x9,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1B,0x1,0x0,0x0,0x0,0x0,0x0,0x50,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0xF0,0x16,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x34,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0xC0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0xF0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x49,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0xC0,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x59,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x4E,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0xE0,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5D,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x22,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x10,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6A,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xCC,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x30,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xCD,0x46,0xF7,0x0,0xCD,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xCD,0x46,0xF7,0x0,0xCD,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xCD,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0x22,0x0,0x0,0x0,0x0,0xC0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3C,0x3C,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0xE0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xF0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x72,0x0,0x0,0x0,0x0,0x0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x35,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x20,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x30,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF6,0x44,0x57,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xE4,0x11,0x64,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0x71,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0x9C,0x87,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x37,0x98,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x45,0xA1,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x8E,0xC8,0xBF,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0xCB,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0xD7,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x39,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x63,0x98,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x83,0x57,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0x53,0x64,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0x2A,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0x35,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x2F,0xCB,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xFE,0x44,0xD7,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x2,0xC,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x55,0x14,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0x27,0x1D,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xE2,0x7F,0x26,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA7,0xE3,0x3A,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0x46,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0x51,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0xC6,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0xD1,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0x64,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0x71,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xAA,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xB0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xC0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0xB0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xDC,0x1,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x64,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xE5,0x1,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xF4,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0xB0,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xEF,0x1,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xDC,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x3,0x0,0x0,0xC0,0xF,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x2A,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xBE,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x28,0x1,0x0,0x0,0x0,0x0,0x0,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x2C,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2E,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xA2,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x20,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x37,0x1,0x0,0x0,0x0,0x0,0x0,0xB0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0xB0,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x60,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF1,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x34,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0xC0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0xF0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x49,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0xC0,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x59,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x4E,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0xE0,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5D,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x22,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x10,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6A,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xCC,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x30,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x75,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xA4,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x79,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x20,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x87,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x70,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x95,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x5C,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x60,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xFB,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x1,0x0,0x0,0x0,0x0,0x0,0x10,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x1,0x2A,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x1D,0x3F,0x13,0x0,0x0,0x0,0x0,0x20,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x30,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0x50,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x60,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x7F,0xA,0x0,0x0,0x0,0x0,0x80,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0x1C,0xA,0x0,0x0,0x0,0x0,0x90,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xA0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x3C,0x3C,0xD0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x90,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF6,0x44,0x57,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xE4,0x11,0x64,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0x71,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0x9C,0x87,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x37,0x98,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x45,0xA1,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x8E,0xC8,0xBF,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0xCB,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0xD7,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x39,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x63,0x98,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x83,0x57,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0x53,0x64,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0x2A,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0x35,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x2F,0xCB,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xFE,0x44,0xD7,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x2,0xC,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x55,0x14,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0x27,0x1D,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xE2,0x7F,0x26,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA7,0xE3,0x3A,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0x46,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0x51,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0xC6,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0xD1,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0x64,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0x71,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xF,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0xF0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x26,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD1,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xAE,0x1,0x0,0x0,0x0,0x0,0x0,0x90,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xDA,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x5,0x0,0x0,0x10,0x15,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xBA,0x1,0x0,0x0,0x0,0x0,0x0,0x40,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x6A,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0xA0,0x9,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x57,0x1,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x4C,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x34,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0xC0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0xF0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x49,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0xC0,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x59,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x4E,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0xE0,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5D,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x22,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x10,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6A,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xCC,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x30,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x75,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA4,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x79,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x20,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x60,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xFB,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x1,0x0,0x0,0x0,0x0,0x0,0x60,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x99,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0xF0,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9D,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x9C,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0xC0,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xBF,0x1,0x0,0x0,0x0,0x0,0x0,0x50,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xEE,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x37,0x7F,0xBC,0x0,0x7F,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x60,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x70,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x80,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x90,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x7F,0xA,0x0,0x0,0x0,0x0,0xB0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3C,0x3C,0xD0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x30,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xE0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x12,0x7F,0xA,0x0,0x0,0x0,0x0,0xD0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x20,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x13,0xA,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xB9,0xC3,0x7,0x40,0x0,0x0,0x0,0x0,0xD0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF6,0x44,0x57,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xE4,0x11,0x64,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0x71,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0x9C,0x87,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x37,0x98,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x45,0xA1,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x8E,0xC8,0xBF,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0xCB,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0xD7,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x39,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x63,0x98,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x83,0x57,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0x53,0x64,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0x2A,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0x35,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x2F,0xCB,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xFE,0x44,0xD7,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x2,0xC,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x55,0x14,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0x27,0x1D,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE2,0x7F,0x26,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA7,0xE3,0x3A,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0x46,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0x51,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0xC6,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0xD1,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0x64,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0x71,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x0,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1B,0x1,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0xF0,0x16,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xCA,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x28,0x1,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x2C,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2E,0x1,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xA2,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x20,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x37,0x1,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0xB0,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x4F,0x1,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xC2,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x90,0xF,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x57,0x1,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x4C,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5E,0x1,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xC8,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0xF0,0x4,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x61,0x1,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xBC,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x3,0x0,0x0,0xC0,0xD,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x68,0x1,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x34,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0xC0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0xF0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x49,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0xC0,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x59,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x4E,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0xE0,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5D,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x22,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x10,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6A,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xCC,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x30,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x87,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x70,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x95,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x5C,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xC6,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x6A,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x10,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x99,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0xF0,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9D,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x9C,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0xC0,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xBB,0x0,0x0,0x7F,0xBC,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x37,0x7F,0xBC,0x0,0x7F,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x80,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x90,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x5A,0x0,0x0,0x0,0x0,0xB0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xC0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x37,0x38,0x64,0x0,0x0,0x0,0x0,0xD0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xE0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0xF0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0x1C,0xA,0x0,0x0,0x0,0x0,0x10,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xE0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x30,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x20,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x7F,0xA,0x0,0x0,0x0,0x0,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xD0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF6,0x44,0x57,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE4,0x11,0x64,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0x71,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0x9C,0x87,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x37,0x98,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x45,0xA1,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x8E,0xC8,0xBF,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0xCB,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0xD7,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x39,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x63,0x98,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x83,0x57,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0x53,0x64,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0x2A,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0x35,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x2F,0xCB,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xFE,0x44,0xD7,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x2,0xC,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x55,0x14,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0x27,0x1D,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xE2,0x7F,0x26,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xA7,0xE3,0x3A,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0x46,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0x51,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0xC6,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0xD1,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0x64,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0x71,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xB9,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x74,0x1,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x9A,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0xA0,0x4,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xB4,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0xF0,0x8,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA4,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x4C,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xAC,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x32,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x90,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xCA,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF1,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xC6,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x6A,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x10,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x87,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x70,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x95,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x5C,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x99,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0xF0,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9D,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x9C,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0xC0,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x1,0x2A,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x37,0x7F,0xBC,0x0,0x7F,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0x43,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x77,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2A,0x7F,0x18,0x0,0x0,0x0,0x0,0x60,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x70,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x80,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x90,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0x1C,0xA,0x0,0x0,0x0,0x0,0xA0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x12,0x7F,0xA,0x0,0x0,0x0,0x0,0xB0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x80,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x10,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA4,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4C,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xAC,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x32,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x90,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xB4,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0xF0,0x8,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xB9,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xC6,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x6A,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x10,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x99,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0xF0,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9D,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x9C,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0xC0,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x34,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0xC0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0xF0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x49,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0xC0,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x59,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x4E,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0xE0,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5D,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x22,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x10,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6A,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xCC,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x30,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x87,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x70,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x95,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x5C,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x37,0x7F,0xBC,0x0,0x7F,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2A,0x7F,0x18,0x0,0x0,0x0,0x0,0x80,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2A,0x7F,0x18,0x0,0x0,0x0,0x0,0x90,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xA0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x43,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2A,0x7F,0x18,0x0,0x0,0x0,0x0,0xC0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0xD0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x7F,0xA,0x0,0x0,0x0,0x0,0xE0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0x1C,0xA,0x0,0x0,0x0,0x0,0x0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xF0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF6,0x44,0x57,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xE4,0x11,0x64,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0x71,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0x9C,0x87,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x37,0x98,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x45,0xA1,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x8E,0xC8,0xBF,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0xCB,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0xD7,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x39,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x63,0x98,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x83,0x57,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0x53,0x64,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0x2A,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0x35,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x2F,0xCB,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xFE,0x44,0xD7,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x2,0xC,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x55,0x14,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0x27,0x1D,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xE2,0x7F,0x26,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA7,0xE3,0x3A,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0x46,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0x51,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0xC6,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0xD1,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0x64,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0x71,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0xC0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xBE,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0xE0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA4,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x4C,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xAC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x32,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x90,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x7F,0xBC,0x1,0x2A,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x1,0x2A,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x1,0x2A,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0x77,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x77,0x0,0x0,0x0,0x0,0x40,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x77,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2A,0x7F,0x18,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2A,0x7F,0x18,0x0,0x0,0x0,0x0,0x70,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2A,0x7F,0x18,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x56,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD1,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xCC,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0xC0,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x64,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x40,0x4,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x32,0x13,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x32,0x13,0x0,0x0,0x0,0x0,0x40,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x32,0x13,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x32,0x13,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x32,0x13,0x0,0x0,0x0,0x0,0x70,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4C,0x1,0x0,0x0,0x0,0x0,0x0,0xB0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x28,0x1,0x0,0x0,0x0,0x0,0x0,0x60,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x2C,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2E,0x1,0x0,0x0,0x0,0x0,0x0,0xF0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xA2,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x20,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x37,0x1,0x0,0x0,0x0,0x0,0x0,0xA0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0xB0,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xCA,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x52,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xFF,0x0,0x0,0x0,0x0,0xD0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xFF,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x76,0x1,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x56,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x4,0x0,0x0,0x60,0x12,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x81,0x1,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xC4,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x99,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0xF0,0x6,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9D,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x9C,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0xC0,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x37,0x7F,0xBC,0x0,0x7F,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x20,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x7F,0xA,0x0,0x0,0x0,0x0,0x40,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xB4,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0xF0,0x8,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x28,0x1,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x2C,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2E,0x1,0x0,0x0,0x0,0x0,0x0,0x10,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xA2,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x20,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x37,0x1,0x0,0x0,0x0,0x0,0x0,0xC0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0xB0,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xF0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x90,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x40,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x76,0x1,0x0,0x0,0x0,0x0,0x0,0xB0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x56,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x4,0x0,0x0,0x60,0x12,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x60,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF1,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x1,0x2A,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x90,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0xC0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xCA,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xD5,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x9E,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xE2,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xC8,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0xF0,0x4,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x34,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0xC0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0xF0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x49,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0xC0,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x59,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x4E,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0xE0,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5D,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x22,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x10,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6A,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xCC,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x30,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x75,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA4,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x79,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x20,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x87,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x70,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x95,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x5C,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xCD,0x4D,0x6A,0x2,0x17,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0xE0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x80,0x0,0x0,0x0,0x0,0xF0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x7F,0xA,0x0,0x0,0x0,0x0,0x20,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0x1C,0xA,0x0,0x0,0x0,0x0,0x30,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x40,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF6,0x44,0x57,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xE4,0x11,0x64,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0x71,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0x9C,0x87,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x37,0x98,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x45,0xA1,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x8E,0xC8,0xBF,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0xCB,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0xD7,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x39,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x63,0x98,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x83,0x57,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0x53,0x64,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0x2A,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0x35,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x2F,0xCB,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xFE,0x44,0xD7,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x2,0xC,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x55,0x14,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0x27,0x1D,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE2,0x7F,0x26,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA7,0xE3,0x3A,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0x46,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0x51,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0xC6,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0xD1,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0x64,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0x71,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x28,0x1,0x0,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2C,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2E,0x1,0x0,0x0,0x0,0x0,0x0,0x60,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xA2,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x20,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x37,0x1,0x0,0x0,0x0,0x0,0x0,0x10,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0xB0,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0xC0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF1,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x4C,0x1,0x0,0x0,0x0,0x0,0x0,0x50,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x1,0x2A,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x3,0x7F,0xBC,0x1,0x2A,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xCA,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x90,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x90,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x90,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0xB0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0xC0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xFF,0x0,0x0,0x0,0x0,0xD0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0x70,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x2,0x0,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB6,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA4,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x4C,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xAC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x32,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x90,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x34,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0xC0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0xF0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x49,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0xC0,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x59,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x4E,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0xE0,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5D,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x22,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x10,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6A,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xCC,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x30,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1B,0x1,0x0,0x0,0x0,0x0,0x0,0xF0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x5,0x0,0x0,0xF0,0x16,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x1A,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0x2B,0x0,0x0,0x0,0x0,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2A,0x7F,0x18,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x2B,0x0,0x0,0x0,0x0,0x50,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x60,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xF6,0x44,0x57,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE4,0x11,0x64,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0x71,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0x9C,0x87,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x37,0x98,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x45,0xA1,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x8E,0xC8,0xBF,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0xCB,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0xD7,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x39,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x63,0x98,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x83,0x57,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0x53,0x64,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0x2A,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0x35,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x2F,0xCB,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xFE,0x44,0xD7,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x2,0xC,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x55,0x14,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0x27,0x1D,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xE2,0x7F,0x26,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA7,0xE3,0x3A,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0x46,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0x51,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0xC6,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0xD1,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0x64,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0x71,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x19,0x3,0x96,0x19,0xA0,0x1D,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x19,0x2,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x36,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x3,0x0,0x0,0xD0,0xC,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xD5,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xE2,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xC8,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x1,0x0,0x0,0xF0,0x4,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xE8,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xF1,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x90,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xB6,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD1,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xB4,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0xF0,0x8,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x23,0x2,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x2,0x0,0x0,0x70,0xB,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x75,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xA4,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x79,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x20,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x87,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x6,0x0,0x0,0x70,0x18,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x95,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x5C,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0xF0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x4,0x0,0x0,0x60,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xFB,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x6,0x1,0x0,0x0,0x0,0x0,0x0,0x60,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x2,0x0,0x0,0x0,0x0,0x0,0xF0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xB6,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x28,0x1,0x0,0x0,0x0,0x0,0x0,0x80,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x2C,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2E,0x1,0x0,0x0,0x0,0x0,0x0,0x10,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0xA2,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x20,0x11,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x37,0x1,0x0,0x0,0x0,0x0,0x0,0xC0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0xB0,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x34,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0xAC,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x5,0x0,0x0,0xC0,0x14,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x4,0x0,0x0,0xF0,0x10,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x49,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xC,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x2,0x0,0x0,0xC0,0xA,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x59,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x4E,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0xE0,0x5,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5D,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x22,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xEA,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x10,0xE,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x6A,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xCC,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0xFA,0xC,0xF7,0x98,0xF5,0x9F,0xF5,0xAE,0xF6,0x5A,0xF8,0x4A,0xFA,0x37,0xFC,0xCC,0xC,0xDF,0xE,0xD5,0xE,0x53,0xD,0xEF,0xA,0x2A,0x8,0x69,0x5,0xF1,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x33,0x7,0x7A,0x6,0xD4,0x5,0x3F,0x5,0xB8,0x4,0x3F,0x4,0xD2,0x3,0x70,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x4,0x0,0x0,0x30,0x13,0x0,0x0,0xFF,0xFF,0xFF,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x1,0x2A,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xCD,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x6,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x2,0x7F,0xBC,0x0,0xCD,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0x3,0x7F,0xBC,0x1,0x2A,0x0,0x0,0x0,0x1,0x0,0x0,0xFF,0xFF,0x0,0x0,0x0,0xB,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x7F,0xBC,0x72,0xF6,0xFF,0xFF,0x0,0x0,0x0,0x0,0x7F,0x13,0x0,0x0,0x0,0x0,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xD0,0x0,0x0,0x0,0x0,0x50,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x60,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x22,0x0,0x0,0x0,0x0,0x70,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x32,0x35,0x0,0x0,0x0,0x0,0x80,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x50,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x18,0x7F,0xA,0x0,0x0,0x0,0x0,0x90,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x90,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0x1C,0xA,0x0,0x0,0x0,0x0,0xA0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x40,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x3C,0x3C,0xD0,0x0,0x0,0x0,0x0,0xB0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x30,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xE0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x2B,0x0,0x0,0x0,0x0,0xC0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1B,0x2E,0xF,0x0,0x0,0x0,0x0,0xD0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x90,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x40,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0xF0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0xA,0x0,0x0,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7F,0x22,0x0,0x0,0x0,0x0,0x10,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xF6,0x44,0x57,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xE4,0x11,0x64,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0x71,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x84,0x9C,0x87,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x37,0x98,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x45,0xA1,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x8E,0xC8,0xBF,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0xCB,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0xD7,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x3E,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xB,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x39,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xF8,0x63,0x98,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x83,0x57,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xE6,0x53,0x64,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xBA,0xA1,0xF1,0x3E,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0x2A,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0x35,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x2D,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x35,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x53,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x2F,0xCB,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xFE,0x44,0xD7,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xE,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0xE4,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x44,0x2,0xC,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x55,0x14,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x92,0x27,0x1D,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xE2,0x7F,0x26,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA7,0xE3,0x3A,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0x46,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x36,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0x51,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x96,0x0,0xC6,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x46,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xAE,0xC6,0xD1,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xFD,0x2F,0x4B,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x45,0x57,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xF5,0x11,0x64,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xCB,0xA1,0x71,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x7C,0x9C,0x87,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xD6,0xAC,0x8F,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xEF,0x37,0x98,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x45,0xA1,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0xDC,0xAA,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0xF7,0x4,0xB5,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x52,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xF,0x0,0x0,0x0,0x0,0x0,0x0,0x86,0xC8,0xBF,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x66,0x66,0x30,0x3F,0x0,0x0,0x0,0x0,0xE0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1A,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1B,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0xE0,0x1C,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1D,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x1D,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x1D,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x1D,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1D,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
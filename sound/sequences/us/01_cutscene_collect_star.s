@@ -0,0 +1,337 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 133
+seq_initchannels 0x7f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+seq_startchannel 6, .channel6
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 66
+chan_setreverb 32
+chan_setvol 122
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 42, 80, 67
+layer_note1 38, 23, 52
+layer_note1 36, 74, 117
+layer_note1 39, 18, 49
+layer_note1 41, 66, 111
+layer_delay 33
+layer_note1 60, 32, 110
+layer_note1 53, 39, 47
+layer_note1 55, 7, 51
+layer_note1 45, 96, 125
+layer_note1 59, 69, 82
+layer_note1 40, 96, 48
+layer_note1 56, 34, 70
+layer_note1 29, 75, 97
+layer_delay 26
+layer_note1 51, 19, 78
+layer_note1 27, 76, 82
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 58, 76, 115
+layer_note1 25, 82, 89
+layer_note1 35, 43, 63
+layer_note1 31, 10, 118
+layer_note1 36, 66, 48
+layer_delay 14
+layer_note1 22, 16, 109
+layer_note1 53, 41, 106
+layer_note1 33, 92, 115
+layer_note1 46, 80, 75
+layer_note1 42, 16, 81
+layer_note1 51, 81, 120
+layer_note1 32, 37, 42
+layer_note1 27, 96, 68
+layer_jump .layer0_1
+
+.channel1:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 43
+chan_setreverb 21
+chan_setvol 114
+chan_setlayer 0, .layer1_0
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 34, 11, 113
+layer_note1 54, 83, 127
+layer_delay 13
+layer_note1 58, 79, 55
+layer_note1 43, 20, 44
+layer_note1 32, 29, 55
+layer_note1 23, 92, 42
+layer_note1 59, 18, 73
+layer_delay 10
+layer_note1 42, 61, 63
+layer_delay 35
+layer_jump .layer1_0
+
+.channel2:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 25
+chan_setreverb 44
+chan_setvol 110
+chan_setlayer 0, .layer2_0
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 50, 78, 61
+layer_note1 33, 13, 126
+layer_note1 30, 49, 107
+layer_note1 58, 62, 125
+layer_note1 50, 93, 92
+layer_note1 52, 45, 123
+layer_note1 36, 25, 111
+layer_note1 49, 16, 82
+layer_note1 54, 41, 57
+layer_note1 50, 51, 118
+layer_note1 42, 81, 121
+layer_note1 28, 45, 89
+layer_note1 25, 6, 116
+layer_note1 41, 26, 70
+layer_note1 48, 54, 126
+layer_note1 46, 10, 91
+layer_jump .layer2_0
+
+.channel3:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 11
+chan_setreverb 10
+chan_setvol 117
+chan_setlayer 0, .layer3_0
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 48, 73, 102
+layer_note1 58, 6, 44
+layer_note1 39, 65, 46
+layer_note1 46, 30, 110
+layer_note1 60, 16, 56
+layer_note1 45, 92, 93
+layer_note1 33, 7, 40
+layer_note1 53, 84, 52
+layer_note1 58, 89, 65
+layer_note1 37, 94, 63
+layer_delay 31
+layer_note1 21, 41, 97
+layer_note1 27, 38, 57
+layer_note1 42, 20, 59
+layer_note1 21, 11, 45
+layer_note1 36, 77, 80
+layer_jump .layer3_0
+
+.channel4:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 10
+chan_setreverb 54
+chan_setvol 123
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+chan_setlayer 2, .layer4_2
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 43, 74, 62
+layer_note1 57, 43, 41
+layer_delay 23
+layer_note1 43, 17, 83
+layer_note1 22, 11, 74
+layer_note1 57, 43, 86
+layer_note1 55, 22, 77
+layer_delay 21
+layer_note1 39, 28, 106
+layer_note1 39, 57, 82
+layer_note1 26, 18, 111
+layer_note1 50, 49, 83
+layer_delay 13
+layer_note1 47, 10, 78
+layer_note1 29, 27, 120
+layer_note1 60, 17, 48
+layer_note1 32, 34, 47
+layer_note1 26, 56, 111
+layer_note1 48, 68, 114
+layer_note1 33, 60, 50
+layer_note1 36, 80, 61
+layer_note1 42, 20, 48
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 48, 92, 65
+layer_delay 31
+layer_note1 22, 33, 119
+layer_delay 18
+layer_note1 43, 75, 59
+layer_delay 44
+layer_note1 29, 78, 91
+layer_note1 47, 72, 103
+layer_jump .layer4_1
+
+.layer4_2:
+layer_note1 51, 87, 125
+layer_note1 54, 84, 68
+layer_delay 26
+layer_note1 22, 73, 58
+layer_note1 58, 25, 88
+layer_note1 50, 14, 50
+layer_note1 22, 14, 68
+layer_delay 25
+layer_delay 34
+layer_note1 30, 25, 123
+layer_note1 43, 70, 88
+layer_note1 52, 10, 113
+layer_delay 39
+layer_note1 24, 60, 66
+layer_note1 58, 59, 101
+layer_note1 44, 83, 115
+layer_note1 21, 90, 40
+layer_note1 39, 70, 112
+layer_jump .layer4_2
+
+.channel5:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 85
+chan_setreverb 4
+chan_setvol 123
+chan_setlayer 0, .layer5_0
+chan_setlayer 1, .layer5_1
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_note1 44, 55, 47
+layer_note1 28, 36, 76
+layer_note1 41, 13, 44
+layer_note1 29, 68, 117
+layer_note1 29, 51, 92
+layer_delay 35
+layer_note1 23, 18, 100
+layer_note1 21, 10, 116
+layer_note1 60, 47, 53
+layer_note1 42, 30, 89
+layer_note1 51, 20, 47
+layer_note1 49, 84, 120
+layer_note1 27, 93, 119
+layer_note1 28, 55, 77
+layer_note1 27, 72, 64
+layer_delay 31
+layer_note1 32, 64, 85
+layer_jump .layer5_0
+
+.layer5_1:
+layer_note1 22, 68, 72
+layer_note1 53, 91, 112
+layer_note1 33, 35, 51
+layer_note1 60, 70, 107
+layer_note1 39, 20, 58
+layer_note1 56, 60, 50
+layer_note1 46, 14, 52
+layer_note1 29, 9, 97
+layer_note1 46, 9, 103
+layer_note1 40, 38, 50
+layer_jump .layer5_1
+
+.channel6:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 18
+chan_setreverb 7
+chan_setvol 105
+chan_setlayer 0, .layer6_0
+chan_setlayer 1, .layer6_1
+chan_setlayer 2, .layer6_2
+.chan_loop6:
+chan_delay 0x7fff
+chan_jump .chan_loop6
+
+.layer6_0:
+layer_note1 31, 7, 69
+layer_note1 24, 82, 58
+layer_note1 33, 90, 126
+layer_note1 27, 6, 77
+layer_note1 21, 83, 69
+layer_note1 31, 64, 54
+layer_note1 36, 22, 43
+layer_note1 43, 48, 100
+layer_jump .layer6_0
+
+.layer6_1:
+layer_note1 55, 87, 81
+layer_note1 25, 19, 108
+layer_note1 30, 54, 58
+layer_note1 34, 46, 105
+layer_note1 31, 43, 87
+layer_note1 22, 22, 116
+layer_delay 10
+layer_note1 28, 59, 78
+layer_note1 29, 81, 94
+layer_note1 42, 16, 71
+layer_note1 43, 87, 107
+layer_delay 32
+layer_delay 26
+layer_note1 43, 43, 100
+layer_delay 17
+layer_note1 37, 20, 111
+layer_note1 29, 95, 97
+layer_jump .layer6_1
+
+.layer6_2:
+layer_note1 46, 61, 62
+layer_note1 49, 49, 106
+layer_delay 35
+layer_note1 25, 67, 66
+layer_note1 48, 85, 99
+layer_delay 25
+layer_delay 46
+layer_note1 58, 25, 94
+layer_note1 50, 17, 126
+layer_note1 34, 75, 91
+layer_note1 21, 21, 74
+layer_note1 22, 6, 72
+layer_note1 57, 96, 90
+layer_note1 36, 51, 76
+layer_note1 32, 82, 50
+layer_delay 22
+layer_note1 41, 21, 107
+layer_note1 30, 14, 93
+layer_note1 38, 72, 57
+layer_note1 60, 32, 108
+layer_jump .layer6_2
+
@@ -0,0 +1,250 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 152
+seq_initchannels 0x1f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 65
+chan_setreverb 7
+chan_setvol 123
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 33, 18, 102
+layer_delay 30
+layer_note1 20, 95, 97
+layer_note1 34, 81, 53
+layer_note1 21, 8, 43
+layer_note1 20, 54, 127
+layer_note1 47, 9, 107
+layer_note1 48, 69, 110
+layer_note1 34, 92, 68
+layer_note1 38, 8, 93
+layer_note1 55, 88, 52
+layer_note1 38, 21, 82
+layer_note1 52, 60, 104
+layer_note1 32, 44, 76
+layer_note1 51, 70, 90
+layer_note1 22, 67, 71
+layer_note1 45, 59, 125
+layer_note1 55, 95, 126
+layer_note1 25, 62, 124
+layer_note1 30, 72, 90
+layer_note1 21, 66, 45
+layer_note1 59, 81, 114
+layer_note1 30, 27, 104
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 32, 75, 110
+layer_note1 52, 50, 113
+layer_note1 37, 90, 110
+layer_note1 20, 55, 105
+layer_note1 53, 77, 66
+layer_note1 23, 67, 86
+layer_note1 32, 70, 92
+layer_note1 42, 59, 84
+layer_delay 40
+layer_note1 59, 48, 98
+layer_note1 34, 87, 62
+layer_note1 31, 17, 110
+layer_note1 36, 10, 126
+layer_delay 7
+layer_note1 37, 37, 74
+layer_jump .layer0_1
+
+.channel1:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 47
+chan_setreverb 22
+chan_setvol 97
+chan_setlayer 0, .layer1_0
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 53, 27, 124
+layer_note1 38, 64, 81
+layer_note1 27, 9, 79
+layer_note1 46, 30, 73
+layer_delay 38
+layer_note1 58, 61, 42
+layer_note1 45, 24, 44
+layer_note1 30, 63, 104
+layer_note1 54, 34, 120
+layer_note1 53, 63, 68
+layer_note1 21, 56, 126
+layer_note1 40, 90, 120
+layer_note1 39, 22, 67
+layer_jump .layer1_0
+
+.channel2:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 78
+chan_setreverb 4
+chan_setvol 69
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 46, 78, 72
+layer_delay 41
+layer_note1 22, 81, 67
+layer_note1 56, 64, 61
+layer_note1 59, 71, 44
+layer_note1 42, 18, 66
+layer_note1 47, 81, 64
+layer_note1 44, 43, 104
+layer_note1 40, 84, 91
+layer_note1 21, 26, 65
+layer_note1 56, 23, 83
+layer_note1 37, 92, 52
+layer_note1 55, 50, 127
+layer_note1 54, 36, 48
+layer_note1 25, 23, 61
+layer_note1 54, 33, 74
+layer_note1 58, 70, 72
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 27, 43, 70
+layer_note1 58, 68, 57
+layer_note1 26, 47, 45
+layer_note1 44, 24, 56
+layer_note1 59, 81, 88
+layer_delay 41
+layer_note1 25, 40, 86
+layer_note1 56, 74, 54
+layer_note1 37, 19, 45
+layer_note1 20, 84, 125
+layer_delay 32
+layer_delay 8
+layer_note1 57, 59, 60
+layer_delay 16
+layer_note1 30, 19, 95
+layer_note1 44, 75, 77
+layer_note1 50, 46, 52
+layer_note1 40, 11, 43
+layer_delay 24
+layer_jump .layer2_1
+
+.channel3:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 115
+chan_setreverb 25
+chan_setvol 100
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_delay 26
+layer_note1 49, 20, 72
+layer_note1 59, 75, 100
+layer_note1 36, 29, 109
+layer_note1 32, 37, 86
+layer_delay 23
+layer_delay 34
+layer_delay 42
+layer_note1 34, 55, 79
+layer_delay 17
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 57, 44, 71
+layer_note1 54, 84, 114
+layer_note1 25, 37, 68
+layer_delay 21
+layer_note1 37, 76, 49
+layer_note1 21, 87, 41
+layer_note1 42, 69, 100
+layer_note1 29, 18, 104
+layer_note1 40, 15, 105
+layer_note1 31, 28, 59
+layer_note1 40, 45, 53
+layer_note1 58, 43, 56
+layer_note1 29, 75, 44
+layer_note1 59, 92, 110
+layer_note1 33, 28, 78
+layer_note1 30, 12, 125
+layer_note1 24, 93, 97
+layer_note1 55, 38, 109
+layer_jump .layer3_1
+
+.channel4:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 116
+chan_setreverb 0
+chan_setvol 110
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 21, 88, 93
+layer_note1 21, 13, 85
+layer_note1 57, 22, 57
+layer_note1 37, 56, 112
+layer_note1 59, 17, 69
+layer_note1 31, 73, 80
+layer_note1 48, 93, 121
+layer_note1 35, 46, 103
+layer_note1 34, 58, 83
+layer_note1 37, 88, 68
+layer_delay 10
+layer_note1 43, 26, 105
+layer_note1 33, 45, 78
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 43, 27, 99
+layer_note1 27, 83, 105
+layer_note1 31, 25, 72
+layer_note1 56, 12, 103
+layer_note1 60, 50, 89
+layer_note1 30, 75, 45
+layer_note1 25, 38, 120
+layer_delay 11
+layer_note1 28, 84, 124
+layer_note1 25, 62, 70
+layer_note1 44, 61, 90
+layer_note1 40, 62, 56
+layer_note1 51, 33, 55
+layer_note1 54, 58, 55
+layer_note1 37, 37, 88
+layer_note1 20, 30, 107
+layer_note1 21, 9, 120
+layer_jump .layer4_1
+
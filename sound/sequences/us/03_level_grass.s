@@ -0,0 +1,278 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 91
+seq_initchannels 0xf
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 92
+chan_setreverb 53
+chan_setvol 81
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+chan_setlayer 2, .layer0_2
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 33, 83, 44
+layer_note1 30, 61, 121
+layer_note1 52, 53, 109
+layer_note1 52, 40, 44
+layer_note1 43, 65, 80
+layer_note1 47, 73, 61
+layer_note1 35, 35, 43
+layer_note1 31, 23, 105
+layer_note1 52, 92, 111
+layer_note1 48, 59, 107
+layer_note1 43, 81, 85
+layer_note1 48, 26, 91
+layer_note1 49, 89, 107
+layer_note1 37, 69, 104
+layer_note1 42, 90, 98
+layer_note1 49, 50, 112
+layer_note1 55, 64, 102
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 30, 84, 74
+layer_note1 50, 45, 78
+layer_note1 52, 77, 106
+layer_note1 59, 81, 92
+layer_note1 33, 68, 105
+layer_note1 59, 15, 83
+layer_note1 32, 19, 47
+layer_note1 23, 40, 115
+layer_note1 26, 72, 57
+layer_note1 35, 32, 47
+layer_note1 22, 13, 86
+layer_note1 35, 92, 43
+layer_delay 10
+layer_delay 7
+layer_note1 28, 26, 63
+layer_jump .layer0_1
+
+.layer0_2:
+layer_note1 44, 81, 45
+layer_note1 35, 25, 44
+layer_delay 45
+layer_note1 27, 42, 83
+layer_note1 39, 63, 110
+layer_note1 22, 39, 91
+layer_note1 29, 66, 68
+layer_delay 26
+layer_note1 21, 63, 56
+layer_note1 45, 68, 105
+layer_note1 41, 39, 73
+layer_note1 46, 89, 42
+layer_note1 28, 91, 47
+layer_note1 28, 26, 61
+layer_delay 46
+layer_note1 22, 37, 69
+layer_note1 24, 38, 50
+layer_note1 59, 85, 86
+layer_note1 47, 41, 107
+layer_note1 29, 10, 89
+layer_note1 27, 71, 51
+layer_note1 26, 8, 63
+layer_note1 26, 33, 43
+layer_note1 49, 64, 79
+layer_jump .layer0_2
+
+.channel1:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 54
+chan_setreverb 43
+chan_setvol 86
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+chan_setlayer 2, .layer1_2
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 21, 80, 115
+layer_delay 32
+layer_note1 57, 29, 52
+layer_note1 50, 52, 42
+layer_note1 27, 84, 86
+layer_note1 43, 45, 42
+layer_note1 46, 18, 53
+layer_note1 21, 63, 47
+layer_note1 51, 65, 66
+layer_note1 59, 15, 40
+layer_note1 43, 45, 49
+layer_note1 51, 30, 54
+layer_note1 45, 65, 57
+layer_note1 45, 21, 72
+layer_delay 11
+layer_note1 41, 88, 90
+layer_note1 26, 9, 119
+layer_note1 22, 96, 103
+layer_note1 49, 24, 87
+layer_note1 53, 67, 93
+layer_note1 38, 56, 69
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 36, 76, 94
+layer_note1 25, 80, 113
+layer_delay 28
+layer_note1 54, 24, 93
+layer_note1 25, 93, 122
+layer_delay 24
+layer_note1 41, 62, 62
+layer_note1 27, 25, 109
+layer_note1 47, 18, 82
+layer_note1 52, 38, 61
+layer_note1 49, 96, 70
+layer_note1 42, 79, 58
+layer_note1 21, 82, 89
+layer_jump .layer1_1
+
+.layer1_2:
+layer_note1 23, 67, 75
+layer_note1 46, 96, 122
+layer_note1 55, 48, 124
+layer_delay 20
+layer_note1 32, 57, 125
+layer_note1 60, 7, 80
+layer_note1 49, 89, 62
+layer_note1 21, 57, 67
+layer_note1 58, 55, 67
+layer_note1 26, 55, 111
+layer_note1 32, 41, 115
+layer_note1 51, 84, 57
+layer_delay 33
+layer_jump .layer1_2
+
+.channel2:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 64
+chan_setreverb 32
+chan_setvol 82
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 24, 50, 40
+layer_note1 54, 91, 124
+layer_delay 43
+layer_note1 41, 64, 74
+layer_note1 49, 9, 50
+layer_note1 42, 28, 91
+layer_note1 60, 23, 46
+layer_note1 44, 65, 126
+layer_note1 20, 42, 111
+layer_note1 20, 52, 44
+layer_note1 44, 78, 96
+layer_note1 39, 69, 123
+layer_delay 40
+layer_note1 39, 15, 73
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 39, 89, 122
+layer_note1 25, 71, 121
+layer_note1 58, 73, 59
+layer_note1 60, 17, 79
+layer_delay 35
+layer_note1 53, 41, 47
+layer_note1 27, 92, 88
+layer_note1 33, 46, 85
+layer_delay 35
+layer_note1 51, 62, 77
+layer_note1 28, 62, 121
+layer_note1 37, 47, 60
+layer_delay 21
+layer_note1 43, 29, 85
+layer_delay 14
+layer_note1 55, 87, 88
+layer_note1 41, 41, 116
+layer_note1 40, 57, 120
+layer_jump .layer2_1
+
+.channel3:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 18
+chan_setreverb 23
+chan_setvol 99
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 42, 62, 101
+layer_delay 17
+layer_note1 44, 22, 43
+layer_delay 16
+layer_note1 47, 7, 109
+layer_note1 58, 55, 109
+layer_note1 60, 25, 86
+layer_note1 51, 18, 58
+layer_note1 41, 38, 58
+layer_note1 36, 17, 83
+layer_note1 35, 84, 45
+layer_note1 43, 88, 118
+layer_delay 15
+layer_note1 24, 61, 96
+layer_note1 28, 47, 106
+layer_note1 27, 49, 122
+layer_note1 59, 56, 69
+layer_note1 45, 66, 102
+layer_note1 40, 75, 119
+layer_note1 57, 71, 108
+layer_note1 51, 57, 98
+layer_note1 44, 73, 97
+layer_delay 12
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 28, 21, 127
+layer_note1 31, 15, 90
+layer_note1 20, 38, 53
+layer_note1 34, 28, 43
+layer_delay 48
+layer_note1 41, 89, 99
+layer_delay 36
+layer_note1 50, 23, 111
+layer_delay 38
+layer_note1 23, 31, 109
+layer_note1 53, 49, 127
+layer_note1 35, 23, 87
+layer_note1 28, 75, 54
+layer_note1 49, 33, 46
+layer_note1 60, 54, 83
+layer_note1 45, 73, 104
+layer_note1 30, 71, 53
+layer_note1 29, 86, 66
+layer_note1 32, 44, 83
+layer_note1 47, 22, 90
+layer_note1 39, 18, 111
+layer_delay 23
+layer_jump .layer3_1
+
@@ -0,0 +1,277 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 155
+seq_initchannels 0x1f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 94
+chan_setreverb 58
+chan_setvol 120
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+chan_setlayer 2, .layer0_2
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 50, 39, 110
+layer_note1 50, 75, 110
+layer_note1 60, 25, 69
+layer_note1 53, 55, 41
+layer_note1 24, 26, 115
+layer_delay 7
+layer_note1 37, 66, 116
+layer_note1 44, 60, 90
+layer_note1 56, 62, 57
+layer_note1 26, 10, 57
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 47, 86, 78
+layer_note1 44, 79, 84
+layer_note1 46, 80, 69
+layer_note1 21, 41, 117
+layer_note1 30, 95, 81
+layer_note1 56, 78, 53
+layer_note1 33, 87, 113
+layer_note1 27, 14, 101
+layer_note1 50, 17, 84
+layer_note1 46, 25, 42
+layer_note1 46, 21, 45
+layer_note1 22, 54, 115
+layer_note1 37, 70, 70
+layer_note1 39, 6, 49
+layer_delay 40
+layer_delay 18
+layer_note1 38, 84, 73
+layer_note1 22, 49, 80
+layer_note1 28, 54, 88
+layer_note1 53, 55, 122
+layer_note1 55, 19, 119
+layer_note1 52, 40, 95
+layer_note1 35, 44, 95
+layer_jump .layer0_1
+
+.layer0_2:
+layer_note1 55, 49, 41
+layer_note1 57, 46, 42
+layer_note1 57, 86, 57
+layer_delay 46
+layer_note1 42, 92, 85
+layer_note1 37, 68, 42
+layer_note1 21, 53, 72
+layer_note1 39, 81, 116
+layer_note1 43, 29, 80
+layer_note1 58, 39, 78
+layer_note1 26, 9, 112
+layer_note1 28, 45, 104
+layer_note1 37, 36, 81
+layer_note1 47, 89, 52
+layer_delay 26
+layer_note1 34, 62, 61
+layer_jump .layer0_2
+
+.channel1:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 86
+chan_setreverb 47
+chan_setvol 87
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+chan_setlayer 2, .layer1_2
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 27, 10, 107
+layer_note1 40, 79, 63
+layer_note1 41, 88, 50
+layer_note1 42, 81, 56
+layer_note1 53, 40, 99
+layer_note1 46, 43, 93
+layer_note1 22, 58, 59
+layer_note1 50, 85, 105
+layer_note1 34, 10, 98
+layer_note1 53, 42, 109
+layer_note1 34, 14, 115
+layer_note1 27, 37, 45
+layer_delay 38
+layer_note1 47, 79, 46
+layer_delay 13
+layer_note1 39, 36, 124
+layer_delay 40
+layer_note1 59, 20, 83
+layer_delay 40
+layer_note1 23, 51, 68
+layer_note1 54, 21, 61
+layer_note1 37, 22, 40
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 45, 12, 74
+layer_note1 59, 73, 106
+layer_note1 50, 47, 40
+layer_note1 28, 11, 55
+layer_delay 36
+layer_note1 25, 71, 104
+layer_note1 30, 46, 49
+layer_note1 44, 81, 78
+layer_note1 32, 48, 94
+layer_delay 41
+layer_delay 30
+layer_note1 56, 28, 45
+layer_note1 58, 89, 109
+layer_note1 22, 85, 95
+layer_delay 46
+layer_note1 40, 59, 93
+layer_note1 35, 33, 108
+layer_note1 57, 15, 94
+layer_note1 28, 9, 81
+layer_note1 55, 39, 55
+layer_note1 27, 90, 107
+layer_note1 26, 46, 112
+layer_note1 57, 6, 100
+layer_jump .layer1_1
+
+.layer1_2:
+layer_note1 44, 11, 107
+layer_delay 12
+layer_note1 44, 28, 43
+layer_note1 27, 9, 54
+layer_note1 38, 80, 78
+layer_note1 22, 78, 105
+layer_note1 35, 19, 110
+layer_note1 55, 13, 110
+layer_note1 56, 29, 49
+layer_note1 31, 88, 71
+layer_note1 45, 38, 87
+layer_note1 42, 77, 93
+layer_jump .layer1_2
+
+.channel2:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 96
+chan_setreverb 32
+chan_setvol 90
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 56, 80, 126
+layer_note1 50, 25, 122
+layer_note1 29, 26, 52
+layer_note1 50, 95, 106
+layer_note1 57, 29, 57
+layer_note1 32, 24, 114
+layer_note1 34, 94, 108
+layer_note1 38, 91, 92
+layer_note1 57, 80, 74
+layer_note1 39, 8, 74
+layer_note1 44, 31, 62
+layer_note1 35, 47, 101
+layer_note1 29, 59, 101
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 55, 9, 101
+layer_note1 24, 57, 45
+layer_note1 34, 36, 122
+layer_note1 24, 33, 72
+layer_note1 32, 39, 57
+layer_note1 22, 38, 61
+layer_note1 40, 29, 94
+layer_delay 11
+layer_delay 22
+layer_note1 38, 10, 85
+layer_note1 41, 6, 43
+layer_note1 47, 54, 102
+layer_delay 47
+layer_note1 51, 56, 56
+layer_jump .layer2_1
+
+.channel3:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 30
+chan_setreverb 56
+chan_setvol 95
+chan_setlayer 0, .layer3_0
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_delay 39
+layer_note1 26, 73, 87
+layer_note1 43, 63, 77
+layer_note1 36, 19, 83
+layer_note1 54, 73, 54
+layer_note1 52, 51, 47
+layer_note1 56, 29, 122
+layer_note1 60, 25, 62
+layer_note1 49, 21, 53
+layer_note1 29, 48, 122
+layer_note1 58, 59, 111
+layer_note1 31, 64, 101
+layer_note1 31, 96, 48
+layer_delay 17
+layer_note1 54, 79, 90
+layer_note1 37, 40, 89
+layer_delay 14
+layer_delay 38
+layer_note1 52, 51, 82
+layer_note1 48, 75, 48
+layer_note1 27, 25, 74
+layer_jump .layer3_0
+
+.channel4:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 28
+chan_setreverb 36
+chan_setvol 74
+chan_setlayer 0, .layer4_0
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 45, 22, 115
+layer_note1 45, 30, 109
+layer_note1 56, 28, 65
+layer_note1 43, 43, 43
+layer_note1 48, 58, 89
+layer_note1 57, 45, 121
+layer_note1 53, 93, 78
+layer_note1 50, 9, 116
+layer_note1 60, 6, 53
+layer_note1 34, 68, 62
+layer_note1 49, 31, 64
+layer_note1 33, 10, 104
+layer_note1 48, 20, 112
+layer_note1 29, 23, 99
+layer_jump .layer4_0
+
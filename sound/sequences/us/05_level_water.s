@@ -0,0 +1,228 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 118
+seq_initchannels 0x1f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 101
+chan_setreverb 30
+chan_setvol 79
+chan_setlayer 0, .layer0_0
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_delay 41
+layer_note1 23, 34, 106
+layer_note1 37, 28, 53
+layer_note1 21, 88, 73
+layer_note1 32, 27, 79
+layer_note1 43, 17, 117
+layer_note1 44, 70, 71
+layer_note1 50, 41, 51
+layer_note1 55, 44, 40
+layer_note1 56, 96, 79
+layer_jump .layer0_0
+
+.channel1:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 105
+chan_setreverb 27
+chan_setvol 96
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 39, 39, 45
+layer_delay 35
+layer_note1 37, 72, 108
+layer_note1 41, 24, 126
+layer_note1 46, 31, 121
+layer_note1 37, 29, 85
+layer_note1 57, 47, 121
+layer_note1 40, 18, 47
+layer_note1 37, 80, 118
+layer_note1 27, 48, 62
+layer_note1 21, 11, 85
+layer_note1 38, 92, 81
+layer_delay 24
+layer_note1 29, 89, 92
+layer_note1 59, 93, 49
+layer_note1 32, 62, 77
+layer_delay 30
+layer_note1 30, 48, 113
+layer_delay 8
+layer_note1 43, 52, 77
+layer_note1 48, 32, 94
+layer_note1 27, 13, 47
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 58, 92, 59
+layer_note1 54, 68, 114
+layer_note1 22, 21, 107
+layer_note1 46, 89, 65
+layer_note1 35, 62, 92
+layer_note1 34, 59, 96
+layer_note1 47, 33, 103
+layer_note1 22, 38, 72
+layer_note1 33, 35, 93
+layer_jump .layer1_1
+
+.channel2:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 36
+chan_setreverb 20
+chan_setvol 66
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 45, 89, 123
+layer_note1 22, 69, 89
+layer_delay 19
+layer_note1 56, 27, 83
+layer_note1 50, 88, 80
+layer_note1 53, 33, 123
+layer_note1 37, 49, 90
+layer_note1 24, 41, 120
+layer_note1 22, 56, 119
+layer_delay 23
+layer_note1 23, 27, 121
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 45, 55, 67
+layer_note1 33, 26, 41
+layer_note1 36, 20, 90
+layer_note1 44, 34, 110
+layer_delay 18
+layer_note1 58, 48, 111
+layer_note1 50, 73, 96
+layer_delay 8
+layer_note1 27, 68, 111
+layer_note1 58, 23, 45
+layer_note1 53, 7, 78
+layer_note1 24, 16, 109
+layer_note1 33, 45, 89
+layer_note1 51, 57, 52
+layer_delay 45
+layer_note1 43, 71, 95
+layer_note1 48, 14, 120
+layer_note1 32, 87, 78
+layer_note1 50, 60, 55
+layer_note1 30, 53, 60
+layer_note1 29, 47, 103
+layer_note1 36, 75, 40
+layer_jump .layer2_1
+
+.channel3:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 1
+chan_setreverb 41
+chan_setvol 99
+chan_setlayer 0, .layer3_0
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 58, 67, 107
+layer_delay 21
+layer_note1 38, 51, 69
+layer_note1 60, 6, 126
+layer_delay 26
+layer_note1 49, 78, 79
+layer_note1 52, 62, 118
+layer_note1 45, 24, 72
+layer_note1 43, 90, 83
+layer_delay 11
+layer_note1 59, 28, 76
+layer_jump .layer3_0
+
+.channel4:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 50
+chan_setreverb 36
+chan_setvol 104
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+chan_setlayer 2, .layer4_2
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_delay 47
+layer_note1 31, 48, 123
+layer_note1 31, 44, 42
+layer_note1 53, 17, 85
+layer_note1 26, 26, 63
+layer_note1 51, 90, 113
+layer_note1 24, 20, 62
+layer_note1 34, 85, 124
+layer_note1 45, 82, 70
+layer_note1 34, 45, 87
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 54, 86, 107
+layer_note1 45, 70, 91
+layer_note1 40, 42, 96
+layer_note1 20, 38, 63
+layer_note1 49, 94, 111
+layer_note1 43, 57, 89
+layer_note1 29, 71, 48
+layer_note1 60, 50, 117
+layer_note1 25, 39, 101
+layer_note1 50, 83, 48
+layer_delay 21
+layer_delay 14
+layer_note1 30, 56, 114
+layer_note1 55, 74, 73
+layer_delay 21
+layer_jump .layer4_1
+
+.layer4_2:
+layer_note1 33, 10, 80
+layer_delay 23
+layer_delay 47
+layer_note1 60, 95, 62
+layer_note1 46, 22, 50
+layer_note1 20, 76, 59
+layer_note1 29, 33, 78
+layer_note1 24, 54, 61
+layer_note1 36, 71, 90
+layer_note1 39, 57, 82
+layer_note1 23, 60, 43
+layer_note1 21, 44, 59
+layer_delay 13
+layer_jump .layer4_2
+
@@ -0,0 +1,393 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 112
+seq_initchannels 0xff
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+seq_startchannel 6, .channel6
+seq_startchannel 7, .channel7
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 7
+chan_setreverb 53
+chan_setvol 119
+chan_setlayer 0, .layer0_0
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 27, 53, 100
+layer_note1 44, 75, 53
+layer_note1 20, 33, 92
+layer_note1 44, 26, 49
+layer_delay 45
+layer_note1 28, 6, 40
+layer_note1 33, 27, 61
+layer_note1 32, 75, 126
+layer_note1 31, 94, 65
+layer_jump .layer0_0
+
+.channel1:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 76
+chan_setreverb 1
+chan_setvol 106
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 36, 14, 82
+layer_note1 58, 81, 40
+layer_note1 41, 14, 79
+layer_note1 39, 67, 80
+layer_note1 50, 96, 62
+layer_delay 7
+layer_note1 42, 57, 42
+layer_note1 46, 52, 88
+layer_note1 20, 63, 45
+layer_note1 59, 31, 55
+layer_note1 49, 50, 105
+layer_note1 53, 38, 99
+layer_delay 29
+layer_jump .layer1_0
+
+.layer1_1:
+layer_delay 11
+layer_note1 52, 84, 86
+layer_note1 41, 41, 109
+layer_delay 26
+layer_note1 25, 86, 59
+layer_note1 39, 67, 60
+layer_note1 25, 82, 108
+layer_note1 22, 36, 116
+layer_note1 36, 64, 123
+layer_note1 23, 87, 44
+layer_note1 41, 32, 56
+layer_note1 56, 22, 120
+layer_note1 46, 19, 61
+layer_note1 29, 13, 93
+layer_note1 49, 85, 61
+layer_note1 49, 68, 80
+layer_note1 38, 66, 91
+layer_jump .layer1_1
+
+.channel2:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 28
+chan_setreverb 24
+chan_setvol 82
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+chan_setlayer 2, .layer2_2
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 31, 17, 102
+layer_note1 55, 70, 86
+layer_delay 28
+layer_note1 22, 45, 86
+layer_note1 37, 68, 73
+layer_note1 38, 49, 123
+layer_note1 20, 66, 110
+layer_note1 40, 91, 75
+layer_note1 52, 88, 126
+layer_note1 42, 41, 122
+layer_note1 46, 50, 62
+layer_note1 48, 52, 82
+layer_note1 53, 27, 65
+layer_note1 50, 42, 50
+layer_note1 46, 27, 118
+layer_note1 57, 72, 125
+layer_note1 39, 85, 110
+layer_note1 60, 40, 43
+layer_note1 57, 62, 119
+layer_note1 34, 93, 63
+layer_note1 22, 66, 68
+layer_note1 28, 20, 80
+layer_note1 50, 30, 110
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 42, 54, 124
+layer_note1 57, 32, 70
+layer_note1 43, 6, 84
+layer_note1 37, 58, 54
+layer_note1 55, 53, 44
+layer_note1 39, 18, 77
+layer_note1 41, 80, 77
+layer_note1 28, 59, 92
+layer_note1 54, 53, 99
+layer_jump .layer2_1
+
+.layer2_2:
+layer_note1 44, 78, 101
+layer_note1 28, 83, 51
+layer_note1 20, 54, 53
+layer_note1 59, 75, 58
+layer_note1 56, 54, 94
+layer_note1 34, 69, 77
+layer_note1 44, 55, 60
+layer_note1 36, 44, 103
+layer_note1 21, 46, 79
+layer_note1 38, 24, 101
+layer_delay 48
+layer_note1 48, 37, 77
+layer_jump .layer2_2
+
+.channel3:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 34
+chan_setreverb 52
+chan_setvol 110
+chan_setlayer 0, .layer3_0
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 37, 37, 100
+layer_note1 35, 68, 74
+layer_note1 38, 43, 103
+layer_note1 50, 72, 122
+layer_note1 27, 8, 56
+layer_note1 54, 96, 83
+layer_note1 53, 9, 99
+layer_note1 57, 22, 44
+layer_delay 41
+layer_note1 26, 93, 109
+layer_note1 47, 60, 116
+layer_note1 60, 89, 101
+layer_note1 44, 66, 90
+layer_note1 32, 43, 99
+layer_note1 24, 44, 40
+layer_note1 47, 80, 76
+layer_note1 50, 45, 58
+layer_note1 55, 69, 82
+layer_note1 47, 80, 109
+layer_note1 24, 35, 74
+layer_note1 24, 90, 43
+layer_note1 47, 14, 91
+layer_note1 23, 21, 55
+layer_jump .layer3_0
+
+.channel4:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 28
+chan_setreverb 45
+chan_setvol 77
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_delay 45
+layer_note1 30, 14, 119
+layer_note1 55, 19, 124
+layer_note1 24, 41, 47
+layer_note1 27, 57, 119
+layer_delay 33
+layer_delay 44
+layer_note1 42, 89, 87
+layer_note1 28, 95, 77
+layer_note1 60, 92, 104
+layer_note1 55, 76, 119
+layer_note1 24, 76, 70
+layer_note1 38, 72, 57
+layer_note1 43, 64, 89
+layer_note1 21, 89, 83
+layer_delay 48
+layer_delay 13
+layer_note1 49, 36, 89
+layer_note1 50, 47, 53
+layer_note1 21, 75, 89
+layer_delay 15
+layer_note1 47, 93, 68
+layer_jump .layer4_0
+
+.layer4_1:
+layer_delay 48
+layer_note1 33, 23, 119
+layer_note1 35, 43, 82
+layer_note1 42, 55, 88
+layer_delay 28
+layer_note1 60, 61, 86
+layer_note1 57, 79, 67
+layer_note1 45, 14, 52
+layer_delay 17
+layer_note1 22, 68, 101
+layer_note1 42, 6, 94
+layer_jump .layer4_1
+
+.channel5:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 76
+chan_setreverb 56
+chan_setvol 114
+chan_setlayer 0, .layer5_0
+chan_setlayer 1, .layer5_1
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_note1 32, 25, 123
+layer_note1 43, 55, 100
+layer_note1 36, 20, 75
+layer_note1 38, 92, 70
+layer_delay 8
+layer_note1 43, 46, 47
+layer_note1 49, 66, 59
+layer_delay 48
+layer_note1 49, 92, 70
+layer_note1 30, 10, 65
+layer_note1 56, 35, 124
+layer_delay 31
+layer_note1 43, 93, 79
+layer_note1 43, 42, 48
+layer_note1 49, 26, 70
+layer_note1 33, 11, 122
+layer_note1 37, 6, 99
+layer_delay 32
+layer_note1 22, 76, 106
+layer_note1 26, 15, 70
+layer_note1 51, 17, 100
+layer_delay 21
+layer_jump .layer5_0
+
+.layer5_1:
+layer_note1 23, 12, 72
+layer_note1 48, 45, 121
+layer_delay 8
+layer_note1 32, 28, 105
+layer_note1 32, 74, 69
+layer_delay 26
+layer_note1 25, 75, 60
+layer_note1 33, 85, 42
+layer_note1 42, 68, 94
+layer_jump .layer5_1
+
+.channel6:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 33
+chan_setreverb 46
+chan_setvol 61
+chan_setlayer 0, .layer6_0
+chan_setlayer 1, .layer6_1
+.chan_loop6:
+chan_delay 0x7fff
+chan_jump .chan_loop6
+
+.layer6_0:
+layer_note1 34, 76, 54
+layer_delay 36
+layer_delay 22
+layer_note1 40, 22, 56
+layer_note1 50, 37, 50
+layer_note1 56, 91, 71
+layer_note1 51, 95, 71
+layer_delay 18
+layer_note1 43, 18, 49
+layer_note1 40, 54, 111
+layer_delay 24
+layer_note1 28, 79, 43
+layer_note1 21, 12, 94
+layer_note1 44, 77, 56
+layer_note1 39, 27, 57
+layer_note1 40, 42, 44
+layer_delay 41
+layer_delay 13
+layer_delay 14
+layer_note1 47, 39, 118
+layer_delay 39
+layer_note1 43, 31, 82
+layer_jump .layer6_0
+
+.layer6_1:
+layer_delay 43
+layer_note1 30, 18, 74
+layer_note1 30, 86, 58
+layer_note1 47, 60, 55
+layer_note1 48, 35, 99
+layer_note1 30, 62, 46
+layer_note1 30, 74, 100
+layer_note1 58, 6, 53
+layer_delay 32
+layer_note1 33, 6, 44
+layer_note1 35, 67, 85
+layer_note1 33, 31, 75
+layer_note1 39, 77, 106
+layer_note1 35, 52, 85
+layer_note1 23, 85, 103
+layer_note1 29, 24, 70
+layer_note1 22, 18, 61
+layer_note1 38, 31, 81
+layer_note1 50, 74, 119
+layer_jump .layer6_1
+
+.channel7:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 50
+chan_setreverb 24
+chan_setvol 61
+chan_setlayer 0, .layer7_0
+.chan_loop7:
+chan_delay 0x7fff
+chan_jump .chan_loop7
+
+.layer7_0:
+layer_note1 59, 29, 89
+layer_delay 7
+layer_note1 52, 55, 104
+layer_note1 45, 63, 114
+layer_note1 55, 91, 47
+layer_note1 46, 52, 115
+layer_delay 39
+layer_note1 38, 15, 43
+layer_delay 28
+layer_note1 46, 45, 41
+layer_note1 35, 15, 44
+layer_note1 39, 50, 117
+layer_note1 33, 67, 106
+layer_delay 13
+layer_note1 54, 60, 90
+layer_note1 44, 54, 62
+layer_note1 53, 32, 126
+layer_note1 44, 47, 53
+layer_note1 55, 94, 87
+layer_note1 26, 33, 77
+layer_note1 37, 85, 49
+layer_note1 30, 15, 120
+layer_note1 31, 34, 123
+layer_delay 42
+layer_jump .layer7_0
+
@@ -0,0 +1,367 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 90
+seq_initchannels 0xff
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+seq_startchannel 6, .channel6
+seq_startchannel 7, .channel7
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 66
+chan_setreverb 2
+chan_setvol 60
+chan_setlayer 0, .layer0_0
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 43, 46, 42
+layer_note1 32, 58, 108
+layer_note1 26, 30, 112
+layer_note1 36, 90, 118
+layer_note1 47, 48, 51
+layer_note1 46, 38, 96
+layer_note1 32, 95, 121
+layer_note1 26, 11, 115
+layer_note1 43, 68, 64
+layer_note1 52, 9, 121
+layer_note1 58, 61, 78
+layer_note1 27, 17, 104
+layer_note1 53, 31, 54
+layer_note1 37, 45, 65
+layer_note1 34, 23, 116
+layer_note1 53, 7, 64
+layer_note1 21, 88, 82
+layer_note1 59, 85, 79
+layer_note1 53, 55, 77
+layer_delay 37
+layer_delay 33
+layer_note1 45, 18, 96
+layer_note1 25, 83, 125
+layer_jump .layer0_0
+
+.channel1:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 114
+chan_setreverb 50
+chan_setvol 108
+chan_setlayer 0, .layer1_0
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 39, 96, 92
+layer_note1 32, 93, 74
+layer_note1 31, 8, 42
+layer_note1 36, 81, 86
+layer_note1 52, 63, 82
+layer_note1 36, 58, 93
+layer_note1 37, 83, 100
+layer_note1 51, 24, 88
+layer_note1 60, 65, 81
+layer_note1 30, 85, 88
+layer_note1 37, 46, 122
+layer_note1 51, 26, 77
+layer_note1 59, 63, 47
+layer_note1 59, 78, 54
+layer_note1 43, 52, 103
+layer_note1 23, 30, 59
+layer_note1 59, 7, 94
+layer_note1 53, 68, 49
+layer_note1 26, 53, 86
+layer_note1 60, 37, 117
+layer_note1 22, 86, 125
+layer_delay 12
+layer_delay 36
+layer_note1 24, 86, 43
+layer_jump .layer1_0
+
+.channel2:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 21
+chan_setreverb 10
+chan_setvol 93
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+chan_setlayer 2, .layer2_2
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 21, 87, 57
+layer_note1 32, 62, 101
+layer_note1 48, 77, 75
+layer_note1 57, 14, 77
+layer_note1 38, 52, 44
+layer_delay 23
+layer_note1 50, 61, 96
+layer_note1 22, 16, 71
+layer_note1 60, 36, 108
+layer_note1 31, 49, 87
+layer_delay 19
+layer_note1 41, 15, 60
+layer_note1 27, 57, 110
+layer_delay 37
+layer_note1 28, 15, 84
+layer_note1 21, 29, 107
+layer_note1 31, 42, 59
+layer_note1 44, 34, 68
+layer_note1 28, 59, 60
+layer_note1 35, 77, 113
+layer_delay 42
+layer_note1 40, 54, 107
+layer_jump .layer2_0
+
+.layer2_1:
+layer_delay 39
+layer_note1 28, 35, 122
+layer_note1 43, 40, 125
+layer_note1 29, 27, 120
+layer_delay 10
+layer_delay 8
+layer_note1 23, 20, 123
+layer_note1 26, 92, 87
+layer_note1 23, 75, 68
+layer_note1 34, 78, 77
+layer_delay 10
+layer_note1 23, 27, 124
+layer_note1 27, 95, 62
+layer_delay 7
+layer_note1 47, 89, 76
+layer_note1 34, 31, 123
+layer_note1 33, 41, 115
+layer_delay 39
+layer_note1 41, 72, 51
+layer_note1 22, 52, 86
+layer_note1 34, 9, 86
+layer_note1 41, 61, 127
+layer_jump .layer2_1
+
+.layer2_2:
+layer_note1 21, 7, 83
+layer_delay 6
+layer_note1 36, 17, 126
+layer_note1 37, 35, 56
+layer_delay 40
+layer_note1 44, 82, 94
+layer_note1 60, 67, 74
+layer_note1 39, 10, 64
+layer_note1 26, 28, 113
+layer_jump .layer2_2
+
+.channel3:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 0
+chan_setreverb 32
+chan_setvol 80
+chan_setlayer 0, .layer3_0
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 50, 68, 107
+layer_note1 54, 66, 67
+layer_note1 44, 25, 98
+layer_note1 20, 49, 93
+layer_note1 28, 42, 87
+layer_note1 43, 34, 40
+layer_note1 31, 16, 92
+layer_note1 34, 88, 51
+layer_note1 46, 22, 58
+layer_note1 23, 72, 107
+layer_note1 51, 52, 82
+layer_note1 57, 55, 74
+layer_jump .layer3_0
+
+.channel4:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 66
+chan_setreverb 8
+chan_setvol 65
+chan_setlayer 0, .layer4_0
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 52, 20, 51
+layer_delay 48
+layer_note1 33, 50, 83
+layer_note1 35, 28, 63
+layer_note1 28, 67, 98
+layer_note1 59, 23, 98
+layer_note1 32, 79, 87
+layer_note1 41, 86, 73
+layer_note1 37, 6, 47
+layer_note1 21, 67, 120
+layer_note1 23, 7, 75
+layer_note1 26, 55, 119
+layer_jump .layer4_0
+
+.channel5:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 26
+chan_setreverb 47
+chan_setvol 107
+chan_setlayer 0, .layer5_0
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_note1 50, 57, 42
+layer_note1 29, 19, 97
+layer_note1 28, 92, 110
+layer_note1 24, 67, 55
+layer_note1 32, 75, 61
+layer_note1 36, 75, 84
+layer_note1 37, 63, 111
+layer_note1 22, 70, 71
+layer_note1 59, 6, 107
+layer_note1 51, 77, 108
+layer_note1 22, 47, 41
+layer_note1 56, 44, 64
+layer_jump .layer5_0
+
+.channel6:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 71
+chan_setreverb 3
+chan_setvol 94
+chan_setlayer 0, .layer6_0
+chan_setlayer 1, .layer6_1
+chan_setlayer 2, .layer6_2
+.chan_loop6:
+chan_delay 0x7fff
+chan_jump .chan_loop6
+
+.layer6_0:
+layer_note1 43, 33, 61
+layer_note1 25, 51, 113
+layer_note1 31, 67, 121
+layer_note1 44, 76, 119
+layer_note1 25, 61, 46
+layer_note1 59, 32, 117
+layer_note1 34, 87, 47
+layer_note1 52, 73, 72
+layer_note1 60, 52, 78
+layer_note1 43, 18, 109
+layer_note1 30, 41, 47
+layer_note1 40, 90, 104
+layer_delay 48
+layer_delay 34
+layer_note1 25, 28, 127
+layer_note1 20, 14, 74
+layer_note1 42, 55, 91
+layer_jump .layer6_0
+
+.layer6_1:
+layer_note1 38, 69, 97
+layer_note1 39, 36, 41
+layer_note1 52, 75, 88
+layer_note1 38, 88, 123
+layer_note1 20, 19, 73
+layer_note1 28, 77, 55
+layer_delay 22
+layer_note1 24, 41, 62
+layer_note1 29, 18, 43
+layer_note1 58, 47, 93
+layer_jump .layer6_1
+
+.layer6_2:
+layer_note1 51, 63, 81
+layer_note1 49, 30, 62
+layer_note1 34, 91, 57
+layer_note1 57, 51, 99
+layer_note1 37, 81, 116
+layer_note1 56, 34, 43
+layer_note1 45, 79, 55
+layer_note1 22, 46, 86
+layer_note1 36, 61, 88
+layer_note1 53, 81, 87
+layer_note1 23, 58, 121
+layer_note1 39, 43, 115
+layer_note1 35, 19, 98
+layer_note1 30, 52, 113
+layer_note1 49, 47, 49
+layer_note1 51, 7, 53
+layer_note1 50, 61, 121
+layer_delay 7
+layer_note1 52, 73, 84
+layer_note1 30, 28, 101
+layer_note1 45, 81, 116
+layer_delay 28
+layer_note1 34, 84, 108
+layer_jump .layer6_2
+
+.channel7:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 67
+chan_setreverb 53
+chan_setvol 109
+chan_setlayer 0, .layer7_0
+chan_setlayer 1, .layer7_1
+.chan_loop7:
+chan_delay 0x7fff
+chan_jump .chan_loop7
+
+.layer7_0:
+layer_note1 46, 44, 62
+layer_note1 42, 10, 42
+layer_note1 33, 6, 45
+layer_note1 50, 88, 53
+layer_note1 50, 47, 100
+layer_note1 43, 24, 54
+layer_note1 34, 40, 93
+layer_note1 50, 53, 59
+layer_jump .layer7_0
+
+.layer7_1:
+layer_note1 60, 41, 64
+layer_note1 55, 13, 104
+layer_note1 45, 73, 45
+layer_note1 60, 9, 121
+layer_delay 11
+layer_delay 44
+layer_note1 32, 70, 52
+layer_note1 56, 67, 82
+layer_note1 31, 62, 66
+layer_note1 20, 34, 81
+layer_note1 56, 43, 59
+layer_note1 21, 43, 53
+layer_note1 33, 91, 66
+layer_note1 55, 82, 109
+layer_note1 58, 69, 51
+layer_note1 58, 75, 61
+layer_note1 58, 31, 120
+layer_note1 38, 59, 78
+layer_note1 22, 62, 67
+layer_jump .layer7_1
+
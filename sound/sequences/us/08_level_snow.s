@@ -0,0 +1,349 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 99
+seq_initchannels 0x3f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 12
+chan_setreverb 4
+chan_setvol 72
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 33, 10, 51
+layer_note1 24, 36, 51
+layer_note1 23, 78, 55
+layer_note1 60, 86, 114
+layer_note1 56, 80, 90
+layer_delay 20
+layer_delay 14
+layer_note1 29, 75, 55
+layer_note1 55, 93, 63
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 60, 30, 87
+layer_delay 10
+layer_note1 59, 32, 103
+layer_note1 47, 46, 99
+layer_note1 49, 52, 78
+layer_note1 31, 95, 71
+layer_delay 25
+layer_note1 41, 63, 76
+layer_note1 24, 21, 105
+layer_note1 41, 25, 102
+layer_note1 24, 77, 113
+layer_jump .layer0_1
+
+.channel1:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 87
+chan_setreverb 44
+chan_setvol 104
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+chan_setlayer 2, .layer1_2
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 49, 14, 51
+layer_note1 50, 95, 125
+layer_delay 25
+layer_note1 48, 42, 89
+layer_note1 42, 8, 99
+layer_note1 59, 20, 103
+layer_delay 24
+layer_delay 21
+layer_note1 51, 16, 61
+layer_note1 55, 41, 57
+layer_note1 55, 41, 93
+layer_note1 44, 35, 59
+layer_delay 15
+layer_note1 34, 7, 102
+layer_note1 31, 39, 76
+layer_delay 32
+layer_note1 59, 78, 80
+layer_note1 52, 85, 123
+layer_note1 23, 64, 127
+layer_note1 45, 56, 91
+layer_note1 50, 87, 91
+layer_delay 10
+layer_note1 48, 26, 54
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 26, 6, 112
+layer_note1 26, 52, 118
+layer_delay 19
+layer_note1 29, 87, 72
+layer_note1 58, 52, 100
+layer_delay 37
+layer_note1 49, 67, 101
+layer_note1 29, 19, 83
+layer_note1 50, 94, 60
+layer_note1 33, 73, 86
+layer_delay 40
+layer_note1 53, 44, 122
+layer_note1 36, 72, 86
+layer_note1 42, 34, 108
+layer_note1 52, 48, 121
+layer_note1 32, 36, 91
+layer_note1 34, 31, 106
+layer_note1 21, 9, 75
+layer_jump .layer1_1
+
+.layer1_2:
+layer_note1 58, 50, 97
+layer_note1 42, 52, 50
+layer_note1 34, 66, 65
+layer_note1 50, 85, 118
+layer_note1 50, 89, 84
+layer_note1 25, 90, 55
+layer_note1 32, 67, 62
+layer_note1 60, 48, 51
+layer_note1 45, 65, 91
+layer_note1 25, 26, 61
+layer_note1 21, 25, 115
+layer_note1 29, 84, 116
+layer_note1 42, 25, 110
+layer_note1 21, 7, 123
+layer_delay 14
+layer_note1 32, 33, 43
+layer_note1 38, 70, 70
+layer_note1 40, 39, 109
+layer_note1 28, 13, 85
+layer_note1 57, 72, 93
+layer_note1 52, 22, 108
+layer_note1 52, 8, 96
+layer_note1 58, 6, 59
+layer_jump .layer1_2
+
+.channel2:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 36
+chan_setreverb 30
+chan_setvol 75
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+chan_setlayer 2, .layer2_2
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 53, 73, 111
+layer_note1 26, 77, 47
+layer_note1 37, 11, 52
+layer_note1 55, 9, 48
+layer_note1 59, 70, 117
+layer_note1 37, 63, 105
+layer_note1 50, 70, 71
+layer_note1 36, 77, 65
+layer_note1 28, 59, 55
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 24, 91, 70
+layer_note1 33, 91, 78
+layer_note1 29, 88, 124
+layer_note1 36, 23, 99
+layer_note1 26, 56, 102
+layer_note1 34, 26, 95
+layer_note1 45, 49, 93
+layer_note1 40, 17, 86
+layer_delay 41
+layer_note1 21, 55, 82
+layer_note1 38, 71, 48
+layer_delay 20
+layer_note1 26, 16, 73
+layer_note1 31, 40, 56
+layer_note1 36, 57, 59
+layer_note1 52, 79, 103
+layer_note1 25, 41, 47
+layer_note1 31, 60, 49
+layer_note1 21, 87, 51
+layer_note1 25, 83, 68
+layer_jump .layer2_1
+
+.layer2_2:
+layer_note1 27, 64, 41
+layer_note1 55, 59, 74
+layer_note1 22, 73, 70
+layer_note1 30, 39, 46
+layer_note1 39, 86, 79
+layer_note1 33, 43, 97
+layer_note1 31, 40, 84
+layer_note1 36, 10, 41
+layer_delay 38
+layer_note1 32, 71, 100
+layer_jump .layer2_2
+
+.channel3:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 114
+chan_setreverb 6
+chan_setvol 115
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+chan_setlayer 2, .layer3_2
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 45, 70, 79
+layer_note1 34, 49, 65
+layer_note1 60, 23, 91
+layer_note1 23, 22, 41
+layer_delay 22
+layer_note1 23, 16, 125
+layer_note1 52, 91, 76
+layer_note1 38, 11, 98
+layer_note1 37, 63, 40
+layer_note1 41, 76, 81
+layer_note1 39, 33, 85
+layer_note1 41, 54, 50
+layer_note1 52, 89, 65
+layer_note1 20, 17, 73
+layer_note1 29, 57, 115
+layer_delay 7
+layer_note1 60, 35, 50
+layer_note1 53, 25, 124
+layer_note1 58, 55, 81
+layer_note1 51, 25, 76
+layer_note1 29, 11, 105
+layer_note1 52, 23, 107
+layer_note1 56, 8, 127
+layer_jump .layer3_0
+
+.layer3_1:
+layer_delay 8
+layer_delay 29
+layer_note1 44, 63, 111
+layer_delay 7
+layer_note1 35, 68, 73
+layer_delay 10
+layer_note1 52, 74, 51
+layer_note1 24, 66, 72
+layer_note1 36, 36, 66
+layer_note1 49, 69, 88
+layer_delay 24
+layer_note1 59, 86, 122
+layer_note1 58, 24, 82
+layer_note1 39, 85, 112
+layer_delay 36
+layer_jump .layer3_1
+
+.layer3_2:
+layer_note1 26, 94, 67
+layer_note1 38, 96, 106
+layer_note1 49, 65, 55
+layer_note1 55, 31, 79
+layer_note1 50, 8, 77
+layer_note1 52, 63, 74
+layer_note1 33, 15, 114
+layer_delay 39
+layer_note1 43, 22, 117
+layer_jump .layer3_2
+
+.channel4:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 28
+chan_setreverb 45
+chan_setvol 106
+chan_setlayer 0, .layer4_0
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 51, 56, 43
+layer_note1 51, 93, 97
+layer_note1 29, 59, 84
+layer_note1 27, 48, 40
+layer_note1 41, 56, 55
+layer_note1 32, 7, 77
+layer_note1 24, 56, 89
+layer_note1 57, 15, 86
+layer_note1 37, 12, 75
+layer_delay 48
+layer_note1 29, 37, 74
+layer_note1 40, 30, 87
+layer_note1 47, 9, 120
+layer_note1 55, 76, 66
+layer_note1 23, 58, 97
+layer_note1 28, 88, 76
+layer_note1 55, 22, 61
+layer_note1 41, 42, 78
+layer_note1 36, 57, 123
+layer_note1 50, 77, 125
+layer_note1 30, 88, 60
+layer_delay 38
+layer_note1 51, 76, 68
+layer_jump .layer4_0
+
+.channel5:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 85
+chan_setreverb 48
+chan_setvol 117
+chan_setlayer 0, .layer5_0
+chan_setlayer 1, .layer5_1
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_note1 35, 17, 62
+layer_note1 25, 46, 70
+layer_note1 56, 31, 42
+layer_note1 46, 55, 92
+layer_note1 33, 54, 74
+layer_note1 23, 69, 75
+layer_note1 43, 22, 127
+layer_note1 60, 33, 51
+layer_note1 35, 55, 91
+layer_note1 47, 45, 42
+layer_delay 33
+layer_note1 50, 81, 102
+layer_jump .layer5_0
+
+.layer5_1:
+layer_delay 39
+layer_note1 48, 37, 53
+layer_note1 29, 72, 127
+layer_delay 47
+layer_note1 49, 16, 110
+layer_note1 20, 22, 69
+layer_note1 22, 88, 78
+layer_note1 60, 38, 107
+layer_jump .layer5_1
+
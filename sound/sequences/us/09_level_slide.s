@@ -0,0 +1,244 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 127
+seq_initchannels 0x1f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 32
+chan_setreverb 12
+chan_setvol 65
+chan_setlayer 0, .layer0_0
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 52, 32, 91
+layer_note1 49, 68, 98
+layer_note1 56, 30, 91
+layer_delay 20
+layer_note1 37, 72, 92
+layer_note1 44, 20, 124
+layer_note1 24, 55, 119
+layer_note1 26, 90, 47
+layer_note1 25, 69, 123
+layer_note1 33, 80, 58
+layer_note1 54, 10, 102
+layer_note1 29, 80, 98
+layer_jump .layer0_0
+
+.channel1:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 73
+chan_setreverb 35
+chan_setvol 105
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 58, 18, 108
+layer_note1 42, 88, 103
+layer_note1 32, 45, 59
+layer_note1 38, 71, 124
+layer_delay 38
+layer_note1 54, 34, 84
+layer_note1 20, 43, 83
+layer_note1 22, 60, 72
+layer_note1 46, 28, 124
+layer_note1 30, 90, 43
+layer_note1 30, 44, 54
+layer_delay 30
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 56, 61, 69
+layer_delay 42
+layer_note1 46, 16, 115
+layer_delay 12
+layer_delay 48
+layer_delay 39
+layer_note1 29, 70, 102
+layer_note1 58, 14, 64
+layer_delay 14
+layer_note1 56, 21, 78
+layer_note1 43, 6, 122
+layer_note1 33, 13, 119
+layer_delay 43
+layer_note1 41, 61, 96
+layer_delay 18
+layer_note1 51, 66, 59
+layer_note1 26, 80, 97
+layer_note1 48, 71, 51
+layer_jump .layer1_1
+
+.channel2:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 100
+chan_setreverb 52
+chan_setvol 106
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_delay 9
+layer_note1 26, 33, 40
+layer_note1 59, 8, 123
+layer_note1 47, 73, 51
+layer_note1 58, 70, 112
+layer_note1 34, 47, 107
+layer_note1 53, 88, 65
+layer_delay 45
+layer_note1 25, 47, 91
+layer_note1 38, 16, 110
+layer_note1 43, 47, 106
+layer_note1 42, 43, 123
+layer_note1 32, 68, 87
+layer_note1 57, 45, 66
+layer_note1 59, 55, 127
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 42, 92, 117
+layer_note1 47, 31, 102
+layer_note1 52, 16, 74
+layer_note1 51, 40, 93
+layer_note1 59, 41, 77
+layer_note1 52, 40, 75
+layer_note1 60, 58, 71
+layer_note1 35, 70, 98
+layer_note1 58, 73, 65
+layer_note1 26, 20, 89
+layer_delay 16
+layer_note1 47, 11, 57
+layer_delay 18
+layer_note1 25, 18, 99
+layer_note1 38, 78, 51
+layer_delay 28
+layer_note1 24, 46, 44
+layer_note1 25, 23, 123
+layer_note1 24, 35, 44
+layer_note1 40, 34, 77
+layer_note1 40, 14, 106
+layer_note1 59, 50, 95
+layer_note1 36, 55, 59
+layer_note1 24, 18, 108
+layer_jump .layer2_1
+
+.channel3:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 21
+chan_setreverb 18
+chan_setvol 82
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_delay 9
+layer_delay 17
+layer_note1 55, 87, 81
+layer_note1 35, 70, 101
+layer_delay 11
+layer_note1 28, 34, 81
+layer_note1 31, 27, 57
+layer_note1 23, 94, 97
+layer_note1 59, 42, 93
+layer_note1 47, 80, 127
+layer_note1 43, 94, 112
+layer_note1 51, 52, 107
+layer_note1 37, 93, 100
+layer_note1 37, 69, 121
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 52, 43, 67
+layer_note1 45, 23, 102
+layer_note1 27, 43, 90
+layer_delay 29
+layer_note1 38, 50, 88
+layer_note1 59, 24, 41
+layer_delay 17
+layer_note1 28, 60, 112
+layer_note1 26, 53, 104
+layer_delay 44
+layer_note1 43, 51, 53
+layer_note1 26, 67, 61
+layer_note1 50, 52, 113
+layer_note1 43, 60, 87
+layer_note1 22, 24, 124
+layer_note1 40, 13, 44
+layer_note1 52, 52, 101
+layer_note1 55, 28, 78
+layer_delay 23
+layer_note1 48, 42, 114
+layer_note1 49, 43, 77
+layer_note1 51, 63, 124
+layer_note1 51, 89, 96
+layer_note1 57, 19, 86
+layer_jump .layer3_1
+
+.channel4:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 92
+chan_setreverb 30
+chan_setvol 109
+chan_setlayer 0, .layer4_0
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 31, 24, 104
+layer_note1 25, 76, 125
+layer_note1 33, 24, 121
+layer_note1 32, 20, 41
+layer_delay 19
+layer_note1 21, 6, 42
+layer_note1 56, 44, 121
+layer_note1 22, 33, 82
+layer_note1 25, 59, 70
+layer_note1 20, 93, 52
+layer_note1 32, 67, 93
+layer_note1 47, 70, 58
+layer_delay 48
+layer_note1 42, 82, 95
+layer_note1 36, 58, 124
+layer_note1 21, 42, 48
+layer_note1 40, 95, 60
+layer_note1 45, 94, 79
+layer_note1 53, 41, 117
+layer_delay 19
+layer_note1 33, 30, 54
+layer_note1 51, 25, 80
+layer_note1 25, 61, 84
+layer_note1 55, 93, 103
+layer_jump .layer4_0
+
@@ -0,0 +1,383 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 158
+seq_initchannels 0x7f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+seq_startchannel 6, .channel6
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 68
+chan_setreverb 8
+chan_setvol 83
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+chan_setlayer 2, .layer0_2
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 49, 83, 50
+layer_note1 59, 95, 45
+layer_note1 30, 96, 97
+layer_note1 47, 26, 61
+layer_note1 27, 22, 104
+layer_note1 57, 14, 89
+layer_note1 26, 43, 66
+layer_note1 46, 17, 74
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 41, 11, 65
+layer_note1 20, 58, 47
+layer_note1 51, 23, 43
+layer_note1 27, 82, 40
+layer_delay 43
+layer_note1 32, 48, 41
+layer_note1 28, 75, 42
+layer_note1 56, 69, 108
+layer_note1 46, 14, 90
+layer_note1 25, 95, 114
+layer_delay 44
+layer_note1 22, 12, 74
+layer_note1 58, 25, 74
+layer_note1 56, 10, 55
+layer_jump .layer0_1
+
+.layer0_2:
+layer_note1 35, 26, 118
+layer_note1 43, 92, 106
+layer_note1 25, 50, 54
+layer_note1 57, 52, 97
+layer_note1 32, 79, 42
+layer_note1 58, 48, 40
+layer_note1 33, 34, 96
+layer_note1 25, 45, 120
+layer_note1 53, 13, 43
+layer_note1 55, 60, 103
+layer_note1 35, 78, 48
+layer_note1 34, 18, 91
+layer_note1 55, 53, 57
+layer_note1 30, 94, 73
+layer_delay 17
+layer_note1 30, 21, 117
+layer_delay 9
+layer_delay 19
+layer_note1 38, 84, 41
+layer_note1 42, 42, 58
+layer_jump .layer0_2
+
+.channel1:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 71
+chan_setreverb 8
+chan_setvol 71
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+chan_setlayer 2, .layer1_2
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 24, 59, 97
+layer_delay 41
+layer_note1 44, 81, 61
+layer_note1 37, 82, 117
+layer_note1 26, 12, 75
+layer_note1 31, 86, 50
+layer_note1 34, 7, 65
+layer_note1 49, 81, 111
+layer_note1 25, 28, 110
+layer_note1 36, 74, 48
+layer_note1 21, 80, 114
+layer_note1 54, 45, 107
+layer_note1 24, 88, 113
+layer_note1 39, 14, 68
+layer_note1 26, 18, 102
+layer_note1 51, 87, 46
+layer_note1 21, 53, 71
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 56, 85, 103
+layer_note1 22, 85, 116
+layer_delay 9
+layer_note1 46, 81, 48
+layer_delay 8
+layer_note1 31, 16, 48
+layer_delay 45
+layer_note1 54, 66, 43
+layer_note1 24, 48, 50
+layer_note1 20, 65, 97
+layer_note1 44, 67, 57
+layer_delay 28
+layer_note1 48, 22, 64
+layer_note1 26, 20, 46
+layer_delay 47
+layer_note1 43, 19, 43
+layer_note1 53, 31, 87
+layer_note1 25, 36, 40
+layer_note1 53, 93, 65
+layer_delay 22
+layer_note1 21, 19, 106
+layer_note1 23, 38, 100
+layer_jump .layer1_1
+
+.layer1_2:
+layer_note1 34, 87, 47
+layer_note1 28, 44, 44
+layer_note1 42, 57, 40
+layer_note1 39, 18, 43
+layer_note1 35, 59, 117
+layer_note1 56, 50, 91
+layer_note1 25, 41, 78
+layer_note1 59, 78, 98
+layer_note1 31, 48, 91
+layer_delay 11
+layer_note1 54, 9, 64
+layer_note1 43, 90, 57
+layer_note1 25, 49, 97
+layer_note1 58, 91, 89
+layer_note1 54, 48, 49
+layer_delay 41
+layer_note1 34, 47, 105
+layer_note1 49, 6, 76
+layer_jump .layer1_2
+
+.channel2:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 18
+chan_setreverb 14
+chan_setvol 61
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_delay 27
+layer_note1 26, 71, 91
+layer_note1 45, 55, 115
+layer_note1 28, 71, 85
+layer_note1 37, 31, 81
+layer_note1 56, 29, 118
+layer_note1 31, 79, 61
+layer_delay 7
+layer_note1 53, 92, 94
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 29, 72, 97
+layer_note1 34, 28, 82
+layer_delay 28
+layer_note1 23, 75, 75
+layer_note1 21, 80, 63
+layer_note1 26, 64, 57
+layer_note1 54, 23, 94
+layer_note1 32, 93, 112
+layer_note1 55, 12, 85
+layer_note1 23, 53, 91
+layer_jump .layer2_1
+
+.channel3:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 111
+chan_setreverb 40
+chan_setvol 84
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+chan_setlayer 2, .layer3_2
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 57, 16, 85
+layer_note1 35, 66, 107
+layer_note1 53, 7, 124
+layer_note1 34, 28, 43
+layer_delay 43
+layer_note1 32, 90, 83
+layer_note1 28, 48, 78
+layer_note1 24, 57, 71
+layer_note1 22, 46, 62
+layer_note1 56, 31, 121
+layer_note1 53, 80, 88
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 44, 10, 90
+layer_delay 32
+layer_note1 31, 91, 121
+layer_note1 52, 69, 106
+layer_note1 43, 84, 84
+layer_note1 32, 13, 122
+layer_note1 39, 19, 66
+layer_note1 32, 65, 55
+layer_note1 38, 34, 41
+layer_note1 60, 59, 74
+layer_note1 60, 50, 81
+layer_note1 30, 76, 127
+layer_delay 19
+layer_delay 19
+layer_delay 34
+layer_note1 55, 96, 49
+layer_delay 32
+layer_note1 31, 13, 71
+layer_note1 52, 79, 93
+layer_note1 32, 87, 84
+layer_note1 53, 58, 44
+layer_note1 54, 46, 75
+layer_note1 38, 61, 108
+layer_note1 26, 13, 85
+layer_jump .layer3_1
+
+.layer3_2:
+layer_note1 43, 63, 87
+layer_delay 32
+layer_note1 31, 14, 122
+layer_delay 47
+layer_note1 51, 8, 79
+layer_note1 44, 39, 64
+layer_note1 50, 27, 117
+layer_delay 24
+layer_note1 53, 21, 115
+layer_note1 32, 62, 118
+layer_delay 38
+layer_note1 31, 15, 107
+layer_note1 39, 24, 93
+layer_note1 32, 45, 100
+layer_note1 50, 70, 122
+layer_jump .layer3_2
+
+.channel4:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 118
+chan_setreverb 3
+chan_setvol 121
+chan_setlayer 0, .layer4_0
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 41, 15, 101
+layer_note1 54, 84, 59
+layer_note1 51, 95, 92
+layer_note1 27, 79, 105
+layer_delay 24
+layer_note1 57, 16, 112
+layer_note1 55, 27, 75
+layer_delay 27
+layer_note1 48, 72, 87
+layer_note1 31, 26, 80
+layer_jump .layer4_0
+
+.channel5:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 84
+chan_setreverb 30
+chan_setvol 70
+chan_setlayer 0, .layer5_0
+chan_setlayer 1, .layer5_1
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_note1 56, 38, 78
+layer_note1 58, 56, 100
+layer_delay 32
+layer_note1 38, 54, 97
+layer_note1 33, 27, 127
+layer_note1 56, 14, 50
+layer_delay 48
+layer_note1 38, 7, 101
+layer_note1 23, 63, 61
+layer_note1 25, 40, 52
+layer_delay 16
+layer_note1 43, 39, 68
+layer_note1 32, 69, 112
+layer_note1 46, 91, 74
+layer_note1 45, 95, 51
+layer_note1 29, 29, 42
+layer_note1 44, 23, 98
+layer_jump .layer5_0
+
+.layer5_1:
+layer_delay 12
+layer_note1 44, 56, 109
+layer_note1 41, 23, 68
+layer_note1 35, 51, 109
+layer_note1 25, 19, 50
+layer_delay 42
+layer_note1 43, 88, 68
+layer_note1 54, 89, 40
+layer_note1 36, 93, 114
+layer_note1 43, 14, 77
+layer_note1 37, 84, 60
+layer_note1 27, 9, 70
+layer_note1 21, 93, 63
+layer_note1 60, 57, 56
+layer_note1 37, 81, 123
+layer_note1 46, 25, 75
+layer_delay 38
+layer_note1 50, 73, 73
+layer_delay 12
+layer_note1 38, 88, 55
+layer_delay 36
+layer_note1 30, 72, 124
+layer_note1 37, 31, 61
+layer_jump .layer5_1
+
+.channel6:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 4
+chan_setreverb 47
+chan_setvol 90
+chan_setlayer 0, .layer6_0
+.chan_loop6:
+chan_delay 0x7fff
+chan_jump .chan_loop6
+
+.layer6_0:
+layer_delay 31
+layer_note1 50, 8, 127
+layer_delay 18
+layer_note1 39, 75, 49
+layer_note1 33, 92, 105
+layer_note1 26, 16, 67
+layer_note1 49, 91, 63
+layer_note1 37, 81, 85
+layer_delay 41
+layer_note1 36, 24, 47
+layer_delay 11
+layer_note1 41, 95, 42
+layer_note1 56, 36, 62
+layer_delay 9
+layer_jump .layer6_0
+
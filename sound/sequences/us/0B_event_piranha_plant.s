@@ -0,0 +1,427 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 84
+seq_initchannels 0xff
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+seq_startchannel 6, .channel6
+seq_startchannel 7, .channel7
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 123
+chan_setreverb 36
+chan_setvol 61
+chan_setlayer 0, .layer0_0
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 37, 89, 60
+layer_delay 37
+layer_note1 35, 52, 45
+layer_note1 28, 83, 85
+layer_note1 38, 92, 73
+layer_note1 39, 90, 86
+layer_delay 21
+layer_note1 59, 54, 45
+layer_note1 35, 23, 64
+layer_note1 39, 74, 86
+layer_note1 35, 46, 125
+layer_note1 47, 66, 48
+layer_note1 40, 70, 60
+layer_note1 46, 36, 44
+layer_delay 25
+layer_note1 24, 74, 50
+layer_delay 42
+layer_note1 58, 25, 54
+layer_note1 26, 62, 61
+layer_note1 32, 50, 95
+layer_note1 48, 37, 127
+layer_note1 59, 72, 62
+layer_jump .layer0_0
+
+.channel1:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 68
+chan_setreverb 29
+chan_setvol 98
+chan_setlayer 0, .layer1_0
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 50, 50, 81
+layer_note1 20, 75, 45
+layer_note1 40, 37, 50
+layer_note1 45, 80, 60
+layer_note1 51, 92, 70
+layer_note1 37, 72, 101
+layer_note1 24, 27, 102
+layer_note1 45, 23, 93
+layer_note1 42, 74, 89
+layer_note1 30, 77, 96
+layer_delay 32
+layer_note1 20, 62, 108
+layer_delay 28
+layer_jump .layer1_0
+
+.channel2:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 38
+chan_setreverb 6
+chan_setvol 118
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 47, 70, 97
+layer_note1 36, 95, 98
+layer_note1 53, 72, 59
+layer_note1 40, 85, 44
+layer_note1 57, 79, 120
+layer_note1 27, 43, 95
+layer_note1 35, 43, 51
+layer_delay 41
+layer_note1 26, 42, 60
+layer_note1 29, 52, 116
+layer_note1 32, 50, 63
+layer_delay 18
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 26, 93, 79
+layer_note1 49, 94, 106
+layer_note1 48, 91, 111
+layer_note1 58, 52, 54
+layer_note1 60, 6, 66
+layer_note1 46, 54, 123
+layer_note1 47, 17, 47
+layer_note1 43, 64, 94
+layer_note1 60, 42, 99
+layer_note1 52, 69, 104
+layer_note1 45, 62, 121
+layer_note1 37, 67, 97
+layer_note1 57, 67, 50
+layer_note1 43, 57, 61
+layer_note1 46, 78, 48
+layer_note1 39, 8, 115
+layer_note1 40, 15, 90
+layer_note1 38, 83, 63
+layer_note1 39, 18, 111
+layer_note1 23, 34, 112
+layer_note1 46, 30, 112
+layer_jump .layer2_1
+
+.channel3:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 4
+chan_setreverb 25
+chan_setvol 85
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 56, 47, 46
+layer_note1 57, 12, 44
+layer_note1 45, 47, 116
+layer_note1 30, 21, 117
+layer_note1 42, 27, 43
+layer_note1 54, 71, 84
+layer_delay 34
+layer_note1 42, 13, 58
+layer_note1 48, 96, 100
+layer_note1 48, 83, 62
+layer_note1 47, 49, 111
+layer_note1 44, 30, 52
+layer_note1 29, 11, 63
+layer_note1 32, 78, 94
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 23, 83, 46
+layer_note1 34, 12, 114
+layer_note1 60, 78, 86
+layer_note1 39, 11, 90
+layer_note1 47, 15, 84
+layer_note1 51, 26, 61
+layer_note1 49, 48, 44
+layer_note1 31, 80, 93
+layer_note1 45, 18, 90
+layer_note1 27, 36, 53
+layer_note1 60, 45, 77
+layer_note1 26, 50, 106
+layer_note1 58, 37, 108
+layer_note1 30, 92, 89
+layer_note1 26, 71, 121
+layer_note1 26, 79, 91
+layer_note1 38, 51, 48
+layer_note1 32, 85, 111
+layer_note1 24, 57, 44
+layer_jump .layer3_1
+
+.channel4:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 110
+chan_setreverb 21
+chan_setvol 82
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+chan_setlayer 2, .layer4_2
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 60, 66, 61
+layer_delay 14
+layer_note1 32, 37, 71
+layer_note1 54, 80, 116
+layer_note1 55, 9, 56
+layer_delay 7
+layer_note1 31, 21, 89
+layer_delay 48
+layer_note1 31, 85, 93
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 23, 95, 88
+layer_note1 49, 48, 63
+layer_delay 46
+layer_note1 43, 91, 49
+layer_delay 22
+layer_note1 49, 7, 59
+layer_note1 53, 45, 58
+layer_note1 54, 21, 76
+layer_note1 41, 6, 113
+layer_jump .layer4_1
+
+.layer4_2:
+layer_note1 53, 60, 105
+layer_delay 9
+layer_note1 58, 13, 122
+layer_note1 20, 33, 58
+layer_note1 46, 25, 43
+layer_note1 27, 67, 78
+layer_note1 49, 28, 120
+layer_delay 31
+layer_note1 48, 90, 62
+layer_note1 50, 25, 45
+layer_note1 44, 27, 100
+layer_note1 33, 69, 106
+layer_note1 56, 77, 88
+layer_delay 47
+layer_note1 40, 22, 47
+layer_note1 41, 73, 106
+layer_jump .layer4_2
+
+.channel5:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 97
+chan_setreverb 39
+chan_setvol 70
+chan_setlayer 0, .layer5_0
+chan_setlayer 1, .layer5_1
+chan_setlayer 2, .layer5_2
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_delay 6
+layer_note1 47, 34, 124
+layer_note1 56, 90, 51
+layer_delay 29
+layer_note1 47, 45, 62
+layer_note1 60, 57, 109
+layer_note1 32, 93, 70
+layer_note1 44, 33, 105
+layer_note1 44, 30, 48
+layer_jump .layer5_0
+
+.layer5_1:
+layer_note1 57, 74, 56
+layer_delay 31
+layer_note1 33, 7, 98
+layer_note1 30, 52, 89
+layer_note1 35, 48, 78
+layer_note1 29, 13, 102
+layer_note1 41, 6, 81
+layer_note1 52, 95, 115
+layer_delay 24
+layer_note1 27, 59, 94
+layer_note1 27, 65, 60
+layer_note1 24, 54, 108
+layer_jump .layer5_1
+
+.layer5_2:
+layer_note1 53, 76, 73
+layer_note1 25, 59, 54
+layer_note1 50, 34, 90
+layer_note1 48, 64, 121
+layer_note1 51, 95, 93
+layer_note1 29, 63, 61
+layer_note1 51, 79, 99
+layer_note1 55, 63, 116
+layer_note1 52, 75, 87
+layer_note1 49, 44, 63
+layer_jump .layer5_2
+
+.channel6:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 57
+chan_setreverb 23
+chan_setvol 80
+chan_setlayer 0, .layer6_0
+chan_setlayer 1, .layer6_1
+chan_setlayer 2, .layer6_2
+.chan_loop6:
+chan_delay 0x7fff
+chan_jump .chan_loop6
+
+.layer6_0:
+layer_note1 22, 13, 61
+layer_note1 39, 27, 65
+layer_delay 35
+layer_note1 52, 37, 44
+layer_delay 37
+layer_note1 42, 8, 93
+layer_note1 42, 39, 42
+layer_note1 22, 24, 123
+layer_jump .layer6_0
+
+.layer6_1:
+layer_delay 36
+layer_note1 38, 50, 80
+layer_note1 41, 82, 77
+layer_note1 26, 67, 125
+layer_note1 43, 68, 95
+layer_note1 24, 26, 114
+layer_note1 40, 42, 65
+layer_delay 43
+layer_note1 22, 27, 60
+layer_note1 43, 56, 55
+layer_note1 32, 79, 49
+layer_note1 23, 76, 72
+layer_note1 59, 95, 51
+layer_note1 31, 27, 97
+layer_note1 55, 30, 127
+layer_jump .layer6_1
+
+.layer6_2:
+layer_note1 47, 58, 64
+layer_note1 43, 67, 56
+layer_note1 32, 79, 124
+layer_note1 23, 93, 106
+layer_note1 31, 30, 50
+layer_note1 60, 93, 109
+layer_delay 38
+layer_note1 56, 47, 80
+layer_note1 57, 86, 62
+layer_note1 50, 37, 88
+layer_note1 52, 19, 93
+layer_note1 25, 37, 47
+layer_delay 10
+layer_note1 37, 95, 83
+layer_note1 54, 53, 57
+layer_note1 56, 87, 56
+layer_note1 20, 63, 122
+layer_delay 31
+layer_note1 59, 8, 60
+layer_note1 46, 36, 100
+layer_note1 30, 16, 83
+layer_jump .layer6_2
+
+.channel7:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 39
+chan_setreverb 40
+chan_setvol 67
+chan_setlayer 0, .layer7_0
+chan_setlayer 1, .layer7_1
+.chan_loop7:
+chan_delay 0x7fff
+chan_jump .chan_loop7
+
+.layer7_0:
+layer_note1 23, 10, 96
+layer_note1 53, 58, 110
+layer_note1 58, 79, 127
+layer_note1 57, 23, 99
+layer_note1 42, 14, 73
+layer_note1 38, 89, 84
+layer_note1 55, 19, 72
+layer_note1 40, 65, 94
+layer_note1 37, 20, 59
+layer_note1 59, 27, 40
+layer_note1 43, 61, 74
+layer_note1 32, 93, 121
+layer_note1 23, 12, 114
+layer_note1 54, 76, 59
+layer_delay 24
+layer_note1 49, 52, 79
+layer_note1 36, 15, 65
+layer_note1 42, 14, 122
+layer_delay 42
+layer_note1 54, 93, 70
+layer_note1 37, 77, 126
+layer_note1 52, 61, 124
+layer_note1 49, 82, 47
+layer_note1 50, 68, 76
+layer_jump .layer7_0
+
+.layer7_1:
+layer_note1 43, 38, 114
+layer_note1 50, 29, 69
+layer_note1 40, 93, 75
+layer_delay 13
+layer_delay 22
+layer_note1 31, 75, 127
+layer_note1 20, 70, 110
+layer_note1 30, 49, 113
+layer_note1 57, 94, 55
+layer_note1 20, 49, 100
+layer_note1 23, 82, 101
+layer_note1 21, 77, 77
+layer_note1 53, 81, 53
+layer_note1 60, 45, 113
+layer_note1 44, 27, 58
+layer_note1 20, 67, 95
+layer_note1 46, 83, 112
+layer_note1 60, 8, 43
+layer_note1 57, 27, 75
+layer_note1 57, 71, 116
+layer_note1 44, 36, 83
+layer_note1 43, 79, 114
+layer_delay 42
+layer_jump .layer7_1
+
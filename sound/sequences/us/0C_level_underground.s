@@ -0,0 +1,399 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 151
+seq_initchannels 0x7f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+seq_startchannel 6, .channel6
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 115
+chan_setreverb 32
+chan_setvol 84
+chan_setlayer 0, .layer0_0
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 59, 29, 52
+layer_note1 29, 17, 108
+layer_note1 60, 11, 116
+layer_note1 48, 89, 118
+layer_note1 59, 7, 107
+layer_delay 8
+layer_note1 35, 82, 43
+layer_note1 40, 62, 115
+layer_note1 53, 35, 121
+layer_note1 20, 90, 50
+layer_note1 37, 58, 110
+layer_note1 25, 96, 72
+layer_note1 34, 71, 76
+layer_delay 42
+layer_note1 45, 19, 77
+layer_note1 21, 93, 40
+layer_note1 23, 66, 88
+layer_note1 45, 59, 49
+layer_note1 32, 92, 74
+layer_note1 39, 48, 41
+layer_note1 27, 23, 71
+layer_note1 20, 13, 99
+layer_note1 31, 93, 111
+layer_note1 52, 30, 56
+layer_jump .layer0_0
+
+.channel1:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 98
+chan_setreverb 7
+chan_setvol 110
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_delay 43
+layer_note1 21, 32, 63
+layer_note1 58, 88, 113
+layer_delay 15
+layer_note1 36, 7, 118
+layer_note1 38, 55, 49
+layer_delay 19
+layer_note1 35, 7, 116
+layer_note1 59, 64, 56
+layer_note1 50, 79, 57
+layer_note1 31, 86, 59
+layer_note1 34, 84, 71
+layer_note1 30, 86, 110
+layer_note1 44, 67, 117
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 26, 19, 44
+layer_note1 36, 36, 90
+layer_note1 58, 68, 77
+layer_note1 24, 22, 69
+layer_note1 59, 84, 49
+layer_note1 33, 8, 48
+layer_note1 48, 37, 47
+layer_delay 24
+layer_note1 56, 22, 51
+layer_note1 48, 48, 124
+layer_jump .layer1_1
+
+.channel2:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 8
+chan_setreverb 59
+chan_setvol 62
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 22, 8, 116
+layer_note1 50, 14, 79
+layer_note1 24, 15, 97
+layer_note1 22, 96, 56
+layer_note1 41, 51, 50
+layer_note1 24, 59, 43
+layer_note1 56, 7, 119
+layer_note1 44, 80, 41
+layer_note1 25, 17, 121
+layer_delay 22
+layer_note1 41, 55, 114
+layer_note1 49, 75, 50
+layer_note1 52, 9, 79
+layer_note1 50, 8, 69
+layer_note1 27, 69, 118
+layer_note1 51, 38, 41
+layer_note1 29, 92, 118
+layer_note1 30, 49, 124
+layer_note1 51, 36, 81
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 32, 87, 95
+layer_note1 32, 33, 89
+layer_note1 40, 32, 57
+layer_delay 28
+layer_note1 22, 14, 75
+layer_note1 27, 63, 100
+layer_note1 33, 58, 88
+layer_note1 51, 92, 80
+layer_note1 59, 63, 81
+layer_delay 8
+layer_note1 58, 11, 126
+layer_note1 56, 51, 79
+layer_note1 56, 8, 122
+layer_delay 35
+layer_note1 37, 36, 58
+layer_note1 60, 20, 97
+layer_delay 40
+layer_note1 43, 15, 127
+layer_note1 50, 38, 62
+layer_note1 50, 74, 44
+layer_jump .layer2_1
+
+.channel3:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 57
+chan_setreverb 17
+chan_setvol 104
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+chan_setlayer 2, .layer3_2
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 30, 56, 68
+layer_delay 30
+layer_delay 35
+layer_note1 20, 54, 110
+layer_note1 52, 49, 99
+layer_note1 33, 18, 122
+layer_note1 27, 33, 71
+layer_note1 25, 45, 108
+layer_note1 40, 39, 42
+layer_note1 25, 10, 96
+layer_note1 46, 41, 102
+layer_note1 33, 14, 94
+layer_note1 31, 74, 82
+layer_note1 28, 66, 59
+layer_note1 53, 92, 96
+layer_note1 51, 80, 51
+layer_note1 48, 73, 111
+layer_note1 55, 87, 61
+layer_note1 55, 38, 79
+layer_note1 59, 32, 78
+layer_note1 54, 73, 74
+layer_note1 32, 58, 108
+layer_delay 6
+layer_note1 21, 74, 45
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 54, 78, 55
+layer_note1 30, 14, 108
+layer_note1 45, 40, 71
+layer_note1 28, 49, 95
+layer_note1 50, 73, 80
+layer_delay 32
+layer_note1 36, 22, 42
+layer_delay 15
+layer_note1 38, 47, 85
+layer_note1 51, 19, 103
+layer_note1 27, 71, 119
+layer_note1 32, 95, 107
+layer_note1 21, 54, 121
+layer_note1 53, 84, 60
+layer_note1 60, 74, 121
+layer_note1 33, 75, 118
+layer_note1 28, 35, 120
+layer_note1 31, 46, 117
+layer_note1 32, 33, 64
+layer_note1 28, 36, 56
+layer_note1 36, 55, 52
+layer_note1 46, 75, 56
+layer_note1 60, 93, 42
+layer_delay 42
+layer_jump .layer3_1
+
+.layer3_2:
+layer_note1 43, 20, 104
+layer_note1 41, 70, 127
+layer_note1 24, 67, 53
+layer_delay 41
+layer_note1 56, 67, 58
+layer_note1 27, 32, 62
+layer_note1 38, 92, 52
+layer_note1 28, 93, 99
+layer_delay 12
+layer_note1 49, 60, 105
+layer_note1 33, 82, 87
+layer_delay 8
+layer_note1 31, 58, 98
+layer_note1 43, 57, 64
+layer_note1 26, 71, 41
+layer_note1 25, 96, 120
+layer_note1 56, 82, 64
+layer_note1 41, 39, 75
+layer_note1 30, 57, 57
+layer_jump .layer3_2
+
+.channel4:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 94
+chan_setreverb 49
+chan_setvol 115
+chan_setlayer 0, .layer4_0
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 31, 15, 83
+layer_note1 26, 7, 85
+layer_note1 59, 12, 69
+layer_note1 39, 49, 67
+layer_note1 56, 29, 108
+layer_delay 38
+layer_note1 33, 95, 55
+layer_note1 56, 8, 54
+layer_note1 35, 38, 96
+layer_note1 23, 31, 122
+layer_note1 26, 39, 72
+layer_note1 41, 76, 109
+layer_note1 53, 78, 52
+layer_note1 24, 76, 116
+layer_note1 22, 55, 60
+layer_note1 30, 69, 109
+layer_note1 23, 60, 103
+layer_note1 53, 57, 116
+layer_note1 53, 42, 101
+layer_note1 55, 42, 124
+layer_jump .layer4_0
+
+.channel5:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 6
+chan_setreverb 0
+chan_setvol 91
+chan_setlayer 0, .layer5_0
+chan_setlayer 1, .layer5_1
+chan_setlayer 2, .layer5_2
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_note1 46, 93, 89
+layer_delay 26
+layer_note1 23, 80, 80
+layer_delay 20
+layer_note1 50, 38, 71
+layer_delay 12
+layer_note1 49, 24, 71
+layer_note1 27, 12, 119
+layer_note1 27, 32, 46
+layer_jump .layer5_0
+
+.layer5_1:
+layer_note1 27, 52, 96
+layer_delay 32
+layer_note1 36, 87, 114
+layer_note1 43, 73, 57
+layer_note1 28, 36, 101
+layer_delay 25
+layer_note1 59, 51, 75
+layer_note1 56, 95, 115
+layer_note1 37, 36, 64
+layer_note1 52, 89, 65
+layer_note1 22, 86, 47
+layer_delay 22
+layer_note1 59, 10, 53
+layer_note1 37, 15, 51
+layer_note1 30, 76, 70
+layer_note1 43, 67, 101
+layer_note1 41, 49, 103
+layer_note1 24, 21, 97
+layer_note1 59, 33, 96
+layer_jump .layer5_1
+
+.layer5_2:
+layer_note1 44, 25, 87
+layer_note1 58, 47, 77
+layer_note1 31, 60, 123
+layer_note1 26, 65, 81
+layer_delay 11
+layer_note1 56, 68, 127
+layer_note1 20, 15, 79
+layer_note1 58, 16, 78
+layer_note1 40, 42, 58
+layer_note1 40, 52, 55
+layer_note1 48, 78, 116
+layer_note1 37, 62, 107
+layer_note1 39, 64, 80
+layer_note1 53, 37, 50
+layer_note1 43, 9, 86
+layer_note1 57, 55, 64
+layer_note1 43, 55, 109
+layer_note1 57, 78, 62
+layer_note1 49, 42, 42
+layer_note1 23, 75, 60
+layer_note1 21, 89, 94
+layer_jump .layer5_2
+
+.channel6:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 78
+chan_setreverb 50
+chan_setvol 70
+chan_setlayer 0, .layer6_0
+chan_setlayer 1, .layer6_1
+.chan_loop6:
+chan_delay 0x7fff
+chan_jump .chan_loop6
+
+.layer6_0:
+layer_note1 26, 46, 50
+layer_delay 47
+layer_delay 47
+layer_note1 34, 68, 106
+layer_note1 49, 56, 84
+layer_note1 41, 92, 57
+layer_note1 54, 15, 119
+layer_note1 46, 91, 84
+layer_note1 44, 17, 99
+layer_note1 60, 9, 107
+layer_jump .layer6_0
+
+.layer6_1:
+layer_note1 27, 59, 93
+layer_note1 35, 26, 121
+layer_note1 30, 47, 66
+layer_note1 53, 43, 75
+layer_note1 23, 66, 79
+layer_note1 39, 88, 59
+layer_note1 31, 13, 98
+layer_delay 36
+layer_note1 22, 46, 53
+layer_note1 42, 33, 115
+layer_note1 50, 82, 105
+layer_note1 31, 41, 91
+layer_note1 39, 86, 110
+layer_note1 55, 67, 73
+layer_note1 45, 49, 124
+layer_note1 25, 67, 68
+layer_note1 33, 23, 89
+layer_note1 53, 41, 47
+layer_note1 35, 7, 100
+layer_jump .layer6_1
+
@@ -0,0 +1,394 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 114
+seq_initchannels 0x7f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+seq_startchannel 6, .channel6
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 36
+chan_setreverb 24
+chan_setvol 61
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 49, 94, 116
+layer_note1 20, 90, 119
+layer_delay 34
+layer_note1 41, 32, 47
+layer_note1 32, 15, 105
+layer_note1 41, 93, 91
+layer_note1 25, 8, 47
+layer_note1 52, 34, 51
+layer_note1 47, 62, 54
+layer_note1 28, 75, 80
+layer_note1 55, 26, 46
+layer_note1 52, 16, 91
+layer_note1 58, 66, 101
+layer_note1 54, 9, 122
+layer_note1 32, 90, 73
+layer_note1 43, 94, 89
+layer_note1 27, 38, 70
+layer_note1 43, 71, 113
+layer_note1 52, 28, 43
+layer_note1 47, 10, 106
+layer_delay 33
+layer_delay 19
+layer_note1 26, 76, 68
+layer_jump .layer0_0
+
+.layer0_1:
+layer_delay 23
+layer_delay 23
+layer_note1 58, 87, 46
+layer_note1 43, 32, 83
+layer_note1 50, 95, 101
+layer_note1 30, 65, 110
+layer_note1 32, 34, 117
+layer_delay 23
+layer_note1 41, 28, 70
+layer_note1 52, 11, 71
+layer_note1 43, 75, 104
+layer_note1 40, 91, 75
+layer_note1 34, 73, 104
+layer_jump .layer0_1
+
+.channel1:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 125
+chan_setreverb 40
+chan_setvol 105
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 30, 63, 77
+layer_note1 22, 41, 82
+layer_note1 52, 87, 96
+layer_note1 33, 42, 106
+layer_note1 20, 94, 43
+layer_delay 23
+layer_note1 35, 31, 95
+layer_note1 23, 77, 112
+layer_note1 36, 11, 93
+layer_note1 25, 57, 65
+layer_note1 42, 53, 121
+layer_note1 56, 26, 42
+layer_note1 29, 9, 44
+layer_note1 46, 74, 65
+layer_note1 44, 18, 85
+layer_note1 37, 94, 127
+layer_note1 59, 84, 55
+layer_note1 58, 95, 126
+layer_note1 35, 15, 92
+layer_note1 25, 93, 82
+layer_delay 11
+layer_note1 39, 95, 63
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 21, 32, 102
+layer_note1 51, 28, 47
+layer_note1 41, 64, 70
+layer_note1 26, 34, 40
+layer_note1 43, 41, 65
+layer_note1 38, 34, 106
+layer_note1 52, 95, 82
+layer_note1 49, 55, 117
+layer_note1 35, 64, 98
+layer_note1 23, 35, 92
+layer_note1 45, 72, 126
+layer_note1 23, 19, 110
+layer_note1 39, 50, 42
+layer_note1 51, 52, 120
+layer_note1 28, 67, 68
+layer_note1 28, 38, 103
+layer_delay 29
+layer_note1 60, 82, 76
+layer_note1 58, 47, 58
+layer_delay 47
+layer_delay 48
+layer_jump .layer1_1
+
+.channel2:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 105
+chan_setreverb 27
+chan_setvol 93
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 51, 55, 91
+layer_note1 31, 27, 66
+layer_note1 27, 40, 106
+layer_note1 42, 45, 57
+layer_note1 39, 33, 43
+layer_note1 22, 7, 61
+layer_note1 32, 43, 64
+layer_note1 39, 75, 42
+layer_note1 26, 52, 127
+layer_note1 32, 63, 52
+layer_note1 28, 56, 104
+layer_note1 38, 65, 85
+layer_note1 44, 59, 106
+layer_delay 23
+layer_delay 15
+layer_note1 43, 94, 53
+layer_note1 47, 76, 91
+layer_note1 43, 15, 56
+layer_note1 34, 19, 94
+layer_delay 9
+layer_note1 35, 9, 54
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 57, 66, 120
+layer_note1 41, 60, 123
+layer_note1 40, 36, 90
+layer_delay 44
+layer_note1 23, 93, 86
+layer_delay 13
+layer_note1 58, 23, 125
+layer_note1 32, 35, 55
+layer_jump .layer2_1
+
+.channel3:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 111
+chan_setreverb 46
+chan_setvol 103
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 44, 68, 83
+layer_note1 59, 87, 108
+layer_note1 24, 35, 83
+layer_note1 59, 78, 56
+layer_note1 48, 41, 72
+layer_note1 26, 21, 115
+layer_note1 31, 52, 110
+layer_note1 59, 79, 75
+layer_note1 39, 53, 85
+layer_note1 41, 70, 116
+layer_note1 31, 85, 91
+layer_note1 40, 85, 86
+layer_note1 29, 43, 83
+layer_note1 45, 11, 106
+layer_note1 54, 15, 125
+layer_note1 36, 26, 102
+layer_note1 39, 27, 96
+layer_note1 24, 94, 69
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 60, 21, 121
+layer_note1 31, 67, 79
+layer_note1 50, 56, 96
+layer_note1 43, 40, 65
+layer_note1 53, 68, 104
+layer_note1 59, 49, 85
+layer_note1 28, 9, 49
+layer_note1 38, 55, 126
+layer_note1 50, 25, 106
+layer_note1 40, 28, 73
+layer_note1 23, 24, 46
+layer_note1 53, 45, 71
+layer_note1 27, 76, 88
+layer_note1 39, 82, 51
+layer_jump .layer3_1
+
+.channel4:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 37
+chan_setreverb 53
+chan_setvol 89
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 53, 52, 64
+layer_delay 19
+layer_note1 55, 19, 70
+layer_note1 54, 75, 96
+layer_delay 45
+layer_note1 56, 88, 47
+layer_note1 21, 69, 89
+layer_note1 45, 16, 49
+layer_note1 53, 64, 111
+layer_note1 55, 57, 109
+layer_delay 38
+layer_note1 29, 9, 82
+layer_note1 53, 92, 119
+layer_note1 39, 34, 78
+layer_note1 52, 56, 107
+layer_delay 8
+layer_note1 43, 94, 76
+layer_note1 27, 11, 54
+layer_note1 29, 14, 117
+layer_note1 52, 74, 61
+layer_note1 42, 34, 91
+layer_delay 15
+layer_note1 56, 64, 81
+layer_note1 36, 7, 76
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 47, 32, 61
+layer_note1 59, 51, 85
+layer_note1 59, 68, 87
+layer_note1 40, 11, 112
+layer_note1 53, 85, 111
+layer_note1 39, 85, 111
+layer_note1 23, 46, 70
+layer_note1 33, 21, 51
+layer_note1 24, 84, 62
+layer_note1 41, 40, 45
+layer_note1 43, 46, 83
+layer_delay 26
+layer_note1 50, 32, 68
+layer_note1 26, 91, 101
+layer_note1 30, 71, 65
+layer_note1 49, 74, 89
+layer_note1 32, 92, 57
+layer_note1 30, 73, 100
+layer_note1 29, 20, 65
+layer_note1 33, 28, 72
+layer_note1 40, 66, 127
+layer_jump .layer4_1
+
+.channel5:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 23
+chan_setreverb 27
+chan_setvol 110
+chan_setlayer 0, .layer5_0
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_note1 56, 89, 62
+layer_note1 29, 16, 109
+layer_note1 40, 86, 115
+layer_note1 22, 35, 100
+layer_note1 51, 23, 60
+layer_note1 49, 83, 111
+layer_note1 29, 69, 58
+layer_note1 53, 76, 116
+layer_note1 60, 39, 72
+layer_delay 16
+layer_note1 54, 79, 125
+layer_delay 44
+layer_delay 39
+layer_jump .layer5_0
+
+.channel6:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 51
+chan_setreverb 40
+chan_setvol 115
+chan_setlayer 0, .layer6_0
+chan_setlayer 1, .layer6_1
+chan_setlayer 2, .layer6_2
+.chan_loop6:
+chan_delay 0x7fff
+chan_jump .chan_loop6
+
+.layer6_0:
+layer_note1 21, 7, 55
+layer_note1 29, 57, 78
+layer_note1 25, 62, 123
+layer_note1 54, 17, 105
+layer_note1 38, 14, 60
+layer_note1 21, 48, 41
+layer_note1 25, 7, 74
+layer_note1 43, 39, 78
+layer_note1 27, 90, 114
+layer_note1 58, 18, 95
+layer_note1 46, 53, 75
+layer_note1 26, 19, 81
+layer_note1 40, 38, 101
+layer_jump .layer6_0
+
+.layer6_1:
+layer_note1 27, 16, 91
+layer_delay 20
+layer_note1 51, 92, 108
+layer_note1 45, 95, 123
+layer_note1 24, 17, 60
+layer_note1 30, 94, 97
+layer_note1 39, 36, 46
+layer_delay 18
+layer_note1 45, 77, 80
+layer_note1 31, 23, 48
+layer_note1 25, 85, 82
+layer_note1 20, 46, 99
+layer_note1 24, 45, 83
+layer_note1 26, 49, 94
+layer_note1 32, 13, 93
+layer_delay 45
+layer_note1 34, 43, 53
+layer_delay 47
+layer_note1 29, 8, 87
+layer_note1 25, 53, 66
+layer_note1 47, 85, 55
+layer_delay 11
+layer_note1 55, 51, 101
+layer_jump .layer6_1
+
+.layer6_2:
+layer_delay 17
+layer_note1 41, 60, 52
+layer_note1 29, 45, 96
+layer_note1 23, 9, 100
+layer_delay 38
+layer_note1 40, 96, 41
+layer_note1 30, 75, 93
+layer_note1 24, 48, 55
+layer_delay 12
+layer_note1 23, 66, 122
+layer_note1 57, 45, 122
+layer_note1 51, 60, 114
+layer_note1 50, 57, 56
+layer_jump .layer6_2
+
@@ -0,0 +1,340 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 117
+seq_initchannels 0x3f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 59
+chan_setreverb 42
+chan_setvol 78
+chan_setlayer 0, .layer0_0
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_delay 40
+layer_note1 38, 9, 95
+layer_delay 44
+layer_note1 37, 24, 50
+layer_note1 36, 63, 95
+layer_note1 36, 51, 69
+layer_note1 55, 78, 94
+layer_note1 47, 87, 80
+layer_note1 42, 82, 121
+layer_note1 48, 76, 118
+layer_note1 28, 62, 126
+layer_note1 54, 28, 77
+layer_note1 53, 51, 72
+layer_jump .layer0_0
+
+.channel1:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 117
+chan_setreverb 16
+chan_setvol 95
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 55, 36, 112
+layer_note1 32, 95, 86
+layer_delay 33
+layer_note1 49, 55, 40
+layer_note1 22, 34, 58
+layer_note1 48, 87, 72
+layer_note1 46, 38, 84
+layer_note1 60, 53, 106
+layer_note1 28, 96, 117
+layer_note1 51, 33, 119
+layer_delay 43
+layer_delay 43
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 32, 27, 127
+layer_note1 34, 27, 48
+layer_note1 58, 77, 109
+layer_note1 48, 49, 122
+layer_delay 6
+layer_delay 25
+layer_delay 25
+layer_note1 56, 82, 49
+layer_note1 53, 52, 44
+layer_delay 27
+layer_note1 55, 74, 106
+layer_note1 34, 91, 66
+layer_note1 22, 54, 104
+layer_note1 30, 24, 73
+layer_note1 33, 39, 94
+layer_note1 42, 37, 115
+layer_note1 33, 88, 84
+layer_note1 40, 56, 98
+layer_jump .layer1_1
+
+.channel2:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 17
+chan_setreverb 48
+chan_setvol 65
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+chan_setlayer 2, .layer2_2
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 39, 30, 97
+layer_note1 55, 55, 82
+layer_delay 39
+layer_note1 28, 24, 46
+layer_delay 16
+layer_note1 39, 83, 89
+layer_note1 42, 22, 52
+layer_note1 48, 80, 114
+layer_jump .layer2_0
+
+.layer2_1:
+layer_delay 40
+layer_note1 23, 47, 61
+layer_note1 54, 22, 40
+layer_note1 29, 17, 101
+layer_note1 24, 50, 73
+layer_note1 33, 12, 70
+layer_note1 35, 72, 96
+layer_note1 45, 85, 46
+layer_note1 23, 20, 118
+layer_delay 40
+layer_note1 43, 74, 90
+layer_note1 54, 44, 73
+layer_delay 9
+layer_note1 30, 7, 53
+layer_note1 37, 17, 82
+layer_note1 47, 26, 119
+layer_note1 38, 11, 54
+layer_delay 31
+layer_note1 50, 55, 74
+layer_note1 29, 63, 78
+layer_delay 7
+layer_jump .layer2_1
+
+.layer2_2:
+layer_note1 34, 37, 87
+layer_note1 50, 58, 73
+layer_note1 57, 74, 99
+layer_note1 44, 66, 64
+layer_delay 8
+layer_note1 52, 28, 56
+layer_delay 43
+layer_delay 11
+layer_note1 51, 79, 106
+layer_note1 23, 33, 123
+layer_note1 21, 74, 42
+layer_note1 29, 44, 119
+layer_note1 23, 70, 94
+layer_note1 36, 34, 102
+layer_delay 12
+layer_note1 53, 70, 41
+layer_jump .layer2_2
+
+.channel3:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 87
+chan_setreverb 41
+chan_setvol 88
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+chan_setlayer 2, .layer3_2
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 47, 36, 105
+layer_note1 26, 53, 58
+layer_note1 42, 23, 127
+layer_note1 34, 91, 76
+layer_note1 36, 23, 56
+layer_note1 58, 19, 47
+layer_note1 29, 84, 105
+layer_delay 35
+layer_note1 44, 79, 113
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 52, 58, 48
+layer_note1 48, 73, 75
+layer_note1 27, 32, 127
+layer_note1 57, 15, 101
+layer_note1 39, 9, 97
+layer_note1 50, 78, 47
+layer_delay 19
+layer_delay 40
+layer_note1 39, 73, 66
+layer_note1 55, 43, 41
+layer_note1 25, 20, 123
+layer_delay 10
+layer_note1 60, 33, 80
+layer_note1 21, 26, 63
+layer_delay 20
+layer_note1 31, 90, 92
+layer_note1 51, 71, 59
+layer_delay 28
+layer_note1 53, 72, 62
+layer_delay 33
+layer_note1 39, 37, 73
+layer_note1 57, 76, 93
+layer_note1 37, 33, 52
+layer_jump .layer3_1
+
+.layer3_2:
+layer_note1 27, 38, 59
+layer_note1 34, 85, 79
+layer_delay 37
+layer_note1 26, 11, 113
+layer_note1 28, 96, 101
+layer_note1 41, 52, 55
+layer_delay 37
+layer_delay 12
+layer_note1 37, 63, 41
+layer_note1 28, 96, 40
+layer_jump .layer3_2
+
+.channel4:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 62
+chan_setreverb 22
+chan_setvol 79
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_delay 29
+layer_note1 42, 30, 53
+layer_delay 16
+layer_note1 60, 60, 47
+layer_note1 58, 61, 55
+layer_note1 55, 32, 59
+layer_note1 44, 8, 90
+layer_note1 41, 60, 91
+layer_note1 55, 37, 91
+layer_note1 58, 77, 46
+layer_note1 48, 19, 108
+layer_note1 52, 63, 58
+layer_note1 55, 11, 111
+layer_note1 21, 36, 95
+layer_delay 23
+layer_note1 22, 50, 64
+layer_note1 49, 57, 118
+layer_note1 33, 61, 112
+layer_note1 45, 57, 68
+layer_note1 32, 78, 94
+layer_note1 22, 95, 42
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 59, 56, 91
+layer_note1 52, 22, 98
+layer_delay 37
+layer_note1 48, 16, 108
+layer_note1 52, 7, 47
+layer_note1 51, 87, 62
+layer_note1 27, 9, 93
+layer_note1 55, 32, 99
+layer_note1 46, 11, 65
+layer_note1 51, 73, 59
+layer_delay 7
+layer_note1 24, 43, 61
+layer_note1 32, 91, 103
+layer_delay 21
+layer_delay 13
+layer_delay 44
+layer_delay 39
+layer_note1 32, 78, 47
+layer_note1 44, 85, 66
+layer_note1 48, 92, 82
+layer_delay 46
+layer_note1 31, 23, 70
+layer_jump .layer4_1
+
+.channel5:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 109
+chan_setreverb 32
+chan_setvol 81
+chan_setlayer 0, .layer5_0
+chan_setlayer 1, .layer5_1
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_note1 39, 42, 97
+layer_note1 20, 19, 96
+layer_note1 31, 39, 42
+layer_note1 49, 33, 111
+layer_note1 54, 96, 117
+layer_note1 57, 22, 94
+layer_note1 48, 8, 91
+layer_note1 28, 10, 82
+layer_note1 24, 15, 54
+layer_note1 25, 85, 125
+layer_note1 31, 78, 102
+layer_note1 49, 79, 40
+layer_note1 21, 85, 83
+layer_note1 42, 16, 92
+layer_note1 25, 82, 66
+layer_note1 29, 21, 113
+layer_note1 44, 80, 77
+layer_note1 38, 91, 93
+layer_note1 51, 30, 53
+layer_note1 44, 44, 45
+layer_delay 34
+layer_jump .layer5_0
+
+.layer5_1:
+layer_note1 23, 60, 106
+layer_delay 45
+layer_note1 27, 83, 118
+layer_note1 40, 7, 78
+layer_note1 21, 89, 61
+layer_note1 22, 43, 95
+layer_delay 33
+layer_delay 33
+layer_delay 15
+layer_note1 43, 92, 89
+layer_note1 52, 67, 66
+layer_delay 26
+layer_note1 23, 37, 68
+layer_note1 58, 57, 106
+layer_jump .layer5_1
+
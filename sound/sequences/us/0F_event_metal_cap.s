@@ -0,0 +1,180 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 158
+seq_initchannels 0xf
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 69
+chan_setreverb 47
+chan_setvol 92
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 39, 65, 127
+layer_note1 45, 21, 73
+layer_note1 40, 51, 73
+layer_note1 60, 86, 106
+layer_delay 41
+layer_note1 37, 27, 41
+layer_note1 27, 82, 83
+layer_delay 23
+layer_note1 44, 57, 114
+layer_note1 48, 83, 52
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 60, 87, 86
+layer_note1 26, 68, 105
+layer_note1 37, 63, 119
+layer_note1 38, 70, 72
+layer_delay 11
+layer_note1 27, 9, 60
+layer_note1 27, 93, 107
+layer_note1 47, 67, 127
+layer_note1 44, 64, 79
+layer_note1 47, 59, 116
+layer_note1 36, 66, 90
+layer_jump .layer0_1
+
+.channel1:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 115
+chan_setreverb 55
+chan_setvol 122
+chan_setlayer 0, .layer1_0
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 37, 79, 96
+layer_delay 31
+layer_note1 47, 8, 84
+layer_note1 43, 66, 73
+layer_note1 53, 30, 45
+layer_note1 50, 38, 52
+layer_note1 22, 30, 79
+layer_delay 6
+layer_note1 38, 72, 85
+layer_note1 27, 10, 58
+layer_note1 20, 35, 72
+layer_note1 36, 29, 71
+layer_jump .layer1_0
+
+.channel2:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 84
+chan_setreverb 18
+chan_setvol 107
+chan_setlayer 0, .layer2_0
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 32, 52, 102
+layer_note1 44, 75, 110
+layer_note1 40, 68, 118
+layer_delay 47
+layer_note1 50, 49, 51
+layer_note1 26, 22, 65
+layer_delay 15
+layer_note1 51, 63, 56
+layer_note1 44, 12, 53
+layer_note1 43, 75, 94
+layer_note1 48, 34, 51
+layer_delay 17
+layer_delay 48
+layer_jump .layer2_0
+
+.channel3:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 90
+chan_setreverb 59
+chan_setvol 65
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+chan_setlayer 2, .layer3_2
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 50, 47, 49
+layer_note1 23, 93, 122
+layer_note1 54, 18, 48
+layer_note1 27, 12, 122
+layer_note1 24, 6, 126
+layer_note1 28, 54, 115
+layer_delay 34
+layer_note1 51, 73, 42
+layer_note1 37, 37, 76
+layer_note1 52, 6, 110
+layer_note1 35, 6, 85
+layer_note1 27, 56, 88
+layer_note1 42, 48, 43
+layer_note1 38, 78, 79
+layer_note1 53, 80, 96
+layer_delay 47
+layer_delay 34
+layer_note1 44, 82, 94
+layer_note1 46, 31, 43
+layer_note1 50, 37, 89
+layer_note1 27, 34, 70
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 24, 37, 51
+layer_note1 55, 12, 43
+layer_note1 58, 89, 76
+layer_note1 47, 64, 68
+layer_note1 24, 86, 49
+layer_note1 31, 53, 98
+layer_note1 44, 19, 117
+layer_note1 33, 93, 84
+layer_note1 54, 45, 46
+layer_note1 60, 64, 57
+layer_note1 37, 66, 79
+layer_note1 29, 13, 106
+layer_delay 25
+layer_note1 60, 43, 87
+layer_jump .layer3_1
+
+.layer3_2:
+layer_delay 7
+layer_note1 24, 22, 115
+layer_note1 39, 57, 115
+layer_note1 58, 50, 62
+layer_note1 55, 87, 85
+layer_note1 53, 61, 54
+layer_delay 25
+layer_note1 37, 27, 78
+layer_note1 32, 20, 105
+layer_note1 34, 55, 76
+layer_note1 27, 55, 54
+layer_note1 58, 15, 109
+layer_note1 35, 13, 115
+layer_jump .layer3_2
+
@@ -0,0 +1,315 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 81
+seq_initchannels 0x1f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 40
+chan_setreverb 58
+chan_setvol 90
+chan_setlayer 0, .layer0_0
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 29, 94, 87
+layer_note1 41, 65, 85
+layer_note1 36, 50, 69
+layer_note1 33, 51, 80
+layer_note1 52, 59, 69
+layer_note1 46, 68, 50
+layer_note1 43, 62, 112
+layer_note1 48, 57, 48
+layer_note1 21, 31, 57
+layer_jump .layer0_0
+
+.channel1:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 4
+chan_setreverb 18
+chan_setvol 127
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 26, 20, 90
+layer_delay 35
+layer_note1 55, 43, 91
+layer_note1 34, 28, 109
+layer_note1 42, 16, 70
+layer_note1 30, 86, 80
+layer_note1 50, 49, 96
+layer_note1 37, 66, 58
+layer_delay 37
+layer_note1 20, 39, 51
+layer_note1 22, 63, 47
+layer_note1 30, 69, 112
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 51, 11, 104
+layer_delay 11
+layer_note1 49, 35, 115
+layer_note1 36, 92, 50
+layer_note1 23, 48, 123
+layer_note1 47, 50, 47
+layer_note1 39, 82, 97
+layer_note1 21, 61, 89
+layer_delay 48
+layer_note1 59, 55, 106
+layer_delay 22
+layer_note1 52, 48, 81
+layer_note1 57, 46, 102
+layer_note1 58, 51, 68
+layer_note1 23, 28, 122
+layer_note1 26, 79, 91
+layer_note1 28, 48, 52
+layer_note1 49, 84, 110
+layer_note1 56, 21, 90
+layer_note1 57, 6, 52
+layer_note1 29, 96, 123
+layer_note1 30, 89, 65
+layer_note1 55, 85, 81
+layer_jump .layer1_1
+
+.channel2:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 103
+chan_setreverb 14
+chan_setvol 126
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+chan_setlayer 2, .layer2_2
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 49, 81, 60
+layer_note1 41, 64, 117
+layer_note1 46, 9, 74
+layer_note1 37, 51, 63
+layer_delay 43
+layer_note1 26, 14, 122
+layer_note1 24, 62, 108
+layer_note1 34, 47, 60
+layer_note1 23, 53, 93
+layer_note1 30, 53, 112
+layer_delay 17
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 49, 65, 116
+layer_note1 24, 60, 75
+layer_note1 35, 91, 43
+layer_note1 45, 89, 61
+layer_delay 43
+layer_note1 59, 92, 98
+layer_note1 41, 63, 99
+layer_note1 36, 55, 98
+layer_note1 45, 95, 121
+layer_note1 27, 27, 125
+layer_note1 48, 67, 82
+layer_note1 56, 65, 106
+layer_delay 20
+layer_note1 55, 70, 91
+layer_note1 45, 93, 82
+layer_note1 48, 38, 62
+layer_note1 37, 59, 55
+layer_note1 34, 40, 60
+layer_note1 38, 25, 97
+layer_note1 35, 25, 101
+layer_note1 27, 89, 71
+layer_note1 45, 60, 68
+layer_note1 46, 95, 122
+layer_jump .layer2_1
+
+.layer2_2:
+layer_note1 45, 66, 68
+layer_note1 44, 51, 83
+layer_note1 41, 18, 56
+layer_note1 34, 79, 124
+layer_note1 31, 94, 107
+layer_note1 36, 33, 70
+layer_note1 51, 29, 70
+layer_note1 51, 53, 60
+layer_note1 33, 77, 108
+layer_note1 60, 48, 119
+layer_delay 44
+layer_delay 9
+layer_note1 42, 56, 82
+layer_note1 57, 87, 115
+layer_note1 40, 52, 93
+layer_note1 60, 54, 41
+layer_note1 50, 78, 121
+layer_note1 24, 91, 61
+layer_note1 27, 13, 119
+layer_delay 46
+layer_note1 58, 74, 95
+layer_note1 32, 74, 84
+layer_note1 25, 23, 46
+layer_jump .layer2_2
+
+.channel3:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 66
+chan_setreverb 56
+chan_setvol 126
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+chan_setlayer 2, .layer3_2
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 21, 24, 40
+layer_note1 50, 34, 58
+layer_note1 52, 85, 89
+layer_note1 34, 60, 82
+layer_note1 51, 12, 55
+layer_note1 54, 29, 90
+layer_note1 56, 42, 80
+layer_note1 60, 19, 74
+layer_note1 53, 7, 71
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 45, 42, 120
+layer_delay 39
+layer_note1 34, 91, 46
+layer_note1 59, 50, 61
+layer_note1 32, 20, 53
+layer_note1 31, 36, 56
+layer_note1 38, 61, 57
+layer_note1 35, 95, 42
+layer_delay 47
+layer_note1 22, 53, 94
+layer_delay 27
+layer_note1 43, 77, 47
+layer_note1 49, 13, 102
+layer_note1 58, 83, 61
+layer_note1 45, 94, 86
+layer_note1 57, 56, 126
+layer_jump .layer3_1
+
+.layer3_2:
+layer_note1 29, 41, 127
+layer_note1 35, 84, 55
+layer_delay 19
+layer_note1 33, 46, 49
+layer_note1 33, 11, 88
+layer_note1 47, 76, 93
+layer_delay 47
+layer_delay 6
+layer_delay 12
+layer_note1 50, 46, 63
+layer_note1 49, 75, 45
+layer_note1 26, 55, 59
+layer_note1 21, 22, 103
+layer_note1 55, 45, 81
+layer_note1 59, 70, 71
+layer_note1 29, 45, 88
+layer_note1 51, 86, 94
+layer_note1 31, 45, 96
+layer_note1 34, 6, 87
+layer_jump .layer3_2
+
+.channel4:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 58
+chan_setreverb 25
+chan_setvol 107
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+chan_setlayer 2, .layer4_2
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_delay 18
+layer_note1 24, 52, 44
+layer_note1 52, 35, 127
+layer_note1 39, 8, 41
+layer_note1 29, 23, 47
+layer_note1 59, 46, 65
+layer_note1 25, 93, 74
+layer_note1 60, 25, 106
+layer_delay 20
+layer_note1 21, 28, 53
+layer_note1 33, 30, 94
+layer_note1 28, 71, 70
+layer_delay 6
+layer_note1 57, 70, 46
+layer_delay 6
+layer_note1 29, 17, 111
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 28, 74, 66
+layer_note1 26, 55, 60
+layer_note1 23, 73, 113
+layer_note1 35, 41, 114
+layer_note1 56, 88, 64
+layer_note1 30, 70, 46
+layer_note1 23, 59, 54
+layer_note1 44, 76, 114
+layer_note1 58, 69, 49
+layer_note1 49, 36, 100
+layer_note1 34, 54, 57
+layer_note1 56, 21, 78
+layer_note1 54, 95, 70
+layer_note1 43, 69, 84
+layer_note1 54, 67, 116
+layer_note1 48, 31, 67
+layer_note1 59, 62, 85
+layer_note1 56, 48, 49
+layer_jump .layer4_1
+
+.layer4_2:
+layer_note1 49, 39, 117
+layer_note1 58, 65, 106
+layer_note1 28, 9, 91
+layer_note1 22, 62, 68
+layer_note1 55, 87, 101
+layer_note1 47, 30, 98
+layer_note1 35, 16, 58
+layer_note1 33, 85, 80
+layer_note1 45, 11, 62
+layer_note1 50, 19, 100
+layer_note1 40, 89, 62
+layer_note1 21, 88, 41
+layer_note1 37, 58, 70
+layer_note1 30, 90, 111
+layer_note1 60, 94, 108
+layer_delay 17
+layer_note1 46, 24, 53
+layer_note1 21, 54, 80
+layer_note1 35, 8, 41
+layer_jump .layer4_2
+
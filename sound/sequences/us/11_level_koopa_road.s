@@ -0,0 +1,300 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 140
+seq_initchannels 0x3f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 72
+chan_setreverb 26
+chan_setvol 89
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 36, 36, 121
+layer_note1 38, 44, 82
+layer_note1 58, 45, 42
+layer_note1 58, 38, 42
+layer_note1 58, 91, 120
+layer_delay 35
+layer_note1 38, 34, 79
+layer_note1 46, 17, 84
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 31, 78, 77
+layer_note1 38, 16, 40
+layer_note1 35, 68, 59
+layer_note1 40, 64, 98
+layer_delay 36
+layer_note1 20, 62, 102
+layer_delay 36
+layer_note1 27, 64, 118
+layer_delay 47
+layer_delay 15
+layer_note1 45, 53, 44
+layer_note1 45, 83, 80
+layer_note1 24, 35, 80
+layer_delay 11
+layer_note1 35, 7, 90
+layer_note1 27, 93, 46
+layer_note1 45, 25, 121
+layer_note1 35, 28, 114
+layer_delay 39
+layer_note1 27, 19, 122
+layer_delay 30
+layer_note1 45, 65, 99
+layer_note1 22, 13, 43
+layer_jump .layer0_1
+
+.channel1:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 109
+chan_setreverb 42
+chan_setvol 92
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+chan_setlayer 2, .layer1_2
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_delay 19
+layer_delay 46
+layer_delay 13
+layer_note1 29, 57, 70
+layer_delay 14
+layer_note1 47, 70, 68
+layer_note1 43, 91, 103
+layer_note1 46, 32, 124
+layer_note1 21, 68, 78
+layer_note1 27, 15, 79
+layer_note1 35, 74, 122
+layer_note1 57, 62, 104
+layer_delay 41
+layer_delay 46
+layer_note1 26, 90, 80
+layer_delay 11
+layer_note1 23, 71, 82
+layer_note1 26, 52, 91
+layer_note1 24, 34, 64
+layer_note1 20, 86, 40
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 58, 85, 66
+layer_delay 46
+layer_delay 46
+layer_delay 48
+layer_note1 34, 32, 104
+layer_note1 60, 75, 124
+layer_note1 37, 71, 43
+layer_note1 52, 33, 100
+layer_note1 42, 23, 98
+layer_note1 31, 19, 64
+layer_delay 29
+layer_note1 26, 25, 44
+layer_note1 59, 94, 55
+layer_note1 34, 50, 66
+layer_note1 25, 29, 51
+layer_jump .layer1_1
+
+.layer1_2:
+layer_delay 8
+layer_note1 29, 92, 60
+layer_note1 46, 11, 85
+layer_delay 31
+layer_note1 27, 84, 89
+layer_note1 42, 62, 87
+layer_note1 42, 30, 50
+layer_note1 44, 58, 47
+layer_note1 46, 91, 110
+layer_note1 53, 57, 84
+layer_delay 15
+layer_note1 40, 27, 91
+layer_delay 8
+layer_note1 60, 63, 123
+layer_note1 29, 6, 61
+layer_note1 32, 91, 114
+layer_note1 57, 58, 43
+layer_delay 39
+layer_note1 20, 22, 80
+layer_note1 25, 81, 108
+layer_note1 29, 82, 94
+layer_note1 56, 84, 92
+layer_jump .layer1_2
+
+.channel2:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 37
+chan_setreverb 39
+chan_setvol 65
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 48, 46, 49
+layer_note1 60, 39, 88
+layer_note1 56, 67, 42
+layer_delay 27
+layer_note1 45, 40, 97
+layer_note1 33, 40, 41
+layer_note1 20, 31, 50
+layer_note1 29, 81, 68
+layer_note1 46, 79, 53
+layer_note1 37, 7, 80
+layer_note1 43, 59, 115
+layer_note1 33, 26, 123
+layer_note1 53, 11, 108
+layer_delay 6
+layer_note1 55, 18, 74
+layer_note1 27, 69, 103
+layer_jump .layer2_0
+
+.layer2_1:
+layer_delay 10
+layer_note1 46, 21, 82
+layer_note1 50, 54, 70
+layer_note1 39, 26, 68
+layer_note1 31, 55, 85
+layer_note1 29, 9, 122
+layer_note1 29, 87, 92
+layer_delay 22
+layer_note1 38, 60, 83
+layer_note1 40, 56, 65
+layer_note1 49, 9, 108
+layer_note1 42, 8, 96
+layer_note1 46, 71, 92
+layer_note1 25, 73, 58
+layer_note1 54, 37, 42
+layer_note1 30, 39, 68
+layer_note1 22, 69, 56
+layer_note1 35, 46, 100
+layer_note1 60, 53, 82
+layer_jump .layer2_1
+
+.channel3:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 74
+chan_setreverb 26
+chan_setvol 61
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 33, 86, 122
+layer_note1 29, 6, 67
+layer_note1 58, 82, 124
+layer_delay 43
+layer_delay 38
+layer_note1 35, 57, 75
+layer_delay 9
+layer_note1 39, 46, 82
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 53, 42, 58
+layer_note1 40, 50, 55
+layer_note1 51, 12, 78
+layer_note1 35, 40, 90
+layer_note1 38, 71, 47
+layer_note1 44, 7, 67
+layer_note1 40, 49, 86
+layer_note1 39, 37, 117
+layer_note1 32, 84, 117
+layer_note1 25, 81, 56
+layer_note1 47, 76, 63
+layer_note1 55, 85, 56
+layer_note1 30, 33, 116
+layer_note1 35, 32, 58
+layer_note1 38, 10, 52
+layer_jump .layer3_1
+
+.channel4:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 95
+chan_setreverb 53
+chan_setvol 97
+chan_setlayer 0, .layer4_0
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 20, 17, 124
+layer_note1 30, 24, 44
+layer_note1 43, 45, 69
+layer_note1 31, 49, 84
+layer_note1 45, 81, 93
+layer_note1 35, 74, 78
+layer_note1 29, 50, 53
+layer_note1 44, 68, 85
+layer_delay 21
+layer_jump .layer4_0
+
+.channel5:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 111
+chan_setreverb 36
+chan_setvol 83
+chan_setlayer 0, .layer5_0
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_note1 24, 83, 88
+layer_note1 26, 7, 106
+layer_note1 49, 90, 80
+layer_note1 49, 14, 116
+layer_note1 31, 42, 50
+layer_delay 29
+layer_note1 59, 71, 75
+layer_note1 33, 61, 53
+layer_note1 47, 36, 127
+layer_note1 24, 60, 98
+layer_note1 52, 53, 75
+layer_note1 40, 62, 105
+layer_delay 21
+layer_note1 20, 37, 51
+layer_note1 48, 44, 107
+layer_note1 43, 91, 118
+layer_note1 25, 55, 83
+layer_note1 51, 22, 59
+layer_note1 43, 92, 107
+layer_note1 38, 85, 64
+layer_delay 27
+layer_jump .layer5_0
+
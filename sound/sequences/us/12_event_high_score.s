@@ -0,0 +1,505 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 133
+seq_initchannels 0xff
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+seq_startchannel 6, .channel6
+seq_startchannel 7, .channel7
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 93
+chan_setreverb 18
+chan_setvol 82
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+chan_setlayer 2, .layer0_2
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_delay 7
+layer_note1 46, 38, 104
+layer_note1 60, 93, 91
+layer_delay 41
+layer_delay 18
+layer_note1 54, 77, 127
+layer_note1 54, 21, 121
+layer_delay 32
+layer_delay 36
+layer_note1 58, 24, 127
+layer_note1 52, 49, 42
+layer_note1 56, 12, 85
+layer_delay 36
+layer_note1 20, 57, 70
+layer_delay 19
+layer_note1 53, 52, 47
+layer_jump .layer0_0
+
+.layer0_1:
+layer_delay 23
+layer_note1 58, 77, 108
+layer_note1 28, 38, 124
+layer_note1 42, 46, 61
+layer_note1 56, 80, 74
+layer_note1 23, 50, 42
+layer_note1 37, 66, 121
+layer_delay 18
+layer_note1 24, 68, 42
+layer_note1 53, 93, 57
+layer_note1 57, 56, 63
+layer_note1 36, 25, 126
+layer_delay 19
+layer_delay 40
+layer_note1 40, 46, 46
+layer_note1 46, 17, 79
+layer_jump .layer0_1
+
+.layer0_2:
+layer_note1 45, 67, 49
+layer_note1 54, 87, 70
+layer_note1 36, 79, 60
+layer_note1 23, 68, 115
+layer_note1 51, 34, 110
+layer_note1 60, 62, 49
+layer_note1 33, 35, 101
+layer_note1 32, 52, 116
+layer_delay 42
+layer_note1 47, 12, 82
+layer_note1 30, 77, 69
+layer_note1 43, 28, 67
+layer_note1 42, 63, 115
+layer_delay 12
+layer_note1 32, 79, 110
+layer_note1 48, 65, 97
+layer_jump .layer0_2
+
+.channel1:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 121
+chan_setreverb 28
+chan_setvol 61
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 20, 65, 83
+layer_note1 33, 12, 74
+layer_delay 48
+layer_note1 21, 20, 100
+layer_note1 39, 84, 66
+layer_note1 26, 9, 98
+layer_note1 34, 89, 43
+layer_note1 27, 60, 47
+layer_note1 23, 30, 108
+layer_note1 42, 50, 109
+layer_note1 46, 57, 40
+layer_note1 41, 16, 44
+layer_note1 38, 47, 81
+layer_delay 14
+layer_note1 35, 69, 76
+layer_note1 36, 37, 49
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 32, 67, 86
+layer_delay 38
+layer_note1 56, 25, 77
+layer_delay 34
+layer_note1 44, 72, 117
+layer_note1 29, 90, 111
+layer_delay 43
+layer_note1 40, 69, 76
+layer_note1 46, 14, 118
+layer_note1 29, 36, 94
+layer_note1 54, 62, 104
+layer_note1 38, 37, 103
+layer_note1 32, 53, 40
+layer_note1 41, 69, 49
+layer_note1 52, 54, 71
+layer_note1 38, 15, 76
+layer_note1 49, 47, 59
+layer_note1 37, 45, 89
+layer_note1 56, 71, 120
+layer_delay 12
+layer_note1 60, 38, 70
+layer_jump .layer1_1
+
+.channel2:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 54
+chan_setreverb 34
+chan_setvol 107
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+chan_setlayer 2, .layer2_2
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 25, 45, 91
+layer_note1 33, 46, 41
+layer_delay 42
+layer_note1 42, 92, 123
+layer_note1 47, 84, 73
+layer_note1 48, 26, 93
+layer_note1 33, 52, 65
+layer_note1 60, 54, 49
+layer_note1 32, 51, 104
+layer_note1 57, 67, 96
+layer_note1 25, 22, 70
+layer_note1 45, 35, 127
+layer_note1 51, 48, 70
+layer_note1 44, 33, 62
+layer_note1 50, 18, 92
+layer_note1 50, 18, 63
+layer_note1 36, 66, 56
+layer_note1 36, 24, 44
+layer_note1 38, 62, 46
+layer_delay 24
+layer_note1 36, 74, 79
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 56, 10, 122
+layer_delay 40
+layer_note1 59, 15, 47
+layer_note1 59, 50, 101
+layer_note1 52, 19, 45
+layer_note1 50, 63, 82
+layer_note1 51, 52, 68
+layer_delay 13
+layer_note1 29, 54, 54
+layer_note1 25, 11, 90
+layer_note1 49, 24, 123
+layer_note1 48, 12, 126
+layer_note1 37, 8, 115
+layer_delay 12
+layer_delay 20
+layer_note1 39, 44, 117
+layer_note1 21, 61, 51
+layer_note1 60, 65, 53
+layer_note1 54, 47, 98
+layer_note1 23, 68, 51
+layer_jump .layer2_1
+
+.layer2_2:
+layer_note1 27, 81, 125
+layer_note1 24, 92, 81
+layer_note1 29, 79, 126
+layer_note1 38, 59, 50
+layer_delay 30
+layer_note1 51, 71, 92
+layer_note1 36, 79, 70
+layer_note1 45, 83, 56
+layer_note1 34, 48, 69
+layer_note1 50, 46, 67
+layer_note1 33, 73, 99
+layer_note1 47, 52, 95
+layer_note1 32, 21, 71
+layer_delay 9
+layer_note1 43, 60, 89
+layer_note1 54, 77, 106
+layer_note1 20, 9, 120
+layer_note1 40, 95, 115
+layer_note1 31, 51, 114
+layer_note1 40, 82, 70
+layer_note1 56, 62, 97
+layer_delay 7
+layer_jump .layer2_2
+
+.channel3:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 116
+chan_setreverb 32
+chan_setvol 79
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+chan_setlayer 2, .layer3_2
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 20, 6, 62
+layer_note1 45, 18, 75
+layer_note1 29, 8, 117
+layer_note1 49, 47, 59
+layer_note1 47, 95, 86
+layer_note1 48, 66, 51
+layer_note1 35, 69, 71
+layer_note1 36, 72, 114
+layer_note1 48, 39, 105
+layer_note1 48, 40, 60
+layer_note1 33, 33, 53
+layer_delay 13
+layer_note1 32, 51, 81
+layer_note1 52, 28, 60
+layer_note1 56, 83, 119
+layer_delay 8
+layer_note1 49, 58, 93
+layer_note1 54, 65, 114
+layer_note1 23, 9, 51
+layer_delay 16
+layer_note1 57, 54, 123
+layer_delay 24
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 30, 49, 80
+layer_note1 56, 64, 77
+layer_note1 60, 96, 93
+layer_note1 56, 82, 94
+layer_note1 39, 65, 109
+layer_note1 23, 96, 107
+layer_note1 28, 47, 44
+layer_delay 25
+layer_note1 25, 52, 115
+layer_delay 19
+layer_note1 25, 53, 60
+layer_note1 58, 66, 80
+layer_note1 48, 66, 67
+layer_jump .layer3_1
+
+.layer3_2:
+layer_note1 46, 9, 70
+layer_note1 32, 73, 122
+layer_delay 43
+layer_note1 37, 81, 77
+layer_note1 41, 63, 58
+layer_note1 36, 41, 48
+layer_note1 50, 39, 97
+layer_note1 20, 72, 60
+layer_note1 41, 7, 67
+layer_note1 23, 67, 76
+layer_delay 46
+layer_note1 36, 71, 86
+layer_note1 34, 10, 71
+layer_delay 10
+layer_note1 22, 56, 123
+layer_jump .layer3_2
+
+.channel4:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 56
+chan_setreverb 48
+chan_setvol 93
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 54, 13, 40
+layer_note1 60, 52, 41
+layer_note1 34, 76, 56
+layer_note1 22, 46, 51
+layer_note1 58, 53, 44
+layer_note1 52, 38, 111
+layer_note1 52, 7, 87
+layer_note1 36, 91, 113
+layer_note1 60, 76, 104
+layer_note1 54, 80, 67
+layer_note1 39, 13, 112
+layer_note1 30, 64, 118
+layer_note1 39, 20, 61
+layer_delay 18
+layer_note1 34, 53, 106
+layer_note1 51, 6, 48
+layer_note1 54, 63, 114
+layer_note1 30, 18, 123
+layer_note1 51, 56, 107
+layer_delay 32
+layer_note1 59, 9, 54
+layer_delay 26
+layer_note1 32, 29, 127
+layer_note1 56, 82, 65
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 27, 40, 125
+layer_note1 36, 23, 86
+layer_note1 29, 71, 79
+layer_note1 25, 86, 101
+layer_note1 60, 76, 92
+layer_note1 41, 81, 65
+layer_note1 35, 36, 78
+layer_note1 44, 44, 61
+layer_note1 45, 87, 109
+layer_note1 37, 8, 64
+layer_note1 42, 92, 77
+layer_note1 45, 73, 91
+layer_note1 30, 33, 44
+layer_note1 56, 78, 92
+layer_note1 30, 47, 110
+layer_note1 50, 12, 71
+layer_note1 33, 18, 55
+layer_note1 47, 46, 127
+layer_note1 35, 22, 105
+layer_delay 22
+layer_jump .layer4_1
+
+.channel5:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 55
+chan_setreverb 22
+chan_setvol 113
+chan_setlayer 0, .layer5_0
+chan_setlayer 1, .layer5_1
+chan_setlayer 2, .layer5_2
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_note1 36, 47, 50
+layer_note1 42, 53, 70
+layer_note1 29, 96, 100
+layer_note1 23, 27, 93
+layer_note1 23, 79, 48
+layer_note1 46, 95, 61
+layer_note1 58, 53, 85
+layer_note1 22, 9, 95
+layer_note1 31, 9, 127
+layer_note1 28, 84, 50
+layer_jump .layer5_0
+
+.layer5_1:
+layer_note1 23, 60, 100
+layer_note1 35, 12, 82
+layer_delay 7
+layer_delay 6
+layer_note1 57, 24, 113
+layer_delay 47
+layer_note1 54, 9, 47
+layer_note1 58, 22, 62
+layer_note1 47, 14, 105
+layer_delay 27
+layer_note1 40, 31, 75
+layer_note1 51, 87, 111
+layer_note1 32, 76, 67
+layer_jump .layer5_1
+
+.layer5_2:
+layer_note1 28, 60, 98
+layer_note1 45, 18, 126
+layer_note1 26, 87, 90
+layer_note1 59, 93, 74
+layer_note1 23, 31, 60
+layer_note1 21, 58, 60
+layer_note1 28, 26, 87
+layer_note1 23, 45, 89
+layer_note1 36, 10, 121
+layer_note1 51, 44, 109
+layer_note1 35, 71, 50
+layer_note1 57, 79, 106
+layer_note1 42, 89, 103
+layer_note1 31, 13, 71
+layer_note1 22, 67, 73
+layer_jump .layer5_2
+
+.channel6:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 21
+chan_setreverb 18
+chan_setvol 108
+chan_setlayer 0, .layer6_0
+.chan_loop6:
+chan_delay 0x7fff
+chan_jump .chan_loop6
+
+.layer6_0:
+layer_delay 40
+layer_note1 33, 17, 107
+layer_note1 36, 46, 41
+layer_note1 51, 88, 109
+layer_note1 20, 45, 94
+layer_note1 39, 21, 60
+layer_note1 52, 34, 69
+layer_note1 40, 22, 58
+layer_note1 25, 16, 83
+layer_note1 29, 49, 107
+layer_note1 58, 93, 65
+layer_note1 33, 54, 118
+layer_note1 26, 56, 40
+layer_note1 49, 76, 75
+layer_note1 45, 69, 58
+layer_note1 39, 66, 80
+layer_note1 39, 37, 67
+layer_jump .layer6_0
+
+.channel7:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 22
+chan_setreverb 26
+chan_setvol 115
+chan_setlayer 0, .layer7_0
+chan_setlayer 1, .layer7_1
+.chan_loop7:
+chan_delay 0x7fff
+chan_jump .chan_loop7
+
+.layer7_0:
+layer_note1 32, 41, 90
+layer_note1 47, 32, 109
+layer_note1 59, 71, 113
+layer_note1 60, 47, 65
+layer_note1 49, 31, 47
+layer_note1 42, 91, 62
+layer_note1 38, 78, 82
+layer_note1 49, 91, 44
+layer_note1 44, 63, 76
+layer_note1 29, 34, 104
+layer_note1 47, 31, 41
+layer_note1 44, 44, 42
+layer_note1 28, 42, 69
+layer_note1 42, 30, 50
+layer_note1 58, 40, 113
+layer_note1 38, 95, 124
+layer_jump .layer7_0
+
+.layer7_1:
+layer_note1 47, 9, 120
+layer_note1 40, 18, 42
+layer_note1 28, 65, 49
+layer_note1 43, 43, 115
+layer_note1 50, 20, 124
+layer_delay 9
+layer_note1 25, 17, 87
+layer_note1 49, 17, 114
+layer_note1 36, 65, 78
+layer_note1 58, 76, 75
+layer_note1 26, 91, 85
+layer_note1 46, 39, 80
+layer_note1 22, 86, 76
+layer_note1 53, 70, 41
+layer_jump .layer7_1
+
@@ -0,0 +1,309 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 95
+seq_initchannels 0x1f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 85
+chan_setreverb 15
+chan_setvol 85
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 38, 64, 73
+layer_note1 27, 47, 106
+layer_note1 31, 36, 61
+layer_note1 43, 79, 104
+layer_note1 51, 33, 78
+layer_note1 41, 57, 68
+layer_note1 45, 74, 84
+layer_note1 53, 40, 74
+layer_note1 39, 76, 54
+layer_note1 56, 70, 58
+layer_note1 60, 26, 64
+layer_note1 47, 22, 92
+layer_note1 56, 18, 65
+layer_note1 54, 49, 124
+layer_note1 25, 68, 58
+layer_note1 51, 16, 71
+layer_note1 54, 51, 66
+layer_note1 60, 56, 114
+layer_note1 53, 6, 57
+layer_note1 25, 67, 91
+layer_note1 31, 55, 93
+layer_delay 31
+layer_note1 43, 24, 82
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 59, 44, 56
+layer_note1 54, 8, 113
+layer_note1 30, 84, 123
+layer_note1 20, 71, 111
+layer_note1 49, 76, 52
+layer_delay 44
+layer_note1 47, 57, 101
+layer_note1 50, 59, 59
+layer_note1 31, 53, 120
+layer_note1 23, 17, 85
+layer_note1 31, 73, 59
+layer_note1 36, 15, 60
+layer_note1 34, 22, 78
+layer_delay 29
+layer_delay 27
+layer_delay 23
+layer_note1 30, 56, 92
+layer_note1 46, 72, 41
+layer_jump .layer0_1
+
+.channel1:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 111
+chan_setreverb 51
+chan_setvol 65
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+chan_setlayer 2, .layer1_2
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 25, 33, 76
+layer_note1 28, 94, 126
+layer_note1 25, 19, 81
+layer_note1 36, 77, 99
+layer_note1 25, 34, 49
+layer_note1 40, 26, 51
+layer_note1 54, 87, 102
+layer_note1 52, 54, 91
+layer_note1 49, 8, 105
+layer_note1 32, 90, 66
+layer_delay 31
+layer_note1 43, 14, 113
+layer_delay 19
+layer_note1 28, 88, 80
+layer_delay 14
+layer_note1 48, 41, 42
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 52, 27, 74
+layer_note1 51, 84, 71
+layer_note1 50, 13, 107
+layer_note1 42, 70, 47
+layer_note1 38, 94, 76
+layer_note1 59, 7, 64
+layer_note1 53, 78, 67
+layer_delay 25
+layer_note1 35, 30, 92
+layer_delay 41
+layer_note1 21, 64, 109
+layer_note1 49, 16, 102
+layer_note1 32, 62, 81
+layer_note1 47, 44, 57
+layer_note1 60, 48, 127
+layer_note1 36, 53, 67
+layer_delay 47
+layer_note1 59, 24, 90
+layer_delay 37
+layer_note1 36, 50, 67
+layer_note1 24, 52, 59
+layer_note1 20, 61, 84
+layer_note1 38, 32, 70
+layer_note1 59, 25, 84
+layer_jump .layer1_1
+
+.layer1_2:
+layer_delay 8
+layer_delay 26
+layer_note1 23, 36, 125
+layer_note1 30, 49, 78
+layer_note1 40, 80, 81
+layer_note1 57, 48, 73
+layer_note1 42, 35, 100
+layer_note1 46, 52, 108
+layer_note1 37, 65, 59
+layer_note1 33, 68, 86
+layer_note1 38, 30, 101
+layer_delay 25
+layer_note1 42, 39, 102
+layer_note1 38, 79, 42
+layer_jump .layer1_2
+
+.channel2:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 58
+chan_setreverb 48
+chan_setvol 110
+chan_setlayer 0, .layer2_0
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 42, 13, 90
+layer_note1 24, 59, 118
+layer_note1 42, 67, 84
+layer_note1 32, 92, 94
+layer_note1 54, 56, 113
+layer_note1 53, 16, 68
+layer_delay 43
+layer_note1 41, 39, 94
+layer_note1 40, 75, 86
+layer_note1 57, 90, 63
+layer_note1 22, 46, 42
+layer_note1 32, 55, 71
+layer_note1 51, 19, 100
+layer_note1 40, 24, 120
+layer_delay 20
+layer_note1 34, 95, 92
+layer_note1 24, 21, 93
+layer_note1 41, 85, 66
+layer_note1 21, 17, 119
+layer_note1 55, 84, 113
+layer_note1 20, 6, 110
+layer_delay 30
+layer_note1 27, 78, 57
+layer_note1 59, 32, 92
+layer_jump .layer2_0
+
+.channel3:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 56
+chan_setreverb 21
+chan_setvol 77
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+chan_setlayer 2, .layer3_2
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 23, 75, 88
+layer_note1 51, 95, 81
+layer_note1 59, 65, 47
+layer_note1 22, 72, 116
+layer_note1 23, 92, 74
+layer_note1 28, 89, 83
+layer_note1 27, 9, 127
+layer_note1 21, 20, 78
+layer_note1 39, 64, 109
+layer_delay 27
+layer_note1 38, 16, 48
+layer_note1 59, 59, 48
+layer_note1 36, 91, 107
+layer_note1 55, 11, 42
+layer_note1 58, 63, 121
+layer_delay 27
+layer_note1 52, 60, 124
+layer_delay 46
+layer_note1 23, 46, 45
+layer_note1 33, 59, 62
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 50, 65, 119
+layer_note1 23, 25, 106
+layer_note1 43, 41, 104
+layer_note1 44, 63, 107
+layer_note1 35, 89, 82
+layer_note1 44, 50, 103
+layer_note1 47, 75, 89
+layer_note1 50, 8, 86
+layer_note1 55, 86, 66
+layer_note1 39, 60, 70
+layer_delay 25
+layer_note1 20, 11, 51
+layer_note1 59, 61, 51
+layer_note1 52, 52, 45
+layer_jump .layer3_1
+
+.layer3_2:
+layer_note1 41, 29, 84
+layer_note1 55, 18, 125
+layer_delay 48
+layer_note1 57, 81, 61
+layer_note1 35, 28, 83
+layer_note1 47, 78, 75
+layer_note1 51, 33, 123
+layer_note1 29, 16, 72
+layer_note1 47, 81, 63
+layer_note1 36, 82, 89
+layer_note1 23, 31, 49
+layer_note1 50, 75, 106
+layer_note1 49, 59, 114
+layer_note1 47, 63, 62
+layer_note1 51, 75, 125
+layer_note1 52, 50, 108
+layer_delay 17
+layer_jump .layer3_2
+
+.channel4:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 95
+chan_setreverb 16
+chan_setvol 65
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 23, 27, 68
+layer_note1 25, 40, 61
+layer_delay 27
+layer_note1 59, 66, 71
+layer_note1 20, 28, 59
+layer_note1 45, 81, 40
+layer_note1 20, 54, 94
+layer_delay 18
+layer_note1 57, 76, 107
+layer_note1 38, 61, 54
+layer_note1 53, 45, 74
+layer_note1 46, 41, 72
+layer_note1 22, 21, 45
+layer_note1 44, 13, 105
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 27, 19, 120
+layer_note1 27, 7, 40
+layer_note1 36, 65, 98
+layer_delay 17
+layer_note1 59, 60, 85
+layer_note1 54, 24, 94
+layer_note1 46, 53, 64
+layer_note1 57, 44, 42
+layer_note1 53, 74, 117
+layer_note1 49, 89, 92
+layer_note1 50, 92, 121
+layer_note1 22, 95, 104
+layer_jump .layer4_1
+
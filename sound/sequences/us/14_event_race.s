@@ -0,0 +1,241 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 146
+seq_initchannels 0xf
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 51
+chan_setreverb 25
+chan_setvol 104
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+chan_setlayer 2, .layer0_2
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 58, 39, 53
+layer_note1 40, 40, 53
+layer_note1 39, 8, 112
+layer_note1 24, 31, 54
+layer_note1 44, 15, 52
+layer_note1 26, 80, 94
+layer_note1 45, 62, 124
+layer_note1 56, 70, 60
+layer_note1 46, 35, 109
+layer_note1 26, 32, 89
+layer_note1 28, 86, 103
+layer_delay 35
+layer_delay 35
+layer_note1 58, 21, 106
+layer_note1 52, 69, 87
+layer_note1 54, 29, 40
+layer_note1 21, 65, 88
+layer_jump .layer0_0
+
+.layer0_1:
+layer_delay 47
+layer_note1 28, 66, 76
+layer_note1 38, 27, 99
+layer_note1 39, 92, 45
+layer_delay 25
+layer_note1 46, 18, 99
+layer_delay 38
+layer_note1 21, 28, 95
+layer_note1 24, 16, 56
+layer_note1 38, 65, 54
+layer_note1 50, 93, 48
+layer_note1 60, 25, 41
+layer_note1 59, 89, 77
+layer_note1 22, 78, 109
+layer_note1 36, 32, 73
+layer_note1 23, 9, 75
+layer_note1 33, 14, 65
+layer_note1 49, 70, 57
+layer_note1 52, 39, 111
+layer_note1 39, 88, 127
+layer_note1 52, 78, 94
+layer_note1 23, 34, 59
+layer_jump .layer0_1
+
+.layer0_2:
+layer_note1 27, 71, 115
+layer_note1 36, 65, 88
+layer_note1 41, 53, 63
+layer_note1 41, 18, 121
+layer_note1 53, 63, 92
+layer_note1 43, 17, 80
+layer_note1 49, 81, 86
+layer_delay 22
+layer_note1 34, 56, 44
+layer_jump .layer0_2
+
+.channel1:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 42
+chan_setreverb 30
+chan_setvol 73
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+chan_setlayer 2, .layer1_2
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_delay 8
+layer_note1 22, 93, 57
+layer_note1 35, 75, 109
+layer_note1 37, 30, 58
+layer_note1 27, 81, 96
+layer_delay 34
+layer_note1 45, 80, 68
+layer_note1 26, 92, 70
+layer_note1 42, 64, 111
+layer_note1 48, 44, 47
+layer_note1 48, 21, 64
+layer_note1 51, 22, 89
+layer_note1 51, 50, 97
+layer_delay 33
+layer_delay 20
+layer_note1 55, 37, 53
+layer_note1 46, 87, 57
+layer_note1 34, 25, 98
+layer_note1 58, 67, 51
+layer_note1 45, 62, 115
+layer_delay 6
+layer_note1 25, 40, 71
+layer_note1 53, 56, 73
+layer_note1 47, 8, 57
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 21, 40, 118
+layer_note1 51, 82, 82
+layer_note1 31, 15, 109
+layer_note1 21, 21, 49
+layer_delay 11
+layer_note1 24, 10, 51
+layer_note1 51, 45, 87
+layer_note1 37, 25, 55
+layer_note1 23, 11, 86
+layer_note1 27, 87, 83
+layer_note1 36, 86, 99
+layer_jump .layer1_1
+
+.layer1_2:
+layer_note1 60, 79, 66
+layer_delay 16
+layer_note1 56, 55, 80
+layer_delay 40
+layer_note1 24, 9, 102
+layer_note1 58, 28, 63
+layer_note1 44, 27, 108
+layer_delay 18
+layer_note1 30, 88, 102
+layer_note1 52, 59, 66
+layer_note1 58, 73, 95
+layer_jump .layer1_2
+
+.channel2:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 48
+chan_setreverb 20
+chan_setvol 126
+chan_setlayer 0, .layer2_0
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 22, 94, 73
+layer_note1 47, 65, 63
+layer_note1 54, 14, 120
+layer_note1 21, 78, 119
+layer_note1 48, 80, 72
+layer_note1 56, 41, 97
+layer_note1 44, 79, 80
+layer_delay 14
+layer_note1 54, 74, 90
+layer_delay 31
+layer_note1 35, 18, 50
+layer_note1 29, 67, 90
+layer_note1 26, 71, 115
+layer_note1 50, 11, 58
+layer_jump .layer2_0
+
+.channel3:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 123
+chan_setreverb 10
+chan_setvol 102
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 37, 22, 76
+layer_note1 39, 72, 102
+layer_note1 59, 57, 89
+layer_note1 34, 76, 65
+layer_note1 32, 7, 56
+layer_note1 22, 43, 49
+layer_note1 41, 67, 121
+layer_note1 45, 58, 98
+layer_note1 24, 14, 114
+layer_note1 43, 25, 65
+layer_note1 43, 40, 106
+layer_note1 41, 29, 81
+layer_note1 57, 70, 44
+layer_note1 37, 87, 105
+layer_note1 25, 62, 50
+layer_note1 22, 72, 57
+layer_note1 33, 52, 57
+layer_note1 45, 62, 73
+layer_note1 40, 28, 110
+layer_note1 54, 37, 102
+layer_note1 21, 27, 99
+layer_note1 40, 41, 118
+layer_jump .layer3_0
+
+.layer3_1:
+layer_delay 33
+layer_delay 39
+layer_note1 28, 92, 62
+layer_note1 27, 62, 44
+layer_note1 36, 80, 78
+layer_note1 37, 39, 124
+layer_delay 10
+layer_note1 52, 52, 41
+layer_note1 46, 44, 76
+layer_note1 50, 64, 69
+layer_note1 38, 13, 106
+layer_note1 43, 21, 86
+layer_note1 24, 93, 71
+layer_note1 58, 25, 52
+layer_note1 47, 57, 127
+layer_note1 47, 81, 61
+layer_note1 27, 49, 54
+layer_jump .layer3_1
+
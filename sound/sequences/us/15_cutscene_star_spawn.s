@@ -0,0 +1,264 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 113
+seq_initchannels 0x1f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 83
+chan_setreverb 36
+chan_setvol 81
+chan_setlayer 0, .layer0_0
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 24, 19, 56
+layer_note1 57, 63, 92
+layer_note1 40, 86, 127
+layer_note1 47, 17, 120
+layer_note1 51, 57, 50
+layer_note1 35, 10, 65
+layer_delay 18
+layer_note1 38, 45, 72
+layer_note1 27, 8, 74
+layer_note1 34, 79, 70
+layer_delay 47
+layer_note1 37, 23, 122
+layer_note1 48, 25, 121
+layer_note1 47, 26, 61
+layer_note1 27, 94, 56
+layer_note1 57, 60, 84
+layer_note1 58, 12, 106
+layer_note1 31, 28, 50
+layer_delay 24
+layer_delay 47
+layer_note1 45, 64, 107
+layer_jump .layer0_0
+
+.channel1:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 42
+chan_setreverb 7
+chan_setvol 118
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+chan_setlayer 2, .layer1_2
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_delay 42
+layer_note1 25, 48, 72
+layer_note1 39, 90, 45
+layer_note1 32, 34, 105
+layer_note1 20, 26, 43
+layer_note1 53, 23, 79
+layer_note1 46, 41, 53
+layer_note1 33, 36, 65
+layer_note1 26, 44, 56
+layer_note1 28, 88, 50
+layer_note1 20, 28, 64
+layer_note1 39, 57, 52
+layer_note1 38, 32, 86
+layer_note1 29, 92, 52
+layer_delay 9
+layer_note1 43, 42, 90
+layer_note1 49, 18, 48
+layer_note1 33, 7, 107
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 55, 85, 83
+layer_note1 31, 41, 77
+layer_note1 26, 6, 45
+layer_note1 33, 85, 91
+layer_note1 25, 80, 86
+layer_note1 48, 12, 123
+layer_delay 45
+layer_note1 55, 56, 90
+layer_note1 49, 17, 114
+layer_note1 40, 35, 65
+layer_jump .layer1_1
+
+.layer1_2:
+layer_note1 41, 54, 66
+layer_note1 42, 23, 51
+layer_note1 43, 8, 55
+layer_note1 54, 24, 77
+layer_note1 20, 23, 127
+layer_note1 53, 24, 42
+layer_note1 53, 63, 71
+layer_note1 44, 94, 108
+layer_note1 38, 70, 117
+layer_note1 38, 85, 50
+layer_note1 37, 51, 56
+layer_note1 35, 68, 56
+layer_note1 40, 86, 111
+layer_delay 40
+layer_note1 27, 40, 122
+layer_delay 18
+layer_note1 33, 75, 104
+layer_jump .layer1_2
+
+.channel2:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 120
+chan_setreverb 40
+chan_setvol 82
+chan_setlayer 0, .layer2_0
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 21, 78, 125
+layer_note1 30, 49, 75
+layer_note1 40, 16, 58
+layer_note1 26, 22, 78
+layer_note1 51, 11, 104
+layer_delay 36
+layer_note1 52, 91, 52
+layer_note1 28, 96, 79
+layer_note1 46, 27, 98
+layer_note1 53, 67, 59
+layer_note1 32, 43, 55
+layer_note1 45, 65, 48
+layer_jump .layer2_0
+
+.channel3:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 29
+chan_setreverb 51
+chan_setvol 87
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+chan_setlayer 2, .layer3_2
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 33, 70, 76
+layer_note1 50, 18, 86
+layer_note1 31, 77, 113
+layer_note1 38, 25, 41
+layer_note1 44, 24, 76
+layer_note1 28, 71, 48
+layer_note1 52, 72, 44
+layer_delay 23
+layer_note1 56, 17, 108
+layer_note1 48, 62, 92
+layer_note1 22, 93, 62
+layer_note1 26, 69, 116
+layer_note1 60, 44, 60
+layer_note1 37, 35, 55
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 54, 81, 97
+layer_note1 35, 75, 61
+layer_note1 48, 17, 104
+layer_delay 7
+layer_note1 42, 39, 79
+layer_note1 45, 87, 126
+layer_delay 29
+layer_delay 42
+layer_note1 31, 26, 69
+layer_note1 48, 59, 45
+layer_delay 19
+layer_jump .layer3_1
+
+.layer3_2:
+layer_note1 55, 65, 51
+layer_note1 49, 95, 124
+layer_note1 53, 43, 82
+layer_delay 18
+layer_delay 46
+layer_delay 8
+layer_note1 31, 90, 65
+layer_note1 38, 6, 55
+layer_delay 20
+layer_note1 52, 87, 117
+layer_note1 37, 84, 83
+layer_note1 58, 75, 56
+layer_note1 23, 7, 51
+layer_note1 53, 66, 62
+layer_note1 33, 76, 84
+layer_delay 24
+layer_note1 30, 76, 78
+layer_note1 33, 16, 55
+layer_note1 59, 25, 105
+layer_note1 42, 45, 86
+layer_jump .layer3_2
+
+.channel4:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 66
+chan_setreverb 45
+chan_setvol 63
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 38, 95, 100
+layer_note1 39, 12, 43
+layer_note1 25, 8, 105
+layer_note1 46, 41, 98
+layer_note1 37, 16, 122
+layer_note1 47, 96, 49
+layer_delay 31
+layer_note1 36, 7, 127
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 24, 92, 40
+layer_note1 26, 69, 95
+layer_delay 39
+layer_delay 6
+layer_note1 56, 90, 121
+layer_delay 45
+layer_note1 35, 50, 87
+layer_note1 53, 21, 48
+layer_note1 36, 80, 97
+layer_note1 51, 11, 45
+layer_note1 49, 16, 63
+layer_note1 57, 72, 119
+layer_note1 59, 83, 112
+layer_note1 35, 42, 45
+layer_delay 28
+layer_note1 58, 64, 80
+layer_note1 20, 44, 117
+layer_delay 18
+layer_note1 29, 82, 114
+layer_note1 56, 73, 62
+layer_delay 20
+layer_note1 53, 10, 104
+layer_delay 12
+layer_note1 50, 64, 106
+layer_jump .layer4_1
+
@@ -0,0 +1,223 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 133
+seq_initchannels 0x1f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 72
+chan_setreverb 30
+chan_setvol 87
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 53, 36, 40
+layer_delay 43
+layer_note1 29, 35, 69
+layer_note1 47, 58, 118
+layer_note1 41, 75, 103
+layer_note1 43, 8, 59
+layer_note1 25, 21, 42
+layer_note1 55, 49, 91
+layer_note1 31, 91, 44
+layer_note1 35, 15, 65
+layer_note1 57, 15, 55
+layer_note1 55, 55, 65
+layer_note1 29, 74, 92
+layer_note1 48, 70, 89
+layer_note1 51, 55, 74
+layer_delay 11
+layer_note1 51, 6, 102
+layer_delay 44
+layer_note1 34, 79, 117
+layer_note1 59, 20, 63
+layer_note1 60, 50, 82
+layer_note1 58, 45, 71
+layer_delay 10
+layer_note1 31, 60, 87
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 53, 90, 70
+layer_note1 30, 81, 41
+layer_note1 51, 70, 88
+layer_note1 35, 26, 111
+layer_delay 32
+layer_note1 50, 13, 76
+layer_delay 22
+layer_note1 22, 59, 71
+layer_note1 24, 49, 122
+layer_note1 29, 67, 46
+layer_note1 53, 67, 43
+layer_note1 43, 25, 87
+layer_note1 47, 68, 114
+layer_jump .layer0_1
+
+.channel1:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 78
+chan_setreverb 8
+chan_setvol 95
+chan_setlayer 0, .layer1_0
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 28, 9, 73
+layer_note1 35, 80, 93
+layer_note1 45, 23, 57
+layer_delay 31
+layer_delay 7
+layer_note1 29, 15, 55
+layer_note1 28, 44, 108
+layer_note1 45, 69, 68
+layer_jump .layer1_0
+
+.channel2:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 46
+chan_setreverb 11
+chan_setvol 108
+chan_setlayer 0, .layer2_0
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 52, 13, 41
+layer_note1 24, 56, 112
+layer_note1 34, 38, 117
+layer_note1 22, 37, 89
+layer_note1 38, 70, 110
+layer_note1 56, 18, 109
+layer_note1 52, 82, 81
+layer_note1 39, 43, 119
+layer_note1 55, 30, 48
+layer_jump .layer2_0
+
+.channel3:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 51
+chan_setreverb 22
+chan_setvol 68
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_delay 10
+layer_note1 60, 63, 104
+layer_note1 21, 93, 122
+layer_note1 50, 72, 105
+layer_note1 45, 15, 68
+layer_delay 48
+layer_note1 35, 41, 115
+layer_note1 47, 64, 70
+layer_note1 40, 68, 69
+layer_note1 25, 10, 101
+layer_note1 43, 83, 67
+layer_note1 60, 86, 119
+layer_note1 58, 95, 127
+layer_note1 50, 69, 89
+layer_note1 44, 73, 40
+layer_note1 32, 45, 90
+layer_note1 25, 76, 62
+layer_delay 25
+layer_note1 44, 65, 53
+layer_note1 30, 96, 95
+layer_note1 41, 53, 122
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 21, 47, 105
+layer_note1 29, 93, 104
+layer_note1 58, 94, 75
+layer_note1 30, 56, 99
+layer_note1 49, 84, 125
+layer_note1 31, 91, 89
+layer_note1 26, 30, 67
+layer_delay 46
+layer_note1 43, 8, 49
+layer_note1 22, 56, 117
+layer_note1 48, 36, 40
+layer_note1 29, 18, 79
+layer_note1 43, 6, 87
+layer_note1 56, 61, 107
+layer_jump .layer3_1
+
+.channel4:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 79
+chan_setreverb 12
+chan_setvol 113
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 57, 65, 42
+layer_note1 24, 16, 95
+layer_note1 32, 25, 47
+layer_note1 53, 83, 108
+layer_note1 50, 92, 126
+layer_note1 37, 25, 85
+layer_note1 60, 86, 41
+layer_note1 24, 91, 48
+layer_note1 26, 92, 64
+layer_note1 42, 13, 60
+layer_delay 37
+layer_note1 45, 26, 44
+layer_delay 28
+layer_note1 46, 31, 64
+layer_note1 53, 60, 50
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 33, 70, 45
+layer_note1 58, 74, 121
+layer_note1 31, 8, 87
+layer_note1 30, 62, 42
+layer_note1 23, 33, 127
+layer_note1 59, 74, 117
+layer_note1 39, 55, 66
+layer_note1 43, 7, 85
+layer_note1 36, 83, 43
+layer_note1 30, 29, 108
+layer_note1 46, 32, 68
+layer_note1 55, 42, 97
+layer_note1 43, 16, 70
+layer_note1 31, 51, 109
+layer_note1 43, 79, 56
+layer_note1 47, 80, 43
+layer_note1 33, 19, 67
+layer_note1 53, 53, 105
+layer_jump .layer4_1
+
@@ -0,0 +1,327 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 111
+seq_initchannels 0x1f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 114
+chan_setreverb 11
+chan_setvol 75
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+chan_setlayer 2, .layer0_2
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 25, 35, 74
+layer_note1 40, 82, 62
+layer_note1 47, 96, 46
+layer_note1 21, 81, 73
+layer_note1 32, 29, 54
+layer_note1 56, 13, 81
+layer_note1 36, 29, 90
+layer_note1 52, 24, 75
+layer_note1 31, 61, 46
+layer_note1 22, 59, 72
+layer_note1 53, 58, 90
+layer_note1 31, 45, 112
+layer_note1 57, 9, 78
+layer_note1 55, 75, 107
+layer_note1 53, 60, 51
+layer_delay 34
+layer_note1 47, 57, 47
+layer_note1 32, 71, 70
+layer_note1 26, 64, 64
+layer_jump .layer0_0
+
+.layer0_1:
+layer_delay 30
+layer_note1 41, 51, 120
+layer_note1 22, 14, 108
+layer_delay 47
+layer_note1 26, 12, 64
+layer_note1 29, 81, 98
+layer_delay 13
+layer_note1 53, 23, 114
+layer_note1 50, 66, 48
+layer_note1 42, 20, 117
+layer_note1 27, 8, 63
+layer_note1 60, 14, 83
+layer_delay 46
+layer_jump .layer0_1
+
+.layer0_2:
+layer_note1 31, 11, 49
+layer_note1 42, 92, 55
+layer_note1 54, 38, 102
+layer_note1 31, 8, 75
+layer_note1 57, 66, 119
+layer_note1 42, 21, 107
+layer_note1 22, 36, 88
+layer_note1 59, 10, 66
+layer_note1 51, 87, 88
+layer_delay 32
+layer_note1 35, 35, 54
+layer_note1 24, 91, 112
+layer_note1 40, 13, 43
+layer_note1 58, 41, 45
+layer_note1 21, 41, 40
+layer_note1 48, 90, 69
+layer_note1 47, 23, 85
+layer_note1 20, 95, 88
+layer_note1 26, 28, 119
+layer_note1 43, 41, 105
+layer_note1 36, 41, 107
+layer_jump .layer0_2
+
+.channel1:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 89
+chan_setreverb 53
+chan_setvol 125
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 54, 30, 103
+layer_note1 24, 55, 125
+layer_note1 32, 96, 60
+layer_delay 30
+layer_note1 23, 72, 107
+layer_note1 29, 31, 111
+layer_note1 58, 6, 107
+layer_note1 21, 20, 104
+layer_note1 60, 14, 52
+layer_note1 31, 38, 104
+layer_note1 40, 58, 113
+layer_note1 55, 48, 81
+layer_note1 23, 35, 105
+layer_note1 40, 92, 76
+layer_delay 21
+layer_delay 26
+layer_note1 21, 46, 54
+layer_delay 34
+layer_note1 31, 26, 101
+layer_note1 45, 51, 57
+layer_note1 39, 36, 109
+layer_note1 59, 53, 45
+layer_note1 37, 71, 109
+layer_jump .layer1_0
+
+.layer1_1:
+layer_delay 21
+layer_note1 55, 23, 96
+layer_delay 21
+layer_note1 27, 77, 101
+layer_note1 30, 70, 88
+layer_delay 27
+layer_note1 28, 91, 114
+layer_note1 47, 86, 108
+layer_delay 35
+layer_note1 48, 52, 66
+layer_note1 20, 16, 54
+layer_note1 49, 16, 67
+layer_note1 60, 40, 120
+layer_delay 16
+layer_jump .layer1_1
+
+.channel2:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 61
+chan_setreverb 37
+chan_setvol 85
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 31, 57, 125
+layer_note1 55, 60, 73
+layer_note1 33, 37, 68
+layer_note1 37, 93, 77
+layer_note1 58, 36, 118
+layer_note1 42, 64, 87
+layer_note1 27, 80, 69
+layer_note1 43, 22, 57
+layer_delay 44
+layer_note1 26, 22, 127
+layer_note1 34, 56, 56
+layer_delay 38
+layer_note1 36, 7, 41
+layer_note1 41, 26, 101
+layer_note1 52, 82, 60
+layer_note1 36, 53, 55
+layer_note1 31, 16, 104
+layer_note1 48, 74, 97
+layer_note1 56, 47, 69
+layer_note1 60, 12, 118
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 20, 73, 109
+layer_note1 46, 86, 82
+layer_note1 26, 35, 92
+layer_note1 56, 49, 118
+layer_note1 29, 47, 91
+layer_note1 21, 94, 84
+layer_note1 30, 62, 41
+layer_note1 44, 60, 49
+layer_note1 21, 67, 89
+layer_note1 27, 84, 111
+layer_note1 30, 42, 122
+layer_jump .layer2_1
+
+.channel3:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 10
+chan_setreverb 29
+chan_setvol 85
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 49, 36, 61
+layer_delay 13
+layer_note1 46, 88, 102
+layer_note1 39, 83, 124
+layer_note1 37, 53, 79
+layer_delay 36
+layer_note1 29, 30, 94
+layer_note1 24, 41, 86
+layer_note1 20, 64, 107
+layer_note1 52, 67, 64
+layer_delay 15
+layer_note1 22, 9, 103
+layer_delay 28
+layer_note1 60, 35, 85
+layer_note1 30, 25, 73
+layer_note1 35, 84, 101
+layer_note1 27, 50, 57
+layer_note1 27, 43, 70
+layer_note1 42, 50, 75
+layer_note1 39, 92, 90
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 33, 23, 59
+layer_note1 28, 14, 126
+layer_note1 23, 80, 102
+layer_note1 38, 20, 55
+layer_note1 20, 8, 127
+layer_note1 59, 68, 99
+layer_note1 28, 71, 70
+layer_note1 36, 11, 80
+layer_note1 23, 75, 96
+layer_note1 55, 70, 104
+layer_note1 28, 41, 116
+layer_note1 22, 70, 48
+layer_note1 21, 9, 79
+layer_note1 53, 54, 89
+layer_delay 32
+layer_jump .layer3_1
+
+.channel4:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 93
+chan_setreverb 7
+chan_setvol 123
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+chan_setlayer 2, .layer4_2
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 35, 82, 57
+layer_delay 24
+layer_delay 30
+layer_note1 37, 52, 55
+layer_note1 41, 52, 74
+layer_note1 37, 50, 80
+layer_note1 46, 76, 62
+layer_note1 26, 69, 60
+layer_note1 31, 36, 95
+layer_note1 43, 65, 123
+layer_note1 53, 63, 51
+layer_note1 50, 20, 103
+layer_note1 37, 24, 109
+layer_note1 48, 74, 78
+layer_note1 58, 82, 90
+layer_note1 35, 66, 87
+layer_note1 27, 67, 79
+layer_note1 56, 19, 86
+layer_note1 42, 10, 101
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 20, 37, 91
+layer_note1 33, 12, 88
+layer_note1 33, 51, 67
+layer_delay 22
+layer_delay 11
+layer_delay 32
+layer_note1 52, 92, 56
+layer_note1 28, 71, 49
+layer_note1 27, 75, 79
+layer_delay 31
+layer_note1 25, 11, 50
+layer_note1 32, 74, 106
+layer_note1 52, 94, 69
+layer_delay 16
+layer_note1 31, 40, 97
+layer_note1 23, 76, 92
+layer_jump .layer4_1
+
+.layer4_2:
+layer_note1 38, 51, 119
+layer_note1 37, 37, 79
+layer_note1 23, 43, 76
+layer_note1 60, 25, 120
+layer_note1 57, 91, 56
+layer_note1 42, 73, 121
+layer_note1 53, 71, 51
+layer_note1 28, 89, 108
+layer_note1 33, 43, 44
+layer_note1 21, 20, 113
+layer_note1 58, 77, 115
+layer_note1 25, 8, 90
+layer_note1 37, 59, 53
+layer_note1 57, 40, 96
+layer_note1 56, 14, 82
+layer_note1 36, 86, 45
+layer_note1 45, 11, 52
+layer_note1 53, 69, 51
+layer_note1 41, 87, 121
+layer_jump .layer4_2
+
@@ -0,0 +1,382 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 90
+seq_initchannels 0x3f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 78
+chan_setreverb 27
+chan_setvol 108
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+chan_setlayer 2, .layer0_2
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_delay 18
+layer_note1 20, 34, 119
+layer_note1 21, 19, 50
+layer_note1 51, 59, 42
+layer_note1 47, 51, 47
+layer_note1 22, 81, 87
+layer_note1 59, 33, 86
+layer_note1 43, 79, 76
+layer_note1 40, 79, 50
+layer_note1 31, 67, 115
+layer_note1 30, 29, 62
+layer_note1 53, 31, 114
+layer_delay 12
+layer_note1 56, 41, 113
+layer_note1 57, 48, 53
+layer_note1 38, 75, 79
+layer_note1 49, 76, 67
+layer_note1 26, 85, 55
+layer_note1 51, 36, 82
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 57, 18, 89
+layer_note1 22, 13, 120
+layer_note1 21, 26, 68
+layer_note1 34, 13, 108
+layer_note1 48, 17, 84
+layer_delay 30
+layer_note1 22, 15, 73
+layer_note1 32, 64, 77
+layer_note1 26, 77, 107
+layer_note1 54, 77, 70
+layer_note1 46, 27, 41
+layer_note1 41, 90, 93
+layer_jump .layer0_1
+
+.layer0_2:
+layer_note1 46, 14, 121
+layer_note1 54, 43, 94
+layer_note1 55, 84, 110
+layer_delay 24
+layer_delay 46
+layer_delay 41
+layer_note1 47, 37, 61
+layer_note1 25, 49, 111
+layer_note1 27, 36, 111
+layer_note1 48, 40, 40
+layer_note1 21, 24, 91
+layer_note1 21, 28, 123
+layer_note1 47, 16, 93
+layer_jump .layer0_2
+
+.channel1:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 122
+chan_setreverb 38
+chan_setvol 82
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+chan_setlayer 2, .layer1_2
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 25, 34, 47
+layer_note1 51, 54, 42
+layer_note1 58, 58, 77
+layer_note1 46, 50, 78
+layer_note1 41, 26, 89
+layer_delay 48
+layer_note1 55, 38, 108
+layer_note1 25, 55, 67
+layer_note1 29, 70, 87
+layer_delay 35
+layer_note1 37, 78, 96
+layer_delay 8
+layer_note1 27, 37, 112
+layer_note1 22, 58, 50
+layer_note1 43, 78, 58
+layer_note1 25, 29, 105
+layer_note1 43, 43, 50
+layer_jump .layer1_0
+
+.layer1_1:
+layer_delay 13
+layer_note1 31, 8, 57
+layer_note1 28, 43, 100
+layer_note1 38, 78, 46
+layer_note1 58, 81, 53
+layer_note1 28, 50, 51
+layer_note1 33, 32, 94
+layer_note1 59, 34, 108
+layer_note1 47, 90, 86
+layer_note1 34, 77, 79
+layer_note1 60, 22, 85
+layer_note1 39, 11, 102
+layer_note1 33, 89, 108
+layer_jump .layer1_1
+
+.layer1_2:
+layer_note1 46, 60, 47
+layer_delay 33
+layer_note1 30, 81, 93
+layer_note1 40, 10, 125
+layer_note1 31, 57, 87
+layer_note1 21, 74, 119
+layer_note1 58, 29, 96
+layer_note1 47, 14, 98
+layer_note1 45, 87, 88
+layer_note1 22, 59, 89
+layer_note1 37, 27, 58
+layer_note1 24, 81, 105
+layer_note1 27, 14, 94
+layer_jump .layer1_2
+
+.channel2:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 37
+chan_setreverb 41
+chan_setvol 99
+chan_setlayer 0, .layer2_0
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 58, 32, 108
+layer_note1 42, 45, 74
+layer_note1 47, 69, 109
+layer_note1 54, 43, 83
+layer_note1 21, 34, 125
+layer_note1 55, 25, 48
+layer_note1 28, 91, 54
+layer_note1 39, 38, 54
+layer_jump .layer2_0
+
+.channel3:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 20
+chan_setreverb 50
+chan_setvol 64
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+chan_setlayer 2, .layer3_2
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 60, 10, 105
+layer_note1 54, 79, 93
+layer_note1 20, 31, 124
+layer_note1 24, 90, 56
+layer_note1 33, 68, 47
+layer_note1 29, 39, 40
+layer_note1 44, 11, 112
+layer_note1 46, 11, 121
+layer_delay 15
+layer_note1 42, 88, 114
+layer_note1 55, 59, 41
+layer_note1 25, 64, 81
+layer_note1 59, 10, 61
+layer_note1 27, 24, 60
+layer_delay 43
+layer_note1 27, 84, 94
+layer_note1 32, 27, 106
+layer_note1 57, 82, 66
+layer_note1 37, 90, 116
+layer_delay 43
+layer_note1 28, 20, 105
+layer_note1 24, 32, 126
+layer_note1 41, 18, 71
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 47, 64, 67
+layer_note1 55, 37, 82
+layer_delay 43
+layer_note1 26, 22, 59
+layer_delay 29
+layer_note1 22, 63, 46
+layer_note1 36, 50, 66
+layer_note1 41, 44, 51
+layer_note1 50, 19, 91
+layer_note1 44, 54, 122
+layer_note1 31, 78, 123
+layer_note1 21, 10, 82
+layer_jump .layer3_1
+
+.layer3_2:
+layer_delay 48
+layer_note1 60, 48, 90
+layer_note1 29, 58, 78
+layer_delay 23
+layer_note1 58, 87, 119
+layer_note1 60, 71, 91
+layer_note1 31, 82, 74
+layer_note1 41, 25, 41
+layer_note1 39, 76, 50
+layer_note1 50, 50, 46
+layer_note1 25, 41, 62
+layer_delay 45
+layer_jump .layer3_2
+
+.channel4:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 93
+chan_setreverb 27
+chan_setvol 91
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+chan_setlayer 2, .layer4_2
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 53, 94, 73
+layer_note1 32, 33, 127
+layer_note1 54, 24, 102
+layer_note1 46, 49, 87
+layer_note1 57, 60, 46
+layer_note1 40, 81, 54
+layer_delay 14
+layer_delay 13
+layer_note1 38, 22, 85
+layer_note1 43, 48, 77
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 59, 32, 112
+layer_note1 58, 82, 76
+layer_note1 22, 89, 60
+layer_note1 22, 64, 109
+layer_note1 22, 22, 101
+layer_delay 29
+layer_note1 60, 62, 69
+layer_note1 29, 90, 64
+layer_note1 37, 79, 64
+layer_delay 37
+layer_note1 20, 40, 72
+layer_note1 50, 28, 118
+layer_note1 46, 31, 54
+layer_note1 44, 6, 92
+layer_delay 23
+layer_note1 34, 33, 70
+layer_delay 24
+layer_note1 46, 16, 62
+layer_note1 32, 11, 109
+layer_note1 24, 8, 40
+layer_note1 22, 79, 43
+layer_note1 40, 79, 101
+layer_jump .layer4_1
+
+.layer4_2:
+layer_note1 34, 40, 47
+layer_note1 28, 6, 52
+layer_delay 12
+layer_delay 21
+layer_note1 25, 94, 96
+layer_note1 51, 68, 105
+layer_note1 22, 11, 110
+layer_note1 20, 47, 104
+layer_note1 50, 6, 113
+layer_note1 40, 83, 114
+layer_jump .layer4_2
+
+.channel5:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 84
+chan_setreverb 48
+chan_setvol 126
+chan_setlayer 0, .layer5_0
+chan_setlayer 1, .layer5_1
+chan_setlayer 2, .layer5_2
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_note1 31, 68, 86
+layer_delay 24
+layer_note1 40, 87, 124
+layer_note1 39, 43, 68
+layer_note1 22, 13, 49
+layer_note1 45, 86, 113
+layer_note1 46, 34, 114
+layer_delay 38
+layer_note1 32, 60, 54
+layer_note1 48, 78, 125
+layer_delay 23
+layer_delay 12
+layer_note1 34, 10, 83
+layer_note1 31, 74, 89
+layer_delay 39
+layer_note1 30, 32, 83
+layer_note1 28, 75, 60
+layer_note1 43, 67, 60
+layer_note1 45, 9, 45
+layer_note1 54, 60, 69
+layer_note1 42, 24, 98
+layer_note1 21, 80, 111
+layer_note1 50, 30, 68
+layer_note1 54, 63, 109
+layer_jump .layer5_0
+
+.layer5_1:
+layer_delay 35
+layer_note1 55, 59, 83
+layer_delay 20
+layer_note1 30, 93, 78
+layer_note1 32, 8, 85
+layer_note1 49, 43, 119
+layer_note1 25, 27, 116
+layer_delay 9
+layer_note1 43, 16, 68
+layer_delay 11
+layer_note1 53, 20, 83
+layer_note1 58, 94, 54
+layer_note1 41, 22, 112
+layer_note1 49, 25, 79
+layer_note1 26, 46, 102
+layer_note1 35, 29, 115
+layer_note1 47, 74, 113
+layer_note1 32, 83, 62
+layer_note1 45, 85, 90
+layer_note1 46, 45, 62
+layer_note1 50, 21, 115
+layer_note1 25, 82, 51
+layer_jump .layer5_1
+
+.layer5_2:
+layer_note1 59, 29, 42
+layer_note1 28, 67, 83
+layer_note1 56, 87, 84
+layer_note1 36, 95, 84
+layer_note1 45, 25, 122
+layer_note1 40, 55, 69
+layer_delay 32
+layer_delay 28
+layer_jump .layer5_2
+
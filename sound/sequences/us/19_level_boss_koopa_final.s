@@ -0,0 +1,255 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 154
+seq_initchannels 0x7f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+seq_startchannel 6, .channel6
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 55
+chan_setreverb 10
+chan_setvol 84
+chan_setlayer 0, .layer0_0
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 29, 96, 76
+layer_note1 20, 62, 99
+layer_note1 60, 20, 43
+layer_note1 51, 62, 127
+layer_note1 25, 93, 72
+layer_note1 30, 93, 81
+layer_note1 24, 75, 123
+layer_note1 22, 33, 80
+layer_note1 24, 45, 52
+layer_note1 58, 25, 102
+layer_jump .layer0_0
+
+.channel1:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 68
+chan_setreverb 35
+chan_setvol 95
+chan_setlayer 0, .layer1_0
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 29, 89, 58
+layer_note1 32, 91, 117
+layer_note1 28, 66, 104
+layer_note1 52, 34, 108
+layer_note1 25, 86, 57
+layer_note1 54, 89, 69
+layer_note1 39, 57, 48
+layer_note1 40, 38, 63
+layer_note1 47, 49, 71
+layer_note1 22, 13, 97
+layer_jump .layer1_0
+
+.channel2:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 112
+chan_setreverb 28
+chan_setvol 71
+chan_setlayer 0, .layer2_0
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 46, 54, 108
+layer_note1 53, 58, 90
+layer_note1 38, 44, 87
+layer_note1 41, 14, 114
+layer_note1 21, 39, 109
+layer_delay 47
+layer_note1 60, 56, 77
+layer_note1 44, 92, 87
+layer_note1 20, 56, 42
+layer_note1 24, 27, 69
+layer_jump .layer2_0
+
+.channel3:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 54
+chan_setreverb 60
+chan_setvol 117
+chan_setlayer 0, .layer3_0
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 27, 16, 46
+layer_note1 21, 77, 102
+layer_delay 27
+layer_note1 26, 29, 54
+layer_delay 38
+layer_note1 58, 72, 103
+layer_note1 39, 38, 127
+layer_note1 49, 64, 122
+layer_note1 29, 49, 50
+layer_note1 29, 29, 56
+layer_note1 41, 42, 69
+layer_note1 28, 37, 52
+layer_note1 60, 83, 117
+layer_jump .layer3_0
+
+.channel4:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 69
+chan_setreverb 29
+chan_setvol 68
+chan_setlayer 0, .layer4_0
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 59, 78, 100
+layer_note1 49, 94, 59
+layer_note1 31, 27, 64
+layer_note1 34, 7, 69
+layer_note1 50, 92, 119
+layer_note1 35, 48, 73
+layer_note1 50, 76, 76
+layer_note1 35, 50, 120
+layer_note1 38, 34, 86
+layer_note1 52, 56, 82
+layer_delay 28
+layer_note1 48, 51, 97
+layer_note1 46, 36, 44
+layer_delay 39
+layer_jump .layer4_0
+
+.channel5:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 77
+chan_setreverb 40
+chan_setvol 68
+chan_setlayer 0, .layer5_0
+chan_setlayer 1, .layer5_1
+chan_setlayer 2, .layer5_2
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_note1 58, 33, 85
+layer_delay 13
+layer_note1 53, 33, 106
+layer_note1 60, 96, 87
+layer_note1 53, 63, 76
+layer_note1 30, 42, 114
+layer_delay 45
+layer_delay 10
+layer_note1 20, 37, 105
+layer_note1 51, 23, 108
+layer_note1 58, 50, 52
+layer_note1 27, 49, 120
+layer_note1 58, 35, 114
+layer_note1 31, 82, 93
+layer_note1 36, 66, 88
+layer_note1 49, 75, 86
+layer_note1 50, 91, 71
+layer_note1 30, 74, 40
+layer_note1 28, 77, 49
+layer_jump .layer5_0
+
+.layer5_1:
+layer_note1 59, 37, 97
+layer_note1 40, 79, 64
+layer_note1 43, 83, 100
+layer_note1 28, 91, 60
+layer_note1 37, 60, 64
+layer_note1 27, 35, 95
+layer_note1 59, 43, 65
+layer_note1 33, 40, 95
+layer_note1 56, 83, 69
+layer_note1 53, 20, 75
+layer_delay 6
+layer_delay 42
+layer_note1 29, 73, 40
+layer_note1 60, 29, 92
+layer_note1 38, 92, 57
+layer_note1 24, 32, 52
+layer_note1 39, 24, 116
+layer_note1 26, 35, 91
+layer_note1 30, 84, 103
+layer_note1 22, 18, 119
+layer_note1 37, 59, 95
+layer_note1 26, 42, 86
+layer_note1 58, 83, 95
+layer_note1 30, 24, 78
+layer_jump .layer5_1
+
+.layer5_2:
+layer_note1 20, 24, 42
+layer_note1 48, 86, 44
+layer_note1 24, 91, 63
+layer_note1 45, 27, 87
+layer_note1 56, 81, 72
+layer_delay 28
+layer_note1 40, 38, 127
+layer_note1 56, 96, 108
+layer_note1 41, 24, 125
+layer_note1 35, 22, 58
+layer_note1 46, 55, 92
+layer_jump .layer5_2
+
+.channel6:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 109
+chan_setreverb 16
+chan_setvol 111
+chan_setlayer 0, .layer6_0
+.chan_loop6:
+chan_delay 0x7fff
+chan_jump .chan_loop6
+
+.layer6_0:
+layer_note1 33, 54, 54
+layer_note1 28, 30, 99
+layer_note1 60, 47, 60
+layer_note1 56, 9, 67
+layer_note1 57, 46, 122
+layer_delay 16
+layer_delay 41
+layer_note1 57, 35, 126
+layer_note1 42, 71, 112
+layer_note1 60, 62, 70
+layer_note1 38, 92, 114
+layer_note1 54, 57, 40
+layer_delay 26
+layer_delay 18
+layer_note1 45, 27, 66
+layer_note1 39, 50, 100
+layer_note1 40, 16, 56
+layer_jump .layer6_0
+
@@ -0,0 +1,299 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 81
+seq_initchannels 0x7f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+seq_startchannel 6, .channel6
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 78
+chan_setreverb 40
+chan_setvol 120
+chan_setlayer 0, .layer0_0
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_delay 42
+layer_note1 57, 21, 113
+layer_note1 32, 71, 119
+layer_note1 31, 76, 85
+layer_note1 53, 19, 121
+layer_note1 58, 80, 85
+layer_note1 32, 92, 60
+layer_note1 24, 15, 91
+layer_note1 52, 87, 56
+layer_note1 22, 75, 62
+layer_delay 43
+layer_note1 47, 77, 97
+layer_note1 51, 84, 104
+layer_note1 48, 13, 103
+layer_note1 23, 58, 88
+layer_note1 49, 8, 101
+layer_jump .layer0_0
+
+.channel1:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 109
+chan_setreverb 39
+chan_setvol 104
+chan_setlayer 0, .layer1_0
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_delay 20
+layer_note1 60, 23, 68
+layer_note1 43, 32, 61
+layer_note1 59, 75, 106
+layer_note1 39, 52, 103
+layer_note1 49, 93, 94
+layer_note1 42, 70, 54
+layer_note1 36, 59, 80
+layer_note1 56, 84, 69
+layer_note1 31, 85, 73
+layer_note1 36, 81, 44
+layer_delay 16
+layer_jump .layer1_0
+
+.channel2:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 69
+chan_setreverb 57
+chan_setvol 82
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+chan_setlayer 2, .layer2_2
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_delay 32
+layer_note1 58, 95, 123
+layer_note1 43, 22, 75
+layer_note1 57, 17, 112
+layer_note1 55, 96, 121
+layer_note1 30, 15, 49
+layer_note1 21, 47, 61
+layer_note1 34, 39, 49
+layer_note1 27, 43, 43
+layer_note1 38, 52, 76
+layer_note1 23, 26, 75
+layer_note1 22, 72, 79
+layer_delay 24
+layer_delay 44
+layer_note1 41, 67, 47
+layer_note1 48, 52, 104
+layer_delay 34
+layer_note1 29, 52, 93
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 26, 22, 114
+layer_note1 20, 22, 57
+layer_note1 60, 46, 77
+layer_note1 22, 15, 87
+layer_note1 26, 20, 111
+layer_note1 22, 20, 126
+layer_note1 51, 13, 49
+layer_note1 32, 14, 101
+layer_note1 45, 85, 74
+layer_note1 30, 55, 86
+layer_jump .layer2_1
+
+.layer2_2:
+layer_delay 11
+layer_note1 52, 75, 108
+layer_note1 24, 70, 88
+layer_delay 34
+layer_delay 47
+layer_note1 34, 54, 63
+layer_note1 28, 70, 64
+layer_note1 47, 94, 65
+layer_delay 35
+layer_note1 39, 36, 84
+layer_note1 31, 26, 94
+layer_jump .layer2_2
+
+.channel3:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 82
+chan_setreverb 31
+chan_setvol 89
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+chan_setlayer 2, .layer3_2
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 47, 83, 97
+layer_note1 33, 50, 120
+layer_note1 23, 71, 42
+layer_note1 27, 75, 90
+layer_note1 59, 24, 123
+layer_note1 42, 59, 94
+layer_note1 40, 10, 48
+layer_note1 51, 65, 71
+layer_delay 23
+layer_note1 20, 60, 41
+layer_delay 19
+layer_delay 6
+layer_delay 37
+layer_delay 13
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 60, 71, 74
+layer_note1 53, 57, 102
+layer_note1 53, 22, 116
+layer_note1 30, 70, 119
+layer_note1 36, 8, 88
+layer_note1 23, 70, 87
+layer_note1 29, 20, 100
+layer_note1 36, 8, 44
+layer_note1 54, 62, 108
+layer_note1 47, 81, 109
+layer_note1 52, 18, 113
+layer_jump .layer3_1
+
+.layer3_2:
+layer_note1 58, 74, 80
+layer_note1 53, 96, 44
+layer_delay 15
+layer_note1 53, 41, 75
+layer_note1 60, 69, 55
+layer_note1 54, 76, 119
+layer_note1 42, 94, 43
+layer_delay 32
+layer_note1 21, 35, 84
+layer_note1 27, 57, 85
+layer_note1 40, 8, 127
+layer_jump .layer3_2
+
+.channel4:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 17
+chan_setreverb 2
+chan_setvol 115
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 56, 24, 43
+layer_note1 56, 9, 116
+layer_note1 60, 76, 99
+layer_note1 38, 35, 76
+layer_delay 7
+layer_note1 46, 74, 95
+layer_note1 57, 81, 51
+layer_note1 47, 79, 74
+layer_note1 38, 41, 68
+layer_note1 21, 49, 61
+layer_note1 23, 84, 115
+layer_note1 33, 49, 117
+layer_note1 20, 95, 49
+layer_delay 12
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 59, 66, 125
+layer_note1 51, 16, 101
+layer_note1 59, 52, 123
+layer_note1 31, 49, 65
+layer_delay 16
+layer_note1 34, 90, 94
+layer_note1 34, 32, 124
+layer_note1 24, 38, 54
+layer_note1 44, 61, 125
+layer_note1 51, 78, 113
+layer_delay 24
+layer_jump .layer4_1
+
+.channel5:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 115
+chan_setreverb 41
+chan_setvol 88
+chan_setlayer 0, .layer5_0
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_delay 21
+layer_delay 31
+layer_note1 29, 96, 53
+layer_note1 23, 90, 80
+layer_note1 52, 96, 89
+layer_delay 45
+layer_note1 26, 30, 69
+layer_note1 41, 22, 121
+layer_jump .layer5_0
+
+.channel6:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 50
+chan_setreverb 41
+chan_setvol 95
+chan_setlayer 0, .layer6_0
+.chan_loop6:
+chan_delay 0x7fff
+chan_jump .chan_loop6
+
+.layer6_0:
+layer_note1 29, 20, 112
+layer_note1 33, 51, 115
+layer_note1 56, 15, 88
+layer_delay 35
+layer_note1 31, 75, 122
+layer_note1 55, 31, 82
+layer_note1 45, 17, 64
+layer_note1 42, 34, 124
+layer_note1 53, 38, 107
+layer_note1 58, 10, 65
+layer_delay 48
+layer_note1 31, 75, 45
+layer_delay 15
+layer_note1 23, 11, 107
+layer_note1 39, 90, 77
+layer_note1 20, 43, 45
+layer_note1 35, 79, 127
+layer_note1 29, 46, 87
+layer_note1 31, 94, 78
+layer_note1 57, 15, 79
+layer_note1 28, 53, 120
+layer_note1 59, 37, 109
+layer_note1 28, 57, 124
+layer_note1 47, 39, 88
+layer_jump .layer6_0
+
@@ -0,0 +1,254 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 106
+seq_initchannels 0x1f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 14
+chan_setreverb 8
+chan_setvol 121
+chan_setlayer 0, .layer0_0
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 47, 37, 92
+layer_note1 32, 94, 43
+layer_note1 34, 24, 56
+layer_note1 50, 55, 86
+layer_note1 57, 9, 43
+layer_note1 38, 75, 108
+layer_delay 8
+layer_note1 49, 82, 124
+layer_note1 40, 91, 94
+layer_note1 32, 13, 72
+layer_note1 59, 55, 94
+layer_note1 29, 13, 52
+layer_delay 40
+layer_note1 22, 12, 92
+layer_note1 58, 17, 109
+layer_note1 46, 11, 93
+layer_note1 57, 15, 45
+layer_note1 35, 16, 57
+layer_note1 37, 50, 117
+layer_note1 47, 50, 106
+layer_note1 44, 10, 45
+layer_note1 20, 72, 54
+layer_note1 59, 94, 100
+layer_delay 17
+layer_jump .layer0_0
+
+.channel1:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 4
+chan_setreverb 51
+chan_setvol 114
+chan_setlayer 0, .layer1_0
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 30, 14, 77
+layer_note1 26, 14, 117
+layer_note1 21, 93, 94
+layer_note1 37, 68, 81
+layer_note1 55, 56, 43
+layer_delay 19
+layer_note1 39, 35, 58
+layer_note1 52, 55, 91
+layer_note1 40, 95, 50
+layer_note1 24, 25, 45
+layer_delay 31
+layer_note1 24, 31, 75
+layer_note1 50, 33, 124
+layer_note1 20, 73, 52
+layer_delay 19
+layer_note1 26, 24, 111
+layer_note1 22, 85, 127
+layer_jump .layer1_0
+
+.channel2:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 42
+chan_setreverb 60
+chan_setvol 127
+chan_setlayer 0, .layer2_0
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 54, 20, 93
+layer_note1 33, 49, 61
+layer_note1 55, 7, 78
+layer_note1 32, 92, 107
+layer_note1 57, 69, 81
+layer_note1 37, 88, 77
+layer_note1 57, 66, 46
+layer_note1 45, 13, 46
+layer_note1 39, 29, 116
+layer_jump .layer2_0
+
+.channel3:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 59
+chan_setreverb 14
+chan_setvol 92
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+chan_setlayer 2, .layer3_2
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 21, 83, 80
+layer_note1 49, 43, 52
+layer_note1 52, 18, 40
+layer_note1 58, 80, 49
+layer_delay 47
+layer_note1 25, 95, 85
+layer_delay 31
+layer_note1 32, 59, 72
+layer_note1 36, 18, 121
+layer_note1 24, 53, 99
+layer_note1 29, 94, 53
+layer_note1 55, 34, 124
+layer_note1 28, 69, 46
+layer_note1 59, 65, 53
+layer_note1 39, 34, 96
+layer_note1 50, 32, 60
+layer_delay 10
+layer_note1 56, 90, 64
+layer_note1 26, 40, 127
+layer_note1 56, 64, 55
+layer_note1 42, 79, 92
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 47, 71, 65
+layer_note1 26, 95, 119
+layer_note1 28, 76, 90
+layer_note1 24, 63, 107
+layer_note1 22, 44, 58
+layer_note1 60, 52, 122
+layer_note1 52, 52, 113
+layer_note1 56, 91, 42
+layer_note1 46, 96, 43
+layer_note1 20, 52, 60
+layer_note1 42, 52, 70
+layer_note1 52, 13, 115
+layer_note1 46, 77, 50
+layer_note1 20, 35, 106
+layer_note1 59, 66, 103
+layer_note1 29, 80, 108
+layer_delay 30
+layer_note1 23, 94, 79
+layer_note1 38, 69, 114
+layer_note1 33, 13, 97
+layer_note1 60, 37, 59
+layer_note1 43, 78, 43
+layer_jump .layer3_1
+
+.layer3_2:
+layer_note1 59, 19, 60
+layer_note1 41, 88, 89
+layer_note1 38, 60, 80
+layer_note1 51, 42, 79
+layer_note1 60, 74, 75
+layer_note1 37, 66, 102
+layer_note1 38, 92, 115
+layer_delay 28
+layer_note1 56, 39, 125
+layer_note1 35, 82, 67
+layer_note1 32, 14, 50
+layer_note1 29, 30, 101
+layer_note1 23, 95, 103
+layer_note1 35, 71, 78
+layer_note1 30, 75, 125
+layer_note1 44, 31, 45
+layer_note1 23, 96, 83
+layer_note1 43, 55, 92
+layer_note1 23, 16, 50
+layer_jump .layer3_2
+
+.channel4:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 90
+chan_setreverb 36
+chan_setvol 69
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_delay 7
+layer_note1 36, 21, 72
+layer_note1 49, 52, 78
+layer_note1 48, 48, 78
+layer_note1 30, 45, 74
+layer_note1 58, 7, 119
+layer_note1 24, 53, 47
+layer_delay 8
+layer_note1 44, 36, 103
+layer_note1 56, 59, 49
+layer_note1 34, 80, 105
+layer_note1 34, 68, 77
+layer_note1 38, 80, 61
+layer_note1 21, 89, 53
+layer_delay 15
+layer_note1 29, 82, 125
+layer_note1 39, 8, 67
+layer_note1 23, 73, 78
+layer_note1 48, 76, 68
+layer_note1 32, 77, 76
+layer_note1 52, 21, 126
+layer_note1 46, 78, 40
+layer_note1 47, 50, 63
+layer_note1 38, 7, 90
+layer_jump .layer4_0
+
+.layer4_1:
+layer_delay 45
+layer_note1 20, 51, 47
+layer_note1 47, 63, 79
+layer_delay 13
+layer_note1 36, 67, 114
+layer_note1 35, 88, 41
+layer_delay 9
+layer_note1 59, 71, 48
+layer_note1 47, 73, 122
+layer_note1 28, 88, 114
+layer_delay 43
+layer_note1 59, 45, 119
+layer_note1 29, 49, 105
+layer_note1 45, 30, 82
+layer_note1 31, 49, 57
+layer_note1 50, 70, 105
+layer_note1 45, 41, 104
+layer_jump .layer4_1
+
@@ -0,0 +1,380 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 115
+seq_initchannels 0x7f
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+seq_startchannel 6, .channel6
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 50
+chan_setreverb 4
+chan_setvol 68
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 45, 29, 71
+layer_note1 51, 15, 121
+layer_note1 25, 84, 94
+layer_note1 23, 90, 96
+layer_note1 20, 88, 101
+layer_note1 59, 49, 118
+layer_note1 53, 24, 52
+layer_note1 39, 10, 127
+layer_note1 30, 64, 59
+layer_note1 23, 28, 123
+layer_delay 15
+layer_note1 56, 79, 93
+layer_delay 34
+layer_note1 49, 51, 41
+layer_note1 36, 28, 101
+layer_note1 53, 13, 106
+layer_note1 33, 68, 111
+layer_delay 27
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 60, 20, 78
+layer_note1 55, 95, 50
+layer_note1 49, 42, 105
+layer_delay 7
+layer_note1 33, 67, 110
+layer_note1 27, 6, 115
+layer_delay 18
+layer_note1 59, 18, 44
+layer_note1 46, 64, 40
+layer_jump .layer0_1
+
+.channel1:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 90
+chan_setreverb 47
+chan_setvol 61
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+chan_setlayer 2, .layer1_2
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 32, 48, 89
+layer_note1 24, 50, 45
+layer_note1 25, 43, 69
+layer_delay 35
+layer_note1 50, 19, 69
+layer_note1 37, 9, 124
+layer_note1 39, 74, 99
+layer_note1 47, 44, 125
+layer_note1 29, 48, 112
+layer_note1 34, 21, 100
+layer_note1 58, 95, 50
+layer_note1 40, 45, 45
+layer_delay 31
+layer_note1 43, 32, 61
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 48, 12, 114
+layer_note1 48, 83, 46
+layer_note1 54, 31, 52
+layer_note1 54, 62, 86
+layer_note1 52, 32, 90
+layer_note1 30, 7, 84
+layer_note1 32, 47, 88
+layer_note1 24, 37, 116
+layer_jump .layer1_1
+
+.layer1_2:
+layer_note1 23, 95, 120
+layer_delay 44
+layer_note1 54, 17, 97
+layer_delay 14
+layer_note1 56, 68, 82
+layer_note1 54, 54, 83
+layer_note1 24, 69, 84
+layer_note1 50, 44, 102
+layer_note1 34, 73, 118
+layer_note1 35, 34, 84
+layer_jump .layer1_2
+
+.channel2:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 78
+chan_setreverb 44
+chan_setvol 97
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+chan_setlayer 2, .layer2_2
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 51, 40, 93
+layer_note1 31, 20, 107
+layer_note1 22, 13, 97
+layer_note1 36, 18, 54
+layer_note1 35, 44, 110
+layer_note1 56, 61, 119
+layer_note1 37, 74, 45
+layer_note1 23, 64, 55
+layer_delay 21
+layer_note1 54, 49, 127
+layer_note1 27, 8, 69
+layer_delay 40
+layer_note1 41, 6, 94
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 43, 42, 126
+layer_delay 17
+layer_note1 29, 28, 42
+layer_note1 51, 88, 45
+layer_note1 57, 21, 103
+layer_note1 41, 65, 83
+layer_note1 32, 81, 82
+layer_note1 46, 70, 98
+layer_note1 24, 61, 123
+layer_note1 45, 87, 126
+layer_jump .layer2_1
+
+.layer2_2:
+layer_note1 47, 61, 60
+layer_note1 27, 23, 127
+layer_note1 32, 24, 76
+layer_note1 52, 55, 82
+layer_note1 37, 48, 51
+layer_delay 10
+layer_note1 46, 9, 106
+layer_note1 20, 88, 122
+layer_note1 52, 68, 42
+layer_note1 50, 21, 103
+layer_note1 46, 74, 90
+layer_note1 40, 47, 111
+layer_note1 36, 7, 127
+layer_note1 48, 8, 94
+layer_note1 52, 54, 47
+layer_note1 54, 59, 110
+layer_delay 41
+layer_note1 59, 22, 56
+layer_note1 51, 30, 41
+layer_note1 55, 62, 102
+layer_jump .layer2_2
+
+.channel3:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 20
+chan_setreverb 39
+chan_setvol 109
+chan_setlayer 0, .layer3_0
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 37, 36, 79
+layer_note1 59, 72, 93
+layer_delay 30
+layer_note1 33, 18, 78
+layer_note1 53, 85, 58
+layer_note1 27, 20, 86
+layer_note1 55, 77, 101
+layer_note1 34, 58, 58
+layer_note1 24, 96, 99
+layer_note1 47, 69, 126
+layer_note1 22, 71, 44
+layer_note1 51, 94, 40
+layer_note1 36, 29, 61
+layer_note1 51, 75, 116
+layer_jump .layer3_0
+
+.channel4:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 126
+chan_setreverb 43
+chan_setvol 108
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 35, 66, 42
+layer_note1 46, 33, 116
+layer_delay 30
+layer_note1 25, 71, 73
+layer_note1 60, 42, 116
+layer_note1 43, 37, 93
+layer_note1 26, 51, 66
+layer_note1 44, 26, 48
+layer_note1 23, 35, 47
+layer_note1 51, 13, 47
+layer_note1 29, 21, 102
+layer_jump .layer4_0
+
+.layer4_1:
+layer_delay 13
+layer_note1 42, 55, 106
+layer_note1 55, 91, 40
+layer_note1 53, 56, 55
+layer_note1 60, 78, 89
+layer_delay 24
+layer_note1 32, 91, 69
+layer_note1 55, 68, 53
+layer_note1 27, 59, 99
+layer_note1 30, 23, 48
+layer_note1 55, 78, 68
+layer_delay 44
+layer_note1 37, 72, 120
+layer_note1 53, 25, 64
+layer_note1 26, 14, 72
+layer_delay 12
+layer_note1 31, 70, 66
+layer_note1 23, 49, 49
+layer_note1 26, 8, 109
+layer_note1 34, 10, 76
+layer_delay 13
+layer_jump .layer4_1
+
+.channel5:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 82
+chan_setreverb 40
+chan_setvol 97
+chan_setlayer 0, .layer5_0
+chan_setlayer 1, .layer5_1
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_delay 29
+layer_note1 37, 57, 120
+layer_note1 35, 57, 118
+layer_note1 23, 7, 96
+layer_note1 58, 22, 63
+layer_note1 51, 95, 124
+layer_note1 24, 51, 126
+layer_note1 20, 62, 75
+layer_note1 53, 63, 66
+layer_note1 48, 36, 122
+layer_note1 53, 91, 79
+layer_note1 48, 37, 115
+layer_note1 35, 71, 104
+layer_note1 60, 35, 99
+layer_note1 28, 78, 55
+layer_note1 59, 37, 95
+layer_note1 51, 73, 58
+layer_delay 7
+layer_note1 24, 26, 102
+layer_note1 32, 43, 106
+layer_jump .layer5_0
+
+.layer5_1:
+layer_note1 39, 38, 54
+layer_note1 58, 85, 112
+layer_note1 33, 85, 99
+layer_note1 26, 89, 61
+layer_note1 60, 96, 98
+layer_delay 8
+layer_note1 45, 76, 105
+layer_note1 21, 6, 44
+layer_note1 29, 61, 114
+layer_note1 34, 85, 68
+layer_note1 30, 28, 52
+layer_note1 34, 81, 48
+layer_note1 22, 49, 101
+layer_note1 50, 65, 110
+layer_jump .layer5_1
+
+.channel6:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 61
+chan_setreverb 9
+chan_setvol 79
+chan_setlayer 0, .layer6_0
+chan_setlayer 1, .layer6_1
+chan_setlayer 2, .layer6_2
+.chan_loop6:
+chan_delay 0x7fff
+chan_jump .chan_loop6
+
+.layer6_0:
+layer_note1 53, 92, 92
+layer_note1 55, 60, 66
+layer_note1 55, 37, 115
+layer_note1 56, 22, 120
+layer_note1 34, 90, 49
+layer_note1 59, 32, 78
+layer_note1 24, 32, 101
+layer_note1 25, 55, 107
+layer_note1 40, 21, 103
+layer_jump .layer6_0
+
+.layer6_1:
+layer_note1 47, 27, 118
+layer_note1 44, 79, 121
+layer_note1 32, 33, 71
+layer_note1 35, 51, 102
+layer_note1 23, 50, 110
+layer_note1 53, 81, 83
+layer_note1 46, 20, 96
+layer_note1 55, 13, 58
+layer_note1 39, 43, 92
+layer_note1 25, 88, 109
+layer_note1 42, 21, 69
+layer_delay 14
+layer_note1 38, 6, 114
+layer_note1 50, 66, 48
+layer_delay 32
+layer_delay 41
+layer_note1 33, 85, 48
+layer_note1 52, 10, 45
+layer_delay 33
+layer_note1 36, 7, 69
+layer_note1 27, 60, 41
+layer_note1 56, 41, 69
+layer_note1 48, 71, 68
+layer_note1 35, 27, 101
+layer_jump .layer6_1
+
+.layer6_2:
+layer_note1 51, 89, 108
+layer_note1 60, 6, 82
+layer_note1 20, 81, 70
+layer_note1 33, 52, 117
+layer_note1 23, 27, 87
+layer_delay 19
+layer_note1 34, 91, 55
+layer_note1 26, 33, 57
+layer_note1 31, 34, 77
+layer_note1 56, 27, 121
+layer_jump .layer6_2
+
@@ -0,0 +1,204 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 96
+seq_initchannels 0xf
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 57
+chan_setreverb 8
+chan_setvol 119
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 45, 26, 56
+layer_note1 32, 9, 92
+layer_note1 26, 59, 80
+layer_note1 28, 28, 104
+layer_note1 37, 84, 69
+layer_note1 48, 22, 65
+layer_delay 24
+layer_note1 36, 16, 106
+layer_note1 37, 21, 113
+layer_note1 30, 31, 87
+layer_delay 33
+layer_note1 51, 53, 60
+layer_note1 36, 55, 104
+layer_note1 31, 35, 62
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 32, 94, 108
+layer_note1 21, 34, 65
+layer_delay 26
+layer_note1 45, 19, 103
+layer_note1 29, 69, 106
+layer_note1 48, 78, 94
+layer_note1 46, 37, 99
+layer_note1 38, 65, 69
+layer_note1 22, 7, 95
+layer_note1 55, 38, 96
+layer_delay 39
+layer_note1 20, 88, 98
+layer_note1 43, 16, 68
+layer_note1 55, 19, 119
+layer_delay 47
+layer_note1 52, 83, 123
+layer_note1 29, 30, 61
+layer_jump .layer0_1
+
+.channel1:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 115
+chan_setreverb 32
+chan_setvol 100
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+chan_setlayer 2, .layer1_2
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 45, 57, 91
+layer_note1 24, 48, 70
+layer_note1 41, 79, 113
+layer_note1 43, 73, 51
+layer_note1 26, 88, 90
+layer_note1 49, 23, 51
+layer_note1 23, 23, 78
+layer_note1 60, 31, 42
+layer_note1 29, 84, 113
+layer_note1 21, 65, 42
+layer_note1 27, 58, 44
+layer_delay 23
+layer_note1 41, 47, 90
+layer_note1 22, 50, 113
+layer_note1 32, 9, 82
+layer_note1 27, 21, 87
+layer_delay 44
+layer_note1 30, 75, 72
+layer_note1 45, 87, 103
+layer_note1 53, 29, 68
+layer_note1 44, 80, 72
+layer_note1 22, 41, 103
+layer_note1 43, 46, 122
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 43, 71, 59
+layer_note1 40, 10, 110
+layer_note1 34, 90, 80
+layer_note1 30, 48, 108
+layer_note1 58, 69, 40
+layer_note1 20, 10, 107
+layer_note1 27, 69, 79
+layer_note1 58, 39, 92
+layer_note1 44, 16, 101
+layer_note1 24, 63, 77
+layer_note1 53, 36, 98
+layer_note1 31, 64, 73
+layer_note1 24, 70, 94
+layer_note1 44, 75, 116
+layer_note1 26, 19, 92
+layer_note1 32, 31, 118
+layer_note1 30, 40, 72
+layer_jump .layer1_1
+
+.layer1_2:
+layer_note1 23, 89, 78
+layer_note1 52, 26, 70
+layer_note1 51, 55, 94
+layer_note1 56, 83, 70
+layer_delay 24
+layer_note1 20, 38, 88
+layer_note1 45, 41, 124
+layer_note1 35, 44, 100
+layer_note1 23, 37, 43
+layer_delay 19
+layer_note1 45, 38, 53
+layer_note1 54, 34, 55
+layer_jump .layer1_2
+
+.channel2:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 9
+chan_setreverb 55
+chan_setvol 103
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 23, 43, 73
+layer_note1 53, 39, 102
+layer_note1 57, 57, 75
+layer_note1 55, 68, 56
+layer_note1 25, 49, 73
+layer_delay 46
+layer_delay 47
+layer_note1 29, 58, 109
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 20, 63, 78
+layer_note1 44, 77, 84
+layer_note1 41, 55, 108
+layer_note1 42, 33, 53
+layer_note1 40, 75, 45
+layer_note1 54, 8, 40
+layer_note1 23, 76, 105
+layer_note1 60, 88, 111
+layer_note1 45, 73, 127
+layer_note1 25, 9, 73
+layer_note1 48, 54, 91
+layer_note1 54, 34, 54
+layer_delay 12
+layer_jump .layer2_1
+
+.channel3:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 32
+chan_setreverb 24
+chan_setvol 103
+chan_setlayer 0, .layer3_0
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 26, 13, 53
+layer_note1 59, 92, 76
+layer_note1 27, 70, 125
+layer_note1 45, 69, 94
+layer_note1 57, 92, 53
+layer_note1 29, 39, 58
+layer_note1 33, 41, 93
+layer_note1 20, 31, 72
+layer_delay 40
+layer_note1 38, 42, 53
+layer_jump .layer3_0
+
@@ -0,0 +1,402 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 89
+seq_initchannels 0xff
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+seq_startchannel 6, .channel6
+seq_startchannel 7, .channel7
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 73
+chan_setreverb 5
+chan_setvol 125
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 22, 19, 96
+layer_note1 42, 16, 103
+layer_note1 58, 75, 93
+layer_note1 32, 63, 61
+layer_note1 46, 92, 127
+layer_note1 32, 75, 126
+layer_note1 37, 71, 68
+layer_note1 50, 72, 58
+layer_note1 39, 81, 122
+layer_note1 59, 18, 87
+layer_note1 36, 25, 83
+layer_note1 55, 56, 60
+layer_note1 47, 65, 76
+layer_note1 29, 47, 121
+layer_note1 33, 91, 75
+layer_delay 7
+layer_note1 46, 76, 57
+layer_note1 38, 7, 46
+layer_note1 39, 21, 40
+layer_note1 53, 13, 44
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 29, 28, 97
+layer_note1 24, 9, 64
+layer_note1 21, 22, 64
+layer_delay 16
+layer_note1 44, 34, 65
+layer_note1 54, 37, 82
+layer_note1 20, 85, 54
+layer_note1 56, 38, 80
+layer_note1 46, 13, 81
+layer_note1 56, 26, 76
+layer_note1 27, 61, 46
+layer_note1 51, 9, 124
+layer_note1 28, 25, 61
+layer_note1 50, 57, 122
+layer_note1 25, 47, 65
+layer_note1 22, 62, 68
+layer_note1 48, 28, 122
+layer_note1 41, 27, 62
+layer_delay 46
+layer_note1 60, 76, 99
+layer_note1 23, 19, 78
+layer_note1 34, 20, 64
+layer_note1 58, 27, 65
+layer_delay 22
+layer_jump .layer0_1
+
+.channel1:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 92
+chan_setreverb 0
+chan_setvol 79
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 34, 61, 68
+layer_note1 36, 38, 109
+layer_note1 45, 65, 78
+layer_note1 27, 26, 115
+layer_note1 24, 89, 72
+layer_delay 12
+layer_note1 34, 32, 56
+layer_delay 29
+layer_note1 40, 14, 76
+layer_note1 60, 96, 83
+layer_note1 46, 52, 55
+layer_note1 43, 42, 55
+layer_note1 54, 50, 56
+layer_note1 31, 71, 42
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 33, 61, 66
+layer_note1 45, 62, 88
+layer_note1 59, 13, 65
+layer_note1 35, 64, 85
+layer_note1 38, 73, 111
+layer_note1 52, 35, 69
+layer_note1 35, 37, 120
+layer_note1 39, 11, 126
+layer_delay 33
+layer_note1 20, 40, 114
+layer_note1 41, 56, 117
+layer_note1 24, 37, 51
+layer_note1 22, 20, 119
+layer_note1 31, 27, 88
+layer_note1 40, 25, 109
+layer_note1 27, 52, 59
+layer_delay 38
+layer_note1 46, 6, 51
+layer_note1 45, 96, 94
+layer_note1 60, 83, 116
+layer_note1 40, 31, 53
+layer_note1 36, 41, 42
+layer_jump .layer1_1
+
+.channel2:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 86
+chan_setreverb 41
+chan_setvol 95
+chan_setlayer 0, .layer2_0
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 55, 74, 109
+layer_note1 28, 63, 125
+layer_note1 41, 52, 127
+layer_note1 33, 47, 66
+layer_note1 35, 33, 40
+layer_note1 31, 52, 73
+layer_note1 36, 80, 42
+layer_note1 48, 68, 116
+layer_jump .layer2_0
+
+.channel3:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 28
+chan_setreverb 42
+chan_setvol 104
+chan_setlayer 0, .layer3_0
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 52, 82, 76
+layer_delay 32
+layer_note1 54, 70, 44
+layer_note1 25, 34, 80
+layer_delay 14
+layer_delay 34
+layer_note1 20, 11, 117
+layer_note1 54, 39, 106
+layer_delay 10
+layer_note1 54, 21, 73
+layer_note1 35, 8, 51
+layer_jump .layer3_0
+
+.channel4:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 83
+chan_setreverb 57
+chan_setvol 85
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 51, 37, 65
+layer_note1 30, 9, 76
+layer_note1 43, 63, 112
+layer_note1 56, 40, 74
+layer_note1 42, 16, 83
+layer_note1 53, 25, 43
+layer_note1 34, 84, 69
+layer_note1 21, 27, 122
+layer_note1 35, 9, 40
+layer_note1 43, 9, 123
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 59, 26, 63
+layer_delay 27
+layer_note1 39, 10, 56
+layer_note1 42, 68, 101
+layer_note1 37, 54, 86
+layer_note1 54, 54, 45
+layer_note1 55, 13, 75
+layer_note1 55, 42, 98
+layer_note1 52, 40, 43
+layer_note1 43, 29, 97
+layer_note1 21, 65, 83
+layer_note1 51, 84, 82
+layer_note1 54, 94, 71
+layer_delay 39
+layer_delay 25
+layer_jump .layer4_1
+
+.channel5:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 11
+chan_setreverb 10
+chan_setvol 86
+chan_setlayer 0, .layer5_0
+chan_setlayer 1, .layer5_1
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_note1 29, 91, 45
+layer_note1 28, 51, 67
+layer_note1 20, 51, 125
+layer_delay 32
+layer_note1 22, 78, 47
+layer_note1 23, 12, 125
+layer_note1 40, 59, 44
+layer_delay 21
+layer_note1 32, 45, 98
+layer_note1 49, 55, 116
+layer_note1 53, 43, 41
+layer_delay 31
+layer_note1 30, 51, 111
+layer_note1 42, 30, 109
+layer_note1 43, 25, 108
+layer_jump .layer5_0
+
+.layer5_1:
+layer_note1 20, 32, 78
+layer_delay 40
+layer_note1 23, 78, 125
+layer_note1 37, 78, 126
+layer_note1 51, 55, 87
+layer_delay 22
+layer_note1 21, 10, 94
+layer_note1 40, 48, 44
+layer_jump .layer5_1
+
+.channel6:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 105
+chan_setreverb 17
+chan_setvol 108
+chan_setlayer 0, .layer6_0
+chan_setlayer 1, .layer6_1
+chan_setlayer 2, .layer6_2
+.chan_loop6:
+chan_delay 0x7fff
+chan_jump .chan_loop6
+
+.layer6_0:
+layer_delay 36
+layer_note1 57, 31, 88
+layer_note1 51, 49, 111
+layer_note1 29, 49, 105
+layer_note1 27, 62, 62
+layer_note1 38, 82, 81
+layer_delay 32
+layer_note1 23, 57, 40
+layer_delay 29
+layer_delay 45
+layer_note1 34, 45, 78
+layer_note1 53, 27, 102
+layer_note1 25, 85, 105
+layer_note1 25, 47, 68
+layer_note1 57, 27, 87
+layer_jump .layer6_0
+
+.layer6_1:
+layer_note1 41, 85, 56
+layer_note1 38, 39, 79
+layer_note1 37, 65, 41
+layer_delay 37
+layer_delay 21
+layer_note1 52, 82, 47
+layer_note1 59, 93, 73
+layer_delay 7
+layer_note1 25, 93, 40
+layer_note1 20, 6, 98
+layer_note1 27, 38, 65
+layer_note1 35, 11, 114
+layer_note1 33, 54, 75
+layer_note1 43, 19, 88
+layer_note1 35, 65, 126
+layer_note1 30, 86, 99
+layer_note1 33, 31, 89
+layer_delay 22
+layer_note1 53, 49, 116
+layer_note1 38, 60, 91
+layer_note1 36, 46, 103
+layer_jump .layer6_1
+
+.layer6_2:
+layer_note1 36, 56, 59
+layer_note1 34, 23, 124
+layer_note1 51, 28, 120
+layer_note1 54, 61, 75
+layer_note1 30, 18, 112
+layer_delay 48
+layer_note1 42, 33, 68
+layer_delay 20
+layer_note1 34, 37, 65
+layer_note1 60, 65, 86
+layer_note1 22, 50, 52
+layer_note1 46, 80, 61
+layer_delay 26
+layer_note1 22, 48, 81
+layer_jump .layer6_2
+
+.channel7:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 25
+chan_setreverb 55
+chan_setvol 67
+chan_setlayer 0, .layer7_0
+chan_setlayer 1, .layer7_1
+.chan_loop7:
+chan_delay 0x7fff
+chan_jump .chan_loop7
+
+.layer7_0:
+layer_note1 35, 57, 116
+layer_note1 56, 76, 98
+layer_note1 25, 55, 105
+layer_note1 35, 62, 63
+layer_note1 29, 37, 93
+layer_note1 55, 83, 107
+layer_note1 55, 38, 70
+layer_note1 37, 16, 99
+layer_note1 55, 62, 46
+layer_note1 32, 17, 62
+layer_note1 56, 89, 125
+layer_note1 20, 74, 43
+layer_note1 58, 42, 91
+layer_note1 20, 6, 68
+layer_delay 34
+layer_note1 33, 8, 57
+layer_note1 24, 93, 45
+layer_note1 24, 19, 112
+layer_note1 30, 27, 58
+layer_note1 56, 74, 111
+layer_note1 56, 96, 106
+layer_note1 40, 17, 81
+layer_note1 54, 7, 75
+layer_note1 49, 50, 112
+layer_jump .layer7_0
+
+.layer7_1:
+layer_note1 26, 67, 100
+layer_note1 27, 76, 78
+layer_note1 60, 43, 65
+layer_note1 37, 12, 54
+layer_note1 20, 17, 60
+layer_note1 60, 60, 109
+layer_delay 25
+layer_note1 36, 85, 60
+layer_note1 24, 68, 88
+layer_note1 30, 29, 97
+layer_delay 28
+layer_note1 48, 16, 71
+layer_note1 48, 77, 104
+layer_note1 40, 65, 66
+layer_delay 33
+layer_note1 44, 67, 43
+layer_note1 28, 92, 94
+layer_note1 27, 64, 48
+layer_note1 36, 8, 112
+layer_jump .layer7_1
+
@@ -0,0 +1,435 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 117
+seq_initchannels 0xff
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+seq_startchannel 6, .channel6
+seq_startchannel 7, .channel7
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 53
+chan_setreverb 16
+chan_setvol 66
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 25, 65, 40
+layer_note1 35, 9, 49
+layer_note1 58, 73, 91
+layer_note1 42, 74, 48
+layer_note1 35, 78, 126
+layer_note1 47, 78, 52
+layer_note1 60, 77, 54
+layer_note1 39, 22, 79
+layer_note1 36, 70, 50
+layer_delay 26
+layer_delay 7
+layer_note1 52, 44, 62
+layer_note1 31, 66, 122
+layer_note1 48, 90, 82
+layer_note1 24, 8, 123
+layer_note1 50, 68, 73
+layer_note1 36, 80, 72
+layer_note1 30, 93, 63
+layer_note1 52, 42, 93
+layer_note1 33, 67, 87
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 59, 44, 105
+layer_note1 60, 54, 78
+layer_note1 50, 53, 79
+layer_note1 30, 43, 107
+layer_note1 21, 94, 64
+layer_delay 27
+layer_note1 57, 76, 72
+layer_note1 60, 74, 44
+layer_note1 20, 24, 116
+layer_note1 43, 39, 96
+layer_note1 28, 23, 89
+layer_note1 41, 9, 64
+layer_note1 50, 6, 58
+layer_note1 24, 54, 71
+layer_note1 39, 84, 41
+layer_note1 41, 6, 101
+layer_note1 26, 51, 102
+layer_note1 50, 79, 62
+layer_delay 27
+layer_note1 26, 30, 65
+layer_note1 26, 19, 90
+layer_jump .layer0_1
+
+.channel1:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 44
+chan_setreverb 10
+chan_setvol 126
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 56, 27, 87
+layer_note1 39, 30, 116
+layer_note1 56, 35, 64
+layer_note1 58, 23, 58
+layer_note1 58, 34, 81
+layer_note1 29, 30, 61
+layer_note1 32, 42, 43
+layer_note1 46, 43, 40
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 27, 67, 74
+layer_note1 46, 65, 111
+layer_delay 10
+layer_note1 55, 86, 97
+layer_note1 33, 81, 40
+layer_delay 36
+layer_note1 36, 8, 110
+layer_note1 42, 29, 105
+layer_note1 50, 86, 97
+layer_note1 32, 14, 62
+layer_delay 45
+layer_delay 12
+layer_note1 31, 42, 43
+layer_note1 42, 95, 108
+layer_note1 32, 11, 109
+layer_note1 53, 7, 121
+layer_note1 27, 85, 95
+layer_note1 27, 56, 62
+layer_note1 27, 90, 89
+layer_note1 28, 72, 112
+layer_jump .layer1_1
+
+.channel2:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 91
+chan_setreverb 59
+chan_setvol 112
+chan_setlayer 0, .layer2_0
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 59, 29, 101
+layer_delay 16
+layer_note1 41, 56, 124
+layer_note1 31, 71, 87
+layer_note1 41, 38, 42
+layer_delay 48
+layer_delay 7
+layer_note1 59, 95, 102
+layer_note1 59, 22, 59
+layer_jump .layer2_0
+
+.channel3:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 57
+chan_setreverb 55
+chan_setvol 69
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+chan_setlayer 2, .layer3_2
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 22, 34, 46
+layer_note1 41, 72, 93
+layer_delay 20
+layer_note1 30, 41, 53
+layer_note1 41, 29, 42
+layer_note1 42, 69, 63
+layer_note1 34, 34, 118
+layer_note1 33, 53, 111
+layer_note1 32, 91, 82
+layer_note1 56, 71, 113
+layer_note1 35, 67, 66
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 56, 69, 81
+layer_note1 21, 21, 99
+layer_delay 37
+layer_note1 59, 26, 113
+layer_note1 39, 18, 101
+layer_note1 46, 28, 57
+layer_note1 25, 6, 127
+layer_note1 45, 37, 108
+layer_note1 33, 13, 58
+layer_note1 27, 66, 60
+layer_note1 21, 85, 80
+layer_note1 43, 27, 94
+layer_note1 30, 61, 73
+layer_note1 38, 63, 83
+layer_note1 25, 44, 93
+layer_note1 23, 89, 54
+layer_note1 40, 88, 88
+layer_jump .layer3_1
+
+.layer3_2:
+layer_note1 31, 63, 126
+layer_note1 55, 87, 122
+layer_delay 33
+layer_note1 51, 14, 90
+layer_note1 51, 40, 93
+layer_note1 44, 34, 79
+layer_note1 27, 19, 107
+layer_note1 47, 7, 41
+layer_note1 24, 71, 95
+layer_note1 22, 57, 66
+layer_delay 9
+layer_note1 30, 69, 83
+layer_note1 41, 61, 43
+layer_note1 50, 94, 100
+layer_note1 28, 24, 118
+layer_delay 8
+layer_note1 24, 34, 67
+layer_note1 57, 18, 41
+layer_jump .layer3_2
+
+.channel4:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 127
+chan_setreverb 46
+chan_setvol 102
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+chan_setlayer 2, .layer4_2
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_note1 25, 49, 104
+layer_note1 26, 53, 88
+layer_note1 48, 31, 68
+layer_note1 44, 50, 85
+layer_note1 26, 20, 47
+layer_note1 26, 95, 107
+layer_note1 46, 13, 93
+layer_note1 24, 45, 43
+layer_delay 42
+layer_note1 54, 84, 76
+layer_delay 36
+layer_delay 47
+layer_note1 39, 77, 40
+layer_delay 47
+layer_note1 48, 94, 49
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 29, 20, 118
+layer_note1 51, 45, 86
+layer_note1 59, 60, 54
+layer_note1 47, 79, 98
+layer_note1 51, 23, 94
+layer_note1 39, 17, 65
+layer_note1 51, 39, 81
+layer_note1 38, 83, 82
+layer_delay 19
+layer_note1 58, 11, 40
+layer_jump .layer4_1
+
+.layer4_2:
+layer_note1 40, 65, 52
+layer_note1 36, 86, 123
+layer_note1 52, 90, 60
+layer_note1 24, 29, 63
+layer_note1 44, 92, 81
+layer_note1 38, 50, 73
+layer_delay 6
+layer_note1 60, 34, 72
+layer_delay 27
+layer_note1 50, 38, 117
+layer_note1 21, 8, 54
+layer_note1 55, 25, 114
+layer_note1 53, 81, 109
+layer_delay 16
+layer_note1 46, 67, 43
+layer_note1 22, 63, 54
+layer_note1 32, 40, 54
+layer_note1 52, 11, 93
+layer_note1 20, 49, 120
+layer_note1 40, 78, 56
+layer_note1 25, 18, 65
+layer_jump .layer4_2
+
+.channel5:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 6
+chan_setreverb 12
+chan_setvol 94
+chan_setlayer 0, .layer5_0
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_note1 24, 17, 122
+layer_note1 22, 55, 97
+layer_note1 51, 51, 97
+layer_note1 35, 66, 44
+layer_note1 41, 39, 96
+layer_delay 18
+layer_note1 26, 18, 126
+layer_note1 32, 70, 117
+layer_note1 28, 36, 93
+layer_note1 45, 74, 42
+layer_note1 49, 93, 62
+layer_note1 41, 95, 113
+layer_delay 14
+layer_note1 39, 87, 99
+layer_note1 27, 80, 91
+layer_jump .layer5_0
+
+.channel6:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 15
+chan_setreverb 32
+chan_setvol 82
+chan_setlayer 0, .layer6_0
+chan_setlayer 1, .layer6_1
+chan_setlayer 2, .layer6_2
+.chan_loop6:
+chan_delay 0x7fff
+chan_jump .chan_loop6
+
+.layer6_0:
+layer_note1 30, 45, 127
+layer_note1 29, 7, 83
+layer_note1 21, 96, 111
+layer_note1 41, 30, 48
+layer_note1 34, 62, 124
+layer_note1 33, 54, 61
+layer_note1 39, 77, 76
+layer_delay 6
+layer_note1 50, 88, 53
+layer_note1 39, 19, 68
+layer_note1 45, 18, 82
+layer_note1 45, 91, 74
+layer_jump .layer6_0
+
+.layer6_1:
+layer_note1 51, 90, 112
+layer_note1 38, 93, 100
+layer_delay 48
+layer_note1 28, 15, 50
+layer_note1 36, 29, 65
+layer_note1 53, 69, 90
+layer_delay 26
+layer_note1 51, 6, 94
+layer_delay 20
+layer_note1 41, 72, 94
+layer_note1 32, 76, 126
+layer_note1 43, 40, 60
+layer_note1 51, 56, 113
+layer_note1 42, 91, 108
+layer_note1 43, 45, 52
+layer_delay 13
+layer_delay 25
+layer_note1 43, 39, 125
+layer_note1 26, 47, 123
+layer_note1 31, 50, 43
+layer_note1 26, 48, 65
+layer_jump .layer6_1
+
+.layer6_2:
+layer_note1 44, 33, 105
+layer_note1 37, 93, 46
+layer_delay 35
+layer_note1 56, 12, 83
+layer_note1 29, 17, 72
+layer_note1 37, 73, 84
+layer_note1 50, 10, 116
+layer_note1 43, 46, 103
+layer_note1 28, 7, 118
+layer_note1 23, 81, 116
+layer_note1 56, 14, 106
+layer_delay 20
+layer_jump .layer6_2
+
+.channel7:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 113
+chan_setreverb 16
+chan_setvol 90
+chan_setlayer 0, .layer7_0
+chan_setlayer 1, .layer7_1
+.chan_loop7:
+chan_delay 0x7fff
+chan_jump .chan_loop7
+
+.layer7_0:
+layer_note1 48, 54, 104
+layer_note1 24, 58, 52
+layer_delay 37
+layer_delay 43
+layer_delay 11
+layer_delay 29
+layer_note1 30, 67, 69
+layer_note1 40, 67, 114
+layer_delay 15
+layer_note1 59, 57, 108
+layer_note1 33, 63, 46
+layer_note1 52, 17, 58
+layer_note1 30, 57, 44
+layer_note1 46, 36, 119
+layer_note1 35, 68, 83
+layer_note1 31, 30, 87
+layer_note1 33, 54, 59
+layer_jump .layer7_0
+
+.layer7_1:
+layer_note1 28, 25, 86
+layer_delay 30
+layer_note1 51, 29, 90
+layer_note1 49, 47, 51
+layer_note1 40, 66, 84
+layer_note1 31, 19, 81
+layer_note1 44, 42, 62
+layer_note1 46, 53, 119
+layer_note1 25, 79, 108
+layer_note1 23, 95, 81
+layer_note1 49, 72, 102
+layer_note1 59, 14, 110
+layer_note1 27, 83, 109
+layer_note1 32, 58, 127
+layer_note1 45, 78, 115
+layer_note1 22, 26, 42
+layer_note1 34, 51, 96
+layer_delay 40
+layer_jump .layer7_1
+
@@ -0,0 +1,204 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 140
+seq_initchannels 0xf
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 0
+chan_setpan 100
+chan_setreverb 9
+chan_setvol 65
+chan_setlayer 0, .layer0_0
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 28, 24, 44
+layer_note1 28, 35, 108
+layer_note1 53, 58, 66
+layer_note1 25, 21, 42
+layer_note1 45, 49, 65
+layer_note1 45, 52, 116
+layer_note1 33, 33, 93
+layer_note1 55, 13, 46
+layer_note1 42, 23, 66
+layer_delay 30
+layer_delay 39
+layer_jump .layer0_0
+
+.channel1:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 55
+chan_setreverb 13
+chan_setvol 115
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+chan_setlayer 2, .layer1_2
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 34, 67, 45
+layer_note1 38, 48, 113
+layer_note1 40, 33, 52
+layer_note1 39, 28, 111
+layer_note1 54, 92, 77
+layer_delay 18
+layer_delay 44
+layer_note1 26, 91, 91
+layer_note1 39, 89, 65
+layer_delay 18
+layer_note1 48, 57, 46
+layer_note1 27, 40, 52
+layer_note1 60, 21, 64
+layer_note1 30, 25, 100
+layer_delay 45
+layer_note1 37, 53, 118
+layer_note1 57, 10, 54
+layer_note1 58, 94, 103
+layer_note1 21, 38, 102
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 20, 18, 88
+layer_note1 48, 28, 45
+layer_delay 42
+layer_note1 23, 84, 66
+layer_note1 39, 94, 63
+layer_note1 55, 94, 105
+layer_note1 52, 57, 69
+layer_note1 59, 65, 79
+layer_note1 49, 47, 57
+layer_note1 53, 50, 64
+layer_note1 44, 80, 61
+layer_delay 48
+layer_delay 33
+layer_note1 35, 54, 79
+layer_note1 39, 75, 115
+layer_note1 37, 10, 44
+layer_note1 37, 39, 108
+layer_note1 43, 32, 91
+layer_delay 34
+layer_note1 32, 36, 67
+layer_note1 39, 95, 87
+layer_delay 19
+layer_delay 21
+layer_jump .layer1_1
+
+.layer1_2:
+layer_note1 48, 89, 75
+layer_note1 46, 10, 48
+layer_note1 39, 66, 40
+layer_note1 37, 54, 74
+layer_note1 39, 37, 114
+layer_note1 34, 36, 117
+layer_delay 46
+layer_note1 40, 18, 125
+layer_note1 32, 8, 87
+layer_note1 51, 45, 126
+layer_note1 36, 45, 89
+layer_note1 33, 76, 68
+layer_note1 23, 79, 71
+layer_note1 35, 12, 92
+layer_note1 40, 40, 53
+layer_note1 23, 47, 71
+layer_note1 47, 24, 46
+layer_note1 22, 58, 68
+layer_note1 48, 75, 58
+layer_delay 37
+layer_note1 48, 40, 101
+layer_note1 20, 92, 123
+layer_note1 30, 17, 99
+layer_jump .layer1_2
+
+.channel2:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 14
+chan_setreverb 59
+chan_setvol 110
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_note1 34, 13, 127
+layer_note1 48, 10, 92
+layer_note1 45, 23, 106
+layer_note1 47, 36, 111
+layer_note1 25, 64, 47
+layer_delay 43
+layer_note1 32, 22, 122
+layer_note1 34, 41, 83
+layer_note1 46, 46, 74
+layer_note1 46, 49, 48
+layer_note1 34, 39, 61
+layer_delay 12
+layer_note1 39, 40, 125
+layer_note1 47, 31, 50
+layer_note1 41, 75, 102
+layer_note1 29, 94, 95
+layer_note1 23, 38, 116
+layer_note1 39, 76, 47
+layer_note1 27, 94, 118
+layer_note1 34, 76, 105
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 54, 44, 89
+layer_note1 54, 46, 117
+layer_note1 36, 15, 122
+layer_note1 29, 94, 58
+layer_note1 54, 24, 94
+layer_note1 31, 28, 98
+layer_note1 57, 51, 89
+layer_note1 32, 67, 83
+layer_delay 29
+layer_note1 32, 23, 101
+layer_note1 30, 32, 52
+layer_note1 57, 69, 84
+layer_note1 28, 15, 121
+layer_jump .layer2_1
+
+.channel3:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 43
+chan_setreverb 4
+chan_setvol 72
+chan_setlayer 0, .layer3_0
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 42, 78, 63
+layer_note1 43, 58, 93
+layer_note1 23, 44, 91
+layer_note1 24, 18, 91
+layer_note1 38, 26, 123
+layer_delay 10
+layer_note1 45, 42, 52
+layer_note1 35, 83, 100
+layer_note1 42, 72, 92
+layer_jump .layer3_0
+
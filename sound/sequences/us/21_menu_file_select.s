@@ -0,0 +1,219 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 107
+seq_initchannels 0xf
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 77
+chan_setreverb 44
+chan_setvol 90
+chan_setlayer 0, .layer0_0
+chan_setlayer 1, .layer0_1
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 26, 47, 105
+layer_note1 23, 72, 100
+layer_note1 20, 75, 56
+layer_note1 51, 31, 76
+layer_note1 32, 63, 50
+layer_note1 22, 73, 54
+layer_note1 48, 8, 95
+layer_delay 8
+layer_jump .layer0_0
+
+.layer0_1:
+layer_note1 49, 45, 103
+layer_note1 39, 78, 113
+layer_note1 22, 81, 77
+layer_note1 41, 16, 71
+layer_note1 38, 60, 48
+layer_note1 20, 29, 97
+layer_note1 25, 13, 56
+layer_note1 23, 76, 78
+layer_delay 9
+layer_note1 22, 68, 40
+layer_note1 53, 94, 81
+layer_note1 51, 67, 71
+layer_note1 53, 79, 105
+layer_note1 44, 54, 114
+layer_note1 32, 71, 56
+layer_note1 42, 88, 87
+layer_delay 21
+layer_note1 51, 9, 53
+layer_note1 57, 27, 80
+layer_jump .layer0_1
+
+.channel1:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 57
+chan_setreverb 29
+chan_setvol 111
+chan_setlayer 0, .layer1_0
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 43, 44, 50
+layer_note1 52, 32, 56
+layer_note1 57, 39, 101
+layer_note1 43, 54, 51
+layer_note1 22, 83, 63
+layer_note1 23, 82, 65
+layer_note1 40, 54, 68
+layer_delay 26
+layer_note1 29, 35, 119
+layer_note1 48, 93, 43
+layer_delay 22
+layer_delay 10
+layer_delay 11
+layer_note1 27, 70, 68
+layer_note1 41, 87, 49
+layer_note1 31, 35, 104
+layer_note1 26, 29, 42
+layer_note1 35, 46, 86
+layer_jump .layer1_0
+
+.channel2:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 47
+chan_setreverb 39
+chan_setvol 61
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+chan_setlayer 2, .layer2_2
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_delay 41
+layer_note1 31, 19, 51
+layer_note1 60, 34, 88
+layer_note1 23, 87, 122
+layer_note1 28, 63, 75
+layer_note1 32, 44, 51
+layer_note1 34, 10, 81
+layer_note1 55, 40, 123
+layer_note1 56, 33, 100
+layer_note1 27, 9, 107
+layer_note1 48, 23, 72
+layer_note1 39, 43, 70
+layer_delay 34
+layer_note1 23, 35, 93
+layer_note1 59, 6, 117
+layer_note1 24, 42, 56
+layer_note1 53, 68, 86
+layer_note1 21, 78, 103
+layer_note1 36, 24, 84
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 42, 54, 117
+layer_note1 26, 86, 116
+layer_delay 29
+layer_note1 20, 75, 113
+layer_note1 24, 35, 118
+layer_note1 48, 42, 93
+layer_note1 60, 21, 127
+layer_note1 43, 95, 47
+layer_delay 45
+layer_delay 32
+layer_note1 31, 21, 120
+layer_note1 24, 74, 60
+layer_note1 25, 26, 111
+layer_note1 30, 28, 56
+layer_note1 55, 75, 89
+layer_note1 31, 42, 121
+layer_note1 58, 77, 43
+layer_delay 17
+layer_note1 37, 48, 55
+layer_jump .layer2_1
+
+.layer2_2:
+layer_note1 29, 50, 102
+layer_delay 41
+layer_note1 25, 51, 92
+layer_note1 34, 24, 99
+layer_note1 49, 21, 111
+layer_note1 49, 32, 83
+layer_note1 22, 35, 92
+layer_note1 25, 72, 99
+layer_note1 48, 30, 51
+layer_delay 23
+layer_note1 26, 60, 105
+layer_note1 50, 91, 45
+layer_note1 48, 59, 45
+layer_note1 39, 26, 119
+layer_note1 28, 68, 97
+layer_note1 37, 52, 50
+layer_note1 36, 90, 47
+layer_note1 25, 57, 66
+layer_note1 33, 86, 45
+layer_note1 48, 50, 49
+layer_delay 48
+layer_note1 32, 30, 101
+layer_delay 23
+layer_note1 58, 27, 89
+layer_jump .layer2_2
+
+.channel3:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 59
+chan_setreverb 32
+chan_setvol 117
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 49, 45, 42
+layer_note1 40, 32, 64
+layer_note1 47, 59, 126
+layer_note1 32, 74, 79
+layer_note1 59, 91, 45
+layer_delay 17
+layer_note1 58, 10, 63
+layer_note1 29, 45, 115
+layer_delay 42
+layer_delay 44
+layer_note1 31, 16, 57
+layer_delay 46
+layer_note1 20, 53, 99
+layer_note1 29, 56, 70
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 49, 74, 94
+layer_note1 58, 42, 114
+layer_note1 55, 34, 111
+layer_note1 21, 64, 42
+layer_note1 35, 60, 67
+layer_delay 31
+layer_delay 13
+layer_delay 24
+layer_jump .layer3_1
+
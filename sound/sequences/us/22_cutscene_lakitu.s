@@ -0,0 +1,464 @@
+.include "seq_macros.inc"
+.section .rodata
+.align 0
+sequence_start:
+
+seq_setmutebhv 0x20
+seq_setmutescale 0x32
+seq_setvol 100
+seq_settempo 101
+seq_initchannels 0xff
+seq_startchannel 0, .channel0
+seq_startchannel 1, .channel1
+seq_startchannel 2, .channel2
+seq_startchannel 3, .channel3
+seq_startchannel 4, .channel4
+seq_startchannel 5, .channel5
+seq_startchannel 6, .channel6
+seq_startchannel 7, .channel7
+.seq_loop:
+seq_delay 0x7fff
+seq_jump .seq_loop
+
+.channel0:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 70
+chan_setreverb 30
+chan_setvol 127
+chan_setlayer 0, .layer0_0
+.chan_loop0:
+chan_delay 0x7fff
+chan_jump .chan_loop0
+
+.layer0_0:
+layer_note1 53, 67, 96
+layer_note1 60, 15, 78
+layer_note1 53, 69, 46
+layer_note1 47, 41, 80
+layer_note1 35, 21, 47
+layer_note1 38, 33, 48
+layer_note1 27, 89, 81
+layer_note1 52, 40, 80
+layer_delay 39
+layer_note1 55, 56, 89
+layer_note1 27, 10, 86
+layer_note1 55, 21, 48
+layer_delay 13
+layer_note1 20, 13, 92
+layer_note1 32, 30, 126
+layer_note1 49, 82, 100
+layer_note1 57, 74, 98
+layer_note1 39, 68, 48
+layer_delay 30
+layer_note1 43, 20, 125
+layer_note1 20, 75, 121
+layer_note1 40, 95, 60
+layer_note1 59, 67, 44
+layer_note1 58, 42, 99
+layer_jump .layer0_0
+
+.channel1:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 108
+chan_setreverb 60
+chan_setvol 124
+chan_setlayer 0, .layer1_0
+chan_setlayer 1, .layer1_1
+.chan_loop1:
+chan_delay 0x7fff
+chan_jump .chan_loop1
+
+.layer1_0:
+layer_note1 59, 67, 89
+layer_delay 31
+layer_note1 40, 27, 53
+layer_note1 40, 85, 76
+layer_note1 31, 51, 94
+layer_note1 41, 88, 87
+layer_note1 57, 90, 105
+layer_delay 46
+layer_note1 20, 35, 101
+layer_delay 23
+layer_note1 25, 79, 55
+layer_note1 32, 31, 117
+layer_delay 6
+layer_note1 53, 93, 87
+layer_delay 15
+layer_note1 25, 23, 98
+layer_jump .layer1_0
+
+.layer1_1:
+layer_note1 57, 32, 111
+layer_note1 27, 48, 86
+layer_delay 37
+layer_note1 21, 91, 42
+layer_note1 51, 43, 119
+layer_note1 53, 22, 82
+layer_delay 30
+layer_note1 48, 40, 65
+layer_note1 53, 31, 56
+layer_jump .layer1_1
+
+.channel2:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 25
+chan_setreverb 11
+chan_setvol 113
+chan_setlayer 0, .layer2_0
+chan_setlayer 1, .layer2_1
+chan_setlayer 2, .layer2_2
+.chan_loop2:
+chan_delay 0x7fff
+chan_jump .chan_loop2
+
+.layer2_0:
+layer_delay 36
+layer_note1 49, 47, 121
+layer_note1 20, 8, 43
+layer_delay 27
+layer_note1 36, 36, 79
+layer_note1 20, 69, 97
+layer_note1 56, 42, 74
+layer_note1 22, 42, 60
+layer_note1 21, 50, 50
+layer_delay 18
+layer_note1 44, 48, 70
+layer_note1 22, 36, 126
+layer_jump .layer2_0
+
+.layer2_1:
+layer_note1 44, 84, 49
+layer_note1 51, 30, 65
+layer_note1 47, 96, 76
+layer_note1 44, 45, 120
+layer_note1 57, 91, 88
+layer_note1 48, 87, 91
+layer_note1 43, 62, 60
+layer_note1 22, 19, 60
+layer_note1 41, 67, 62
+layer_note1 28, 36, 52
+layer_note1 53, 59, 58
+layer_note1 56, 70, 51
+layer_jump .layer2_1
+
+.layer2_2:
+layer_note1 56, 73, 96
+layer_note1 57, 18, 96
+layer_note1 52, 45, 63
+layer_note1 54, 61, 76
+layer_note1 35, 59, 72
+layer_delay 16
+layer_note1 39, 7, 79
+layer_note1 32, 45, 97
+layer_delay 21
+layer_note1 47, 70, 86
+layer_note1 27, 31, 43
+layer_note1 35, 76, 75
+layer_note1 59, 81, 82
+layer_note1 36, 50, 43
+layer_note1 27, 29, 105
+layer_note1 21, 42, 47
+layer_note1 53, 46, 81
+layer_note1 47, 71, 125
+layer_note1 36, 50, 71
+layer_note1 58, 7, 108
+layer_jump .layer2_2
+
+.channel3:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 22
+chan_setreverb 16
+chan_setvol 117
+chan_setlayer 0, .layer3_0
+chan_setlayer 1, .layer3_1
+.chan_loop3:
+chan_delay 0x7fff
+chan_jump .chan_loop3
+
+.layer3_0:
+layer_note1 58, 48, 62
+layer_note1 29, 45, 56
+layer_note1 49, 53, 84
+layer_note1 38, 42, 81
+layer_note1 20, 45, 60
+layer_note1 24, 59, 108
+layer_note1 40, 29, 59
+layer_note1 28, 58, 70
+layer_note1 60, 42, 115
+layer_note1 54, 31, 126
+layer_jump .layer3_0
+
+.layer3_1:
+layer_note1 20, 84, 120
+layer_note1 30, 49, 110
+layer_note1 59, 46, 100
+layer_note1 42, 27, 75
+layer_note1 25, 20, 111
+layer_delay 7
+layer_note1 29, 76, 125
+layer_note1 60, 21, 122
+layer_note1 32, 8, 119
+layer_note1 55, 61, 88
+layer_delay 40
+layer_note1 48, 17, 64
+layer_note1 29, 69, 76
+layer_note1 40, 51, 66
+layer_note1 29, 32, 112
+layer_delay 13
+layer_note1 35, 23, 45
+layer_delay 20
+layer_note1 49, 69, 49
+layer_note1 43, 39, 88
+layer_note1 52, 6, 48
+layer_note1 42, 25, 124
+layer_note1 35, 19, 55
+layer_jump .layer3_1
+
+.channel4:
+chan_largenoteson
+chan_setinstr 2
+chan_setpan 105
+chan_setreverb 8
+chan_setvol 67
+chan_setlayer 0, .layer4_0
+chan_setlayer 1, .layer4_1
+chan_setlayer 2, .layer4_2
+.chan_loop4:
+chan_delay 0x7fff
+chan_jump .chan_loop4
+
+.layer4_0:
+layer_delay 41
+layer_note1 36, 52, 88
+layer_note1 34, 70, 54
+layer_note1 44, 27, 52
+layer_delay 25
+layer_note1 21, 73, 62
+layer_note1 47, 62, 90
+layer_note1 51, 95, 50
+layer_note1 58, 73, 95
+layer_note1 43, 12, 62
+layer_note1 41, 49, 88
+layer_jump .layer4_0
+
+.layer4_1:
+layer_note1 27, 45, 79
+layer_note1 33, 29, 123
+layer_note1 57, 13, 90
+layer_note1 34, 34, 107
+layer_note1 25, 34, 109
+layer_note1 53, 77, 105
+layer_note1 38, 80, 68
+layer_note1 21, 88, 90
+layer_note1 42, 57, 118
+layer_note1 47, 53, 40
+layer_note1 48, 79, 57
+layer_note1 24, 52, 66
+layer_note1 31, 62, 115
+layer_note1 59, 8, 102
+layer_note1 41, 95, 72
+layer_note1 37, 77, 85
+layer_note1 28, 63, 95
+layer_note1 30, 13, 103
+layer_jump .layer4_1
+
+.layer4_2:
+layer_note1 28, 50, 48
+layer_note1 21, 32, 114
+layer_delay 16
+layer_delay 36
+layer_note1 26, 48, 62
+layer_note1 22, 64, 59
+layer_note1 23, 6, 62
+layer_note1 28, 73, 90
+layer_jump .layer4_2
+
+.channel5:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 16
+chan_setreverb 18
+chan_setvol 125
+chan_setlayer 0, .layer5_0
+chan_setlayer 1, .layer5_1
+.chan_loop5:
+chan_delay 0x7fff
+chan_jump .chan_loop5
+
+.layer5_0:
+layer_note1 48, 78, 93
+layer_note1 43, 77, 103
+layer_note1 24, 65, 56
+layer_note1 32, 60, 87
+layer_note1 53, 95, 89
+layer_note1 30, 52, 109
+layer_note1 21, 57, 86
+layer_note1 20, 17, 126
+layer_note1 36, 25, 92
+layer_note1 51, 41, 84
+layer_note1 23, 53, 54
+layer_note1 32, 94, 91
+layer_note1 26, 58, 51
+layer_jump .layer5_0
+
+.layer5_1:
+layer_note1 39, 90, 90
+layer_note1 30, 7, 87
+layer_note1 23, 42, 56
+layer_note1 47, 81, 88
+layer_note1 29, 86, 102
+layer_note1 22, 58, 58
+layer_note1 42, 40, 122
+layer_note1 41, 91, 117
+layer_note1 20, 58, 46
+layer_note1 51, 53, 64
+layer_delay 43
+layer_note1 34, 57, 76
+layer_note1 36, 52, 89
+layer_delay 21
+layer_delay 21
+layer_note1 36, 18, 99
+layer_delay 23
+layer_delay 43
+layer_note1 55, 31, 121
+layer_jump .layer5_1
+
+.channel6:
+chan_largenoteson
+chan_setinstr 1
+chan_setpan 94
+chan_setreverb 4
+chan_setvol 91
+chan_setlayer 0, .layer6_0
+chan_setlayer 1, .layer6_1
+chan_setlayer 2, .layer6_2
+.chan_loop6:
+chan_delay 0x7fff
+chan_jump .chan_loop6
+
+.layer6_0:
+layer_note1 39, 15, 114
+layer_note1 45, 14, 48
+layer_note1 55, 28, 113
+layer_note1 49, 38, 121
+layer_delay 46
+layer_delay 35
+layer_note1 22, 56, 69
+layer_note1 21, 26, 96
+layer_jump .layer6_0
+
+.layer6_1:
+layer_note1 48, 21, 70
+layer_note1 23, 26, 47
+layer_note1 38, 30, 126
+layer_note1 35, 17, 45
+layer_note1 21, 83, 61
+layer_note1 34, 83, 64
+layer_delay 15
+layer_note1 29, 69, 76
+layer_note1 22, 56, 57
+layer_note1 45, 96, 67
+layer_note1 39, 79, 80
+layer_delay 26
+layer_note1 39, 63, 44
+layer_note1 37, 33, 42
+layer_delay 27
+layer_note1 44, 59, 43
+layer_note1 57, 19, 62
+layer_note1 42, 74, 108
+layer_note1 33, 13, 56
+layer_note1 53, 44, 124
+layer_jump .layer6_1
+
+.layer6_2:
+layer_note1 30, 18, 113
+layer_note1 46, 83, 100
+layer_note1 26, 61, 71
+layer_note1 45, 86, 86
+layer_note1 40, 65, 86
+layer_note1 49, 55, 111
+layer_note1 26, 88, 110
+layer_note1 30, 61, 103
+layer_note1 51, 17, 68
+layer_note1 42, 6, 78
+layer_note1 51, 90, 118
+layer_note1 59, 19, 72
+layer_note1 48, 9, 87
+layer_note1 30, 68, 93
+layer_note1 51, 24, 61
+layer_note1 52, 44, 127
+layer_jump .layer6_2
+
+.channel7:
+chan_largenoteson
+chan_setinstr 3
+chan_setpan 118
+chan_setreverb 20
+chan_setvol 98
+chan_setlayer 0, .layer7_0
+chan_setlayer 1, .layer7_1
+chan_setlayer 2, .layer7_2
+.chan_loop7:
+chan_delay 0x7fff
+chan_jump .chan_loop7
+
+.layer7_0:
+layer_delay 37
+layer_note1 21, 94, 83
+layer_note1 20, 91, 108
+layer_note1 58, 74, 84
+layer_delay 24
+layer_note1 21, 25, 40
+layer_note1 20, 53, 94
+layer_note1 48, 71, 121
+layer_note1 33, 91, 102
+layer_note1 56, 49, 109
+layer_jump .layer7_0
+
+.layer7_1:
+layer_note1 37, 40, 64
+layer_note1 32, 85, 98
+layer_note1 58, 48, 42
+layer_note1 45, 49, 49
+layer_note1 29, 35, 50
+layer_note1 60, 79, 58
+layer_note1 50, 48, 78
+layer_note1 50, 51, 113
+layer_note1 56, 6, 48
+layer_note1 60, 44, 46
+layer_note1 56, 65, 111
+layer_note1 23, 87, 79
+layer_note1 56, 9, 104
+layer_note1 50, 13, 105
+layer_note1 35, 15, 73
+layer_delay 45
+layer_note1 49, 80, 70
+layer_note1 57, 77, 86
+layer_note1 35, 50, 59
+layer_note1 38, 51, 122
+layer_note1 34, 14, 95
+layer_jump .layer7_1
+
+.layer7_2:
+layer_note1 60, 46, 118
+layer_note1 27, 42, 68
+layer_note1 57, 25, 83
+layer_note1 33, 76, 68
+layer_note1 40, 50, 106
+layer_note1 46, 20, 118
+layer_note1 34, 45, 57
+layer_note1 36, 29, 106
+layer_note1 60, 13, 113
+layer_note1 36, 7, 65
+layer_note1 51, 9, 109
+layer_note1 24, 9, 123
+layer_note1 42, 85, 53
+layer_note1 24, 40, 63
+layer_delay 42
+layer_note1 28, 70, 55
+layer_jump .layer7_2
+
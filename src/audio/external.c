@@ -13,6 +13,60 @@
 #include "seq_ids.h"
 #include "dialog_ids.h"
 
+#ifndef TARGET_N64
+#include "../pc/audio_cmd_ring.h"
+#endif
+
+#ifdef AUDIO_CMD_RING
+// Requests from the game thread that are run on the audio thread, see audio_cmd_ring.h
+enum AudioCmdOp {
+    AUDIO_CMD_PLAY_SOUND,
+    AUDIO_CMD_GAME_LOOP_TICK,
+    AUDIO_CMD_SEQUENCE_PLAYER_FADE_OUT,
+    AUDIO_CMD_FADE_VOLUME_SCALE,
+    AUDIO_CMD_LOWER_SEQUENCE_PLAYER,
+    AUDIO_CMD_SEQUENCE_PLAYER_UNLOWER,
+    AUDIO_CMD_SET_SOUND_DISABLED,
+    AUDIO_CMD_STOP_SOUND,
+    AUDIO_CMD_STOP_SOUNDS_FROM_SOURCE,
+    AUDIO_CMD_STOP_CONTINUOUS_SOUNDS,
+    AUDIO_CMD_SOUND_BANKS_DISABLE,
+    AUDIO_CMD_SOUND_BANKS_ENABLE,
+    AUDIO_CMD_SET_SOUND_BANK_FREQ,
+    AUDIO_CMD_PLAY_DIALOG_SOUND,
+    AUDIO_CMD_PLAY_SEQUENCE,
+    AUDIO_CMD_PLAY_SECONDARY_MUSIC,
+    AUDIO_CMD_STOP_SECONDARY_MUSIC,
+    AUDIO_CMD_FADE_OUT_ALL_MUSIC,
+    AUDIO_CMD_PLAY_COURSE_CLEAR,
+    AUDIO_CMD_PLAY_PEACHS_JINGLE,
+    AUDIO_CMD_PLAY_PUZZLE_JINGLE,
+    AUDIO_CMD_PLAY_STAR_FANFARE,
+    AUDIO_CMD_PLAY_POWER_STAR_JINGLE,
+    AUDIO_CMD_PLAY_RACE_FANFARE,
+    AUDIO_CMD_PLAY_TOADS_JINGLE,
+    AUDIO_CMD_SOUND_RESET,
+    AUDIO_CMD_SET_SOUND_MODE
+};
+
+// Returns from the calling function if the request was posted to the audio thread
+#define AUDIO_CMD_DEFER(op, arg0, arg1, arg2, arg3)                                                  \
+    if (audio_cmd_ring_post(op, (uintptr_t) (arg0), (uintptr_t) (arg1), (uintptr_t) (arg2),          \
+                            (uintptr_t) (arg3))) {                                                   \
+        return;                                                                                      \
+    }
+
+static void audio_cmd_execute(const struct AudioCmd *cmd);
+
+// gSequencePlayers[SEQ_PLAYER_LEVEL].enabled as of the last buffer, for play_music on the game
+// thread. The background music queue stays on the game thread, as it was on N64, so that
+// get_current_background_music never races the audio thread; only the sequence changes that the
+// queue functions make are posted.
+static u8 sLevelSequencePlayerEnabled;
+#else
+#define AUDIO_CMD_DEFER(op, arg0, arg1, arg2, arg3)
+#endif
+
 #ifdef VERSION_EU
 #define EU_FLOAT(x) x ## f
 #else
@@ -890,6 +944,9 @@ void update_game_sound_wrapper_3ds() {
 
 // 3DS Version
 void create_next_audio_buffer(s16 *samples, u32 num_samples) {
+#ifdef AUDIO_CMD_RING
+    audio_cmd_ring_drain(audio_cmd_execute);
+#endif
     gAudioFrameCount++;
 
     // Use the sound system state to synthesize audio
@@ -898,12 +955,19 @@ void create_next_audio_buffer(s16 *samples, u32 num_samples) {
 
     gAudioRandom = ((gAudioRandom + gAudioFrameCount) * gAudioFrameCount);
     decrease_sample_dma_ttls();
+#ifdef AUDIO_CMD_RING
+    __atomic_store_n(&sLevelSequencePlayerEnabled, gSequencePlayers[SEQ_PLAYER_LEVEL].enabled,
+                     __ATOMIC_RELAXED);
+#endif
 }
 
 #else
 
 // Non-3DS Version
 void create_next_audio_buffer(s16 *samples, u32 num_samples) {
+#ifdef AUDIO_CMD_RING
+    audio_cmd_ring_drain(audio_cmd_execute);
+#endif
     gAudioFrameCount++;
 
     // Update the sound system's state
@@ -918,12 +982,17 @@ void create_next_audio_buffer(s16 *samples, u32 num_samples) {
 
     gAudioRandom = ((gAudioRandom + gAudioFrameCount) * gAudioFrameCount);
     decrease_sample_dma_ttls();
+#ifdef AUDIO_CMD_RING
+    __atomic_store_n(&sLevelSequencePlayerEnabled, gSequencePlayers[SEQ_PLAYER_LEVEL].enabled,
+                     __ATOMIC_RELAXED);
+#endif
 }
 #endif // TARGET_N3DS ELSE
 #endif // TARGET_N64_ELSE
 #endif // VERSION_EU_ELSE
 
 void play_sound(s32 soundBits, f32 *pos) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_PLAY_SOUND, soundBits, pos, 0, 0);
     sSoundRequests[sSoundRequestCount].soundBits = soundBits;
     sSoundRequests[sSoundRequestCount].position = pos;
     sSoundRequestCount++;
@@ -1309,6 +1378,7 @@ static void noop_8031EEC8(void) {
 }
 
 void audio_signal_game_loop_tick(void) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_GAME_LOOP_TICK, 0, 0, 0, 0);
     sGameLoopTicked = 1;
 #ifdef VERSION_EU
     maybe_tick_game_sound();
@@ -1659,6 +1729,7 @@ void update_game_sound(void) {
 void play_sequence(u8 player, u8 seqId, u16 fadeTimer) {
     u8 temp_ret;
     u8 i;
+    AUDIO_CMD_DEFER(AUDIO_CMD_PLAY_SEQUENCE, player, seqId, fadeTimer, 0);
 
     if (player == 0) {
         sPlayer0CurSeqId = seqId & 0x7f;
@@ -1698,6 +1769,7 @@ void play_sequence(u8 player, u8 seqId, u16 fadeTimer) {
 }
 
 void sequence_player_fade_out(u8 player, u16 fadeTimer) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_SEQUENCE_PLAYER_FADE_OUT, player, fadeTimer, 0, 0);
 #ifdef VERSION_EU
     if (!player) {
         sPlayer0CurSeqId = SEQUENCE_NONE;
@@ -1713,6 +1785,7 @@ void sequence_player_fade_out(u8 player, u16 fadeTimer) {
 
 void fade_volume_scale(u8 player, u8 targetScale, u16 fadeTimer) {
     u8 i;
+    AUDIO_CMD_DEFER(AUDIO_CMD_FADE_VOLUME_SCALE, player, targetScale, fadeTimer, 0);
     for (i = 0; i < CHANNELS_MAX; i++) {
         fade_channel_volume_scale(player, i, targetScale, fadeTimer);
     }
@@ -1922,6 +1995,7 @@ void unused_8031FED0(u8 player, u32 bits, s8 arg2) {
 }
 
 void func_8031FFB4(u8 player, u16 fadeTimer, u8 arg2) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_LOWER_SEQUENCE_PLAYER, player, fadeTimer, arg2, 0);
     if (player == 0) {
         sCapVolumeTo40 = TRUE;
         func_803200E4(fadeTimer);
@@ -1931,6 +2005,7 @@ void func_8031FFB4(u8 player, u16 fadeTimer, u8 arg2) {
 }
 
 void sequence_player_unlower(u8 player, u16 fadeTimer) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_SEQUENCE_PLAYER_UNLOWER, player, fadeTimer, 0, 0);
     sCapVolumeTo40 = FALSE;
     if (player == 0) {
         if (gSequencePlayers[player].state != SEQUENCE_PLAYER_STATE_FADE_OUT) {
@@ -1990,6 +2065,7 @@ u8 func_803200E4(u16 fadeTimer) {
 
 void set_sound_disabled(u8 disabled) {
     u8 i;
+    AUDIO_CMD_DEFER(AUDIO_CMD_SET_SOUND_DISABLED, disabled, 0, 0, 0);
 
     for (i = 0; i < SEQUENCE_PLAYERS; i++) {
 #ifdef VERSION_EU
@@ -2040,6 +2116,10 @@ void sound_init(void) {
         }
     }
 
+#ifdef AUDIO_CMD_RING
+    // sound_reset has already cleared the game thread's queue when it posted itself
+    if (!audio_cmd_ring_is_consumer())
+#endif
     for (i = 0; i < MAX_BG_MUSIC_QUEUE_SIZE; i++) {
         sBackgroundMusicQueue[i].priority = 0;
     }
@@ -2052,6 +2132,9 @@ void sound_init(void) {
     sUnused80332114 = 0;
     sPlayer0CurSeqId = 0xff;
     gSoundMode = SOUND_MODE_STEREO;
+#ifdef AUDIO_CMD_RING
+    if (!audio_cmd_ring_is_consumer())
+#endif
     sBackgroundMusicQueueSize = 0;
     D_8033211C = 0;
     D_80332120 = 0;
@@ -2083,6 +2166,7 @@ void get_currently_playing_sound(u8 bankIndex, u8 *numPlayingSounds, u8 *arg2, u
 void func_803205E8(u32 soundBits, f32 *vec) {
     u8 bankIndex;
     u8 item;
+    AUDIO_CMD_DEFER(AUDIO_CMD_STOP_SOUND, soundBits, vec, 0, 0);
 
     bankIndex = (soundBits & SOUNDARGS_MASK_BANK) >> SOUNDARGS_SHIFT_BANK;
     item = gSoundBanks[bankIndex][0].next;
@@ -2102,6 +2186,7 @@ void func_803205E8(u32 soundBits, f32 *vec) {
 void func_803206F8(f32 *arg0) {
     u8 bankIndex;
     u8 item;
+    AUDIO_CMD_DEFER(AUDIO_CMD_STOP_SOUNDS_FROM_SOURCE, arg0, 0, 0, 0);
 
     for (bankIndex = 0; bankIndex < SOUND_BANK_COUNT; bankIndex++) {
         item = gSoundBanks[bankIndex][0].next;
@@ -2126,6 +2211,7 @@ static void func_803207DC(u8 bankIndex) {
 }
 
 void func_80320890(void) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_STOP_CONTINUOUS_SOUNDS, 0, 0, 0, 0);
     func_803207DC(1);
     func_803207DC(4);
     func_803207DC(6);
@@ -2133,6 +2219,7 @@ void func_80320890(void) {
 
 void sound_banks_disable(UNUSED u8 player, u16 bankMask) {
     u8 i;
+    AUDIO_CMD_DEFER(AUDIO_CMD_SOUND_BANKS_DISABLE, player, bankMask, 0, 0);
 
     for (i = 0; i < SOUND_BANK_COUNT; i++) {
         if (bankMask & 1) {
@@ -2152,6 +2239,7 @@ void disable_all_sequence_players(void) {
 
 void sound_banks_enable(UNUSED u8 player, u16 bankMask) {
     u8 i;
+    AUDIO_CMD_DEFER(AUDIO_CMD_SOUND_BANKS_ENABLE, player, bankMask, 0, 0);
 
     for (i = 0; i < SOUND_BANK_COUNT; i++) {
         if (bankMask & 1) {
@@ -2171,11 +2259,13 @@ u8 unused_803209D8(u8 player, u8 channelIndex, u8 arg2) {
 }
 
 void func_80320A4C(u8 bankIndex, u8 arg1) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_SET_SOUND_BANK_FREQ, bankIndex, arg1, 0, 0);
     D_80363808[bankIndex] = arg1;
 }
 
 void play_dialog_sound(u8 dialogID) {
     u8 speaker;
+    AUDIO_CMD_DEFER(AUDIO_CMD_PLAY_DIALOG_SOUND, dialogID, 0, 0, 0);
 
     if (dialogID >= DIALOG_COUNT) {
         dialogID = 0;
@@ -2198,6 +2288,15 @@ void play_dialog_sound(u8 dialogID) {
 #endif
 }
 
+static u8 level_sequence_player_enabled(void) {
+#ifdef AUDIO_CMD_RING
+    if (audio_cmd_ring_posting()) {
+        return __atomic_load_n(&sLevelSequencePlayerEnabled, __ATOMIC_RELAXED);
+    }
+#endif
+    return gSequencePlayers[SEQ_PLAYER_LEVEL].enabled;
+}
+
 void play_music(u8 player, u16 seqArgs, u16 fadeTimer) {
     u8 seqId = seqArgs & 0xff;
     u8 priority = seqArgs >> 8;
@@ -2223,7 +2322,7 @@ void play_music(u8 player, u16 seqArgs, u16 fadeTimer) {
         if (sBackgroundMusicQueue[i].seqId == seqId) {
             if (i == 0) {
                 play_sequence(SEQ_PLAYER_LEVEL, seqId, fadeTimer);
-            } else if (!gSequencePlayers[SEQ_PLAYER_LEVEL].enabled) {
+            } else if (!level_sequence_player_enabled()) {
                 stop_background_music(sBackgroundMusicQueue[0].seqId);
             }
             return;
@@ -2344,6 +2443,7 @@ void func_80320ED8(void) {
 
 void play_secondary_music(u8 seqId, u8 bgMusicVolume, u8 volume, u16 fadeTimer) {
     UNUSED u32 dummy;
+    AUDIO_CMD_DEFER(AUDIO_CMD_PLAY_SECONDARY_MUSIC, seqId, bgMusicVolume, volume, fadeTimer);
 
     sUnused80332118 = 0;
     if (sPlayer0CurSeqId == 0xff || sPlayer0CurSeqId == SEQ_MENU_TITLE_SCREEN) {
@@ -2368,6 +2468,7 @@ void play_secondary_music(u8 seqId, u8 bgMusicVolume, u8 volume, u16 fadeTimer)
 }
 
 void func_80321080(u16 fadeTimer) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_STOP_SECONDARY_MUSIC, fadeTimer, 0, 0, 0);
     if (D_80363812 != 0) {
         D_80363812 = 0;
         D_80332120 = 0;
@@ -2379,6 +2480,7 @@ void func_80321080(u16 fadeTimer) {
 
 void func_803210D4(u16 fadeOutTime) {
     u8 i;
+    AUDIO_CMD_DEFER(AUDIO_CMD_FADE_OUT_ALL_MUSIC, fadeOutTime, 0, 0, 0);
 
     if (sHasStartedFadeOut) {
         return;
@@ -2408,6 +2510,7 @@ void func_803210D4(u16 fadeOutTime) {
 }
 
 void play_course_clear(void) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_PLAY_COURSE_CLEAR, 0, 0, 0, 0);
     play_sequence(SEQ_PLAYER_ENV, SEQ_EVENT_CUTSCENE_COLLECT_STAR, 0);
     D_8033211C = 0x80 | 0;
 #ifdef VERSION_EU
@@ -2417,6 +2520,7 @@ void play_course_clear(void) {
 }
 
 void play_peachs_jingle(void) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_PLAY_PEACHS_JINGLE, 0, 0, 0, 0);
     play_sequence(SEQ_PLAYER_ENV, SEQ_EVENT_PEACH_MESSAGE, 0);
     D_8033211C = 0x80 | 0;
 #ifdef VERSION_EU
@@ -2431,6 +2535,7 @@ void play_peachs_jingle(void) {
  * yoshi, releasing chain chomp, opening the pyramid top, etc.
  */
 void play_puzzle_jingle(void) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_PLAY_PUZZLE_JINGLE, 0, 0, 0, 0);
     play_sequence(SEQ_PLAYER_ENV, SEQ_EVENT_SOLVE_PUZZLE, 0);
     D_8033211C = 0x80 | 20;
 #ifdef VERSION_EU
@@ -2440,6 +2545,7 @@ void play_puzzle_jingle(void) {
 }
 
 void play_star_fanfare(void) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_PLAY_STAR_FANFARE, 0, 0, 0, 0);
     play_sequence(SEQ_PLAYER_ENV, SEQ_EVENT_HIGH_SCORE, 0);
     D_8033211C = 0x80 | 20;
 #ifdef VERSION_EU
@@ -2449,6 +2555,7 @@ void play_star_fanfare(void) {
 }
 
 void play_power_star_jingle(u8 arg0) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_PLAY_POWER_STAR_JINGLE, arg0, 0, 0, 0);
     if (!arg0) {
         D_80363812 = 0;
     }
@@ -2461,6 +2568,7 @@ void play_power_star_jingle(u8 arg0) {
 }
 
 void play_race_fanfare(void) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_PLAY_RACE_FANFARE, 0, 0, 0, 0);
     play_sequence(SEQ_PLAYER_ENV, SEQ_EVENT_RACE, 0);
     D_8033211C = 0x80 | 20;
 #ifdef VERSION_EU
@@ -2470,6 +2578,7 @@ void play_race_fanfare(void) {
 }
 
 void play_toads_jingle(void) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_PLAY_TOADS_JINGLE, 0, 0, 0, 0);
     play_sequence(SEQ_PLAYER_ENV, SEQ_EVENT_TOAD_MESSAGE, 0);
     D_8033211C = 0x80 | 20;
 #ifdef VERSION_EU
@@ -2479,6 +2588,16 @@ void play_toads_jingle(void) {
 }
 
 void sound_reset(u8 presetId) {
+#ifdef AUDIO_CMD_RING
+    if (audio_cmd_ring_posting()) {
+        u8 i;
+        for (i = 0; i < MAX_BG_MUSIC_QUEUE_SIZE; i++) {
+            sBackgroundMusicQueue[i].priority = 0;
+        }
+        sBackgroundMusicQueueSize = 0;
+    }
+#endif
+    AUDIO_CMD_DEFER(AUDIO_CMD_SOUND_RESET, presetId, 0, 0, 0);
 #ifndef VERSION_JP
     if (presetId >= 8) {
         presetId = 0;
@@ -2506,6 +2625,7 @@ void sound_reset(u8 presetId) {
 }
 
 void audio_set_sound_mode(u8 soundMode) {
+    AUDIO_CMD_DEFER(AUDIO_CMD_SET_SOUND_MODE, soundMode, 0, 0, 0);
     D_80332108 = (D_80332108 & 0xf) + (soundMode << 4);
     gSoundMode = soundMode;
 }
@@ -2517,3 +2637,97 @@ void unused_80321460(UNUSED s32 arg0, UNUSED s32 arg1, UNUSED s32 arg2, UNUSED s
 void unused_80321474(UNUSED s32 arg0) {
 }
 #endif
+
+#ifdef AUDIO_CMD_RING
+static void audio_cmd_execute(const struct AudioCmd *cmd) {
+    const uintptr_t *args = cmd->args;
+
+    switch (cmd->op) {
+        case AUDIO_CMD_PLAY_SOUND:
+            play_sound((s32) args[0], (f32 *) args[1]);
+            break;
+        case AUDIO_CMD_GAME_LOOP_TICK:
+            // Commands from several game frames can arrive at once, so update the sound banks
+            // for each frame here instead of once before the next buffer
+            audio_signal_game_loop_tick();
+            update_game_sound();
+            sGameLoopTicked = 0;
+            break;
+        case AUDIO_CMD_SEQUENCE_PLAYER_FADE_OUT:
+            sequence_player_fade_out(args[0], args[1]);
+            break;
+        case AUDIO_CMD_FADE_VOLUME_SCALE:
+            fade_volume_scale(args[0], args[1], args[2]);
+            break;
+        case AUDIO_CMD_LOWER_SEQUENCE_PLAYER:
+            func_8031FFB4(args[0], args[1], args[2]);
+            break;
+        case AUDIO_CMD_SEQUENCE_PLAYER_UNLOWER:
+            sequence_player_unlower(args[0], args[1]);
+            break;
+        case AUDIO_CMD_SET_SOUND_DISABLED:
+            set_sound_disabled(args[0]);
+            break;
+        case AUDIO_CMD_STOP_SOUND:
+            func_803205E8(args[0], (f32 *) args[1]);
+            break;
+        case AUDIO_CMD_STOP_SOUNDS_FROM_SOURCE:
+            func_803206F8((f32 *) args[0]);
+            break;
+        case AUDIO_CMD_STOP_CONTINUOUS_SOUNDS:
+            func_80320890();
+            break;
+        case AUDIO_CMD_SOUND_BANKS_DISABLE:
+            sound_banks_disable(args[0], args[1]);
+            break;
+        case AUDIO_CMD_SOUND_BANKS_ENABLE:
+            sound_banks_enable(args[0], args[1]);
+            break;
+        case AUDIO_CMD_SET_SOUND_BANK_FREQ:
+            func_80320A4C(args[0], args[1]);
+            break;
+        case AUDIO_CMD_PLAY_DIALOG_SOUND:
+            play_dialog_sound(args[0]);
+            break;
+        case AUDIO_CMD_PLAY_SEQUENCE:
+            play_sequence(args[0], args[1], args[2]);
+            break;
+        case AUDIO_CMD_PLAY_SECONDARY_MUSIC:
+            play_secondary_music(args[0], args[1], args[2], args[3]);
+            break;
+        case AUDIO_CMD_STOP_SECONDARY_MUSIC:
+            func_80321080(args[0]);
+            break;
+        case AUDIO_CMD_FADE_OUT_ALL_MUSIC:
+            func_803210D4(args[0]);
+            break;
+        case AUDIO_CMD_PLAY_COURSE_CLEAR:
+            play_course_clear();
+            break;
+        case AUDIO_CMD_PLAY_PEACHS_JINGLE:
+            play_peachs_jingle();
+            break;
+        case AUDIO_CMD_PLAY_PUZZLE_JINGLE:
+            play_puzzle_jingle();
+            break;
+        case AUDIO_CMD_PLAY_STAR_FANFARE:
+            play_star_fanfare();
+            break;
+        case AUDIO_CMD_PLAY_POWER_STAR_JINGLE:
+            play_power_star_jingle(args[0]);
+            break;
+        case AUDIO_CMD_PLAY_RACE_FANFARE:
+            play_race_fanfare();
+            break;
+        case AUDIO_CMD_PLAY_TOADS_JINGLE:
+            play_toads_jingle();
+            break;
+        case AUDIO_CMD_SOUND_RESET:
+            sound_reset(args[0]);
+            break;
+        case AUDIO_CMD_SET_SOUND_MODE:
+            audio_set_sound_mode(args[0]);
+            break;
+    }
+}
+#endif
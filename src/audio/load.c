@@ -138,6 +138,19 @@ void audio_dma_partial_copy_async(uintptr_t *devAddr, u8 **vAddr, ssize_t *remai
     *vAddr += transfer;
 }
 
+#ifdef DIRECT_SAMPLE_DATA
+// Nothing is buffered, so there is nothing to expire
+void decrease_sample_dma_ttls(void) {
+}
+
+// Returns the sample data where it was loaded, instead of a copy in a DMA buffer
+void *dma_sample_data(uintptr_t devAddr, UNUSED u32 size, UNUSED s32 noteFlags, UNUSED u8 *noteSampleDmaIndexPtr) {
+    return (void *) devAddr;
+}
+
+void init_sample_dma_buffers(UNUSED s32 arg0) {
+}
+#else
 void decrease_sample_dma_ttls() {
     u32 i;
 
@@ -390,6 +403,7 @@ out2:
 #undef j
 #endif
 }
+#endif
 
 #ifndef static
 // Keep supporting the good old "#define static" hack.
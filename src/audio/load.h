@@ -10,6 +10,12 @@
 #define PRELOAD_BANKS 2
 #define PRELOAD_SEQUENCE 1
 
+// Sample banks stay resident in memory when not on N64, so notes decode samples straight from
+// the bank instead of from copies in the sample DMA buffers
+#if !defined TARGET_N64 && !defined AUDIO_SAMPLE_DMA
+#define DIRECT_SAMPLE_DATA
+#endif
+
 #define IS_SEQUENCE_CHANNEL_VALID(ptr) ((uintptr_t)(ptr) != (uintptr_t)&gSequenceChannelNone)
 
 extern struct Note *gNotes;
@@ -8,7 +8,21 @@
 #include "external.h"
 
 #ifndef TARGET_N64
+#include <stdbool.h>
+#include <string.h>
 #include "../pc/mixer.h"
+#include "../pc/adpcm_cache.h"
+#endif
+
+#ifdef AUDIO_STAGE_PROFILING
+#include <time.h>
+#endif
+
+// Rendering notes in parallel needs every note to decode straight from its sound bank
+#if defined(AUDIO_PARALLEL_NOTES) && defined(DIRECT_SAMPLE_DATA)
+#define SYNTHESIS_PARALLEL_NOTES
+#include <stdlib.h>
+#include "../pc/audio_jobs.h"
 #endif
 
 #ifdef TARGET_N3DS
@@ -45,6 +59,15 @@ static s16* sCurAiBufBasePtr = NULL;
     aSetBuffer(pkt, 0, 0, c + DMEM_ADDR_WET_RIGHT_CH, d);                                              \
     aSaveBuffer(pkt, VIRTUAL_TO_PHYSICAL2(gSynthesisReverb.ringBuffer.right + (off)));
 
+#ifndef TARGET_N64
+// Loads a stretch of the ring buffer straight into both the dry and the wet channels
+#define aLoadReverbPair(c, len, off)                                                                   \
+    aLoadReverbImpl(0x8000 + gSynthesisReverb.reverbGain, gSynthesisReverb.ringBuffer.left + (off),    \
+                    c + DMEM_ADDR_LEFT_CH, c + DMEM_ADDR_WET_LEFT_CH, len);                            \
+    aLoadReverbImpl(0x8000 + gSynthesisReverb.reverbGain, gSynthesisReverb.ringBuffer.right + (off),   \
+                    c + DMEM_ADDR_RIGHT_CH, c + DMEM_ADDR_WET_RIGHT_CH, len)
+#endif
+
 // Rounds val up to the next multiple of (1 << amnt). For example, ALIGN(50, 5) results in 64 (nearest 32)
 #define ALIGN(val, amnt) (((val) + (1 << amnt) - 1) & ~((1 << amnt) - 1))
 
@@ -88,6 +111,48 @@ f32 *gCurrentRightVolRamping; // Points to any of the three right buffers above
 struct SynthesisReverb gSynthesisReverb;
 #endif
 
+#ifdef AUDIO_STAGE_PROFILING
+struct AudioStageProfile gAudioStageProfile;
+
+// Each thread rendering notes keeps its own stack, and the time of all threads adds up
+static AUDIO_THREAD_LOCAL u8 sAudioStageStack[8] = { AUDIO_STAGE_OTHER };
+static AUDIO_THREAD_LOCAL s32 sAudioStageDepth;
+static AUDIO_THREAD_LOCAL u64 sAudioStageStartTime;
+
+static u64 audio_stage_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Charges the time since the last switch to the running stage
+static void audio_stage_switch(void) {
+    u64 now = audio_stage_time();
+    if (sAudioStageStartTime != 0) {
+        __atomic_fetch_add(&gAudioStageProfile.nanoseconds[sAudioStageStack[sAudioStageDepth]], now - sAudioStageStartTime, __ATOMIC_RELAXED);
+    }
+    sAudioStageStartTime = now;
+}
+
+void audio_stage_push(enum AudioStage stage) {
+    // Mixer commands issued for reverb count as reverb
+    if (sAudioStageStack[sAudioStageDepth] == AUDIO_STAGE_REVERB) {
+        stage = AUDIO_STAGE_REVERB;
+    }
+    audio_stage_switch();
+    sAudioStageStack[++sAudioStageDepth] = stage;
+    __atomic_fetch_add(&gAudioStageProfile.calls[stage], 1, __ATOMIC_RELAXED);
+}
+
+void audio_stage_pop(void) {
+    audio_stage_switch();
+    // Time outside of every stage isn't counted, which leaves out idle worker threads
+    if (--sAudioStageDepth == 0) {
+        sAudioStageStartTime = 0;
+    }
+}
+#endif
+
 #ifndef VERSION_EU
 u8 sAudioSynthesisPad[0x20];
 #endif
@@ -278,7 +343,9 @@ u64 *synthesis_execute(u64 *cmdBuf, s32 *writtenCmds, s16 *aiBuf, s32 bufLen) {
     DO_3DS(sCurAiBufBasePtr = aiBuf;);
 
     for (i = gAudioBufferParameters.updatesPerFrame; i > 0; i--) {
+        AUDIO_STAGE_PUSH(AUDIO_STAGE_SEQUENCES);
         process_sequences(i - 1);
+        AUDIO_STAGE_POP();
         synthesis_load_note_subs_eu(gAudioBufferParameters.updatesPerFrame - i);
     }
     aSegment(cmd++, 0, 0);
@@ -346,10 +413,14 @@ u64 *synthesis_execute(u64 *cmdBuf, s32 *writtenCmds, s16 *aiBuf, s32 bufLen) {
             }
         }
 
+        AUDIO_STAGE_PUSH(AUDIO_STAGE_SEQUENCES);
         process_sequences(i - 1);
+        AUDIO_STAGE_POP();
         
         if (gSynthesisReverb.useReverb != 0) {
+            AUDIO_STAGE_PUSH(AUDIO_STAGE_REVERB);
             prepare_reverb_ring_buffer(chunkLen, gAudioUpdatesPerFrame - i);
+            AUDIO_STAGE_POP();
         }
 
         cmd = synthesis_do_one_audio_update((s16 *) aiBufPtr, chunkLen, cmd, gAudioUpdatesPerFrame - i);
@@ -559,7 +630,17 @@ u64 *synthesis_do_one_audio_update(s16 *aiBuf, s32 bufLen, u64 *cmd, u32 updateI
         aClearBuffer(cmd++, DMEM_ADDR_LEFT_CH, DEFAULT_LEN_2CH);
         cmd = synthesis_process_notes(aiBuf, bufLen, cmd);
     } else {
+        AUDIO_STAGE_PUSH(AUDIO_STAGE_REVERB);
         if (gReverbDownsampleRate == 1) {
+#ifndef TARGET_N64
+            // Same as the commands below, in one pass over the oldest samples in the ring buffer
+            if (v1->lengthB != 0) {
+                aLoadReverbPair(0, v1->lengthA, v1->startPos);
+                aLoadReverbPair(v1->lengthA, DEFAULT_LEN_1CH - v1->lengthA, 0);
+            } else {
+                aLoadReverbPair(0, DEFAULT_LEN_1CH, v1->startPos);
+            }
+#else
             // Put the oldest samples in the ring buffer into the wet channels
             aSetLoadBufferPair(cmd++, 0, v1->startPos);
             if (v1->lengthB != 0) {
@@ -577,6 +658,7 @@ u64 *synthesis_do_one_audio_update(s16 *aiBuf, s32 bufLen, u64 *cmd, u32 updateI
             // 0x8000 here is -100%
             aMix(cmd++, 0, /*gain*/ 0x8000 + gSynthesisReverb.reverbGain, /*in*/ DMEM_ADDR_WET_LEFT_CH,
                  /*out*/ DMEM_ADDR_WET_LEFT_CH);
+#endif
         } else {
             // Same as above but upsample the previously downsampled samples used for reverb first
             temp = 0; //! jesus christ
@@ -600,7 +682,9 @@ u64 *synthesis_do_one_audio_update(s16 *aiBuf, s32 bufLen, u64 *cmd, u32 updateI
             aMix(cmd++, 0, /*gain*/ 0x8000 + gSynthesisReverb.reverbGain, /*in*/ DMEM_ADDR_LEFT_CH, /*out*/ DMEM_ADDR_LEFT_CH);
             aDMEMMove(cmd++, DMEM_ADDR_LEFT_CH, DMEM_ADDR_WET_LEFT_CH, DEFAULT_LEN_2CH);
         }
+        AUDIO_STAGE_POP();
         cmd = synthesis_process_notes(aiBuf, bufLen, cmd);
+        AUDIO_STAGE_PUSH(AUDIO_STAGE_REVERB);
         if (gReverbDownsampleRate == 1) {
             aSetSaveBufferPair(cmd++, 0, v1->lengthA, v1->startPos);
             if (v1->lengthB != 0) {
@@ -614,6 +698,7 @@ u64 *synthesis_do_one_audio_update(s16 *aiBuf, s32 bufLen, u64 *cmd, u32 updateI
             aSaveBuffer(cmd++, VIRTUAL_TO_PHYSICAL2(gSynthesisReverb.items[gSynthesisReverb.curFrame][updateIndex].toDownsampleLeft));
             gSynthesisReverb.resampleFlags = 0;
         }
+        AUDIO_STAGE_POP();
     }
     return cmd;
 }
@@ -1422,350 +1507,507 @@ u64 *synthesis_process_note(struct Note *note, struct NoteSubEu *noteSubEu, stru
 // US and JP Non-N64 versions
 #else
 
-// Cleaned up and somewhat optimized version
-u64 *synthesis_process_notes(s16 *aiBuf, s32 bufLen, u64 *cmd) {
-    s16* curLoadedBook = NULL;
+#ifdef DIRECT_SAMPLE_DATA
+// Decodes ADPCM data at source to dmemAddr, like aADPCMdecDirect. Packets found in the decoded
+// ADPCM cache are copied from it, and the decoder only starts at the first one that isn't.
+static u64 *adpcm_decode_cached(u64 *cmd, u32 flags, ADPCM_STATE state, const s16 *loopState, u8 *source, u16 dmemAddr, s32 nbytes) {
+    static AUDIO_THREAD_LOCAL s16 decoded[2512 / sizeof(s16)]; // All of DMEM
+    const s32 nPackets = (nbytes + 31) / 32;
+    s32 nCached = 0;
+
+    if (gAdpcmCacheStats.budget == 0 || nPackets == 0) {
+        aSetBuffer(cmd++, 0, 0, dmemAddr, nbytes);
+        aADPCMdecDirect(cmd++, flags, VIRTUAL_TO_PHYSICAL2(state), source);
+        return cmd;
+    }
 
-    for (s32 noteIndex = 0; noteIndex < gMaxSimultaneousNotes; noteIndex++) {
-        struct Note* note = &gNotes[noteIndex];
+    AUDIO_STAGE_PUSH(AUDIO_STAGE_ADPCM);
 
-        // If the note is enabled but the audio bank isn't loaded, error.
-        //! This function requires note->enabled to be volatile, but it breaks other functions like note_enable.
-        //! Casting to a struct with just the volatile bitfield works, but there may be a better way to match.
-#ifdef VERSION_US
-        if (((struct vNote *)note)->enabled && IS_BANK_LOAD_COMPLETE(note->bankId) == FALSE) {
-#else
-        if (IS_BANK_LOAD_COMPLETE(note->bankId) == FALSE) {
-#endif
-            gAudioErrorFlags = (note->bankId << 8) + noteIndex + 0x1000000;
-        }
-        
-        // If the note is loaded and its bank is loaded, play it. Else, continue.
-        else if (((struct vNote *)note)->enabled) {
-            s32 flags;
-            u16 noteSamplesDmemAddrBeforeResampling;
+    // Like the decoder, start with the 16 samples before the first packet
+    if (flags & A_INIT) {
+        memset(decoded, 0, 16 * sizeof(s16));
+    } else if (flags & A_LOOP) {
+        memcpy(decoded, loopState, 16 * sizeof(s16));
+    } else {
+        memcpy(decoded, state, 16 * sizeof(s16));
+    }
 
-            // Init the note
-            if (note->needsInit == TRUE) {
-                flags = A_INIT;
-                note->samplePosInt = 0;
-                note->samplePosFrac = 0;
-            } else {
-                flags = 0;
-            }
+    adpcm_cache_lock();
+    for (; nCached < nPackets; nCached++) {
+        s16 *out = &decoded[(nCached + 1) * 16];
+        const s16 *samples = adpcm_cache_find(source + nCached * 9, out[-2], out[-1]);
+        if (samples == NULL) {
+            break;
+        }
+        memcpy(out, samples, 16 * sizeof(s16));
+    }
+    adpcm_cache_unlock();
+    memcpy(state, &decoded[nCached * 16], 16 * sizeof(s16));
+    if (nCached != 0) {
+        aSetBuffer(cmd++, 0, dmemAddr, 0, (nCached + 1) * 16 * sizeof(s16));
+        aLoadBuffer(cmd++, VIRTUAL_TO_PHYSICAL2(decoded));
+    }
+    AUDIO_STAGE_POP();
 
-            // Clamp the frequency
-            if (note->frequency >= US_FLOAT(3.99993))
-                note->frequency = US_FLOAT(3.99993);
+    if (nCached == nPackets) {
+        return cmd;
+    }
 
-            // If frequency is >= 2.0, the processing must be split into two parts
-            const bool tIsHighFreqNote = note->frequency >= US_FLOAT(2.0);
-            const f32 resamplingRate = tIsHighFreqNote ? note->frequency * US_FLOAT(.5) : note->frequency;
-            const s32 nParts = ((s32) tIsHighFreqNote) + 1; // If tIsHighFreqNote, 2. Else, 1.
+    // Decode the rest after the last cached packet, which the decoder rewrites as its initial state
+    const u16 restAddr = dmemAddr + nCached * 16 * sizeof(s16);
+    aSetBuffer(cmd++, 0, 0, restAddr, (nPackets - nCached) * 16 * sizeof(s16));
+    aADPCMdecDirect(cmd++, nCached != 0 ? 0 : flags, VIRTUAL_TO_PHYSICAL2(state), source + nCached * 9);
+
+    AUDIO_STAGE_PUSH(AUDIO_STAGE_ADPCM);
+    aSetBuffer(cmd++, 0, 0, restAddr, (nPackets - nCached + 1) * 16 * sizeof(s16));
+    aSaveBuffer(cmd++, VIRTUAL_TO_PHYSICAL2(&decoded[nCached * 16]));
+    adpcm_cache_lock();
+    for (s32 i = nCached; i < nPackets; i++) {
+        const s16 *out = &decoded[(i + 1) * 16];
+        adpcm_cache_insert(source + i * 9, out[-2], out[-1], out);
+    }
+    adpcm_cache_unlock();
+    AUDIO_STAGE_POP();
+    return cmd;
+}
+#endif
 
-            const u16 resamplingRateFixedPoint = (u16)(s32)(resamplingRate * 32768.0f);
-            const u32 samplesLenFixedPoint = note->samplePosFrac + (resamplingRateFixedPoint * bufLen) * 2;
-            note->samplePosFrac = samplesLenFixedPoint & 0xFFFF; // 16-bit store, can't reuse
+// Decodes and resamples an enabled note into DMEM_ADDR_TEMP, and sets the flags to mix it with
+static u64 *synthesis_render_note(u64 *cmd, struct Note *note, s32 bufLen, s16 **curLoadedBook, s32 *mixFlags) {
+    s32 flags;
+    u16 noteSamplesDmemAddrBeforeResampling;
 
-            // A wave synthesis note (not ADPCM)
-            if (note->sound == NULL) {
-                cmd = load_wave_samples(cmd, note, samplesLenFixedPoint >> 0x10);
-                noteSamplesDmemAddrBeforeResampling = DMEM_ADDR_UNCOMPRESSED_NOTE + note->samplePosInt * 2;
-                note->samplePosInt += (samplesLenFixedPoint >> 0x10);
-                flags = 0;
-            }
+    // Init the note
+    if (note->needsInit == TRUE) {
+        flags = A_INIT;
+        note->samplePosInt = 0;
+        note->samplePosFrac = 0;
+    } else {
+        flags = 0;
+    }
 
-            // An ADPCM note
-            else {
-                const struct AudioBankSample *audioBookSample = note->sound->sample;
-                const struct AdpcmLoop *loopInfo = audioBookSample->loop;
-                u8* sampleAddr = audioBookSample->sampleAddr;
+    // Clamp the frequency
+    if (note->frequency >= US_FLOAT(3.99993))
+        note->frequency = US_FLOAT(3.99993);
+
+    // If frequency is >= 2.0, the processing must be split into two parts
+    const bool tIsHighFreqNote = note->frequency >= US_FLOAT(2.0);
+    const f32 resamplingRate = tIsHighFreqNote ? note->frequency * US_FLOAT(.5) : note->frequency;
+    const s32 nParts = ((s32) tIsHighFreqNote) + 1; // If tIsHighFreqNote, 2. Else, 1.
+
+    const u16 resamplingRateFixedPoint = (u16)(s32)(resamplingRate * 32768.0f);
+    const u32 samplesLenFixedPoint = note->samplePosFrac + (resamplingRateFixedPoint * bufLen) * 2;
+    note->samplePosFrac = samplesLenFixedPoint & 0xFFFF; // 16-bit store, can't reuse
+
+    // A wave synthesis note (not ADPCM)
+    if (note->sound == NULL) {
+        cmd = load_wave_samples(cmd, note, samplesLenFixedPoint >> 0x10);
+        noteSamplesDmemAddrBeforeResampling = DMEM_ADDR_UNCOMPRESSED_NOTE + note->samplePosInt * 2;
+        note->samplePosInt += (samplesLenFixedPoint >> 0x10);
+        flags = 0;
+    }
 
-                s32 resampledTempLen = 0;
+    // An ADPCM note
+    else {
+        const struct AudioBankSample *audioBookSample = note->sound->sample;
+        const struct AdpcmLoop *loopInfo = audioBookSample->loop;
+        u8* sampleAddr = audioBookSample->sampleAddr;
 
-                // If the wrong ADPCM book is loaded, load the right one
-                if (curLoadedBook != audioBookSample->book->book) {
-                    const u32 nEntries = audioBookSample->book->order * audioBookSample->book->npredictors;
-                    curLoadedBook = audioBookSample->book->book;
-                    aLoadADPCM(cmd++, nEntries * 16, VIRTUAL_TO_PHYSICAL2(curLoadedBook));
-                }
+        s32 resampledTempLen = 0;
 
-                // Execute 1 or 2 times depending on frequency
-                for (s32 curPart = 0; curPart < nParts; curPart++) {
-                    s32 nAdpcmSamplesProcessed = 0;
-                    s32 decodeTailPtr = 0;  // Points to the first free byte in the uncompressed note buffer
-                    s32 samplesLenAdjusted;
-                    s32 samplePosAlignmentOffset; // Offset into the ADPCM output buffer start pos
+        // If the wrong ADPCM book is loaded, load the right one
+        if (*curLoadedBook != audioBookSample->book->book) {
+            const u32 nEntries = audioBookSample->book->order * audioBookSample->book->npredictors;
+            *curLoadedBook = audioBookSample->book->book;
+            aLoadADPCM(cmd++, nEntries * 16, VIRTUAL_TO_PHYSICAL2(*curLoadedBook));
+        }
 
-                    // Adjust sample length if we have two parts
-                    if (nParts == 1) {
-                        samplesLenAdjusted = samplesLenFixedPoint >> 0x10;
-                    } else if ((samplesLenFixedPoint >> 0x10) & 1) {
-                        samplesLenAdjusted = ((samplesLenFixedPoint >> 0x10) & ~1) + (curPart * 2);
-                    }
-                    else {
-                        samplesLenAdjusted = (samplesLenFixedPoint >> 0x10);
-                    }
+        // Execute 1 or 2 times depending on frequency
+        for (s32 curPart = 0; curPart < nParts; curPart++) {
+            s32 nAdpcmSamplesProcessed = 0;
+            s32 decodeTailPtr = 0;  // Points to the first free byte in the uncompressed note buffer
+            s32 samplesLenAdjusted;
+            s32 samplePosAlignmentOffset; // Offset into the ADPCM output buffer start pos
+
+            // Adjust sample length if we have two parts
+            if (nParts == 1) {
+                samplesLenAdjusted = samplesLenFixedPoint >> 0x10;
+            } else if ((samplesLenFixedPoint >> 0x10) & 1) {
+                samplesLenAdjusted = ((samplesLenFixedPoint >> 0x10) & ~1) + (curPart * 2);
+            }
+            else {
+                samplesLenAdjusted = (samplesLenFixedPoint >> 0x10);
+            }
 
-                    /*
-                     * Process every sample in this part of the note
-                     * Contents run gMaxSimultaneousNotes * (parts per note (2 max)) * (samplesLenAdjusted per note)
-                     * Important information:
-                     *   ADPCM is compressed data, stored in chunks of 9 bytes.
-                     *   PCM is uncompressed data, stored in 16-bit unsigned ints.
-                     *   For every 16 PCM samples, 9 bytes of ADPCM + the previous 2 bytes of PCM are used.
-                     *   A Sample Chunk is the smallest amount of data that adpcmDec decodes at once
-                    */
-                    
-                    while (nAdpcmSamplesProcessed != samplesLenAdjusted) {
-                        const s32 samplesRemaining = loopInfo->end - note->samplePosInt; // samples until the end of this part of the note
-                        const s32 nSamplesToProcess = samplesLenAdjusted - nAdpcmSamplesProcessed; // samples to process this notePart
-                        s32 samplePosIntLowerNibble = note->samplePosInt & 15; // Aligned to 16-byte chunks
-                        s32 nAdpcmPacketsThisIteration; // Data is decoded one packet at a time (16 samples PCM from 9 bytes ADPCM)
-                        s32 nUncompressedSamplesThisIteration; // 
-                        bool noteFinished = false, restart = false;
-
-                        // If we can avoid skipping samples, do so
-                        if (samplePosIntLowerNibble == 0 && note->restart == FALSE) {
-                            samplePosIntLowerNibble = 16;
-                        }
+            /*
+             * Process every sample in this part of the note
+             * Contents run gMaxSimultaneousNotes * (parts per note (2 max)) * (samplesLenAdjusted per note)
+             * Important information:
+             *   ADPCM is compressed data, stored in chunks of 9 bytes.
+             *   PCM is uncompressed data, stored in 16-bit unsigned ints.
+             *   For every 16 PCM samples, 9 bytes of ADPCM + the previous 2 bytes of PCM are used.
+             *   A Sample Chunk is the smallest amount of data that adpcmDec decodes at once
+            */
+            
+            while (nAdpcmSamplesProcessed != samplesLenAdjusted) {
+                const s32 samplesRemaining = loopInfo->end - note->samplePosInt; // samples until the end of this part of the note
+                const s32 nSamplesToProcess = samplesLenAdjusted - nAdpcmSamplesProcessed; // samples to process this notePart
+                s32 samplePosIntLowerNibble = note->samplePosInt & 15; // Aligned to 16-byte chunks
+                s32 nAdpcmPacketsThisIteration; // Data is decoded one packet at a time (16 samples PCM from 9 bytes ADPCM)
+                s32 nUncompressedSamplesThisIteration; // 
+                bool noteFinished = false, restart = false;
+
+                // If we can avoid skipping samples, do so
+                if (samplePosIntLowerNibble == 0 && note->restart == FALSE) {
+                    samplePosIntLowerNibble = 16;
+                }
 
-                        s32 samplesSkippedThisIteration = 16 - samplePosIntLowerNibble; // Alignment
-                        s32 s3;
+                s32 samplesSkippedThisIteration = 16 - samplePosIntLowerNibble; // Alignment
+                s32 s3;
 
-                        // If we have more chunks after this one, process a full chunk
-                        if (nSamplesToProcess < samplesRemaining) {
-                            nAdpcmPacketsThisIteration = (nSamplesToProcess - samplesSkippedThisIteration + 15) / 16;
-                            nUncompressedSamplesThisIteration = nAdpcmPacketsThisIteration * 16;
-                            s3 = samplesSkippedThisIteration + nUncompressedSamplesThisIteration - nSamplesToProcess;
-                        }
+                // If we have more chunks after this one, process a full chunk
+                if (nSamplesToProcess < samplesRemaining) {
+                    nAdpcmPacketsThisIteration = (nSamplesToProcess - samplesSkippedThisIteration + 15) / 16;
+                    nUncompressedSamplesThisIteration = nAdpcmPacketsThisIteration * 16;
+                    s3 = samplesSkippedThisIteration + nUncompressedSamplesThisIteration - nSamplesToProcess;
+                }
 
-                        // The final sample chunk, which may be smaller than the rest
-                        else {
-                            nUncompressedSamplesThisIteration = samplesRemaining + samplePosIntLowerNibble - 16;
-                            s3 = 0;
-                            if (nUncompressedSamplesThisIteration <= 0) {
-                                nUncompressedSamplesThisIteration = 0;
-                                samplesSkippedThisIteration = samplesRemaining;
-                            }
-                            nAdpcmPacketsThisIteration = (nUncompressedSamplesThisIteration + 15) / 16;
-                            
-                            if (loopInfo->count != 0)
-                                restart =  true;
-                            else
-                                noteFinished = true;
-                        }
+                // The final sample chunk, which may be smaller than the rest
+                else {
+                    nUncompressedSamplesThisIteration = samplesRemaining + samplePosIntLowerNibble - 16;
+                    s3 = 0;
+                    if (nUncompressedSamplesThisIteration <= 0) {
+                        nUncompressedSamplesThisIteration = 0;
+                        samplesSkippedThisIteration = samplesRemaining;
+                    }
+                    nAdpcmPacketsThisIteration = (nUncompressedSamplesThisIteration + 15) / 16;
+                    
+                    if (loopInfo->count != 0)
+                        restart =  true;
+                    else
+                        noteFinished = true;
+                }
 
 
-#ifdef ENHANCED_RSPA_EMULATION
+#ifdef DIRECT_SAMPLE_DATA
 
-                        uint8_t* directSampleAddr = 0; // Sample data is read directly from emuROM
+                uint8_t* directSampleAddr = 0; // Sample data is decoded where it was loaded, see dma_sample_data
 
-                        if (nAdpcmPacketsThisIteration == 0)
-                            nUncompressedSamplesThisIteration = 0;
-                        else
-                            directSampleAddr = sampleAddr + (((note->samplePosInt - samplePosIntLowerNibble + 16) >> 4) * 9);
+                if (nAdpcmPacketsThisIteration == 0)
+                    nUncompressedSamplesThisIteration = 0;
+                else
+                    directSampleAddr = sampleAddr + (((note->samplePosInt - samplePosIntLowerNibble + 16) >> 4) * 9);
 
 #else
 
-                        u32 sampleDataOffset; // Aligns sample data to 16-byte chunks.
+                u32 sampleDataOffset; // Aligns sample data to 16-byte chunks.
 
-                        // Load compressed ADPCM data into the RSP
-                        if (nAdpcmPacketsThisIteration != 0) {
-                            const s32 tempNumSamples = (note->samplePosInt - samplePosIntLowerNibble + 16) / 16;
-                            
-                            // Load sample data
-                            const u8* sampleDataAddr = dma_sample_data(
-                                (uintptr_t) (sampleAddr + tempNumSamples * 9), // Source addr
-                                nAdpcmPacketsThisIteration * 9, // size
-                                flags,
-                                &note->sampleDmaIndex);
-
-                            sampleDataOffset = (u32)((uintptr_t) sampleDataAddr & 0b1111); // lower 4 bits of address (aligned down to 16) 
-
-                            // Load ADPCM data into DMEM_ADDR_COMPRESSED_ADPCM_DATA
-                            aSetBuffer(cmd++, 0, DMEM_ADDR_COMPRESSED_ADPCM_DATA, 0, nAdpcmPacketsThisIteration * 9 + sampleDataOffset); 
-                            aLoadBuffer(cmd++, VIRTUAL_TO_PHYSICAL2(sampleDataAddr - sampleDataOffset)); 
-                        } else {
-                            nUncompressedSamplesThisIteration = 0;
-                            sampleDataOffset = 0;
-                        }
+                // Load compressed ADPCM data into the RSP
+                if (nAdpcmPacketsThisIteration != 0) {
+                    const s32 tempNumSamples = (note->samplePosInt - samplePosIntLowerNibble + 16) / 16;
+                    
+                    // Load sample data
+                    const u8* sampleDataAddr = dma_sample_data(
+                        (uintptr_t) (sampleAddr + tempNumSamples * 9), // Source addr
+                        nAdpcmPacketsThisIteration * 9, // size
+                        flags,
+                        &note->sampleDmaIndex);
+
+                    sampleDataOffset = (u32)((uintptr_t) sampleDataAddr & 0b1111); // lower 4 bits of address (aligned down to 16) 
+
+                    // Load ADPCM data into DMEM_ADDR_COMPRESSED_ADPCM_DATA
+                    aSetBuffer(cmd++, 0, DMEM_ADDR_COMPRESSED_ADPCM_DATA, 0, nAdpcmPacketsThisIteration * 9 + sampleDataOffset); 
+                    aLoadBuffer(cmd++, VIRTUAL_TO_PHYSICAL2(sampleDataAddr - sampleDataOffset)); 
+                } else {
+                    nUncompressedSamplesThisIteration = 0;
+                    sampleDataOffset = 0;
+                }
 #endif
 
-                        // If we need to restart the note, loop it
-                        if (note->restart != FALSE) {
-                            aSetLoop(cmd++, VIRTUAL_TO_PHYSICAL2(audioBookSample->loop->state));
-                            flags = A_LOOP; // = 2
-                            note->restart = FALSE;
-                        }
+                // If we need to restart the note, loop it
+                if (note->restart != FALSE) {
+                    aSetLoop(cmd++, VIRTUAL_TO_PHYSICAL2(audioBookSample->loop->state));
+                    flags = A_LOOP; // = 2
+                    note->restart = FALSE;
+                }
 
-                        const s32 nSamplesInThisIteration = nUncompressedSamplesThisIteration + samplesSkippedThisIteration - s3;
+                const s32 nSamplesInThisIteration = nUncompressedSamplesThisIteration + samplesSkippedThisIteration - s3;
 
-#ifdef ENHANCED_RSPA_EMULATION
-                        
-                        // Decode some data
-                        // If this is the firt decode, do an unaligned chunk to get us aligned to 32-byte chunks.
-                        if (nAdpcmSamplesProcessed == 0) {
-                            aSetBuffer(cmd++, 0, /*Unused IN*/ 0, DMEM_ADDR_UNCOMPRESSED_NOTE, nUncompressedSamplesThisIteration * 2);
-                            aADPCMdecDirect(cmd++, flags, VIRTUAL_TO_PHYSICAL2(note->synthesisBuffers->adpcmdecState), directSampleAddr);
-                            samplePosAlignmentOffset = samplePosIntLowerNibble * 2;
-                        }
-                        
-                        // If this is not the first decode, decode aligned to 32-byte chunks
-                        // and then the data is copied to unaligned memory
-                        else {
-                            const s32 alignedDecodeAddr = ALIGN(decodeTailPtr, 5);
-                            aSetBuffer(cmd++, 0, /*Unused IN*/ 0, DMEM_ADDR_UNCOMPRESSED_NOTE + alignedDecodeAddr, nUncompressedSamplesThisIteration * 2);
-
-                            aADPCMdecDirect(cmd++, flags, VIRTUAL_TO_PHYSICAL2(note->synthesisBuffers->adpcmdecState), directSampleAddr);
-
-                            // Shift our aligned data down to the unaligned destination
-                            aDMEMMove(
-                                cmd++,
-                                DMEM_ADDR_UNCOMPRESSED_NOTE + alignedDecodeAddr + (samplePosIntLowerNibble * 2), // input
-                                DMEM_ADDR_UNCOMPRESSED_NOTE + decodeTailPtr, // output
-                                nSamplesInThisIteration * 2); // nbytes
-                        }
+#ifdef DIRECT_SAMPLE_DATA
+                
+                // Decode some data
+                // If this is the firt decode, do an unaligned chunk to get us aligned to 32-byte chunks.
+                if (nAdpcmSamplesProcessed == 0) {
+                    cmd = adpcm_decode_cached(cmd, flags, note->synthesisBuffers->adpcmdecState, audioBookSample->loop->state,
+                                              directSampleAddr, DMEM_ADDR_UNCOMPRESSED_NOTE, nUncompressedSamplesThisIteration * 2);
+                    samplePosAlignmentOffset = samplePosIntLowerNibble * 2;
+                }
+                
+                // If this is not the first decode, decode aligned to 32-byte chunks
+                // and then the data is copied to unaligned memory
+                else {
+                    const s32 alignedDecodeAddr = ALIGN(decodeTailPtr, 5);
+                    cmd = adpcm_decode_cached(cmd, flags, note->synthesisBuffers->adpcmdecState, audioBookSample->loop->state,
+                                              directSampleAddr, DMEM_ADDR_UNCOMPRESSED_NOTE + alignedDecodeAddr, nUncompressedSamplesThisIteration * 2);
+
+                    // Shift our aligned data down to the unaligned destination
+                    aDMEMMove(
+                        cmd++,
+                        DMEM_ADDR_UNCOMPRESSED_NOTE + alignedDecodeAddr + (samplePosIntLowerNibble * 2), // input
+                        DMEM_ADDR_UNCOMPRESSED_NOTE + decodeTailPtr, // output
+                        nSamplesInThisIteration * 2); // nbytes
+                }
 #else
-                        // Decode some data
-                        // If this is the firt decode, do an unaligned chunk to get us aligned to 32-byte chunks.
-                        if (nAdpcmSamplesProcessed == 0) {
-                            aSetBuffer(cmd++, 0, DMEM_ADDR_COMPRESSED_ADPCM_DATA + sampleDataOffset, DMEM_ADDR_UNCOMPRESSED_NOTE, nUncompressedSamplesThisIteration * 2);
-                            aADPCMdec(cmd++, flags, VIRTUAL_TO_PHYSICAL2(note->synthesisBuffers->adpcmdecState));
-                            samplePosAlignmentOffset = samplePosIntLowerNibble * 2;
-                        }
-
-                        
-                        
-                        // If this is not the first decode, decode aligned to 32-byte chunks
-                        // and then the data is copied to unaligned memory
-                        else {
-                            const s32 alignedDecodeAddr = ALIGN(decodeTailPtr, 5);
-                            aSetBuffer(cmd++, 0, DMEM_ADDR_COMPRESSED_ADPCM_DATA + sampleDataOffset, DMEM_ADDR_UNCOMPRESSED_NOTE + alignedDecodeAddr, nUncompressedSamplesThisIteration * 2);
-                            aADPCMdec(cmd++, flags, VIRTUAL_TO_PHYSICAL2(note->synthesisBuffers->adpcmdecState));
+                // Decode some data
+                // If this is the firt decode, do an unaligned chunk to get us aligned to 32-byte chunks.
+                if (nAdpcmSamplesProcessed == 0) {
+                    aSetBuffer(cmd++, 0, DMEM_ADDR_COMPRESSED_ADPCM_DATA + sampleDataOffset, DMEM_ADDR_UNCOMPRESSED_NOTE, nUncompressedSamplesThisIteration * 2);
+                    aADPCMdec(cmd++, flags, VIRTUAL_TO_PHYSICAL2(note->synthesisBuffers->adpcmdecState));
+                    samplePosAlignmentOffset = samplePosIntLowerNibble * 2;
+                }
 
-                            // Shift our aligned data down to the unaligned destination
-                            aDMEMMove(
-                                cmd++,
-                                DMEM_ADDR_UNCOMPRESSED_NOTE + alignedDecodeAddr + (samplePosIntLowerNibble * 2), // input
-                                DMEM_ADDR_UNCOMPRESSED_NOTE + decodeTailPtr, // output
-                                nSamplesInThisIteration * 2); // nbytes
-                        }
+                
+                
+                // If this is not the first decode, decode aligned to 32-byte chunks
+                // and then the data is copied to unaligned memory
+                else {
+                    const s32 alignedDecodeAddr = ALIGN(decodeTailPtr, 5);
+                    aSetBuffer(cmd++, 0, DMEM_ADDR_COMPRESSED_ADPCM_DATA + sampleDataOffset, DMEM_ADDR_UNCOMPRESSED_NOTE + alignedDecodeAddr, nUncompressedSamplesThisIteration * 2);
+                    aADPCMdec(cmd++, flags, VIRTUAL_TO_PHYSICAL2(note->synthesisBuffers->adpcmdecState));
+
+                    // Shift our aligned data down to the unaligned destination
+                    aDMEMMove(
+                        cmd++,
+                        DMEM_ADDR_UNCOMPRESSED_NOTE + alignedDecodeAddr + (samplePosIntLowerNibble * 2), // input
+                        DMEM_ADDR_UNCOMPRESSED_NOTE + decodeTailPtr, // output
+                        nSamplesInThisIteration * 2); // nbytes
+                }
 #endif
 
-                        nAdpcmSamplesProcessed += nSamplesInThisIteration;
+                nAdpcmSamplesProcessed += nSamplesInThisIteration;
 
-                        switch (flags) {
-                            case A_INIT: // = 1
-                                samplePosAlignmentOffset = 0;
-                                decodeTailPtr = nUncompressedSamplesThisIteration * 2 + decodeTailPtr;
-                                break;
+                switch (flags) {
+                    case A_INIT: // = 1
+                        samplePosAlignmentOffset = 0;
+                        decodeTailPtr = nUncompressedSamplesThisIteration * 2 + decodeTailPtr;
+                        break;
 
-                            case A_LOOP: // = 2
-                                decodeTailPtr = nSamplesInThisIteration * 2 + decodeTailPtr;
-                                break;
+                    case A_LOOP: // = 2
+                        decodeTailPtr = nSamplesInThisIteration * 2 + decodeTailPtr;
+                        break;
 
-                            default:
-                                if (decodeTailPtr != 0) {
-                                    decodeTailPtr = nSamplesInThisIteration * 2 + decodeTailPtr;
-                                } else {
-                                    decodeTailPtr = (samplePosIntLowerNibble + nSamplesInThisIteration) * 2;
-                                }
-                                break;
+                    default:
+                        if (decodeTailPtr != 0) {
+                            decodeTailPtr = nSamplesInThisIteration * 2 + decodeTailPtr;
+                        } else {
+                            decodeTailPtr = (samplePosIntLowerNibble + nSamplesInThisIteration) * 2;
                         }
-                        flags = 0;
+                        break;
+                }
+                flags = 0;
 
-                        // If the note is finished, clear junk data from the end of the buffer,
-                        // disable the note, and exit the loop.
-                        if (noteFinished) {
-                            aClearBuffer(cmd++, DMEM_ADDR_UNCOMPRESSED_NOTE + decodeTailPtr,
-                                         (samplesLenAdjusted - nAdpcmSamplesProcessed) * 2);
-                            note->samplePosInt = 0;
-                            note->finished = 1;
-                            ((struct vNote *)note)->enabled = 0;
+                // If the note is finished, clear junk data from the end of the buffer,
+                // disable the note, and exit the loop.
+                if (noteFinished) {
+                    aClearBuffer(cmd++, DMEM_ADDR_UNCOMPRESSED_NOTE + decodeTailPtr,
+                                 (samplesLenAdjusted - nAdpcmSamplesProcessed) * 2);
+                    note->samplePosInt = 0;
+                    note->finished = 1;
+                    ((struct vNote *)note)->enabled = 0;
+                    break;
+                }
+
+                else if (restart) {
+                    note->restart = TRUE;
+                    note->samplePosInt = loopInfo->start;
+                }
+                
+                else {
+                    note->samplePosInt += nSamplesToProcess;
+                }
+            }
+
+            // End of while-loop synthesis
+            // ADPCM only
+
+            switch (nParts) {
+
+                // If we have one part, don't resample.
+                case 1:
+                    noteSamplesDmemAddrBeforeResampling = DMEM_ADDR_UNCOMPRESSED_NOTE + samplePosAlignmentOffset;
+                    break;
+
+                // If we have two parts (high-pitched notes), resample
+                case 2:
+                    switch (curPart) {
+                        case 0:
+                            aSetBuffer(cmd++, 0, DMEM_ADDR_UNCOMPRESSED_NOTE + samplePosAlignmentOffset, DMEM_ADDR_RESAMPLED, samplesLenAdjusted + 4);
+                            aResample(cmd++, A_INIT, 0xff60, VIRTUAL_TO_PHYSICAL2(note->synthesisBuffers->dummyResampleState));
+                            resampledTempLen = samplesLenAdjusted + 4;
+                            noteSamplesDmemAddrBeforeResampling = DMEM_ADDR_RESAMPLED + 4;
+                            if (note->finished != FALSE) {
+                                aClearBuffer(cmd++, DMEM_ADDR_RESAMPLED + resampledTempLen, samplesLenAdjusted + 0x10);
+                            }
                             break;
-                        }
 
-                        else if (restart) {
-                            note->restart = TRUE;
-                            note->samplePosInt = loopInfo->start;
-                        }
-                        
-                        else {
-                            note->samplePosInt += nSamplesToProcess;
-                        }
+                        case 1:
+                            aSetBuffer(cmd++, 0, DMEM_ADDR_UNCOMPRESSED_NOTE + samplePosAlignmentOffset,
+                                       DMEM_ADDR_RESAMPLED2,
+                                       samplesLenAdjusted + 8);
+                            aResample(cmd++, A_INIT, 0xff60,
+                                      VIRTUAL_TO_PHYSICAL2(
+                                          note->synthesisBuffers->dummyResampleState));
+                            aDMEMMove(cmd++, DMEM_ADDR_RESAMPLED2 + 4,
+                                      DMEM_ADDR_RESAMPLED + resampledTempLen,
+                                      samplesLenAdjusted + 4);
+                            break;
                     }
+            }
 
-                    // End of while-loop synthesis
-                    // ADPCM only
+            if (note->finished != FALSE) {
+                break;
+            }
 
-                    switch (nParts) {
+        } // end for (curPart = 0; curPart < nParts; curPart++){...}
+    } // End if(...) {synthetic} else {adpcm}
 
-                        // If we have one part, don't resample.
-                        case 1:
-                            noteSamplesDmemAddrBeforeResampling = DMEM_ADDR_UNCOMPRESSED_NOTE + samplePosAlignmentOffset;
-                            break;
+    // Our note is now fully decompressed/synthesized.
+    // Do one final resample, synthesis_mix_note does the rest.
 
-                        // If we have two parts (high-pitched notes), resample
-                        case 2:
-                            switch (curPart) {
-                                case 0:
-                                    aSetBuffer(cmd++, 0, DMEM_ADDR_UNCOMPRESSED_NOTE + samplePosAlignmentOffset, DMEM_ADDR_RESAMPLED, samplesLenAdjusted + 4);
-                                    aResample(cmd++, A_INIT, 0xff60, VIRTUAL_TO_PHYSICAL2(note->synthesisBuffers->dummyResampleState));
-                                    resampledTempLen = samplesLenAdjusted + 4;
-                                    noteSamplesDmemAddrBeforeResampling = DMEM_ADDR_RESAMPLED + 4;
-                                    if (note->finished != FALSE) {
-                                        aClearBuffer(cmd++, DMEM_ADDR_RESAMPLED + resampledTempLen, samplesLenAdjusted + 0x10);
-                                    }
-                                    break;
+    flags = 0;
 
-                                case 1:
-                                    aSetBuffer(cmd++, 0, DMEM_ADDR_UNCOMPRESSED_NOTE + samplePosAlignmentOffset,
-                                               DMEM_ADDR_RESAMPLED2,
-                                               samplesLenAdjusted + 8);
-                                    aResample(cmd++, A_INIT, 0xff60,
-                                              VIRTUAL_TO_PHYSICAL2(
-                                                  note->synthesisBuffers->dummyResampleState));
-                                    aDMEMMove(cmd++, DMEM_ADDR_RESAMPLED2 + 4,
-                                              DMEM_ADDR_RESAMPLED + resampledTempLen,
-                                              samplesLenAdjusted + 4);
-                                    break;
-                            }
-                    }
+    if (note->needsInit == TRUE) {
+        flags = A_INIT;
+        note->needsInit = FALSE;
+    }
 
-                    if (note->finished != FALSE) {
-                        break;
-                    }
+    cmd = final_resample(cmd, note, bufLen * 2, resamplingRateFixedPoint,
+                         noteSamplesDmemAddrBeforeResampling, flags);
+    *mixFlags = flags;
+    return cmd;
+}
 
-                } // end for (curPart = 0; curPart < nParts; curPart++){...}
-            } // End if(...) {synthetic} else {adpcm}
+// Mixes the note rendered into DMEM_ADDR_TEMP into the output channels
+static u64 *synthesis_mix_note(u64 *cmd, struct Note *note, s32 bufLen, s32 flags) {
+    // panRight = 1, panLeft = 2, else 0
+    const u16 panRight = note->headsetPanRight | note->prevHeadsetPanRight;
+    const u16 panLeft = note->headsetPanLeft | note->prevHeadsetPanLeft;
+    const s32 panSettings = panRight ? 1 : (panLeft ? 2 : 0);
 
-            // Our note is now fully decompressed/synthesized.
-            // Do one final resample, process envelope, and apply headset panning.
+    // Stereo panning is handled here
+    cmd = process_envelope(cmd, note, bufLen, DMEM_ADDR_TEMP, panSettings, flags);
 
-            flags = 0;
+    // Only ever set if gSoundMode == HEADSET. Applies extra panning nonsense.
+    if (note->usesHeadsetPanEffects) {
+        cmd = note_apply_headset_pan_effects(cmd, note, bufLen * 2, flags, panSettings);
+    }
+    return cmd;
+}
 
-            if (note->needsInit == TRUE) {
-                flags = A_INIT;
-                note->needsInit = FALSE;
-            }
+#ifdef SYNTHESIS_PARALLEL_NOTES
+// Notes are rendered on every audio job thread, each with its own emulated DMEM, then mixed one
+// after another in note order on this thread, so the output doesn't depend on the thread count.
+struct RenderedNote {
+    struct Note *note;
+    s32 flags;
+    s16 samples[DMEM_ADDR_LEFT_CH / sizeof(s16)]; // Everything below the output channels
+};
 
-            cmd = final_resample(cmd, note, bufLen * 2, resamplingRateFixedPoint,
-                                 noteSamplesDmemAddrBeforeResampling, flags);
+static struct RenderedNote *sRenderedNotes;
+static s32 sRenderedNotesCapacity;
+static s32 sRenderedNotesBufLen;
+
+static void synthesis_render_note_job(int index, UNUSED void *arg) {
+    struct RenderedNote *rendered = &sRenderedNotes[index];
+    s16 *curLoadedBook = NULL;
+    u64 *cmd = NULL; // Commands run as they are issued on PC
+
+    AUDIO_STAGE_PUSH(AUDIO_STAGE_NOTES);
+    // The resampler keeps a few samples past the ones a note decoded as its state, so every note starts
+    // from cleared DMEM, here and in synthesis_process_notes, which keeps the output the same whichever
+    // thread renders it
+    aClearBuffer(cmd++, DMEM_ADDR_TEMP, sizeof(rendered->samples));
+    cmd = synthesis_render_note(cmd, rendered->note, sRenderedNotesBufLen, &curLoadedBook, &rendered->flags);
+    aSetBuffer(cmd++, 0, 0, DMEM_ADDR_TEMP, sizeof(rendered->samples));
+    aSaveBuffer(cmd++, VIRTUAL_TO_PHYSICAL2(rendered->samples));
+    AUDIO_STAGE_POP();
+}
 
-            // panRight = 1, panLeft = 2, else 0
-            const u16 panRight = note->headsetPanRight | note->prevHeadsetPanRight;
-            const u16 panLeft = note->headsetPanLeft | note->prevHeadsetPanLeft;
-            const s32 panSettings = panRight ? 1 : (panLeft ? 2 : 0);
+static bool synthesis_reserve_rendered_notes(void) {
+    if (sRenderedNotesCapacity < gMaxSimultaneousNotes) {
+        struct RenderedNote *renderedNotes = realloc(sRenderedNotes, gMaxSimultaneousNotes * sizeof(struct RenderedNote));
+        if (renderedNotes == NULL) {
+            return false;
+        }
+        sRenderedNotes = renderedNotes;
+        sRenderedNotesCapacity = gMaxSimultaneousNotes;
+    }
+    return true;
+}
 
-            // Stereo panning is handled here
-            cmd = process_envelope(cmd, note, bufLen, DMEM_ADDR_TEMP, panSettings, flags);
+static u64 *synthesis_process_notes_parallel(u64 *cmd, s32 bufLen) {
+    s32 nRendered = 0;
 
-            // Only ever set if gSoundMode == HEADSET. Applies extra panning nonsense.
-            if (note->usesHeadsetPanEffects) {
-                cmd = note_apply_headset_pan_effects(cmd, note, bufLen * 2, flags, panSettings);
-            }
+    // Same checks as synthesis_process_notes
+    for (s32 noteIndex = 0; noteIndex < gMaxSimultaneousNotes; noteIndex++) {
+        struct Note* note = &gNotes[noteIndex];
+#ifdef VERSION_US
+        if (((struct vNote *)note)->enabled && IS_BANK_LOAD_COMPLETE(note->bankId) == FALSE) {
+#else
+        if (IS_BANK_LOAD_COMPLETE(note->bankId) == FALSE) {
+#endif
+            gAudioErrorFlags = (note->bankId << 8) + noteIndex + 0x1000000;
+        } else if (((struct vNote *)note)->enabled) {
+            sRenderedNotes[nRendered++].note = note;
+        }
+    }
+
+    sRenderedNotesBufLen = bufLen;
+    audio_jobs_run(synthesis_render_note_job, NULL, nRendered);
+
+    for (s32 i = 0; i < nRendered; i++) {
+        aSetBuffer(cmd++, 0, DMEM_ADDR_TEMP, 0, sizeof(sRenderedNotes[i].samples));
+        aLoadBuffer(cmd++, VIRTUAL_TO_PHYSICAL2(sRenderedNotes[i].samples));
+        cmd = synthesis_mix_note(cmd, sRenderedNotes[i].note, bufLen, sRenderedNotes[i].flags);
+    }
+    return cmd;
+}
+#endif
+
+// Cleaned up and somewhat optimized version
+u64 *synthesis_process_notes(s16 *aiBuf, s32 bufLen, u64 *cmd) {
+    s16* curLoadedBook = NULL;
+    AUDIO_STAGE_PUSH(AUDIO_STAGE_NOTES);
+
+#ifdef SYNTHESIS_PARALLEL_NOTES
+    // Falls back to one note after another if there is no room for every rendered note
+    if (audio_jobs_num_threads() > 1 && synthesis_reserve_rendered_notes()) {
+        cmd = synthesis_process_notes_parallel(cmd, bufLen);
+    } else
+#endif
+    for (s32 noteIndex = 0; noteIndex < gMaxSimultaneousNotes; noteIndex++) {
+        struct Note* note = &gNotes[noteIndex];
 
+        // If the note is enabled but the audio bank isn't loaded, error.
+        //! This function requires note->enabled to be volatile, but it breaks other functions like note_enable.
+        //! Casting to a struct with just the volatile bitfield works, but there may be a better way to match.
+#ifdef VERSION_US
+        if (((struct vNote *)note)->enabled && IS_BANK_LOAD_COMPLETE(note->bankId) == FALSE) {
+#else
+        if (IS_BANK_LOAD_COMPLETE(note->bankId) == FALSE) {
+#endif
+            gAudioErrorFlags = (note->bankId << 8) + noteIndex + 0x1000000;
+        }
+        
+        // If the note is loaded and its bank is loaded, play it. Else, continue.
+        else if (((struct vNote *)note)->enabled) {
+            s32 flags;
+#ifdef SYNTHESIS_PARALLEL_NOTES
+            // From the same DMEM as synthesis_render_note_job, so that both give the same output
+            aClearBuffer(cmd++, DMEM_ADDR_TEMP, DMEM_ADDR_LEFT_CH);
+#endif
+            cmd = synthesis_render_note(cmd, note, bufLen, &curLoadedBook, &flags);
+            cmd = synthesis_mix_note(cmd, note, bufLen, flags);
         } // end of if(data is not yet loaded) {skip note} else {process note}
     } // end of for(each note) {process}
 
@@ -1807,6 +2049,7 @@ u64 *synthesis_process_notes(s16 *aiBuf, s32 bufLen, u64 *cmd) {
     aSaveBuffer(cmd++, VIRTUAL_TO_PHYSICAL2(aiBuf));
 #endif
 
+    AUDIO_STAGE_POP();
     return cmd;
 }
 
@@ -3,6 +3,12 @@
 
 #include "internal.h"
 
+// Per-stage timing is only available on PC, see src/pc/mixer.h
+#ifndef AUDIO_STAGE_PROFILING
+#define AUDIO_STAGE_PUSH(stage)
+#define AUDIO_STAGE_POP()
+#endif
+
 #define DEFAULT_LEN_1CH 0x140
 #define DEFAULT_LEN_2CH 0x280
 
@@ -834,20 +834,12 @@ static void (*LevelScriptJumpTable[])(void) = {
 
 #if defined TARGET_N3DS && !defined DISABLE_AUDIO
 
-static inline void waitForSynchronizationVar(volatile __3ds_s32* const ptr) {
-    while(*ptr > 0)
-        N3DS_AUDIO_SLEEP_FUNC(N3DS_AUDIO_SLEEP_DURATION_NANOS);
-}
-
 struct LevelCommand *level_script_execute(struct LevelCommand *cmd) {
     sScriptStatus = SCRIPT_RUNNING;
     sCurrentCmd = cmd;
 
     // Either wait for synthesis or tick
-    if (s_thread5_wait_for_audio_to_finish)
-        waitForSynchronizationVar(&s_audio_frames_to_process);
-    else
-        waitForSynchronizationVar(&s_audio_frames_to_tick);
+    audio_3ds_thread5_wait();
 
 
     profiler_3ds_log_time(0);
@@ -857,7 +849,7 @@ struct LevelCommand *level_script_execute(struct LevelCommand *cmd) {
 
         // If we need to wait for synthesis to finish, wait and break
         if (s_thread5_wait_for_audio_to_finish) {
-            waitForSynchronizationVar(&s_audio_frames_to_process);
+            audio_3ds_thread5_wait();
             break;
         }
     }
@@ -869,15 +861,11 @@ struct LevelCommand *level_script_execute(struct LevelCommand *cmd) {
     profiler_3ds_log_time(1); // Run Level Script
 
     profiler_log_thread5_time(LEVEL_SCRIPT_EXECUTE);
-    audio_game_loop_tick(); // Sets external.c/sGameLoopTicked to 1
-
-    // Notify audio thread that a frame is ready. Maintain this order.
-    AtomicIncrement(&s_audio_frames_to_tick);
-    AtomicIncrement(&s_audio_frames_to_process);
+    // Sets external.c/sGameLoopTicked to 1, or posts the tick to a free-running audio thread
+    audio_game_loop_tick();
 
     profiler_3ds_log_time(0);
-    if (s_thread5_does_audio)
-        audio_3ds_run_one_frame();
+    audio_3ds_thread5_end_frame();
     profiler_3ds_log_time(2); // Synchronous Audio Synthesis
 
     init_render_image();
@@ -7,6 +7,182 @@
 #include "game/object_list_processor.h"
 #include "surface_collision.h"
 #include "surface_load.h"
+#ifdef ENABLE_COLLISION_CAPTURE
+#include "pc/collision_capture.h"
+#else
+#define COLLISION_CAPTURE_QUERY(kind, flags, x, y, z, offsetY, radius)
+#endif
+
+#ifdef PACKED_SURFACE_PARTITION
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#define PACKED_SURFACE_SSE41
+#else
+#include <arm_neon.h>
+#define PACKED_SURFACE_NEON
+#endif
+#endif
+
+#ifdef SURFACE_QUERY_PROFILING
+struct SurfaceQueryStats gSurfaceQueryStats;
+#define SURFACE_QUERY_ADD(field, listIndex, n) gSurfaceQueryStats.field[listIndex] += (n)
+#else
+#define SURFACE_QUERY_ADD(field, listIndex, n)
+#endif
+#define SURFACE_QUERY_COUNT(field, listIndex) SURFACE_QUERY_ADD(field, listIndex, 1)
+
+#ifdef ENABLE_COLLISION_CAPTURE
+/**
+ * Returns the global state that the current query depends on, as capture flags.
+ */
+static u8 collision_capture_flags(void) {
+    u8 flags = 0;
+
+    if (gCheckingSurfaceCollisionsForCamera) {
+        flags |= COLLISION_CAPTURE_CAMERA;
+    }
+    if (gFindFloorIncludeSurfaceIntangible) {
+        flags |= COLLISION_CAPTURE_INCLUDE_INTANGIBLE;
+    }
+    if (gCurrentObject != NULL
+        && ((gCurrentObject->activeFlags & ACTIVE_FLAG_MOVE_THROUGH_GRATE)
+            || (gCurrentObject == gMarioObject && (gMarioState->flags & MARIO_VANISH_CAP)))) {
+        flags |= COLLISION_CAPTURE_THROUGH_VANISH_WALLS;
+    }
+    return flags;
+}
+#endif
+
+#ifdef FINE_SURFACE_PARTITION
+/**
+ * Returns the fine cell's list of static surfaces, or NULL if none of them can be hit
+ * at height y.
+ */
+static struct FineSurfaceList *fine_surface_list(s16 x, f32 y, s16 z, s32 listIndex) {
+    struct FineSurfaceList *list;
+
+    list = &gStaticFineSurfacePartition[(z + LEVEL_BOUNDARY_MAX) / FINE_CELL_SIZE]
+                                       [(x + LEVEL_BOUNDARY_MAX) / FINE_CELL_SIZE][listIndex];
+    if (y < list->minY || y > list->maxY) {
+        SURFACE_QUERY_COUNT(lists, listIndex);
+        SURFACE_QUERY_COUNT(listsSkipped, listIndex);
+        return NULL;
+    }
+    return list;
+}
+#endif
+
+#ifdef PACKED_SURFACE_PARTITION
+/**
+ * Which of the block's surfaces have (x, z) inside their edges, one bit per lane. Floors have
+ * their vertices counterclockwise from above, ceilings clockwise. This is the same integer math
+ * as find_floor_from_list and find_ceil_from_list.
+ */
+static u32 packed_edge_hits(struct PackedSurfaceBlock *b, s32 x, s32 z, s32 isCeil) {
+#if defined(PACKED_SURFACE_SSE41)
+    __m128i px = _mm_set1_epi32(x);
+    __m128i pz = _mm_set1_epi32(z);
+    __m128i x1 = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *) b->x1));
+    __m128i z1 = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *) b->z1));
+    __m128i x2 = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *) b->x2));
+    __m128i z2 = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *) b->z2));
+    __m128i x3 = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *) b->x3));
+    __m128i z3 = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *) b->z3));
+    __m128i e1 = _mm_sub_epi32(_mm_mullo_epi32(_mm_sub_epi32(z1, pz), _mm_sub_epi32(x2, x1)),
+                               _mm_mullo_epi32(_mm_sub_epi32(x1, px), _mm_sub_epi32(z2, z1)));
+    __m128i e2 = _mm_sub_epi32(_mm_mullo_epi32(_mm_sub_epi32(z2, pz), _mm_sub_epi32(x3, x2)),
+                               _mm_mullo_epi32(_mm_sub_epi32(x2, px), _mm_sub_epi32(z3, z2)));
+    __m128i e3 = _mm_sub_epi32(_mm_mullo_epi32(_mm_sub_epi32(z3, pz), _mm_sub_epi32(x1, x3)),
+                               _mm_mullo_epi32(_mm_sub_epi32(x3, px), _mm_sub_epi32(z1, z3)));
+    __m128i outside;
+
+    if (isCeil) {
+        __m128i zero = _mm_setzero_si128();
+        outside = _mm_or_si128(_mm_or_si128(_mm_cmpgt_epi32(e1, zero), _mm_cmpgt_epi32(e2, zero)),
+                               _mm_cmpgt_epi32(e3, zero));
+    } else {
+        // Negative on any edge
+        outside = _mm_or_si128(_mm_or_si128(e1, e2), e3);
+    }
+    return ~_mm_movemask_ps(_mm_castsi128_ps(outside)) & 0xF;
+#elif defined(PACKED_SURFACE_NEON)
+    static const u32 laneBits[4] = { 1, 2, 4, 8 };
+    int32x4_t zero = vdupq_n_s32(0);
+    int32x4_t px = vdupq_n_s32(x);
+    int32x4_t pz = vdupq_n_s32(z);
+    int32x4_t x1 = vmovl_s16(vld1_s16(b->x1));
+    int32x4_t z1 = vmovl_s16(vld1_s16(b->z1));
+    int32x4_t x2 = vmovl_s16(vld1_s16(b->x2));
+    int32x4_t z2 = vmovl_s16(vld1_s16(b->z2));
+    int32x4_t x3 = vmovl_s16(vld1_s16(b->x3));
+    int32x4_t z3 = vmovl_s16(vld1_s16(b->z3));
+    int32x4_t e1 = vsubq_s32(vmulq_s32(vsubq_s32(z1, pz), vsubq_s32(x2, x1)),
+                             vmulq_s32(vsubq_s32(x1, px), vsubq_s32(z2, z1)));
+    int32x4_t e2 = vsubq_s32(vmulq_s32(vsubq_s32(z2, pz), vsubq_s32(x3, x2)),
+                             vmulq_s32(vsubq_s32(x2, px), vsubq_s32(z3, z2)));
+    int32x4_t e3 = vsubq_s32(vmulq_s32(vsubq_s32(z3, pz), vsubq_s32(x1, x3)),
+                             vmulq_s32(vsubq_s32(x3, px), vsubq_s32(z1, z3)));
+    uint32x4_t outside;
+    uint32x2_t bits;
+
+    if (isCeil) {
+        outside = vorrq_u32(vorrq_u32(vcgtq_s32(e1, zero), vcgtq_s32(e2, zero)), vcgtq_s32(e3, zero));
+    } else {
+        outside = vorrq_u32(vorrq_u32(vcltq_s32(e1, zero), vcltq_s32(e2, zero)), vcltq_s32(e3, zero));
+    }
+    outside = vandq_u32(outside, vld1q_u32(laneBits));
+    bits = vorr_u32(vget_low_u32(outside), vget_high_u32(outside));
+    return ~(vget_lane_u32(bits, 0) | vget_lane_u32(bits, 1)) & 0xF;
+#endif
+}
+
+/**
+ * Which of the block's walls can push a point at height y, and (x, z) within reach of their
+ * plane. The plane distance is compared with some slack, so that the exact test can be left
+ * to find_wall_collisions_from_list.
+ */
+static u32 packed_wall_hits(struct PackedSurfaceBlock *b, f32 x, f32 y, f32 z, f32 reach) {
+#if defined(PACKED_SURFACE_SSE41)
+    __m128 py = _mm_set1_ps(y);
+    __m128 lowerY = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *) b->lowerY)));
+    __m128 upperY = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *) b->upperY)));
+    __m128 offset = _mm_add_ps(_mm_mul_ps(_mm_load_ps(b->normalX), _mm_set1_ps(x)),
+                               _mm_mul_ps(_mm_load_ps(b->normalY), py));
+    __m128 inside;
+
+    offset = _mm_add_ps(offset, _mm_mul_ps(_mm_load_ps(b->normalZ), _mm_set1_ps(z)));
+    offset = _mm_add_ps(offset, _mm_load_ps(b->originOffset));
+    offset = _mm_andnot_ps(_mm_set1_ps(-0.0f), offset);
+    inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(py, lowerY), _mm_cmple_ps(py, upperY)),
+                        _mm_cmple_ps(offset, _mm_set1_ps(reach)));
+    return _mm_movemask_ps(inside);
+#elif defined(PACKED_SURFACE_NEON)
+    static const u32 laneBits[4] = { 1, 2, 4, 8 };
+    float32x4_t py = vdupq_n_f32(y);
+    float32x4_t lowerY = vcvtq_f32_s32(vmovl_s16(vld1_s16(b->lowerY)));
+    float32x4_t upperY = vcvtq_f32_s32(vmovl_s16(vld1_s16(b->upperY)));
+    float32x4_t offset = vaddq_f32(vmulq_n_f32(vld1q_f32(b->normalX), x),
+                                   vmulq_n_f32(vld1q_f32(b->normalY), y));
+    uint32x4_t inside;
+    uint32x2_t bits;
+
+    offset = vaddq_f32(offset, vmulq_n_f32(vld1q_f32(b->normalZ), z));
+    offset = vabsq_f32(vaddq_f32(offset, vld1q_f32(b->originOffset)));
+    inside = vandq_u32(vandq_u32(vcgeq_f32(py, lowerY), vcleq_f32(py, upperY)),
+                       vcleq_f32(offset, vdupq_n_f32(reach)));
+    inside = vandq_u32(inside, vld1q_u32(laneBits));
+    bits = vorr_u32(vget_low_u32(inside), vget_high_u32(inside));
+    return vget_lane_u32(bits, 0) | vget_lane_u32(bits, 1);
+#endif
+}
+
+/**
+ * The lanes of a block that hold surfaces, when `remaining` are left in its list.
+ */
+static u32 packed_lane_mask(s32 remaining) {
+    return remaining >= PACKED_SURFACE_LANES ? (1 << PACKED_SURFACE_LANES) - 1 : (1 << remaining) - 1;
+}
+#endif
 
 /**************************************************
  *                      WALLS                     *
@@ -34,10 +210,13 @@ static s32 find_wall_collisions_from_list(struct SurfaceNode *surfaceNode,
         radius = 200.0f;
     }
 
+    SURFACE_QUERY_COUNT(lists, SPATIAL_PARTITION_WALLS);
+
     // Stay in this loop until out of walls.
     while (surfaceNode != NULL) {
         surf = surfaceNode->surface;
         surfaceNode = surfaceNode->next;
+        SURFACE_QUERY_COUNT(surfacesVisited, SPATIAL_PARTITION_WALLS);
 
         // Exclude a large number of walls immediately to optimize.
         if (y < surf->lowerY || y > surf->upperY) {
@@ -153,6 +332,68 @@ static s32 find_wall_collisions_from_list(struct SurfaceNode *surfaceNode,
     return numCols;
 }
 
+#ifdef PACKED_SURFACE_PARTITION
+/**
+ * The walls of a packed list that might push the point, in order, for
+ * find_wall_collisions_from_list to check exactly.
+ */
+static struct SurfaceNode sPackedWallCandidates[PACKED_SURFACE_MAX_LIST];
+
+static s32 find_wall_collisions_from_packed(struct FineSurfaceList *list, struct WallCollisionData *data) {
+    struct PackedSurfaceBlock *block = &gPackedStaticSurfaces[list->packedIndex];
+    f32 radius = data->radius;
+    f32 y = data->y + data->offsetY;
+    s32 numCandidates = 0;
+    s32 i, lane;
+    u32 hits;
+
+    if (radius > 200.0f) {
+        radius = 200.0f;
+    }
+
+    SURFACE_QUERY_ADD(surfacesVisited, SPATIAL_PARTITION_WALLS, list->packedCount);
+    for (i = 0; i < list->packedCount; i += PACKED_SURFACE_LANES, block++) {
+        hits = packed_wall_hits(block, data->x, y, data->z, radius + 1.0f) & packed_lane_mask(list->packedCount - i);
+        for (lane = 0; hits != 0; lane++, hits >>= 1) {
+            if (hits & 1) {
+                sPackedWallCandidates[numCandidates].surface = block->surface[lane];
+                sPackedWallCandidates[numCandidates].next = &sPackedWallCandidates[numCandidates + 1];
+                numCandidates++;
+            }
+        }
+    }
+
+    if (numCandidates == 0) {
+        SURFACE_QUERY_COUNT(lists, SPATIAL_PARTITION_WALLS);
+        return 0;
+    }
+    sPackedWallCandidates[numCandidates - 1].next = NULL;
+    return find_wall_collisions_from_list(sPackedWallCandidates, data);
+}
+#endif
+
+#ifdef FINE_SURFACE_PARTITION
+/**
+ * Checks the static walls of the fine cell, unless they are out of reach.
+ */
+static s32 find_static_wall_collisions(s16 x, s16 z, struct WallCollisionData *data) {
+    f32 y = data->y + data->offsetY;
+    struct FineSurfaceList *list = fine_surface_list(x, y, z, SPATIAL_PARTITION_WALLS);
+
+    if (list == NULL) {
+        return 0;
+    }
+#ifdef PACKED_SURFACE_PARTITION
+    // Positions that are NaN or infinite collide with walls that the packed test would skip
+    if (list->packedCount >= 0 && y == y && data->x > -LEVEL_BOUNDARY_MAX && data->x < LEVEL_BOUNDARY_MAX
+        && data->z > -LEVEL_BOUNDARY_MAX && data->z < LEVEL_BOUNDARY_MAX) {
+        return find_wall_collisions_from_packed(list, data);
+    }
+#endif
+    return find_wall_collisions_from_list(list->next, data);
+}
+#endif
+
 /**
  * Formats the position and wall search for find_wall_collisions.
  */
@@ -188,6 +429,8 @@ s32 find_wall_collisions(struct WallCollisionData *colData) {
     s16 x = colData->x;
     s16 z = colData->z;
 
+    COLLISION_CAPTURE_QUERY(COLLISION_CAPTURE_WALL, collision_capture_flags(), colData->x, colData->y,
+                            colData->z, colData->offsetY, colData->radius);
     colData->numWalls = 0;
 
     if (x <= -LEVEL_BOUNDARY_MAX || x >= LEVEL_BOUNDARY_MAX) {
@@ -207,8 +450,23 @@ s32 find_wall_collisions(struct WallCollisionData *colData) {
     numCollisions += find_wall_collisions_from_list(node, colData);
 
     // Check for surfaces that are a part of level geometry.
+#ifdef FINE_SURFACE_PARTITION
+    // Walls of objects may have pushed the position, which the static walls are checked from.
+    // If it left the 16x16 cell, the fine cells no longer match the list this would check.
+    x = colData->x;
+    z = colData->z;
+    if (x > -LEVEL_BOUNDARY_MAX && x < LEVEL_BOUNDARY_MAX && z > -LEVEL_BOUNDARY_MAX
+        && z < LEVEL_BOUNDARY_MAX && (x + LEVEL_BOUNDARY_MAX) / CELL_SIZE == cellX
+        && (z + LEVEL_BOUNDARY_MAX) / CELL_SIZE == cellZ) {
+        numCollisions += find_static_wall_collisions(x, z, colData);
+    } else {
+        node = gStaticSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_WALLS].next;
+        numCollisions += find_wall_collisions_from_list(node, colData);
+    }
+#else
     node = gStaticSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_WALLS].next;
     numCollisions += find_wall_collisions_from_list(node, colData);
+#endif
 
     // Increment the debug tracker.
     gNumCalls.wall += 1;
@@ -229,11 +487,13 @@ static struct Surface *find_ceil_from_list(struct SurfaceNode *surfaceNode, s32
     struct Surface *ceil = NULL;
 
     ceil = NULL;
+    SURFACE_QUERY_COUNT(lists, SPATIAL_PARTITION_CEILS);
 
     // Stay in this loop until out of ceilings.
     while (surfaceNode != NULL) {
         surf = surfaceNode->surface;
         surfaceNode = surfaceNode->next;
+        SURFACE_QUERY_COUNT(surfacesVisited, SPATIAL_PARTITION_CEILS);
 
         x1 = surf->vertex1[0];
         z1 = surf->vertex1[2];
@@ -300,6 +560,79 @@ static struct Surface *find_ceil_from_list(struct SurfaceNode *surfaceNode, s32
     return ceil;
 }
 
+#ifdef PACKED_SURFACE_PARTITION
+/**
+ * Same as find_ceil_from_list, for a packed list.
+ */
+static struct Surface *find_ceil_from_packed(struct FineSurfaceList *list, s32 x, s32 y, s32 z, f32 *pheight) {
+    struct PackedSurfaceBlock *block = &gPackedStaticSurfaces[list->packedIndex];
+    s32 i, lane;
+    u32 hits;
+    f32 nx, ny, nz, oo;
+    f32 height;
+
+    SURFACE_QUERY_COUNT(lists, SPATIAL_PARTITION_CEILS);
+
+    for (i = 0; i < list->packedCount; i += PACKED_SURFACE_LANES, block++) {
+        hits = packed_edge_hits(block, x, z, TRUE) & packed_lane_mask(list->packedCount - i);
+        SURFACE_QUERY_ADD(surfacesVisited, SPATIAL_PARTITION_CEILS,
+                          list->packedCount - i < PACKED_SURFACE_LANES ? list->packedCount - i : PACKED_SURFACE_LANES);
+
+        for (lane = 0; hits != 0; lane++, hits >>= 1) {
+            if (!(hits & 1)) {
+                continue;
+            }
+
+            if (gCheckingSurfaceCollisionsForCamera != 0) {
+                if (block->flags[lane] & SURFACE_FLAG_NO_CAM_COLLISION) {
+                    continue;
+                }
+            } else if (block->type[lane] == SURFACE_CAMERA_BOUNDARY) {
+                continue;
+            }
+
+            nx = block->normalX[lane];
+            ny = block->normalY[lane];
+            nz = block->normalZ[lane];
+            oo = block->originOffset[lane];
+
+            if (ny == 0.0f) {
+                continue;
+            }
+
+            height = -(x * nx + nz * z + oo) / ny;
+            if (y - (height - -78.0f) > 0.0f) {
+                continue;
+            }
+
+            *pheight = height;
+            return block->surface[lane];
+        }
+    }
+
+    return NULL;
+}
+#endif
+
+#ifdef FINE_SURFACE_PARTITION
+/**
+ * Finds the first static ceiling of the fine cell above a point.
+ */
+static struct Surface *find_static_ceil(s16 x, s32 y, s16 z, f32 *pheight) {
+    struct FineSurfaceList *list = fine_surface_list(x, y, z, SPATIAL_PARTITION_CEILS);
+
+    if (list == NULL) {
+        return NULL;
+    }
+#ifdef PACKED_SURFACE_PARTITION
+    if (list->packedCount >= 0) {
+        return find_ceil_from_packed(list, x, y, z, pheight);
+    }
+#endif
+    return find_ceil_from_list(list->next, x, y, z, pheight);
+}
+#endif
+
 /**
  * Find the lowest ceiling above a given position and return the height.
  */
@@ -319,6 +652,8 @@ f32 find_ceil(f32 posX, f32 posY, f32 posZ, struct Surface **pceil) {
     z = (s16) posZ;
     *pceil = NULL;
 
+    COLLISION_CAPTURE_QUERY(COLLISION_CAPTURE_CEIL, collision_capture_flags(), posX, posY, posZ, 0.0f, 0.0f);
+
     if (x <= -LEVEL_BOUNDARY_MAX || x >= LEVEL_BOUNDARY_MAX) {
         return height;
     }
@@ -335,8 +670,12 @@ f32 find_ceil(f32 posX, f32 posY, f32 posZ, struct Surface **pceil) {
     dynamicCeil = find_ceil_from_list(surfaceList, x, y, z, &dynamicHeight);
 
     // Check for surfaces that are a part of level geometry.
+#ifdef FINE_SURFACE_PARTITION
+    ceil = find_static_ceil(x, y, z, &height);
+#else
     surfaceList = gStaticSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_CEILS].next;
     ceil = find_ceil_from_list(surfaceList, x, y, z, &height);
+#endif
 
     if (dynamicHeight < height) {
         ceil = dynamicCeil;
@@ -404,10 +743,13 @@ static struct Surface *find_floor_from_list(struct SurfaceNode *surfaceNode, s32
     f32 height;
     struct Surface *floor = NULL;
 
+    SURFACE_QUERY_COUNT(lists, SPATIAL_PARTITION_FLOORS);
+
     // Iterate through the list of floors until there are no more floors.
     while (surfaceNode != NULL) {
         surf = surfaceNode->surface;
         surfaceNode = surfaceNode->next;
+        SURFACE_QUERY_COUNT(surfacesVisited, SPATIAL_PARTITION_FLOORS);
 
         x1 = surf->vertex1[0];
         z1 = surf->vertex1[2];
@@ -468,6 +810,79 @@ static struct Surface *find_floor_from_list(struct SurfaceNode *surfaceNode, s32
     return floor;
 }
 
+#ifdef PACKED_SURFACE_PARTITION
+/**
+ * Same as find_floor_from_list, for a packed list.
+ */
+static struct Surface *find_floor_from_packed(struct FineSurfaceList *list, s32 x, s32 y, s32 z, f32 *pheight) {
+    struct PackedSurfaceBlock *block = &gPackedStaticSurfaces[list->packedIndex];
+    s32 i, lane;
+    u32 hits;
+    f32 nx, ny, nz, oo;
+    f32 height;
+
+    SURFACE_QUERY_COUNT(lists, SPATIAL_PARTITION_FLOORS);
+
+    for (i = 0; i < list->packedCount; i += PACKED_SURFACE_LANES, block++) {
+        hits = packed_edge_hits(block, x, z, FALSE) & packed_lane_mask(list->packedCount - i);
+        SURFACE_QUERY_ADD(surfacesVisited, SPATIAL_PARTITION_FLOORS,
+                          list->packedCount - i < PACKED_SURFACE_LANES ? list->packedCount - i : PACKED_SURFACE_LANES);
+
+        for (lane = 0; hits != 0; lane++, hits >>= 1) {
+            if (!(hits & 1)) {
+                continue;
+            }
+
+            if (gCheckingSurfaceCollisionsForCamera != 0) {
+                if (block->flags[lane] & SURFACE_FLAG_NO_CAM_COLLISION) {
+                    continue;
+                }
+            } else if (block->type[lane] == SURFACE_CAMERA_BOUNDARY) {
+                continue;
+            }
+
+            nx = block->normalX[lane];
+            ny = block->normalY[lane];
+            nz = block->normalZ[lane];
+            oo = block->originOffset[lane];
+
+            if (ny == 0.0f) {
+                continue;
+            }
+
+            height = -(x * nx + nz * z + oo) / ny;
+            if (y - (height + -78.0f) < 0.0f) {
+                continue;
+            }
+
+            *pheight = height;
+            return block->surface[lane];
+        }
+    }
+
+    return NULL;
+}
+#endif
+
+#ifdef FINE_SURFACE_PARTITION
+/**
+ * Finds the first static floor of the fine cell under a point.
+ */
+static struct Surface *find_static_floor(s16 x, s32 y, s16 z, f32 *pheight) {
+    struct FineSurfaceList *list = fine_surface_list(x, y, z, SPATIAL_PARTITION_FLOORS);
+
+    if (list == NULL) {
+        return NULL;
+    }
+#ifdef PACKED_SURFACE_PARTITION
+    if (list->packedCount >= 0) {
+        return find_floor_from_packed(list, x, y, z, pheight);
+    }
+#endif
+    return find_floor_from_list(list->next, x, y, z, pheight);
+}
+#endif
+
 /**
  * Find the height of the highest floor below a point.
  */
@@ -526,6 +941,8 @@ f32 find_floor(f32 xPos, f32 yPos, f32 zPos, struct Surface **pfloor) {
 
     *pfloor = NULL;
 
+    COLLISION_CAPTURE_QUERY(COLLISION_CAPTURE_FLOOR, collision_capture_flags(), xPos, yPos, zPos, 0.0f, 0.0f);
+
     if (x <= -LEVEL_BOUNDARY_MAX || x >= LEVEL_BOUNDARY_MAX) {
         return height;
     }
@@ -542,8 +959,12 @@ f32 find_floor(f32 xPos, f32 yPos, f32 zPos, struct Surface **pfloor) {
     dynamicFloor = find_floor_from_list(surfaceList, x, y, z, &dynamicHeight);
 
     // Check for surfaces that are a part of level geometry.
+#ifdef FINE_SURFACE_PARTITION
+    floor = find_static_floor(x, y, z, &height);
+#else
     surfaceList = gStaticSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_FLOORS].next;
     floor = find_floor_from_list(surfaceList, x, y, z, &height);
+#endif
 
     // To prevent the Merry-Go-Round room from loading when Mario passes above the hole that leads
     // there, SURFACE_INTANGIBLE is used. This prevent the wrong room from loading, but can also allow
@@ -554,7 +975,11 @@ f32 find_floor(f32 xPos, f32 yPos, f32 zPos, struct Surface **pfloor) {
         //  (happens when there is no floor under the SURFACE_INTANGIBLE floor) but returns the height
         //  of the SURFACE_INTANGIBLE floor instead of the typical -11000 returned for a NULL floor.
         if (floor != NULL && floor->type == SURFACE_INTANGIBLE) {
+#ifdef FINE_SURFACE_PARTITION
+            floor = find_static_floor(x, (s32)(height - 200.0f), z, &height);
+#else
             floor = find_floor_from_list(surfaceList, x, (s32)(height - 200.0f), z, &height);
+#endif
         }
     } else {
         // To prevent accidentally leaving the floor tangible, stop checking for it.
@@ -594,6 +1019,8 @@ f32 find_water_level(f32 x, f32 z) {
     f32 waterLevel = -11000.0f;
     s16 *p = gEnvironmentRegions;
 
+    COLLISION_CAPTURE_QUERY(COLLISION_CAPTURE_WATER, 0, x, 0.0f, z, 0.0f, 0.0f);
+
     if (p != NULL) {
         numRegions = *p++;
 
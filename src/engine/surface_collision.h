@@ -8,6 +8,34 @@
 #define LEVEL_BOUNDARY_MAX 0x2000
 #define CELL_SIZE          0x400
 
+#ifdef FINE_SURFACE_PARTITION
+// Static surfaces are also sorted into a finer grid, whose lists keep the order of the 16x16 ones
+#ifndef FINE_CELLS_PER_CELL
+#define FINE_CELLS_PER_CELL 4
+#endif
+#define FINE_CELL_SIZE     (CELL_SIZE / FINE_CELLS_PER_CELL)
+#define NUM_FINE_CELLS     (16 * FINE_CELLS_PER_CELL)
+#endif
+
+// Packing the fine lists only pays off where their surfaces can be tested with SIMD
+#if defined(PACKED_SURFACE_PARTITION) && !defined(__SSE4_1__) && !defined(__ARM_NEON)
+#undef PACKED_SURFACE_PARTITION
+#endif
+#if defined(PACKED_SURFACE_PARTITION) && !defined(FINE_SURFACE_PARTITION)
+#error PACKED_SURFACE_PARTITION packs the lists of FINE_SURFACE_PARTITION
+#endif
+
+#ifdef SURFACE_QUERY_PROFILING
+// Indexed by SPATIAL_PARTITION_FLOORS, _CEILS and _WALLS
+struct SurfaceQueryStats {
+    u64 lists[3]; // Lists searched, static and dynamic
+    u64 listsSkipped[3]; // Lists whose height range ruled the query out
+    u64 surfacesVisited[3];
+};
+
+extern struct SurfaceQueryStats gSurfaceQueryStats;
+#endif
+
 struct WallCollisionData
 {
     /*0x00*/ f32 x, y, z;
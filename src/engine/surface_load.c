@@ -1,4 +1,7 @@
 #include <PR/ultratypes.h>
+#ifdef PERSISTENT_DYNAMIC_SURFACES
+#include <string.h>
+#endif
 
 #include "prevent_bss_reordering.h"
 
@@ -14,6 +17,10 @@
 #include "game/mario.h"
 #include "game/object_list_processor.h"
 #include "surface_load.h"
+#ifdef ENABLE_COLLISION_CAPTURE
+#include "game/area.h"
+#include "pc/collision_capture.h"
+#endif
 
 s32 unused8038BE90;
 
@@ -24,6 +31,72 @@ s32 unused8038BE90;
 SpatialPartitionCell gStaticSurfacePartition[16][16];
 SpatialPartitionCell gDynamicSurfacePartition[16][16];
 
+#ifdef FINE_SURFACE_PARTITION
+/**
+ * The static partition again, with each 16x16 cell's lists split between its finer cells. Each
+ * list keeps only the surfaces that a query in its cell can hit, in the order of the 16x16 list,
+ * so queries find the same surface in fewer steps.
+ */
+FineSpatialPartitionCell gStaticFineSurfacePartition[NUM_FINE_CELLS][NUM_FINE_CELLS];
+
+/**
+ * Nodes of the fine lists. Lists that would hold every node of their 16x16 list share it instead.
+ */
+#define FINE_SURFACE_NODE_POOL_SIZE 40000
+static struct SurfaceNode sFineSurfaceNodePool[FINE_SURFACE_NODE_POOL_SIZE];
+s32 gFineSurfaceNodesAllocated;
+#endif
+
+#ifdef PACKED_SURFACE_PARTITION
+/**
+ * The fine lists, copied into blocks that queries can test several surfaces at once from.
+ */
+struct PackedSurfaceBlock gPackedStaticSurfaces[PACKED_SURFACE_POOL_SIZE];
+s32 gPackedSurfaceBlocksAllocated;
+#endif
+
+#ifdef PERSISTENT_DYNAMIC_SURFACES
+/**
+ * A load_object_collision_model call: where its surfaces and nodes went, and what they were
+ * computed from. The calls of the current and the last frame are kept, in order.
+ */
+struct DynamicSurfaceLoad {
+    struct Object *object;
+    const BehaviorScript *behavior;
+    void *collisionData;
+    Mat4 transform;
+    s32 firstSurface, numSurfaces;
+    s32 firstNode, numNodes;
+};
+
+#define DYNAMIC_SURFACE_LOG_SIZE 512
+static struct DynamicSurfaceLoad sDynamicSurfaceLog[2][DYNAMIC_SURFACE_LOG_SIZE];
+static s32 sDynamicSurfaceLogCount[2];
+static s32 sCurrentDynamicSurfaceLog;
+static s32 sNextLastFrameLoad;
+// Whether every load so far this frame was the same as last frame's, so that the partition is too
+static s32 sSameAsLastFrame;
+// The node or list head that each node of sSurfaceNodePool was linked after
+static struct SurfaceNode *sDynamicNodePredecessors[SURFACE_NODE_POOL_SIZE];
+
+struct DynamicSurfaceStats gDynamicSurfaceStats;
+
+#ifdef CHECK_PERSISTENT_DYNAMIC_SURFACES
+/**
+ * The object surfaces and partition that loading every object again would have built this frame,
+ * to compare the reused ones with after each load.
+ */
+static struct Surface sShadowSurfacePool[SURFACE_POOL_SIZE];
+static struct SurfaceNode sShadowSurfaceNodePool[SURFACE_NODE_POOL_SIZE];
+static SpatialPartitionCell sShadowDynamicSurfacePartition[16][16];
+static SpatialPartitionCell sSavedDynamicSurfacePartition[16][16];
+static s32 sShadowSurfacesAllocated;
+static s32 sShadowSurfaceNodesAllocated;
+// Whether the shadow is being built, whose nodes must not replace the pool's predecessors
+static s32 sBuildingShadowSurfaces;
+#endif
+#endif
+
 /**
  * Pools of data to contain either surface nodes or surfaces.
  */
@@ -49,7 +122,7 @@ static struct SurfaceNode *alloc_surface_node(void) {
     //! A bounds check! If there's more surface nodes than 7000 allowed,
     //  we, um...
     // Perhaps originally just debug feedback?
-    if (gSurfaceNodesAllocated >= 7000) {
+    if (gSurfaceNodesAllocated >= SURFACE_NODE_POOL_SIZE) {
     }
 
     return node;
@@ -160,6 +233,15 @@ static void add_surface_to_cell(s16 dynamic, s16 cellX, s16 cellZ, struct Surfac
 
     newNode->next = list->next;
     list->next = newNode;
+#ifdef PERSISTENT_DYNAMIC_SURFACES
+#ifdef CHECK_PERSISTENT_DYNAMIC_SURFACES
+    if (dynamic && !sBuildingShadowSurfaces) {
+#else
+    if (dynamic) {
+#endif
+        sDynamicNodePredecessors[newNode - sSurfaceNodePool] = list;
+    }
+#endif
 }
 
 /**
@@ -294,6 +376,206 @@ static void add_surface(struct Surface *surface, s32 dynamic) {
 static void stub_surface_load_1(void) {
 }
 
+#ifdef FINE_SURFACE_PARTITION
+#define FINE_UNBOUNDED 0x7FFFFFFF
+// Margin for the rounding in find_floor's and find_ceil's height calculations
+#define FINE_HEIGHT_MARGIN 16
+// How far from its plane a wall reaches: the 200 unit radius over the smallest normal component
+// on the axis it isn't projected on (0.707), rounded up
+#define FINE_WALL_REACH 300
+// Wall queries pick their cell by the position truncated to s16, but test the float position
+#define FINE_WALL_SLACK 2
+// Beyond this, the integer edge tests of find_floor and find_ceil can overflow
+#define FINE_MAX_EXACT_COORD 0x3FFF
+
+/**
+ * Finds the range of positions from which a query can hit the surface, in cell coordinates.
+ */
+static void get_fine_surface_bounds(struct Surface *surf, s32 listIndex, s32 *minX, s32 *maxX, s32 *minZ,
+                                    s32 *maxZ) {
+    s32 extendX = 0;
+    s32 extendZ = 0;
+
+    *minX = min_3(surf->vertex1[0], surf->vertex2[0], surf->vertex3[0]);
+    *maxX = max_3(surf->vertex1[0], surf->vertex2[0], surf->vertex3[0]);
+    *minZ = min_3(surf->vertex1[2], surf->vertex2[2], surf->vertex3[2]);
+    *maxZ = max_3(surf->vertex1[2], surf->vertex2[2], surf->vertex3[2]);
+
+    if (*minX < -FINE_MAX_EXACT_COORD || *maxX > FINE_MAX_EXACT_COORD
+        || *minZ < -FINE_MAX_EXACT_COORD || *maxZ > FINE_MAX_EXACT_COORD) {
+        *minX = *minZ = -FINE_UNBOUNDED;
+        *maxX = *maxZ = FINE_UNBOUNDED;
+        return;
+    }
+
+    if (listIndex == SPATIAL_PARTITION_WALLS) {
+        if (surf->flags & SURFACE_FLAG_X_PROJECTION) {
+            extendX = FINE_WALL_REACH;
+            extendZ = FINE_WALL_SLACK;
+        } else {
+            extendX = FINE_WALL_SLACK;
+            extendZ = FINE_WALL_REACH;
+        }
+    }
+
+    *minX += LEVEL_BOUNDARY_MAX - extendX;
+    *maxX += LEVEL_BOUNDARY_MAX + extendX;
+    *minZ += LEVEL_BOUNDARY_MAX - extendZ;
+    *maxZ += LEVEL_BOUNDARY_MAX + extendZ;
+}
+
+/**
+ * Copies the surfaces of a 16x16 list that can be hit from a fine cell into its list, and finds
+ * the heights at which queries can hit them.
+ */
+static void build_fine_surface_list(struct SurfaceNode *node, s32 listIndex, s32 cellX, s32 cellZ,
+                                    struct FineSurfaceList *list) {
+    struct SurfaceNode *head = node;
+    struct SurfaceNode **tail = &list->next;
+    s32 firstNode = gFineSurfaceNodesAllocated;
+    s32 loX = cellX * FINE_CELL_SIZE;
+    s32 hiX = loX + FINE_CELL_SIZE - 1;
+    s32 loZ = cellZ * FINE_CELL_SIZE;
+    s32 hiZ = loZ + FINE_CELL_SIZE - 1;
+    s32 numSkipped = 0;
+    s32 minX, maxX, minZ, maxZ;
+    s32 minY, maxY;
+    struct Surface *surf;
+
+    list->next = NULL;
+    list->minY = FINE_UNBOUNDED;
+    list->maxY = -FINE_UNBOUNDED;
+
+    for (; node != NULL; node = node->next) {
+        surf = node->surface;
+        get_fine_surface_bounds(surf, listIndex, &minX, &maxX, &minZ, &maxZ);
+
+        if (maxX < loX || minX > hiX || maxZ < loZ || minZ > hiZ) {
+            numSkipped++;
+            continue;
+        }
+
+        if (gFineSurfaceNodesAllocated >= FINE_SURFACE_NODE_POOL_SIZE) {
+            // Out of nodes, so search the whole 16x16 list
+            gFineSurfaceNodesAllocated = firstNode;
+            list->next = head;
+            list->minY = -FINE_UNBOUNDED;
+            list->maxY = FINE_UNBOUNDED;
+            return;
+        }
+        *tail = &sFineSurfaceNodePool[gFineSurfaceNodesAllocated++];
+        (*tail)->surface = surf;
+        (*tail)->next = NULL;
+        tail = &(*tail)->next;
+
+        switch (listIndex) {
+            case SPATIAL_PARTITION_FLOORS:
+                // A floor is hit from up to 78 units below it, and from anywhere above
+                minY = min_3(surf->vertex1[1], surf->vertex2[1], surf->vertex3[1]) - 78 - FINE_HEIGHT_MARGIN;
+                maxY = FINE_UNBOUNDED;
+                break;
+            case SPATIAL_PARTITION_CEILS:
+                minY = -FINE_UNBOUNDED;
+                maxY = max_3(surf->vertex1[1], surf->vertex2[1], surf->vertex3[1]) + 78 + FINE_HEIGHT_MARGIN;
+                break;
+            default:
+                minY = surf->lowerY;
+                maxY = surf->upperY;
+                break;
+        }
+        if (minY < list->minY) {
+            list->minY = minY;
+        }
+        if (maxY > list->maxY) {
+            list->maxY = maxY;
+        }
+    }
+
+    if (numSkipped == 0 && head != NULL) {
+        gFineSurfaceNodesAllocated = firstNode;
+        list->next = head;
+    }
+}
+
+#ifdef PACKED_SURFACE_PARTITION
+/**
+ * Copies a fine list into packed blocks, unless they are full. Lanes past its end stay zeroed.
+ */
+static void pack_fine_surface_list(struct FineSurfaceList *list) {
+    struct PackedSurfaceBlock *block;
+    struct SurfaceNode *node;
+    struct Surface *surf;
+    s32 count = 0;
+    s32 numBlocks;
+    s32 i, lane;
+
+    for (node = list->next; node != NULL; node = node->next) {
+        count++;
+    }
+    numBlocks = (count + PACKED_SURFACE_LANES - 1) / PACKED_SURFACE_LANES;
+
+    list->packedIndex = gPackedSurfaceBlocksAllocated;
+    list->packedCount = -1;
+    if (count > PACKED_SURFACE_MAX_LIST || gPackedSurfaceBlocksAllocated + numBlocks > PACKED_SURFACE_POOL_SIZE) {
+        return;
+    }
+
+    for (node = list->next, i = 0; node != NULL; node = node->next, i++) {
+        surf = node->surface;
+        block = &gPackedStaticSurfaces[gPackedSurfaceBlocksAllocated + i / PACKED_SURFACE_LANES];
+        lane = i % PACKED_SURFACE_LANES;
+        if (lane == 0) {
+            bzero(block, sizeof(*block));
+        }
+
+        block->x1[lane] = surf->vertex1[0];
+        block->z1[lane] = surf->vertex1[2];
+        block->x2[lane] = surf->vertex2[0];
+        block->z2[lane] = surf->vertex2[2];
+        block->x3[lane] = surf->vertex3[0];
+        block->z3[lane] = surf->vertex3[2];
+        block->lowerY[lane] = surf->lowerY;
+        block->upperY[lane] = surf->upperY;
+        block->normalX[lane] = surf->normal.x;
+        block->normalY[lane] = surf->normal.y;
+        block->normalZ[lane] = surf->normal.z;
+        block->originOffset[lane] = surf->originOffset;
+        block->type[lane] = surf->type;
+        block->flags[lane] = surf->flags;
+        block->surface[lane] = surf;
+    }
+    gPackedSurfaceBlocksAllocated += numBlocks;
+    list->packedCount = count;
+}
+#endif
+
+/**
+ * Builds the fine partition from the 16x16 one, once the level's static surfaces are loaded.
+ */
+static void build_fine_surface_partition(void) {
+    s32 cellX, cellZ, listIndex;
+    struct SurfaceNode *head;
+
+    gFineSurfaceNodesAllocated = 0;
+#ifdef PACKED_SURFACE_PARTITION
+    gPackedSurfaceBlocksAllocated = 0;
+#endif
+
+    for (cellZ = 0; cellZ < NUM_FINE_CELLS; cellZ++) {
+        for (cellX = 0; cellX < NUM_FINE_CELLS; cellX++) {
+            for (listIndex = 0; listIndex < 3; listIndex++) {
+                head = gStaticSurfacePartition[cellZ / FINE_CELLS_PER_CELL][cellX / FINE_CELLS_PER_CELL][listIndex].next;
+                build_fine_surface_list(head, listIndex, cellX, cellZ,
+                                        &gStaticFineSurfacePartition[cellZ][cellX][listIndex]);
+#ifdef PACKED_SURFACE_PARTITION
+                pack_fine_surface_list(&gStaticFineSurfacePartition[cellZ][cellX][listIndex]);
+#endif
+            }
+        }
+    }
+}
+#endif
+
 /**
  * Initializes a Surface struct using the given vertex data
  * @param vertexData The raw data containing vertex positions
@@ -524,8 +806,8 @@ static void load_environmental_regions(s16 **data) {
  * Allocate some of the main pool for surfaces (2300 surf) and for surface nodes (7000 nodes).
  */
 void alloc_surface_pools(void) {
-    sSurfacePoolSize = 2300;
-    sSurfaceNodePool = main_pool_alloc(7000 * sizeof(struct SurfaceNode), MEMORY_POOL_LEFT);
+    sSurfacePoolSize = SURFACE_POOL_SIZE;
+    sSurfaceNodePool = main_pool_alloc(SURFACE_NODE_POOL_SIZE * sizeof(struct SurfaceNode), MEMORY_POOL_LEFT);
     sSurfacePool = main_pool_alloc(sSurfacePoolSize * sizeof(struct Surface), MEMORY_POOL_LEFT);
 
     gCCMEnteredSlide = 0;
@@ -592,6 +874,16 @@ void load_area_terrain(s16 index, s16 *data, s8 *surfaceRooms, s16 *macroObjects
     s16 *vertexData;
     UNUSED s32 unused;
 
+#ifdef ENABLE_COLLISION_CAPTURE
+    COLLISION_CAPTURE_AREA_LOADED(gCurrLevelNum, index);
+#endif
+
+#ifdef PERSISTENT_DYNAMIC_SURFACES
+    // Static surfaces take the pool over, so no object surface can be reused
+    sDynamicSurfaceLogCount[0] = 0;
+    sDynamicSurfaceLogCount[1] = 0;
+#endif
+
     // Initialize the data for this.
     gEnvironmentRegions = NULL;
     unused8038BE90 = 0;
@@ -637,6 +929,10 @@ void load_area_terrain(s16 index, s16 *data, s8 *surfaceRooms, s16 *macroObjects
         }
     }
 
+#ifdef FINE_SURFACE_PARTITION
+    build_fine_surface_partition();
+#endif
+
     gNumStaticSurfaceNodes = gSurfaceNodesAllocated;
     gNumStaticSurfaces = gSurfacesAllocated;
 }
@@ -650,6 +946,25 @@ void clear_dynamic_surfaces(void) {
         gSurfaceNodesAllocated = gNumStaticSurfaceNodes;
 
         clear_spatial_partition(&gDynamicSurfacePartition[0][0]);
+
+#ifdef PERSISTENT_DYNAMIC_SURFACES
+        // The surfaces stay in the pool, to be reused by the objects that load them again
+        sCurrentDynamicSurfaceLog ^= 1;
+        sDynamicSurfaceLogCount[sCurrentDynamicSurfaceLog] = 0;
+        sNextLastFrameLoad = 0;
+        sSameAsLastFrame = TRUE;
+
+        gDynamicSurfaceStats.totalRebuilt += gDynamicSurfaceStats.rebuilt;
+        gDynamicSurfaceStats.totalReused += gDynamicSurfaceStats.reused;
+        gDynamicSurfaceStats.frames++;
+        gDynamicSurfaceStats.rebuilt = 0;
+        gDynamicSurfaceStats.reused = 0;
+#ifdef CHECK_PERSISTENT_DYNAMIC_SURFACES
+        sShadowSurfacesAllocated = gNumStaticSurfaces;
+        sShadowSurfaceNodesAllocated = gNumStaticSurfaceNodes;
+        clear_spatial_partition(&sShadowDynamicSurfacePartition[0][0]);
+#endif
+#endif
     }
 }
 
@@ -752,6 +1067,209 @@ void load_object_surfaces(s16 **data, s16 *vertexData) {
     }
 }
 
+#ifdef PERSISTENT_DYNAMIC_SURFACES
+/**
+ * Finds the current object's load from last frame, starting where the last one found left off,
+ * since objects load in the same order from frame to frame unless some spawn or unload.
+ */
+static struct DynamicSurfaceLoad *find_last_frame_load(void) {
+    struct DynamicSurfaceLoad *log = sDynamicSurfaceLog[sCurrentDynamicSurfaceLog ^ 1];
+    s32 count = sDynamicSurfaceLogCount[sCurrentDynamicSurfaceLog ^ 1];
+    s32 i, index;
+
+    for (i = 0; i < count; i++) {
+        index = (sNextLastFrameLoad + i) % count;
+        if (log[index].object == gCurrentObject) {
+            sNextLastFrameLoad = index + 1;
+            return &log[index];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Loads the current object's surfaces, unless it loaded them last frame with the same collision
+ * and transform. They are then still in the pool, exactly as loading them again would write them,
+ * unless this frame's surfaces already reached them, and are only moved down to the end of this
+ * frame's surfaces and added to the partition again. Surfaces and nodes end up where loading them
+ * again would put them, so queries find the same surfaces in the same order.
+ *
+ * While the frame has loaded the same as last frame, the partition is the same as it was at this
+ * point last frame, so each node goes right back after the node it followed then.
+ */
+static void load_object_surfaces_persistent(s16 *collisionData, s16 *vertexData) {
+    struct DynamicSurfaceLoad *load = NULL;
+    struct DynamicSurfaceLoad *prev;
+    s32 firstSurface = gSurfacesAllocated;
+    s32 firstNode = gSurfaceNodesAllocated;
+    s32 index = sDynamicSurfaceLogCount[sCurrentDynamicSurfaceLog];
+    Mat4 m;
+    s32 i;
+
+    // What transform_object_vertices transforms with
+    if (gCurrentObject->header.gfx.throwMatrix == NULL) {
+        gCurrentObject->header.gfx.throwMatrix = &gCurrentObject->transform;
+        obj_build_transform_from_pos_and_angle(gCurrentObject, O_POS_INDEX, O_FACE_ANGLE_INDEX);
+    }
+    obj_apply_scale_to_matrix(gCurrentObject, m, gCurrentObject->transform);
+
+    if (index < DYNAMIC_SURFACE_LOG_SIZE) {
+        load = &sDynamicSurfaceLog[sCurrentDynamicSurfaceLog][index];
+        sDynamicSurfaceLogCount[sCurrentDynamicSurfaceLog]++;
+    }
+
+    prev = find_last_frame_load();
+    if (prev != NULL && prev->behavior == gCurrentObject->behavior
+        && prev->collisionData == gCurrentObject->collisionData && prev->firstSurface >= firstSurface
+        && memcmp(prev->transform, m, sizeof(Mat4)) == 0) {
+        if (sSameAsLastFrame && prev == &sDynamicSurfaceLog[sCurrentDynamicSurfaceLog ^ 1][index]
+            && prev->firstSurface == firstSurface && prev->firstNode == firstNode) {
+            for (i = firstNode; i < firstNode + prev->numNodes; i++) {
+                sSurfaceNodePool[i].next = sDynamicNodePredecessors[i]->next;
+                sDynamicNodePredecessors[i]->next = &sSurfaceNodePool[i];
+            }
+            gSurfacesAllocated += prev->numSurfaces;
+            gSurfaceNodesAllocated += prev->numNodes;
+            gDynamicSurfaceStats.reused += prev->numSurfaces;
+            *load = *prev;
+            return;
+        }
+        sSameAsLastFrame = FALSE;
+
+        if (prev->firstSurface != firstSurface) {
+            memmove(&sSurfacePool[firstSurface], &sSurfacePool[prev->firstSurface],
+                    prev->numSurfaces * sizeof(struct Surface));
+        }
+        for (i = 0; i < prev->numSurfaces; i++) {
+            add_surface(&sSurfacePool[gSurfacesAllocated++], TRUE);
+        }
+        gDynamicSurfaceStats.reused += prev->numSurfaces;
+    } else {
+        sSameAsLastFrame = FALSE;
+
+        collisionData++;
+        transform_object_vertices(&collisionData, vertexData);
+
+        // TERRAIN_LOAD_CONTINUE acts as an "end" to the terrain data.
+        while (*collisionData != TERRAIN_LOAD_CONTINUE) {
+            load_object_surfaces(&collisionData, vertexData);
+        }
+        gDynamicSurfaceStats.rebuilt += gSurfacesAllocated - firstSurface;
+    }
+
+    if (load != NULL) {
+        load->object = gCurrentObject;
+        load->behavior = gCurrentObject->behavior;
+        load->collisionData = gCurrentObject->collisionData;
+        memcpy(load->transform, m, sizeof(Mat4));
+        load->firstSurface = firstSurface;
+        load->numSurfaces = gSurfacesAllocated - firstSurface;
+        load->firstNode = firstNode;
+        load->numNodes = gSurfaceNodesAllocated - firstNode;
+    } else {
+        sSameAsLastFrame = FALSE;
+    }
+}
+
+#ifdef CHECK_PERSISTENT_DYNAMIC_SURFACES
+/**
+ * Loads the current object's surfaces the way load_object_surfaces does without reuse, into the
+ * shadow pool and partition. The ones the game uses are put aside meanwhile.
+ */
+static void load_shadow_object_surfaces(s16 *collisionData, s16 *vertexData) {
+    struct Surface *surfacePool = sSurfacePool;
+    struct SurfaceNode *surfaceNodePool = sSurfaceNodePool;
+    s32 surfacesAllocated = gSurfacesAllocated;
+    s32 surfaceNodesAllocated = gSurfaceNodesAllocated;
+
+    memcpy(sSavedDynamicSurfacePartition, gDynamicSurfacePartition, sizeof(gDynamicSurfacePartition));
+    memcpy(gDynamicSurfacePartition, sShadowDynamicSurfacePartition, sizeof(gDynamicSurfacePartition));
+    sSurfacePool = sShadowSurfacePool;
+    sSurfaceNodePool = sShadowSurfaceNodePool;
+    gSurfacesAllocated = sShadowSurfacesAllocated;
+    gSurfaceNodesAllocated = sShadowSurfaceNodesAllocated;
+    sBuildingShadowSurfaces = TRUE;
+
+    collisionData++;
+    transform_object_vertices(&collisionData, vertexData);
+
+    // TERRAIN_LOAD_CONTINUE acts as an "end" to the terrain data.
+    while (*collisionData != TERRAIN_LOAD_CONTINUE) {
+        load_object_surfaces(&collisionData, vertexData);
+    }
+
+    sBuildingShadowSurfaces = FALSE;
+    sShadowSurfacesAllocated = gSurfacesAllocated;
+    sShadowSurfaceNodesAllocated = gSurfaceNodesAllocated;
+    memcpy(sShadowDynamicSurfacePartition, gDynamicSurfacePartition, sizeof(gDynamicSurfacePartition));
+    memcpy(gDynamicSurfacePartition, sSavedDynamicSurfacePartition, sizeof(gDynamicSurfacePartition));
+    sSurfacePool = surfacePool;
+    sSurfaceNodePool = surfaceNodePool;
+    gSurfacesAllocated = surfacesAllocated;
+    gSurfaceNodesAllocated = surfaceNodesAllocated;
+}
+
+static s32 surfaces_equal(struct Surface *a, struct Surface *b) {
+    return a->type == b->type && a->force == b->force && a->flags == b->flags && a->room == b->room
+           && a->lowerY == b->lowerY && a->upperY == b->upperY
+           && memcmp(a->vertex1, b->vertex1, sizeof(Vec3s)) == 0
+           && memcmp(a->vertex2, b->vertex2, sizeof(Vec3s)) == 0
+           && memcmp(a->vertex3, b->vertex3, sizeof(Vec3s)) == 0
+           && memcmp(&a->normal, &b->normal, sizeof(a->normal)) == 0
+           && memcmp(&a->originOffset, &b->originOffset, sizeof(f32)) == 0 && a->object == b->object;
+}
+
+/**
+ * Whether the object surfaces and the dynamic partition are the same as the shadow's: the same
+ * surfaces at the same places in the pool, and every list with the same nodes in the same order.
+ */
+static s32 dynamic_surfaces_match_shadow(void) {
+    struct SurfaceNode *node, *shadowNode;
+    s32 i;
+
+    if (gSurfacesAllocated != sShadowSurfacesAllocated
+        || gSurfaceNodesAllocated != sShadowSurfaceNodesAllocated) {
+        return FALSE;
+    }
+    for (i = gNumStaticSurfaces; i < gSurfacesAllocated; i++) {
+        if (!surfaces_equal(&sSurfacePool[i], &sShadowSurfacePool[i])) {
+            return FALSE;
+        }
+    }
+    for (i = 0; i < 16 * 16 * 3; i++) {
+        node = (&gDynamicSurfacePartition[0][0][0] + i)->next;
+        shadowNode = (&sShadowDynamicSurfacePartition[0][0][0] + i)->next;
+
+        while (node != NULL && shadowNode != NULL) {
+            if (node - sSurfaceNodePool != shadowNode - sShadowSurfaceNodePool
+                || node->surface - sSurfacePool != shadowNode->surface - sShadowSurfacePool) {
+                return FALSE;
+            }
+            node = node->next;
+            shadowNode = shadowNode->next;
+        }
+        if (node != shadowNode) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/**
+ * Builds the current object's surfaces again into the shadow, and counts the load as mismatched
+ * unless the pool and partition are still the same as the shadow's.
+ */
+static void check_object_surfaces(s16 *collisionData, s16 *vertexData) {
+    load_shadow_object_surfaces(collisionData, vertexData);
+
+    gDynamicSurfaceStats.checkedLoads++;
+    if (!dynamic_surfaces_match_shadow()) {
+        gDynamicSurfaceStats.mismatchedLoads++;
+    }
+}
+#endif
+#endif
+
 /**
  * Transform an object's vertices, reload them, and render the object.
  */
@@ -778,6 +1296,12 @@ void load_object_collision_model(void) {
     // Update if no Time Stop, in range, and in the current room.
     if (!(gTimeStopState & TIME_STOP_ACTIVE) && marioDist < tangibleDist
         && !(gCurrentObject->activeFlags & ACTIVE_FLAG_IN_DIFFERENT_ROOM)) {
+#ifdef PERSISTENT_DYNAMIC_SURFACES
+        load_object_surfaces_persistent(collisionData, vertexData);
+#ifdef CHECK_PERSISTENT_DYNAMIC_SURFACES
+        check_object_surfaces(collisionData, vertexData);
+#endif
+#else
         collisionData++;
         transform_object_vertices(&collisionData, vertexData);
 
@@ -785,6 +1309,7 @@ void load_object_collision_model(void) {
         while (*collisionData != TERRAIN_LOAD_CONTINUE) {
             load_object_surfaces(&collisionData, vertexData);
         }
+#endif
     }
 
     if (marioDist < gCurrentObject->oDrawingDistance) {
@@ -4,6 +4,10 @@
 #include <PR/ultratypes.h>
 
 #include "types.h"
+#include "surface_collision.h"
+
+#define SURFACE_POOL_SIZE      2300
+#define SURFACE_NODE_POOL_SIZE 7000
 
 struct SurfaceNode
 {
@@ -20,11 +24,72 @@ enum
 
 typedef struct SurfaceNode SpatialPartitionCell[3];
 
+#ifdef FINE_SURFACE_PARTITION
+// A list of static surfaces, and the heights at which a query can hit one of them
+struct FineSurfaceList
+{
+    struct SurfaceNode *next;
+    s32 minY, maxY;
+#ifdef PACKED_SURFACE_PARTITION
+    s32 packedIndex; // Of the list's first block in gPackedStaticSurfaces
+    s32 packedCount; // Surfaces in the blocks, or -1 if the list didn't fit and is only linked
+#endif
+};
+
+typedef struct FineSurfaceList FineSpatialPartitionCell[3];
+#endif
+
+#ifdef PACKED_SURFACE_PARTITION
+#define PACKED_SURFACE_LANES      4 // Surfaces tested at once
+#define PACKED_SURFACE_POOL_SIZE  16384 // In blocks of PACKED_SURFACE_LANES surfaces
+#define PACKED_SURFACE_MAX_LIST   1024 // Longer lists stay linked
+
+// Surfaces of a fine list, PACKED_SURFACE_LANES at a time. What the edge tests and the walls'
+// height check read fills the first 64 bytes, the plane the second. The Surface is only read
+// for the walls that pass, and for the surface a query returns.
+struct PackedSurfaceBlock
+{
+    s16 x1[PACKED_SURFACE_LANES], z1[PACKED_SURFACE_LANES];
+    s16 x2[PACKED_SURFACE_LANES], z2[PACKED_SURFACE_LANES];
+    s16 x3[PACKED_SURFACE_LANES], z3[PACKED_SURFACE_LANES];
+    s16 lowerY[PACKED_SURFACE_LANES], upperY[PACKED_SURFACE_LANES];
+    f32 normalX[PACKED_SURFACE_LANES], normalY[PACKED_SURFACE_LANES], normalZ[PACKED_SURFACE_LANES];
+    f32 originOffset[PACKED_SURFACE_LANES];
+    s16 type[PACKED_SURFACE_LANES];
+    s8 flags[PACKED_SURFACE_LANES];
+    struct Surface *surface[PACKED_SURFACE_LANES];
+} __attribute__((aligned(64)));
+#endif
+
+#ifdef PERSISTENT_DYNAMIC_SURFACES
+// Object surfaces that load_object_collision_model computed again, and those it reused
+struct DynamicSurfaceStats
+{
+    u32 rebuilt, reused; // This frame so far
+    u64 totalRebuilt, totalReused; // Over every finished frame
+    u32 frames;
+#ifdef CHECK_PERSISTENT_DYNAMIC_SURFACES
+    u32 checkedLoads, mismatchedLoads; // Compared with a full rebuild, over every frame
+#endif
+};
+#endif
+
 // Needed for bs bss reordering memes.
 extern s32 unused8038BE90;
 
 extern SpatialPartitionCell gStaticSurfacePartition[16][16];
 extern SpatialPartitionCell gDynamicSurfacePartition[16][16];
+#ifdef FINE_SURFACE_PARTITION
+extern FineSpatialPartitionCell gStaticFineSurfacePartition[NUM_FINE_CELLS][NUM_FINE_CELLS];
+extern s32 gFineSurfaceNodesAllocated;
+#endif
+#ifdef PACKED_SURFACE_PARTITION
+extern struct PackedSurfaceBlock gPackedStaticSurfaces[PACKED_SURFACE_POOL_SIZE];
+extern s32 gPackedSurfaceBlocksAllocated;
+#endif
+#ifdef PERSISTENT_DYNAMIC_SURFACES
+extern struct DynamicSurfaceStats gDynamicSurfaceStats;
+#endif
 extern struct SurfaceNode *sSurfaceNodePool;
 extern struct Surface *sSurfacePool;
 extern s16 sSurfacePoolSize;
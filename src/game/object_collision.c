@@ -6,6 +6,10 @@
 #include "mario.h"
 #include "object_list_processor.h"
 #include "spawn_object.h"
+#include "object_collision.h"
+#ifdef OBJECT_COLLISION_GRID
+#include "engine/surface_collision.h"
+#endif
 
 struct Object *debug_print_obj_collision(struct Object *a) {
     struct Object *sp24;
@@ -57,6 +61,9 @@ int detect_object_hitbox_overlap(struct Object *a, struct Object *b) {
     }
 
     //! no return value
+#ifdef AVOID_UB
+    return 0;
+#endif
 }
 
 int detect_object_hurtbox_overlap(struct Object *a, struct Object *b) {
@@ -89,6 +96,9 @@ int detect_object_hurtbox_overlap(struct Object *a, struct Object *b) {
     }
 
     //! no return value
+#ifdef AVOID_UB
+    return 0;
+#endif
 }
 
 void clear_object_collision(struct Object *a) {
@@ -167,7 +177,308 @@ void check_destructive_object_collision(void) {
     }
 }
 
+#ifdef OBJECT_COLLISION_GRID
+/**
+ * Broad phase for the checks above. Every object in a list that collides is given an index, in list
+ * order, and the cells of a 16x16 grid over the level hold a mask of the objects whose hitbox
+ * cylinder reaches into them. The objects an object is checked against are those in the cells it
+ * reaches into, visited in index order, so pairs are tested in the same order as walking the lists.
+ * Objects in no shared cell can't pass detect_object_hitbox_overlap, which then has no side effects.
+ *
+ * Filling the grid costs more than testing a few pairs per object, so frames where the lists would
+ * give fewer pairs than that check every tangible object in index order instead.
+ */
+#define OBJECT_GRID_CELLS (2 * LEVEL_BOUNDARY_MAX / CELL_SIZE)
+#define OBJECT_GRID_MAX_OBJECTS 256
+#define OBJECT_GRID_MASK_WORDS (OBJECT_GRID_MAX_OBJECTS / 64)
+#define OBJECT_GRID_MIN_PAIRS_PER_OBJECT 8
+// Added to hitbox extents so that rounding can't separate objects that overlap
+#define OBJECT_GRID_MARGIN 1.0f
+
+struct ObjectGridMask {
+    u64 words[OBJECT_GRID_MASK_WORDS];
+};
+
+struct ObjectGridCell {
+    u32 frame; // Cells not written to since an earlier frame are empty
+    struct ObjectGridMask objects;
+};
+
+struct ObjectGridCells {
+    s16 minX, maxX, minZ, maxZ;
+};
+
+struct ObjectCollisionStats gObjectCollisionStats;
+
+static struct ObjectGridCell sObjectGrid[OBJECT_GRID_CELLS][OBJECT_GRID_CELLS];
+static u32 sObjectGridFrame;
+static s32 sObjectGridBuilt;
+static struct Object *sGridObjects[OBJECT_GRID_MAX_OBJECTS];
+static struct ObjectGridCells sGridObjectCells[OBJECT_GRID_MAX_OBJECTS];
+static struct ObjectGridMask sTangibleGridObjects;
+static s16 sGridListStart[NUM_OBJ_LISTS];
+static s16 sGridListEnd[NUM_OBJ_LISTS];
+
+static s16 object_grid_cell(f32 coord) {
+    f32 offset = coord + LEVEL_BOUNDARY_MAX;
+
+    // Also sends NaN to the first cell; an object with a NaN position overlaps nothing
+    if (!(offset > 0.0f)) {
+        return 0;
+    }
+    if (offset >= 2 * LEVEL_BOUNDARY_MAX) {
+        return OBJECT_GRID_CELLS - 1;
+    }
+    return (s32) offset / CELL_SIZE;
+}
+
+static void object_grid_find_cells(struct Object *obj, struct ObjectGridCells *cells) {
+    // A negative radius only shrinks the sum of radii, so the other hitbox must reach this position
+    f32 extent = (obj->hitboxRadius > 0.0f ? obj->hitboxRadius : 0.0f) + OBJECT_GRID_MARGIN;
+
+    cells->minX = object_grid_cell(obj->oPosX - extent);
+    cells->maxX = object_grid_cell(obj->oPosX + extent);
+    cells->minZ = object_grid_cell(obj->oPosZ - extent);
+    cells->maxZ = object_grid_cell(obj->oPosZ + extent);
+}
+
+/**
+ * Does what clear_object_collision does for every list that collides, and meanwhile indexes their
+ * objects. Returns FALSE if there are too many of them, in which case the lists are walked instead.
+ */
+static s32 clear_object_collision_and_index(void) {
+    static const s8 gridLists[] = {
+        OBJ_LIST_POLELIKE, OBJ_LIST_PLAYER,  OBJ_LIST_PUSHABLE,    OBJ_LIST_GENACTOR,
+        OBJ_LIST_LEVEL,    OBJ_LIST_SURFACE, OBJ_LIST_DESTRUCTIVE,
+    };
+    s32 count = 0;
+    s32 i;
+
+    bzero(&sTangibleGridObjects, sizeof(sTangibleGridObjects));
+
+    for (i = 0; i < ARRAY_COUNT(gridLists); i++) {
+        struct Object *head = (struct Object *) &gObjectLists[gridLists[i]];
+        struct Object *obj = (struct Object *) head->header.next;
+
+        sGridListStart[gridLists[i]] = count;
+        while (obj != head) {
+            obj->numCollidedObjs = 0;
+            obj->collidedObjInteractTypes = 0;
+            if (obj->oIntangibleTimer > 0) {
+                obj->oIntangibleTimer--;
+            }
+
+            // Intangible objects are never checked, and stay so until every check is done
+            if (count < OBJECT_GRID_MAX_OBJECTS) {
+                sGridObjects[count] = obj;
+                if (obj->oIntangibleTimer == 0) {
+                    sTangibleGridObjects.words[count / 64] |= (u64) 1 << (count % 64);
+                }
+            }
+            count++;
+            obj = (struct Object *) obj->header.next;
+        }
+        sGridListEnd[gridLists[i]] = count;
+    }
+    return count <= OBJECT_GRID_MAX_OBJECTS;
+}
+
+static s32 is_checked_destructive_object(struct Object *obj) {
+    return obj->oDistanceToMario < 2000.0f && !(obj->activeFlags & ACTIVE_FLAG_UNK9);
+}
+
+#define GRID_LIST_LENGTH(list) (sGridListEnd[list] - sGridListStart[list])
+
+/**
+ * The number of pairs walking the lists would give, which the checks below count as listPairs.
+ */
+static s32 count_object_list_pairs(void) {
+    s32 numObjects = sGridListEnd[OBJ_LIST_DESTRUCTIVE];
+    s32 pairs = 0;
+    s32 i;
+
+    for (i = sGridListStart[OBJ_LIST_PLAYER]; i < sGridListEnd[OBJ_LIST_PLAYER]; i++) {
+        if (sGridObjects[i]->oIntangibleTimer == 0) {
+            pairs += numObjects - i - 1 + sGridListStart[OBJ_LIST_PLAYER];
+        }
+    }
+    for (i = sGridListStart[OBJ_LIST_DESTRUCTIVE]; i < sGridListEnd[OBJ_LIST_DESTRUCTIVE]; i++) {
+        if (sGridObjects[i]->oIntangibleTimer == 0 && is_checked_destructive_object(sGridObjects[i])) {
+            pairs += sGridListEnd[OBJ_LIST_DESTRUCTIVE] - i - 1 + GRID_LIST_LENGTH(OBJ_LIST_GENACTOR)
+                     + GRID_LIST_LENGTH(OBJ_LIST_PUSHABLE) + GRID_LIST_LENGTH(OBJ_LIST_SURFACE);
+        }
+    }
+    for (i = sGridListStart[OBJ_LIST_PUSHABLE]; i < sGridListEnd[OBJ_LIST_PUSHABLE]; i++) {
+        if (sGridObjects[i]->oIntangibleTimer == 0) {
+            pairs += sGridListEnd[OBJ_LIST_PUSHABLE] - i - 1;
+        }
+    }
+    return pairs;
+}
+
+static void build_object_grid(void) {
+    s32 count = sGridListEnd[OBJ_LIST_DESTRUCTIVE];
+    s32 i, x, z;
+
+    sObjectGridFrame++;
+
+    for (i = 0; i < count; i++) {
+        struct ObjectGridCells *cells = &sGridObjectCells[i];
+        u64 bit = (u64) 1 << (i % 64);
+
+        object_grid_find_cells(sGridObjects[i], cells);
+        if (!(sTangibleGridObjects.words[i / 64] & bit)) {
+            continue;
+        }
+        for (z = cells->minZ; z <= cells->maxZ; z++) {
+            for (x = cells->minX; x <= cells->maxX; x++) {
+                struct ObjectGridCell *cell = &sObjectGrid[z][x];
+
+                if (cell->frame != sObjectGridFrame) {
+                    cell->frame = sObjectGridFrame;
+                    bzero(&cell->objects, sizeof(cell->objects));
+                }
+                cell->objects.words[i / 64] |= bit;
+            }
+        }
+    }
+}
+
+/**
+ * The tangible objects that the object at index could overlap with.
+ */
+static void find_nearby_grid_objects(s32 index, struct ObjectGridMask *nearby) {
+    struct ObjectGridCells *cells = &sGridObjectCells[index];
+    s32 x, z, w;
+
+    if (!sObjectGridBuilt) {
+        *nearby = sTangibleGridObjects;
+        return;
+    }
+
+    bzero(nearby, sizeof(*nearby));
+    for (z = cells->minZ; z <= cells->maxZ; z++) {
+        for (x = cells->minX; x <= cells->maxX; x++) {
+            struct ObjectGridCell *cell = &sObjectGrid[z][x];
+
+            if (cell->frame == sObjectGridFrame) {
+                for (w = 0; w < OBJECT_GRID_MASK_WORDS; w++) {
+                    nearby->words[w] |= cell->objects.words[w];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Same as check_collision_in_list for the indexed objects in [start, end), given the objects a
+ * could overlap with.
+ */
+static void check_collision_in_grid(struct Object *a, struct ObjectGridMask *nearby, s32 start, s32 end) {
+    s32 w;
+
+    if (a->oIntangibleTimer != 0) {
+        return;
+    }
+    gObjectCollisionStats.listPairs += end - start;
+
+    for (w = start / 64; w < OBJECT_GRID_MASK_WORDS && w * 64 < end; w++) {
+        u64 words = nearby->words[w];
+
+        if (start > w * 64) {
+            words &= ~(u64) 0 << (start - w * 64);
+        }
+        if (end < (w + 1) * 64) {
+            words &= ((u64) 1 << (end - w * 64)) - 1;
+        }
+
+        while (words != 0) {
+            struct Object *b = sGridObjects[w * 64 + __builtin_ctzll(words)];
+
+            words &= words - 1;
+            gObjectCollisionStats.candidatePairs++;
+            if (detect_object_hitbox_overlap(a, b)) {
+                gObjectCollisionStats.overlaps++;
+                if (b->hurtboxRadius != 0.0f) {
+                    detect_object_hurtbox_overlap(a, b);
+                }
+            }
+        }
+    }
+}
+
+#define CHECK_COLLISION_IN_GRID_LIST(a, nearby, list) \
+    check_collision_in_grid(a, nearby, sGridListStart[list], sGridListEnd[list])
+
+static void check_player_object_collision_grid(void) {
+    struct ObjectGridMask nearby;
+    s32 i;
+
+    for (i = sGridListStart[OBJ_LIST_PLAYER]; i < sGridListEnd[OBJ_LIST_PLAYER]; i++) {
+        struct Object *a = sGridObjects[i];
+
+        find_nearby_grid_objects(i, &nearby);
+        check_collision_in_grid(a, &nearby, i + 1, sGridListEnd[OBJ_LIST_PLAYER]);
+        CHECK_COLLISION_IN_GRID_LIST(a, &nearby, OBJ_LIST_POLELIKE);
+        CHECK_COLLISION_IN_GRID_LIST(a, &nearby, OBJ_LIST_LEVEL);
+        CHECK_COLLISION_IN_GRID_LIST(a, &nearby, OBJ_LIST_GENACTOR);
+        CHECK_COLLISION_IN_GRID_LIST(a, &nearby, OBJ_LIST_PUSHABLE);
+        CHECK_COLLISION_IN_GRID_LIST(a, &nearby, OBJ_LIST_SURFACE);
+        CHECK_COLLISION_IN_GRID_LIST(a, &nearby, OBJ_LIST_DESTRUCTIVE);
+    }
+}
+
+static void check_pushable_object_collision_grid(void) {
+    struct ObjectGridMask nearby;
+    s32 i;
+
+    for (i = sGridListStart[OBJ_LIST_PUSHABLE]; i < sGridListEnd[OBJ_LIST_PUSHABLE]; i++) {
+        find_nearby_grid_objects(i, &nearby);
+        check_collision_in_grid(sGridObjects[i], &nearby, i + 1, sGridListEnd[OBJ_LIST_PUSHABLE]);
+    }
+}
+
+static void check_destructive_object_collision_grid(void) {
+    struct ObjectGridMask nearby;
+    s32 i;
+
+    for (i = sGridListStart[OBJ_LIST_DESTRUCTIVE]; i < sGridListEnd[OBJ_LIST_DESTRUCTIVE]; i++) {
+        struct Object *a = sGridObjects[i];
+
+        if (is_checked_destructive_object(a)) {
+            find_nearby_grid_objects(i, &nearby);
+            check_collision_in_grid(a, &nearby, i + 1, sGridListEnd[OBJ_LIST_DESTRUCTIVE]);
+            CHECK_COLLISION_IN_GRID_LIST(a, &nearby, OBJ_LIST_GENACTOR);
+            CHECK_COLLISION_IN_GRID_LIST(a, &nearby, OBJ_LIST_PUSHABLE);
+            CHECK_COLLISION_IN_GRID_LIST(a, &nearby, OBJ_LIST_SURFACE);
+        }
+    }
+}
+#endif
+
 void detect_object_collisions(void) {
+#ifdef OBJECT_COLLISION_GRID
+    if (clear_object_collision_and_index()) {
+        sObjectGridBuilt =
+            count_object_list_pairs() >= OBJECT_GRID_MIN_PAIRS_PER_OBJECT * sGridListEnd[OBJ_LIST_DESTRUCTIVE];
+        if (sObjectGridBuilt) {
+            build_object_grid();
+        }
+
+        gObjectCollisionStats.listPairs = 0;
+        gObjectCollisionStats.candidatePairs = 0;
+        gObjectCollisionStats.overlaps = 0;
+        check_player_object_collision_grid();
+        check_destructive_object_collision_grid();
+        check_pushable_object_collision_grid();
+        gObjectCollisionStats.totalListPairs += gObjectCollisionStats.listPairs;
+        gObjectCollisionStats.totalCandidatePairs += gObjectCollisionStats.candidatePairs;
+        gObjectCollisionStats.totalOverlaps += gObjectCollisionStats.overlaps;
+        gObjectCollisionStats.gridFrames += sObjectGridBuilt;
+        gObjectCollisionStats.frames++;
+        return;
+    }
+#else
     clear_object_collision((struct Object *) &gObjectLists[OBJ_LIST_POLELIKE]);
     clear_object_collision((struct Object *) &gObjectLists[OBJ_LIST_PLAYER]);
     clear_object_collision((struct Object *) &gObjectLists[OBJ_LIST_PUSHABLE]);
@@ -175,6 +486,7 @@ void detect_object_collisions(void) {
     clear_object_collision((struct Object *) &gObjectLists[OBJ_LIST_LEVEL]);
     clear_object_collision((struct Object *) &gObjectLists[OBJ_LIST_SURFACE]);
     clear_object_collision((struct Object *) &gObjectLists[OBJ_LIST_DESTRUCTIVE]);
+#endif
     check_player_object_collision();
     check_destructive_object_collision();
     check_pushable_object_collision();
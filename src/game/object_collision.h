@@ -1,6 +1,20 @@
 #ifndef OBJECT_COLLISION_H
 #define OBJECT_COLLISION_H
 
+#include <PR/ultratypes.h>
+
+#ifdef OBJECT_COLLISION_GRID
+// Object pairs detect_object_collisions would have walked through its lists, and those it tested
+struct ObjectCollisionStats
+{
+    u32 listPairs, candidatePairs, overlaps; // Last frame
+    u64 totalListPairs, totalCandidatePairs, totalOverlaps; // Over every counted frame
+    u32 frames, gridFrames; // Frames counted (all but those with too many objects), and those the grid was filled
+};
+
+extern struct ObjectCollisionStats gObjectCollisionStats;
+#endif
+
 void detect_object_collisions(void);
 
 #endif // OBJECT_COLLISION_H
@@ -0,0 +1,150 @@
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef AUDIO_PARALLEL_NOTES
+#include <pthread.h>
+#endif
+
+#include "adpcm_cache.h"
+
+struct AdpcmCacheEntry {
+    struct AdpcmCacheEntry *next;
+    struct AdpcmCacheEntry *lruPrev, *lruNext; // Towards the most and least recently used
+
+    const uint8_t *packet;
+    int16_t prev2, prev1;
+    int16_t samples[16];
+};
+
+struct AdpcmCacheStats gAdpcmCacheStats;
+
+static struct AdpcmCacheEntry *sAdpcmCacheArena;
+static uint32_t sAdpcmCacheArenaSize;
+static uint32_t sAdpcmCacheArenaPos;
+static struct AdpcmCacheEntry **sAdpcmCacheHashmap;
+static uint32_t sAdpcmCacheHashBits;
+static struct AdpcmCacheEntry sAdpcmCacheLru; // Sentinel: sAdpcmCacheLru.lruNext is the most recently used entry
+
+#ifdef AUDIO_PARALLEL_NOTES
+static pthread_mutex_t sAdpcmCacheMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+void adpcm_cache_lock(void) {
+#ifdef AUDIO_PARALLEL_NOTES
+    pthread_mutex_lock(&sAdpcmCacheMutex);
+#endif
+}
+
+void adpcm_cache_unlock(void) {
+#ifdef AUDIO_PARALLEL_NOTES
+    pthread_mutex_unlock(&sAdpcmCacheMutex);
+#endif
+}
+
+static uint32_t adpcm_cache_hash(const uint8_t *packet, int16_t prev2, int16_t prev1) {
+    uint32_t key = (uint32_t) (uintptr_t) packet ^ (((uint32_t) (uint16_t) prev2 << 16) | (uint16_t) prev1) * 0x9e3779b1;
+    return (key * 0x9e3779b1) >> (32 - sAdpcmCacheHashBits);
+}
+
+static void adpcm_cache_lru_unlink(struct AdpcmCacheEntry *entry) {
+    entry->lruPrev->lruNext = entry->lruNext;
+    entry->lruNext->lruPrev = entry->lruPrev;
+}
+
+static void adpcm_cache_lru_push_front(struct AdpcmCacheEntry *entry) {
+    entry->lruPrev = &sAdpcmCacheLru;
+    entry->lruNext = sAdpcmCacheLru.lruNext;
+    sAdpcmCacheLru.lruNext->lruPrev = entry;
+    sAdpcmCacheLru.lruNext = entry;
+}
+
+void adpcm_cache_set_budget(size_t bytes) {
+    free(sAdpcmCacheArena);
+    free(sAdpcmCacheHashmap);
+    sAdpcmCacheArena = NULL;
+    sAdpcmCacheHashmap = NULL;
+    sAdpcmCacheArenaSize = 0;
+    sAdpcmCacheArenaPos = 0;
+    sAdpcmCacheLru.lruPrev = sAdpcmCacheLru.lruNext = &sAdpcmCacheLru;
+    gAdpcmCacheStats.entries = 0;
+    gAdpcmCacheStats.bytes = 0;
+    gAdpcmCacheStats.budget = bytes;
+
+    // At most two entries per hashmap slot, which costs one pointer per entry on average
+    uint32_t numEntries = bytes / (sizeof(struct AdpcmCacheEntry) + sizeof(struct AdpcmCacheEntry *));
+    if (numEntries == 0) {
+        return;
+    }
+    sAdpcmCacheHashBits = 1;
+    while ((1u << sAdpcmCacheHashBits) < numEntries / 2) {
+        sAdpcmCacheHashBits++;
+    }
+    sAdpcmCacheArena = malloc(numEntries * sizeof(struct AdpcmCacheEntry));
+    sAdpcmCacheHashmap = calloc(1u << sAdpcmCacheHashBits, sizeof(struct AdpcmCacheEntry *));
+    if (sAdpcmCacheArena == NULL || sAdpcmCacheHashmap == NULL) {
+        adpcm_cache_set_budget(0);
+        return;
+    }
+    sAdpcmCacheArenaSize = numEntries;
+    gAdpcmCacheStats.bytes = (1u << sAdpcmCacheHashBits) * sizeof(struct AdpcmCacheEntry *);
+}
+
+const int16_t *adpcm_cache_find(const uint8_t *packet, int16_t prev2, int16_t prev1) {
+    if (sAdpcmCacheArenaSize == 0) {
+        return NULL;
+    }
+    struct AdpcmCacheEntry *entry = sAdpcmCacheHashmap[adpcm_cache_hash(packet, prev2, prev1)];
+    while (entry != NULL) {
+        if (entry->packet == packet && entry->prev2 == prev2 && entry->prev1 == prev1) {
+            adpcm_cache_lru_unlink(entry);
+            adpcm_cache_lru_push_front(entry);
+            gAdpcmCacheStats.hits++;
+            return entry->samples;
+        }
+        entry = entry->next;
+    }
+    return NULL;
+}
+
+// Reuses the least recently used entry once the arena is full
+void adpcm_cache_insert(const uint8_t *packet, int16_t prev2, int16_t prev1, const int16_t *samples) {
+    if (sAdpcmCacheArenaSize == 0) {
+        return;
+    }
+    gAdpcmCacheStats.misses++;
+
+    // Packets after the first miss of a decode may have been cached already
+    uint32_t hash = adpcm_cache_hash(packet, prev2, prev1);
+    struct AdpcmCacheEntry *entry = sAdpcmCacheHashmap[hash];
+    while (entry != NULL) {
+        if (entry->packet == packet && entry->prev2 == prev2 && entry->prev1 == prev1) {
+            adpcm_cache_lru_unlink(entry);
+            adpcm_cache_lru_push_front(entry);
+            return;
+        }
+        entry = entry->next;
+    }
+
+    if (sAdpcmCacheArenaPos < sAdpcmCacheArenaSize) {
+        entry = &sAdpcmCacheArena[sAdpcmCacheArenaPos++];
+        gAdpcmCacheStats.entries++;
+        gAdpcmCacheStats.bytes += sizeof(struct AdpcmCacheEntry);
+    } else {
+        entry = sAdpcmCacheLru.lruPrev;
+        struct AdpcmCacheEntry **link = &sAdpcmCacheHashmap[adpcm_cache_hash(entry->packet, entry->prev2, entry->prev1)];
+        while (*link != entry) {
+            link = &(*link)->next;
+        }
+        *link = entry->next;
+        adpcm_cache_lru_unlink(entry);
+        gAdpcmCacheStats.evictions++;
+    }
+
+    entry->packet = packet;
+    entry->prev2 = prev2;
+    entry->prev1 = prev1;
+    memcpy(entry->samples, samples, sizeof(entry->samples));
+    entry->next = sAdpcmCacheHashmap[hash];
+    sAdpcmCacheHashmap[hash] = entry;
+    adpcm_cache_lru_push_front(entry);
+}
@@ -0,0 +1,41 @@
+#ifndef ADPCM_CACHE_H
+#define ADPCM_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Decoded ADPCM cache.
+//
+// Notes decode their samples 16 at a time, one 9-byte packet after another, and the samples a
+// packet decodes to only depend on its bytes, its sample's codebook and the two samples decoded
+// before it. Packets are stored in a fixed-size LRU arena keyed by their address in the loaded
+// sound bank and those two samples, so the short samples that play over and over (footsteps,
+// coins, jumps) and the loops of held notes are decoded once and then copied.
+//
+// The budget defaults to 0, which disables the cache. This file is ignored completely on N64.
+
+struct AdpcmCacheStats {
+    uint64_t hits; // Packets copied from the cache
+    uint64_t misses; // Packets decoded, then cached
+    uint64_t evictions;
+    uint32_t entries;
+    size_t bytes; // Arena in use, including bookkeeping
+    size_t budget;
+};
+
+extern struct AdpcmCacheStats gAdpcmCacheStats;
+
+// Drops every cached packet
+void adpcm_cache_set_budget(size_t bytes);
+
+// Returns the 16 samples that the packet at packet decodes to after prev2 and prev1, or NULL
+const int16_t *adpcm_cache_find(const uint8_t *packet, int16_t prev2, int16_t prev1);
+// Counts a miss, call for each packet that had to be decoded
+void adpcm_cache_insert(const uint8_t *packet, int16_t prev2, int16_t prev1, const int16_t *samples);
+
+// Hold around finds and inserts, and while reading what a find returned, when notes are rendered
+// in parallel (AUDIO_PARALLEL_NOTES). Does nothing otherwise.
+void adpcm_cache_lock(void);
+void adpcm_cache_unlock(void);
+
+#endif // ADPCM_CACHE_H
@@ -8,18 +8,16 @@
 #include <string.h>
 #include "macros.h"
 #include "audio_3ds.h"
+#include "audio_pacing.h"
 #include "src/audio/external.h"
+#include "src/pc/audio_cmd_ring.h"
 
 #define PLAYBACK_RATE 32000
 
-// We synthesize 2 * SAMPLES_HIGH or LOW each frame
+// We synthesize two buffers each frame, each about 32000/60 samples long (32000/50 on EU)
 #ifdef VERSION_EU
-#define SAMPLES_HIGH 656 // ROUND_UP_16(32000/50) + 16
-#define SAMPLES_LOW 640
 #define SAMPLES_DESIRED 1320
 #else
-#define SAMPLES_HIGH 544 // ROUND_UP_16(32000/60)
-#define SAMPLES_LOW 528
 #define SAMPLES_DESIRED 1100
 #endif
 
@@ -59,15 +57,25 @@ bool s_thread5_wait_for_audio_to_finish = true;
 bool s_thread5_does_audio = false;
 enum N3dsCpu s_audio_cpu = OLD_CORE_0;
 
-volatile __3ds_s32 s_audio_frames_to_tick = 0;
-volatile __3ds_s32 s_audio_frames_to_process = 0;
-volatile bool s_audio_thread_processing = false;
-
 // Synchronization variables
 static volatile bool running = true;
+#ifdef N3DS_AUDIO_FREE_RUNNING
+static LightEvent s_audio_start_event; // Signalled once the game has initialized the sound system
+static LightEvent s_dsp_event; // Signalled every time the DSP advances
+#else
+// Frames Thread5 has finished that the audio thread has yet to tick, and to synthesize
+static volatile __3ds_s32 s_audio_frames_to_tick = 0;
+static volatile __3ds_s32 s_audio_frames_to_process = 0;
+
+// This is a purely informative value.
+// It is set to true when it acknowledges a new frame to process,
+// and to false when the audio thread begins spinning.
+// Do not use this for bi-directional synchronization!
+static volatile bool s_audio_thread_processing = false;
+#endif
 
 // Statically allocate to improve performance
-static s16 audio_buffer [2 * SAMPLES_HIGH * N3DS_DSP_N_CHANNELS];
+static s16 audio_buffer [2 * AUDIO_PACING_MAX_BUFFER_LEN * N3DS_DSP_N_CHANNELS];
 
 // Used in synthesis.c to avoid intermediate copies when possible
 size_t samples_to_copy;
@@ -147,18 +155,25 @@ static void audio_3ds_play_ext(const uint8_t *buf, size_t len)
 {
     if (audio_3ds_next_buffer_is_ready())
         audio_3ds_play_internal(buf, len, len);
+    else
+        audio_pacing_report_overrun();
 }
 
 inline void audio_3ds_run_one_frame() {
 
-    // If we've buffered less than desired, SAMPLES_HIGH; else, SAMPLES_LOW
-    u32 num_audio_samples = audio_3ds_buffered() < audio_3ds_get_desired_buffered() ? SAMPLES_HIGH : SAMPLES_LOW;
+    u32 num_audio_samples = audio_pacing_next_buffer_len(audio_3ds_buffered(), audio_3ds_get_desired_buffered());
     s16* const direct_buf_t = (s16*) sDspVAddrs[sNextBuffer];
     samples_to_copy = 0;
     
+#ifdef N3DS_AUDIO_FREE_RUNNING
+    // The audio thread gets the game's ticks through the audio command ring instead
+    if (s_thread5_does_audio)
+        update_game_sound_wrapper_3ds();
+#else
     // Update audio state once per Thread5 frame, then let Thread5 continue
     update_game_sound_wrapper_3ds();
     AtomicDecrement(&s_audio_frames_to_tick);
+#endif
 
     // Synthesize to our audio buffer
     for (int i = 0; i < 2; i++) {
@@ -168,7 +183,9 @@ inline void audio_3ds_run_one_frame() {
         create_next_audio_buffer(copy_buf, num_audio_samples);
     }
 
+#ifndef N3DS_AUDIO_FREE_RUNNING
     AtomicDecrement(&s_audio_frames_to_process);
+#endif
 
     // Play our audio buffer. If we outrun the DSP, we wait until the DSP is ready.
     audio_3ds_play_internal((u8 *)audio_buffer, N3DS_DSP_N_CHANNELS * num_audio_samples * 4, N3DS_DSP_N_CHANNELS * samples_to_copy * 4);
@@ -176,6 +193,71 @@ inline void audio_3ds_run_one_frame() {
 
 Thread threadId = NULL;
 
+#ifdef N3DS_AUDIO_FREE_RUNNING
+static void audio_3ds_dsp_callback(UNUSED void *data)
+{
+    LightEvent_Signal(&s_dsp_event);
+}
+
+// Synthesizes continuously at the DSP's pace, like the N64, so that slow game frames don't
+// make audio choppy. The game's sound requests arrive through the audio command ring,
+// so nothing here has to wait for Thread5, and nothing polls while the DSP is busy.
+static void audio_3ds_loop()
+{
+    LightEvent_Wait(&s_audio_start_event);
+    audio_cmd_ring_set_consumer();
+    audio_pacing_set_device_paced(true);
+
+    while (running)
+    {
+        if (audio_3ds_next_buffer_is_ready() && audio_3ds_buffered() < audio_3ds_get_desired_buffered())
+            audio_3ds_run_one_frame();
+        else
+            LightEvent_Wait(&s_dsp_event);
+    }
+
+    threadId = NULL;
+}
+
+// Thread5 never waits for a free-running audio thread
+void audio_3ds_thread5_wait()
+{
+}
+
+void audio_3ds_thread5_end_frame()
+{
+    if (s_thread5_does_audio)
+        audio_3ds_run_one_frame();
+}
+
+#else
+
+static inline void audio_3ds_wait_for_frames(volatile __3ds_s32* const ptr)
+{
+    while (*ptr > 0)
+        N3DS_AUDIO_SLEEP_FUNC(N3DS_AUDIO_SLEEP_DURATION_NANOS);
+}
+
+// Waits until the audio thread has synthesized every frame Thread5 has finished, or only ticked them
+void audio_3ds_thread5_wait()
+{
+    if (s_thread5_wait_for_audio_to_finish)
+        audio_3ds_wait_for_frames(&s_audio_frames_to_process);
+    else
+        audio_3ds_wait_for_frames(&s_audio_frames_to_tick);
+}
+
+void audio_3ds_thread5_end_frame()
+{
+    // Notify audio thread that a frame is ready. Maintain this order.
+    AtomicIncrement(&s_audio_frames_to_tick);
+    AtomicIncrement(&s_audio_frames_to_process);
+
+    if (s_thread5_does_audio)
+        audio_3ds_run_one_frame();
+}
+
+// Synthesizes one frame for each frame Thread5 finishes, in lockstep with the game
 static void audio_3ds_loop()
 {
     
@@ -183,10 +265,8 @@ static void audio_3ds_loop()
     {
         s_audio_thread_processing = s_audio_frames_to_process > 0;
 
-        // In an ideal world, we would just continually run audio synthesis.
-        // This would give an N64-like behavior, with no audio choppiness on slowdown.
-        // However, due to race conditions, that is currently non-viable.
-        // If the audio thread's DMA were ripped out, it would likely work.
+        // Build with N3DS_AUDIO_FREE_RUNNING to synthesize continuously instead,
+        // for an N64-like behavior with no audio choppiness on slowdown.
         if (s_audio_thread_processing)
             audio_3ds_run_one_frame();
         else
@@ -198,14 +278,19 @@ static void audio_3ds_loop()
     s_audio_frames_to_tick = -9999;
     threadId = NULL;
 }
+#endif
 
 
 // Fully initializes the audio thread
 static void audio_3ds_initialize_thread()
 {
+#ifdef N3DS_AUDIO_FREE_RUNNING
+    LightEvent_Init(&s_audio_start_event, RESET_STICKY);
+#else
     // Start audio thread in a consistent state
     s_audio_frames_to_tick = s_audio_frames_to_process = 0;
     s_audio_thread_processing = true;
+#endif
 
     // Set main thread priority to desired value
     if (R_SUCCEEDED(svcSetThreadPriority(CUR_THREAD_HANDLE, N3DS_DESIRED_PRIORITY_MAIN_THREAD)))
@@ -224,7 +309,9 @@ static void audio_3ds_initialize_thread()
         fprintf(stderr, "Failed to set AppCpuTimeLimit to %d.\n", N3DS_AUDIO_CORE_1_LIMIT);
     }
 
-    // Create a thread if applicable
+    // Create a thread if applicable. A free-running one needs the audio command ring, which EU
+    // doesn't post its sound requests to, so EU then synthesizes on Thread5.
+#if !defined(N3DS_AUDIO_FREE_RUNNING) || defined(AUDIO_CMD_RING)
     if (s_audio_cpu != OLD_CORE_0) {
 
         printf("Audio thread priority: 0x%x\n", N3DS_DESIRED_PRIORITY_AUDIO_THREAD);
@@ -234,19 +321,24 @@ static void audio_3ds_initialize_thread()
         if (threadId != NULL) {
             printf("Created audio thread on core %i.\n", s_audio_cpu);
 
+#ifndef N3DS_AUDIO_FREE_RUNNING
             while (s_audio_thread_processing) {
                 printf("Waiting for audio thread to settle...\n");
                 N3DS_AUDIO_SLEEP_FUNC(N3DS_AUDIO_MILLIS_TO_NANOS(33));
             }
             printf("Audio thread finished settling.\n");
+#endif
         } else
             printf("Failed to create audio thread.\n");
     }
+#endif
     
     // If thread creation failed, or was never attempted...
     if (threadId == NULL) {
         s_thread5_does_audio = true;
+#ifndef N3DS_AUDIO_FREE_RUNNING
         s_audio_thread_processing = false;
+#endif
         printf("Using Thread5 for audio.\n");
     } else {
         s_thread5_does_audio = false;
@@ -258,6 +350,10 @@ union NdspMix ndsp_mix;
 static void audio_3ds_initialize_dsp()
 {
     ndspInit();
+#ifdef N3DS_AUDIO_FREE_RUNNING
+    LightEvent_Init(&s_dsp_event, RESET_ONESHOT);
+    ndspSetCallback(audio_3ds_dsp_callback, NULL);
+#endif
 
     ndspSetOutputMode(NDSP_OUTPUT_STEREO);
     ndspChnReset(0);
@@ -290,10 +386,24 @@ static bool audio_3ds_init()
     return true;
 }
 
+// Lets a free-running audio thread start, once audio_init and sound_init have run
+void audio_3ds_start_synthesis()
+{
+#ifdef N3DS_AUDIO_FREE_RUNNING
+    if (threadId != NULL)
+        audio_cmd_ring_enable();
+    LightEvent_Signal(&s_audio_start_event);
+#endif
+}
+
 // Stops the audio thread and waits for it to exit.
 static void audio_3ds_stop(void)
 {
     running = false;
+#ifdef N3DS_AUDIO_FREE_RUNNING
+    LightEvent_Signal(&s_audio_start_event);
+    LightEvent_Signal(&s_dsp_event);
+#endif
 
     if (threadId)
         threadJoin(threadId, U64_MAX);
@@ -13,9 +13,19 @@ extern int16_t* direct_buf;
 // Used in synthesis.c to avoid intermediate copies when possible
 extern bool audio_3ds_next_buffer_is_ready();
 
-// Used in audio_3ds when multi-threaded and level_script when single-threaded
+// Used by the audio thread, or by audio_3ds_thread5_end_frame when single-threaded
 extern void audio_3ds_run_one_frame();
 
+// Thread5's side of its synchronization with the audio thread, used by level_script.
+// Waits until the audio thread has ticked the last frame, or synthesized it if
+// s_thread5_wait_for_audio_to_finish is set. Returns at once with N3DS_AUDIO_FREE_RUNNING.
+extern void audio_3ds_thread5_wait();
+// Hands a finished frame to the audio thread, or synthesizes it if Thread5 does audio.
+extern void audio_3ds_thread5_end_frame();
+
+// Lets the audio thread start synthesizing, once audio_init and sound_init have run
+extern void audio_3ds_start_synthesis();
+
 // Sets the volume of the NDSP directly.
 extern void audio_3ds_set_dsp_volume(float left, float right);
 
@@ -61,6 +61,7 @@ enum N3dsCpu {
 };
 
 // Controls when Thread5 is allowed to skip waiting for the audio thread.
+// Ignored when built with N3DS_AUDIO_FREE_RUNNING, as Thread5 then never waits.
 extern bool s_thread5_wait_for_audio_to_finish;
 
 // Tells Thread5 whether or not to run audio synchronously
@@ -69,15 +70,5 @@ extern bool s_thread5_does_audio;
 // Which CPU to run audio on
 extern enum N3dsCpu s_audio_cpu;
 
-// Synchronization variables
-extern volatile __3ds_s32 s_audio_frames_to_tick;
-extern volatile __3ds_s32 s_audio_frames_to_process;
-
-// This is a purely informative value.
-// It is set to true when it acknowledges a new frame to process,
-// and to false when the audio thread begins spinning.
-// Do not use this for bi-directional synchronization!
-extern volatile bool s_audio_thread_processing;
-
 #endif
 #endif
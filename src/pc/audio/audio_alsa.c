@@ -34,6 +34,8 @@
 #include <stdio.h>
 
 #include "audio_api.h"
+#include "audio_rate.h"
+#include "audio_pacing.h"
 
 #define PCM_DEVICE "default"
 static snd_pcm_t *pcm_handle;
@@ -52,7 +54,7 @@ static bool audio_alsa_init(void) {
 	snd_pcm_hw_params_t *params;
 	snd_pcm_uframes_t frames;
 
-	rate 	 = 32000;
+	rate 	 = audio_rate_requested() != 0 ? audio_rate_requested() : 48000;
 	channels = 2;
 
 	/* Open the PCM device in playback mode */
@@ -80,10 +82,19 @@ static bool audio_alsa_init(void) {
 	if ((pcm = snd_pcm_hw_params_set_channels(pcm_handle, params, channels)) < 0)
 		printf("ERROR: Can't set channels number. %s\n", snd_strerror(pcm));
 
+	/* Without a rate in the config, take the one the hardware runs at instead of resampling. A device
+	   that only runs at one rate reports it here; otherwise take the nearest one to 48 kHz. */
+	if (audio_rate_requested() == 0) {
+		snd_pcm_hw_params_set_rate_resample(pcm_handle, params, 0);
+		if (snd_pcm_hw_params_get_rate(params, &tmp, 0) >= 0)
+			rate = tmp;
+	}
+
 	if ((pcm = snd_pcm_hw_params_set_rate_near(pcm_handle, params, &rate, 0)) < 0)
 		printf("ERROR: Can't set rate. %s\n", snd_strerror(pcm));
+	audio_rate_set_device(rate);
 
-	alsa_buffer_size = 1600 + 528 + 544; // five audio buffers from the game
+	alsa_buffer_size = audio_rate_to_device(1600 + 528 + 544); // five audio buffers from the game
 	if ((pcm = snd_pcm_hw_params_set_buffer_size_near(pcm_handle, params, &alsa_buffer_size)) < 0)
 		printf("ERROR: Can't set buffer size. %s\n", snd_strerror(pcm));
 
@@ -133,7 +144,7 @@ static int audio_alsa_buffered(void) {
 }
 
 static int audio_alsa_get_desired_buffered(void) {
-    return 1100;
+    return audio_rate_to_device(1100);
 }
 
 static void audio_alsa_play(const uint8_t* buff, size_t len) {
@@ -144,13 +155,14 @@ static void audio_alsa_play(const uint8_t* buff, size_t len) {
     int frames = len / 4;
     int pcm;
 	if ((pcm = snd_pcm_writei(pcm_handle, buff, frames)) == -EPIPE) {
-		printf("XRUN.\n");
+		audio_pacing_report_xrun();
 		snd_pcm_prepare(pcm_handle);
         // Add some silence to avoid another XRUN
-        char buf[1100 * 4 + len];
-        memset(buf, 0, 1100 * 4);
-        memcpy(buf + 1100 * 4, buff, len);
-		if ((pcm = snd_pcm_writei(pcm_handle, buf, 1100 + frames)) < 0) {
+        int silence = audio_rate_to_device(1100);
+        char buf[silence * 4 + len];
+        memset(buf, 0, silence * 4);
+        memcpy(buf + silence * 4, buff, len);
+		if ((pcm = snd_pcm_writei(pcm_handle, buf, silence + frames)) < 0) {
 			printf("Failed again %d\n", pcm);
 		}
 	} else if (pcm < 0) {
@@ -7,6 +7,7 @@
 
 struct AudioAPI {
     bool (*init)(void);
+    // Counted in samples at the device's rate, see audio_rate.h
     int (*buffered)(void);
     int (*get_desired_buffered)(void);
     void (*play)(const uint8_t *buf, size_t len);
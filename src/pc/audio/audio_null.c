@@ -1,19 +1,55 @@
+#ifndef TARGET_N3DS
+#include <time.h>
+#endif
+
 #include "macros.h"
 #include "audio_api.h"
 
+#ifndef TARGET_N3DS
+#include "audio_rate.h"
+
+// Pretends to play at the output rate, so that an audio thread is paced like with a real device
+#define PLAYBACK_RATE audio_rate_device()
+#define SAMPLES_DESIRED audio_rate_to_device(1100)
+
+static double sPlaybackEnd; // When everything played so far will have finished, in seconds
+
+static double audio_null_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+#endif
+
 static bool audio_null_init(void) {
     return true;
 }
 
 static int audio_null_buffered(void) {
+#ifndef TARGET_N3DS
+    double remaining = sPlaybackEnd - audio_null_now();
+    return remaining > 0.0 ? (int) (remaining * PLAYBACK_RATE) : 0;
+#else
     return 0;
+#endif
 }
 
 static int audio_null_get_desired_buffered(void) {
+#ifndef TARGET_N3DS
+    return SAMPLES_DESIRED;
+#else
     return 0;
+#endif
 }
 
 static void audio_null_play(UNUSED const uint8_t *buf, UNUSED size_t len) {
+#ifndef TARGET_N3DS
+    double now = audio_null_now();
+    if (sPlaybackEnd < now) {
+        sPlaybackEnd = now;
+    }
+    sPlaybackEnd += (double) (len / 4) / PLAYBACK_RATE;
+#endif
 }
 
 #ifdef TARGET_N3DS
@@ -0,0 +1,79 @@
+#include "audio_pacing.h"
+
+#define SAMPLE_RATE 32000
+#ifdef VERSION_EU
+#define BUFFERS_PER_SECOND 50
+#else
+#define BUFFERS_PER_SECOND 60
+#endif
+#define NOMINAL_BUFFER_LEN ((float) SAMPLE_RATE / BUFFERS_PER_SECOND)
+
+#define SMOOTHING 0.25f // Share of each new measurement in the smoothed queue
+#define PROPORTIONAL_GAIN (1.0f / 16) // Per buffer, so the error decays by 1/8 per frame
+#define INTEGRAL_GAIN (1.0f / 2048)
+#define MAX_INTEGRAL 24.0f // Drift between the frame rate and the device's clock, in samples per buffer
+
+struct AudioPacingStats gAudioPacingStats;
+
+static bool sStarted;
+static bool sDevicePaced;
+static float sSmoothedBuffered;
+static float sIntegral;
+static float sRemainder; // Rounding error carried to the next buffer
+
+static float clampf(float x, float lo, float hi) {
+    return x < lo ? lo : x > hi ? hi : x;
+}
+
+uint32_t audio_pacing_next_buffer_len(int buffered, int desired) {
+    struct AudioPacingStats *stats = &gAudioPacingStats;
+    int bin = buffered > 0 ? buffered / AUDIO_PACING_HISTOGRAM_STEP : 0;
+
+    if (buffered <= 0 && sStarted) {
+        stats->underruns++;
+    }
+    stats->frames++;
+    stats->histogram[bin < AUDIO_PACING_HISTOGRAM_BINS ? bin : AUDIO_PACING_HISTOGRAM_BINS - 1]++;
+    stats->target = desired;
+    stats->buffered = buffered;
+
+    if (!sStarted) {
+        sSmoothedBuffered = buffered;
+        sStarted = true;
+    }
+    sSmoothedBuffered += (buffered - sSmoothedBuffered) * SMOOTHING;
+    stats->latencyMs = sSmoothedBuffered * 1000.0f / SAMPLE_RATE;
+
+    float ideal = NOMINAL_BUFFER_LEN;
+    if (!sDevicePaced) {
+        float error = desired - sSmoothedBuffered;
+        sIntegral = clampf(sIntegral + error * INTEGRAL_GAIN, -MAX_INTEGRAL, MAX_INTEGRAL);
+        ideal = clampf(ideal + error * PROPORTIONAL_GAIN + sIntegral, AUDIO_PACING_MIN_BUFFER_LEN,
+                       AUDIO_PACING_MAX_BUFFER_LEN);
+    }
+    ideal += sRemainder;
+
+    uint32_t len = (uint32_t) (ideal / 16 + 0.5f) * 16;
+    if (len < AUDIO_PACING_MIN_BUFFER_LEN) {
+        len = AUDIO_PACING_MIN_BUFFER_LEN;
+    }
+    if (len > AUDIO_PACING_MAX_BUFFER_LEN) {
+        len = AUDIO_PACING_MAX_BUFFER_LEN;
+    }
+    sRemainder = clampf(ideal - len, -16.0f, 16.0f);
+
+    stats->bufferLen = len;
+    return len;
+}
+
+void audio_pacing_set_device_paced(bool enable) {
+    sDevicePaced = enable;
+}
+
+void audio_pacing_report_overrun(void) {
+    gAudioPacingStats.overruns++;
+}
+
+void audio_pacing_report_xrun(void) {
+    gAudioPacingStats.xruns++;
+}
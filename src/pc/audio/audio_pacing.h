@@ -0,0 +1,55 @@
+#ifndef AUDIO_PACING_H
+#define AUDIO_PACING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Chooses how many samples to synthesize into each audio buffer, so that the audio queued on the
+// device settles at the backend's desired amount instead of swinging around it.
+//
+// The queue is smoothed over a few frames, and buffers are lengthened or shortened in proportion
+// to how far it is from the target, plus a slowly integrated term that absorbs the difference
+// between the game's frame rate and the device's clock. Lengths are multiples of 16 within 5% of
+// the nominal length, and the fractional part is carried to the next buffer, so the average
+// length follows the controller exactly.
+
+#ifdef VERSION_EU
+#define AUDIO_PACING_MIN_BUFFER_LEN 624
+#define AUDIO_PACING_MAX_BUFFER_LEN 672
+#else
+#define AUDIO_PACING_MIN_BUFFER_LEN 512
+#define AUDIO_PACING_MAX_BUFFER_LEN 560
+#endif
+
+#define AUDIO_PACING_HISTOGRAM_BINS 16
+#define AUDIO_PACING_HISTOGRAM_STEP 256 // Samples per bin, the last bin holds everything above
+
+struct AudioPacingStats {
+    uint64_t frames;
+    uint64_t underruns; // Frames that found nothing queued, so the device had run dry
+    uint64_t overruns; // Buffers the backend dropped, or cut short, because its queue was full
+    uint64_t xruns; // Underruns the device reported itself, which can start and end between two frames
+    int32_t target; // Samples the backend wants queued
+    int32_t buffered; // Samples queued at the last frame
+    float latencyMs; // Smoothed queue, in milliseconds of audio
+    uint32_t bufferLen; // Samples per buffer chosen for the last frame
+    uint64_t histogram[AUDIO_PACING_HISTOGRAM_BINS]; // Frames by how many samples were queued
+};
+
+extern struct AudioPacingStats gAudioPacingStats;
+
+// Call once per frame before synthesizing, with the backend's buffered() and get_desired_buffered().
+// Returns the length of each of the frame's two buffers.
+uint32_t audio_pacing_next_buffer_len(int buffered, int desired);
+
+// For audio threads that synthesize whenever the device runs short. Their queue is already held at
+// the target, and since every buffer advances the sequences by the same number of ticks, buffers
+// have to average the nominal length to keep the music's tempo.
+void audio_pacing_set_device_paced(bool enable);
+
+// Called by backends that drop audio when their queue is full
+void audio_pacing_report_overrun(void);
+// Called by backends whose device reports running dry, such as ALSA's -EPIPE
+void audio_pacing_report_xrun(void);
+
+#endif // AUDIO_PACING_H
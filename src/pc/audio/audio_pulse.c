@@ -8,6 +8,8 @@
 
 #include "macros.h"
 #include "audio_api.h"
+#include "audio_pacing.h"
+#include "audio_rate.h"
 
 static struct {
     pa_mainloop *mainloop;
@@ -46,6 +48,10 @@ static void pas_stream_write_cb(UNUSED pa_stream *s, UNUSED size_t length, UNUSE
     //printf("write cb: %d %d\n", (int)length, (int)ws);
 }
 
+static void pas_server_info_cb(UNUSED pa_context *c, const pa_server_info *info, void *userdata) {
+    *(uint32_t *)userdata = info != NULL ? info->sample_spec.rate : AUDIO_RATE_GAME;
+}
+
 static bool audio_pulse_init(void) {
     // Create mainloop
     pas.mainloop = pa_mainloop_new();
@@ -74,17 +80,30 @@ static bool audio_pulse_init(void) {
         goto fail;
     }
     
+    // Without a rate in the config, play at the server's, so that it doesn't have to resample
+    uint32_t rate = audio_rate_requested();
+    if (rate == 0) {
+        pa_operation *op = pa_context_get_server_info(pas.context, pas_server_info_cb, &rate);
+        while (op != NULL && pa_operation_get_state(op) == PA_OPERATION_RUNNING) {
+            pa_mainloop_iterate(pas.mainloop, true, NULL);
+        }
+        if (op != NULL) {
+            pa_operation_unref(op);
+        }
+    }
+    audio_rate_set_device(rate);
+    
     // Create stream
     pa_sample_spec ss;
     ss.format = PA_SAMPLE_S16LE;
-    ss.rate = 32000;
+    ss.rate = audio_rate_device();
     ss.channels = 2;
     
     pa_buffer_attr attr;
-    attr.maxlength = (1600 + 544 + 528 + 1600) * 4;
-    attr.tlength = (528*2 + 544) * 4;
-    attr.prebuf = 1500 * 4;
-    attr.minreq = 161 * 4;
+    attr.maxlength = audio_rate_to_device(1600 + 544 + 528 + 1600) * 4;
+    attr.tlength = audio_rate_to_device(528*2 + 544) * 4;
+    attr.prebuf = audio_rate_to_device(1500) * 4;
+    attr.minreq = audio_rate_to_device(161) * 4;
     attr.fragsize = (uint32_t)-1;
     
     pas.stream = pa_stream_new(pas.context, "mario", &ss, NULL);
@@ -171,7 +190,7 @@ static int audio_pulse_buffered(void) {
 }
 
 static int audio_pulse_get_desired_buffered(void) {
-    return 1100;
+    return audio_rate_to_device(1100);
 }
 
 static void audio_pulse_play(const uint8_t *buf, size_t len) {
@@ -184,6 +203,7 @@ static void audio_pulse_play(const uint8_t *buf, size_t len) {
     size_t ws = pas.attr.maxlength - audio_pulse_buffered() * 4;
     if (ws < len) {
         //printf("Warning: can't write everything: %d vs %d\n", (int)len, (int)ws);
+        audio_pacing_report_overrun();
         len = ws;
     }
     if (pa_stream_write(pas.stream, buf, len, pas_write_complete, 0LL, PA_SEEK_RELATIVE) < 0) {
@@ -0,0 +1,203 @@
+#include <math.h>
+#include <string.h>
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#define AUDIO_RATE_SSE
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define AUDIO_RATE_NEON
+#endif
+
+#include "audio_rate.h"
+#include "audio_pacing.h"
+
+#define SINC_TAPS 32
+#define SINC_PHASES 256
+#define SINC_CENTER (SINC_TAPS / 2 - 1) // Tap that the output lines up with, at phase 0
+#define SINC_CUTOFF 0.9f // Of the lower of the two Nyquist frequencies
+#define HISTORY (SINC_TAPS - 1) // Samples kept from one call to the next
+#define MAX_INPUT (AUDIO_PACING_MAX_BUFFER_LEN * 2) // Converted at once, one frame's buffers
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static uint32_t sRequested = AUDIO_RATE_GAME;
+static uint32_t sDevice = AUDIO_RATE_GAME;
+static bool sSinc = true;
+static bool sKernelsReady;
+
+// One extra phase, so that the kernel can be interpolated past the last one
+static float sKernels[SINC_PHASES + 1][SINC_TAPS] __attribute__((aligned(16)));
+
+// Input as floats, after the last HISTORY samples of the previous call
+static float sLeft[HISTORY + MAX_INPUT] __attribute__((aligned(16)));
+static float sRight[HISTORY + MAX_INPUT] __attribute__((aligned(16)));
+
+static uint64_t sPosition; // Of the next output's first tap in sLeft/sRight, in 32.32 fixed point
+static uint64_t sStep = (uint64_t) 1 << 32;
+
+void audio_rate_configure(uint32_t rate, bool sinc) {
+    if (rate != 0 && (rate < AUDIO_RATE_MIN || rate > AUDIO_RATE_MAX)) {
+        rate = AUDIO_RATE_GAME;
+    }
+    sRequested = rate;
+    sSinc = sinc;
+    audio_rate_set_device(rate != 0 ? rate : AUDIO_RATE_GAME);
+}
+
+uint32_t audio_rate_requested(void) {
+    return sRequested;
+}
+
+static void build_kernels(void) {
+    // Lowpass below whichever Nyquist frequency is lower, relative to the input's
+    double cutoff = SINC_CUTOFF * (sDevice < AUDIO_RATE_GAME ? (double) sDevice / AUDIO_RATE_GAME : 1.0);
+
+    for (int phase = 0; phase <= SINC_PHASES; phase++) {
+        double sum = 0.0;
+        for (int tap = 0; tap < SINC_TAPS; tap++) {
+            double x = tap - SINC_CENTER - (double) phase / SINC_PHASES;
+            double sinc = x == 0.0 ? 1.0 : sin(M_PI * cutoff * x) / (M_PI * cutoff * x);
+            double w = M_PI * x / (SINC_TAPS / 2); // Blackman window, 0 at both ends
+            double window = 0.42 + 0.5 * cos(w) + 0.08 * cos(2.0 * w);
+            sKernels[phase][tap] = (float) (sinc * (window > 0.0 ? window : 0.0));
+            sum += sKernels[phase][tap];
+        }
+        // Unity gain at every phase, so that a constant input stays constant
+        for (int tap = 0; tap < SINC_TAPS; tap++) {
+            sKernels[phase][tap] = (float) (sKernels[phase][tap] / sum);
+        }
+    }
+    sKernelsReady = true;
+}
+
+void audio_rate_set_device(uint32_t rate) {
+    if (rate < AUDIO_RATE_MIN || rate > AUDIO_RATE_MAX) {
+        rate = AUDIO_RATE_GAME;
+    }
+    if (rate != sDevice) {
+        sKernelsReady = false;
+    }
+    sDevice = rate;
+    sStep = ((uint64_t) AUDIO_RATE_GAME << 32) / rate;
+}
+
+uint32_t audio_rate_device(void) {
+    return sDevice;
+}
+
+int audio_rate_to_device(int gameSamples) {
+    return (int) ((int64_t) gameSamples * sDevice / AUDIO_RATE_GAME);
+}
+
+int audio_rate_to_game(int deviceSamples) {
+    return (int) ((int64_t) deviceSamples * AUDIO_RATE_GAME / sDevice);
+}
+
+size_t audio_rate_max_output(size_t num_samples) {
+    return (size_t) (((uint64_t) num_samples * sDevice + AUDIO_RATE_GAME - 1) / AUDIO_RATE_GAME) + 1;
+}
+
+static int16_t to_s16(float sample) {
+    if (sample >= 32767.0f) {
+        return 32767;
+    }
+    if (sample <= -32768.0f) {
+        return -32768;
+    }
+    return (int16_t) (sample >= 0.0f ? sample + 0.5f : sample - 0.5f);
+}
+
+// Filters both channels with the kernel interpolated at the position's fraction
+static void filter_sinc(const float *left, const float *right, uint32_t fraction, int16_t *out) {
+    uint32_t phase = fraction >> (32 - 8); // log2(SINC_PHASES)
+    float blend = (float) (fraction & 0xffffff) * (1.0f / (1 << 24));
+    const float *k0 = sKernels[phase];
+    const float *k1 = sKernels[phase + 1];
+
+#if defined(AUDIO_RATE_SSE)
+    __m128 blendv = _mm_set1_ps(blend);
+    __m128 accl = _mm_setzero_ps();
+    __m128 accr = _mm_setzero_ps();
+    for (int i = 0; i < SINC_TAPS; i += 4) {
+        __m128 a = _mm_load_ps(k0 + i);
+        __m128 k = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(_mm_load_ps(k1 + i), a), blendv));
+        accl = _mm_add_ps(accl, _mm_mul_ps(_mm_loadu_ps(left + i), k));
+        accr = _mm_add_ps(accr, _mm_mul_ps(_mm_loadu_ps(right + i), k));
+    }
+    // Sum the four lanes of both: l0+l2, r0+r2, l1+l3, r1+r3, then the halves
+    __m128 sums = _mm_add_ps(_mm_unpacklo_ps(accl, accr), _mm_unpackhi_ps(accl, accr));
+    sums = _mm_add_ps(sums, _mm_movehl_ps(sums, sums));
+    float result[4];
+    _mm_storeu_ps(result, sums);
+    out[0] = to_s16(result[0]);
+    out[1] = to_s16(result[1]);
+#elif defined(AUDIO_RATE_NEON)
+    float32x4_t accl = vdupq_n_f32(0.0f);
+    float32x4_t accr = vdupq_n_f32(0.0f);
+    for (int i = 0; i < SINC_TAPS; i += 4) {
+        float32x4_t a = vld1q_f32(k0 + i);
+        float32x4_t k = vmlaq_n_f32(a, vsubq_f32(vld1q_f32(k1 + i), a), blend);
+        accl = vmlaq_f32(accl, vld1q_f32(left + i), k);
+        accr = vmlaq_f32(accr, vld1q_f32(right + i), k);
+    }
+    float32x2_t sums = vpadd_f32(vadd_f32(vget_low_f32(accl), vget_high_f32(accl)),
+                                 vadd_f32(vget_low_f32(accr), vget_high_f32(accr)));
+    out[0] = to_s16(vget_lane_f32(sums, 0));
+    out[1] = to_s16(vget_lane_f32(sums, 1));
+#else
+    float suml = 0.0f;
+    float sumr = 0.0f;
+    for (int i = 0; i < SINC_TAPS; i++) {
+        float k = k0[i] + (k1[i] - k0[i]) * blend;
+        suml += left[i] * k;
+        sumr += right[i] * k;
+    }
+    out[0] = to_s16(suml);
+    out[1] = to_s16(sumr);
+#endif
+}
+
+static void filter_linear(const float *left, const float *right, uint32_t fraction, int16_t *out) {
+    float blend = (float) (fraction >> 8) * (1.0f / (1 << 24));
+
+    // Same delay as the sinc filter
+    out[0] = to_s16(left[SINC_CENTER] + (left[SINC_CENTER + 1] - left[SINC_CENTER]) * blend);
+    out[1] = to_s16(right[SINC_CENTER] + (right[SINC_CENTER + 1] - right[SINC_CENTER]) * blend);
+}
+
+size_t audio_rate_convert(const int16_t *in, size_t num_samples, int16_t *out) {
+    size_t written = 0;
+
+    if (sSinc && !sKernelsReady) {
+        build_kernels();
+    }
+
+    while (num_samples > 0) {
+        size_t n = num_samples < MAX_INPUT ? num_samples : MAX_INPUT;
+        for (size_t i = 0; i < n; i++) {
+            sLeft[HISTORY + i] = in[i * 2];
+            sRight[HISTORY + i] = in[i * 2 + 1];
+        }
+
+        // Every output needs SINC_TAPS samples from its position on, HISTORY of which were kept
+        uint64_t end = (uint64_t) n << 32;
+        for (; sPosition < end; sPosition += sStep, written++) {
+            size_t i = (size_t) (sPosition >> 32);
+            if (sSinc) {
+                filter_sinc(sLeft + i, sRight + i, (uint32_t) sPosition, out + written * 2);
+            } else {
+                filter_linear(sLeft + i, sRight + i, (uint32_t) sPosition, out + written * 2);
+            }
+        }
+        sPosition -= end;
+
+        memmove(sLeft, sLeft + n, HISTORY * sizeof(float));
+        memmove(sRight, sRight + n, HISTORY * sizeof(float));
+        in += n * 2;
+        num_samples -= n;
+    }
+    return written;
+}
@@ -0,0 +1,52 @@
+#ifndef AUDIO_RATE_H
+#define AUDIO_RATE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Converts the game's 32 kHz output to the rate the audio device runs at, so that backends can
+// open the device at its native rate instead of having the OS resample behind them.
+//
+// The conversion is either linear, or a 32-tap windowed sinc whose kernel is interpolated between
+// 256 precomputed phases. The sinc leaves everything up to 12 kHz unchanged and rolls off above it,
+// which removes the images that linear interpolation lets through. Both run once per buffer after
+// create_next_audio_buffer and add 16 samples of latency. At the game's own rate nothing is
+// converted.
+//
+// Backends' buffered() and get_desired_buffered() count samples at the device's rate.
+
+#define AUDIO_RATE_GAME 32000
+#define AUDIO_RATE_MIN 8000
+#define AUDIO_RATE_MAX 192000
+
+// Call before initializing the backend. A rate of 0 asks for the device's native rate, rates
+// out of range fall back to the game's. Where the backend can't tell the native rate (ALSA
+// devices that run at several, SDL before 2.24), 0 means 48 kHz, or the nearest rate it accepts.
+void audio_rate_configure(uint32_t rate, bool sinc);
+
+// The rate backends should open the device at, or 0 if they should pick its native rate
+uint32_t audio_rate_requested(void);
+// For backends to report the rate they got. Defaults to the requested one, or the game's.
+void audio_rate_set_device(uint32_t rate);
+uint32_t audio_rate_device(void);
+
+// Converts between counts of samples at the game's and at the device's rate
+int audio_rate_to_device(int gameSamples);
+int audio_rate_to_game(int deviceSamples);
+
+// The most samples audio_rate_convert can write for num_samples of input
+size_t audio_rate_max_output(size_t num_samples);
+// Converts interleaved stereo samples at the game's rate, carrying the filter's state over from
+// the previous call. Returns how many stereo samples it wrote to out.
+size_t audio_rate_convert(const int16_t *in, size_t num_samples, int16_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AUDIO_RATE_H
@@ -7,6 +7,8 @@
 #endif
 
 #include "audio_api.h"
+#include "audio_pacing.h"
+#include "audio_rate.h"
 
 static SDL_AudioDeviceID dev;
 
@@ -17,16 +19,26 @@ static bool audio_sdl_init(void) {
     }
     SDL_AudioSpec want, have;
     SDL_zero(want);
-    want.freq = 32000;
+    // Without a rate in the config, ask for the default device's rate where SDL can tell, and let it
+    // open the device at whatever rate it runs at
+    want.freq = audio_rate_requested() != 0 ? audio_rate_requested() : 48000;
+#if SDL_VERSION_ATLEAST(2, 24, 0)
+    SDL_AudioSpec device;
+    if (audio_rate_requested() == 0 && SDL_GetDefaultAudioInfo(NULL, &device, 0) == 0 && device.freq > 0) {
+        want.freq = device.freq;
+    }
+#endif
     want.format = AUDIO_S16;
     want.channels = 2;
     want.samples = 512;
     want.callback = NULL;
-    dev = SDL_OpenAudioDevice(NULL, 0, &want, &have, 0);
+    dev = SDL_OpenAudioDevice(NULL, 0, &want, &have,
+                              audio_rate_requested() != 0 ? 0 : SDL_AUDIO_ALLOW_FREQUENCY_CHANGE);
     if (dev == 0) {
         fprintf(stderr, "SDL_OpenAudio error: %s\n", SDL_GetError());
         return false;
     }
+    audio_rate_set_device(have.freq);
     SDL_PauseAudioDevice(dev, 0);
     return true;
 }
@@ -36,13 +48,15 @@ static int audio_sdl_buffered(void) {
 }
 
 static int audio_sdl_get_desired_buffered(void) {
-    return 1100;
+    return audio_rate_to_device(1100);
 }
 
 static void audio_sdl_play(const uint8_t *buf, size_t len) {
-    if (audio_sdl_buffered() < 6000) {
+    if (audio_sdl_buffered() < audio_rate_to_device(6000)) {
         // Don't fill the audio buffer too much in case this happens
         SDL_QueueAudio(dev, buf, len);
+    } else {
+        audio_pacing_report_overrun();
     }
 }
 
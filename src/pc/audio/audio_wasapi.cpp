@@ -10,6 +10,7 @@
 #include <audioclient.h>
 
 #include "audio_api.h"
+#include "audio_rate.h"
 
 // These constants are currently missing from the MinGW headers.
 #ifndef AUDCLNT_STREAMFLAGS_AUTOCONVERTPCM
@@ -120,11 +121,21 @@ static bool audio_wasapi_setup_stream(void) {
         ThrowIfFailed(immdev_enumerator->GetDefaultAudioEndpoint(eRender, eConsole, &wasapi.device));
         ThrowIfFailed(wasapi.device->Activate(IID_IAudioClient, CLSCTX_ALL, nullptr, IID_PPV_ARGS_Helper(&wasapi.client)));
 
+        // Without a rate in the config, play at the mixer's, so that Windows doesn't have to resample
+        UINT32 rate = audio_rate_requested();
+        if (rate == 0) {
+            WAVEFORMATEX *mix_format;
+            ThrowIfFailed(wasapi.client->GetMixFormat(&mix_format));
+            rate = mix_format->nSamplesPerSec;
+            CoTaskMemFree(mix_format);
+        }
+        audio_rate_set_device(rate);
+
         WAVEFORMATEX desired;
         desired.wFormatTag = WAVE_FORMAT_PCM;
         desired.nChannels = 2;
-        desired.nSamplesPerSec = 32000;
-        desired.nAvgBytesPerSec = 32000 * 2 * 2;
+        desired.nSamplesPerSec = audio_rate_device();
+        desired.nAvgBytesPerSec = audio_rate_device() * 2 * 2;
         desired.nBlockAlign = 4;
         desired.wBitsPerSample = 16;
         desired.cbSize = 0;
@@ -161,7 +172,7 @@ static int audio_wasapi_buffered(void) {
 }
 
 static int audio_wasapi_get_desired_buffered(void) {
-    return 1100;
+    return audio_rate_to_device(1100);
 }
 
 //#include <stdio.h>
@@ -191,7 +202,7 @@ static void audio_wasapi_play(const uint8_t *buf, size_t len) {
         memcpy(data, buf, frames * 4);
         ThrowIfFailed(wasapi.rclient->ReleaseBuffer(frames, 0));
 
-        if (!wasapi.started && padding + frames > 1500) {
+        if (!wasapi.started && padding + frames > (UINT32) audio_rate_to_device(1500)) {
             wasapi.started = true;
             ThrowIfFailed(wasapi.client->Start());
         }
@@ -0,0 +1,74 @@
+#include <time.h>
+
+#include "audio_cmd_ring.h"
+
+#define AUDIO_CMD_RING_SIZE 1024 // Power of two
+
+struct AudioCmdRingStats gAudioCmdRingStats;
+
+static struct AudioCmd sAudioCmdRing[AUDIO_CMD_RING_SIZE];
+static uint32_t sAudioCmdWritePos; // Only written by the game thread
+static uint32_t sAudioCmdReadPos; // Only written by the audio thread
+static bool sAudioCmdRingEnabled;
+static _Thread_local bool sAudioCmdIsConsumer;
+
+void audio_cmd_ring_enable(void) {
+    sAudioCmdRingEnabled = true;
+}
+
+void audio_cmd_ring_set_consumer(void) {
+    sAudioCmdIsConsumer = true;
+}
+
+bool audio_cmd_ring_posting(void) {
+    return sAudioCmdRingEnabled && !sAudioCmdIsConsumer;
+}
+
+bool audio_cmd_ring_is_consumer(void) {
+    return sAudioCmdIsConsumer;
+}
+
+bool audio_cmd_ring_post(uint8_t op, uintptr_t arg0, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3) {
+    if (!audio_cmd_ring_posting()) {
+        return false;
+    }
+
+    uint32_t writePos = sAudioCmdWritePos;
+    uint32_t pending = writePos - __atomic_load_n(&sAudioCmdReadPos, __ATOMIC_ACQUIRE);
+
+    // Requests can't be dropped, so wait if the audio thread has fallen this far behind
+    if (pending == AUDIO_CMD_RING_SIZE) {
+        const struct timespec delay = { 0, 100000 };
+        gAudioCmdRingStats.stalls++;
+        do {
+            nanosleep(&delay, NULL);
+            pending = writePos - __atomic_load_n(&sAudioCmdReadPos, __ATOMIC_ACQUIRE);
+        } while (pending == AUDIO_CMD_RING_SIZE);
+    }
+
+    struct AudioCmd *cmd = &sAudioCmdRing[writePos % AUDIO_CMD_RING_SIZE];
+    cmd->op = op;
+    cmd->args[0] = arg0;
+    cmd->args[1] = arg1;
+    cmd->args[2] = arg2;
+    cmd->args[3] = arg3;
+    __atomic_store_n(&sAudioCmdWritePos, writePos + 1, __ATOMIC_RELEASE);
+
+    gAudioCmdRingStats.posted++;
+    if (pending + 1 > gAudioCmdRingStats.maxPending) {
+        gAudioCmdRingStats.maxPending = pending + 1;
+    }
+    return true;
+}
+
+void audio_cmd_ring_drain(void (*execute)(const struct AudioCmd *cmd)) {
+    uint32_t readPos = sAudioCmdReadPos;
+    uint32_t writePos = __atomic_load_n(&sAudioCmdWritePos, __ATOMIC_ACQUIRE);
+
+    while (readPos != writePos) {
+        execute(&sAudioCmdRing[readPos % AUDIO_CMD_RING_SIZE]);
+        readPos++;
+        // Free each slot as soon as it's done, so that a full ring doesn't wait for the whole batch
+        __atomic_store_n(&sAudioCmdReadPos, readPos, __ATOMIC_RELEASE);
+    }
+}
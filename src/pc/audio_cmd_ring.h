@@ -0,0 +1,53 @@
+#ifndef AUDIO_CMD_RING_H
+#define AUDIO_CMD_RING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Lock-free single-producer, single-consumer ring of sound requests from the game thread to an
+// audio thread that synthesizes continuously, instead of once per game frame.
+//
+// The game calls the functions in external.h as usual. Once the ring is enabled, each of them
+// posts itself here and returns, and the audio thread runs them in order before synthesizing
+// its next buffer. Calls made on the audio thread itself run immediately. The ring is disabled
+// by default, which keeps every call on the calling thread.
+//
+// The background music queue is the exception: play_music and the other queue functions keep
+// it on the game thread, where get_current_background_music reads it, and post only the
+// sequence changes they make.
+//
+// Not used by EU, which already queues its sequence commands in port_eu.c. On 3DS, only used when
+// built with N3DS_AUDIO_FREE_RUNNING; otherwise its audio thread synthesizes in step with the game.
+
+#if !defined(VERSION_EU) && (!defined(TARGET_N3DS) || defined(N3DS_AUDIO_FREE_RUNNING))
+#define AUDIO_CMD_RING
+#endif
+
+struct AudioCmd {
+    uint8_t op;
+    uintptr_t args[4];
+};
+
+struct AudioCmdRingStats {
+    uint64_t posted;
+    uint64_t stalls; // Posts that waited for the audio thread to make room
+    uint32_t maxPending;
+};
+
+extern struct AudioCmdRingStats gAudioCmdRingStats;
+
+// Call on the game thread once the audio thread is running, before any request it should run
+void audio_cmd_ring_enable(void);
+// Call on the audio thread before it runs anything
+void audio_cmd_ring_set_consumer(void);
+
+// Returns true if requests made on the calling thread are posted instead of run
+bool audio_cmd_ring_posting(void);
+// Returns true on the audio thread
+bool audio_cmd_ring_is_consumer(void);
+// Returns false if the caller should run the command itself
+bool audio_cmd_ring_post(uint8_t op, uintptr_t arg0, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3);
+// Runs execute on every posted command, in order. Audio thread only.
+void audio_cmd_ring_drain(void (*execute)(const struct AudioCmd *cmd));
+
+#endif // AUDIO_CMD_RING_H
@@ -0,0 +1,127 @@
+#include "audio_jobs.h"
+
+#ifdef AUDIO_PARALLEL_NOTES
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define MAX_AUDIO_THREADS 16
+
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    int numThreads;
+
+    // Guarded by lock
+    unsigned int batch;
+    int numBusyWorkers;
+
+    void (*job)(int index, void *arg);
+    void *arg;
+    int count;
+    int next; // Claimed with atomics
+} sAudioJobs = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .start = PTHREAD_COND_INITIALIZER,
+    .done = PTHREAD_COND_INITIALIZER,
+    .numThreads = 1,
+};
+
+static void audio_jobs_claim_all(void) {
+    int index;
+    while ((index = __atomic_fetch_add(&sAudioJobs.next, 1, __ATOMIC_RELAXED)) < sAudioJobs.count) {
+        sAudioJobs.job(index, sAudioJobs.arg);
+    }
+}
+
+static void *audio_jobs_worker(void *unused) {
+    unsigned int batch = 0;
+    (void) unused;
+
+    pthread_mutex_lock(&sAudioJobs.lock);
+    for (;;) {
+        while (sAudioJobs.batch == batch) {
+            pthread_cond_wait(&sAudioJobs.start, &sAudioJobs.lock);
+        }
+        batch = sAudioJobs.batch;
+        pthread_mutex_unlock(&sAudioJobs.lock);
+
+        audio_jobs_claim_all();
+
+        pthread_mutex_lock(&sAudioJobs.lock);
+        if (--sAudioJobs.numBusyWorkers == 0) {
+            pthread_cond_signal(&sAudioJobs.done);
+        }
+    }
+    return NULL;
+}
+
+void audio_jobs_init(int num_threads) {
+    if (num_threads <= 0) {
+        num_threads = sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (num_threads > MAX_AUDIO_THREADS) {
+        num_threads = MAX_AUDIO_THREADS;
+    }
+    // Workers are only ever added
+    while (sAudioJobs.numThreads < num_threads) {
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, audio_jobs_worker, NULL) != 0) {
+            break;
+        }
+        pthread_detach(thread);
+        sAudioJobs.numThreads++;
+    }
+}
+
+int audio_jobs_num_threads(void) {
+    return sAudioJobs.numThreads;
+}
+
+void audio_jobs_run(void (*job)(int index, void *arg), void *arg, int count) {
+    if (sAudioJobs.numThreads == 1) {
+        for (int i = 0; i < count; i++) {
+            job(i, arg);
+        }
+        return;
+    }
+
+    // Workers are all waiting for the next batch here, so nothing else reads these
+    pthread_mutex_lock(&sAudioJobs.lock);
+    sAudioJobs.job = job;
+    sAudioJobs.arg = arg;
+    sAudioJobs.count = count;
+    sAudioJobs.next = 0;
+    sAudioJobs.numBusyWorkers = sAudioJobs.numThreads - 1;
+    sAudioJobs.batch++;
+    pthread_cond_broadcast(&sAudioJobs.start);
+    pthread_mutex_unlock(&sAudioJobs.lock);
+
+    audio_jobs_claim_all();
+
+    pthread_mutex_lock(&sAudioJobs.lock);
+    while (sAudioJobs.numBusyWorkers != 0) {
+        pthread_cond_wait(&sAudioJobs.done, &sAudioJobs.lock);
+    }
+    pthread_mutex_unlock(&sAudioJobs.lock);
+}
+
+#else
+
+void audio_jobs_init(int num_threads) {
+    (void) num_threads;
+}
+
+int audio_jobs_num_threads(void) {
+    return 1;
+}
+
+void audio_jobs_run(void (*job)(int index, void *arg), void *arg, int count) {
+    for (int i = 0; i < count; i++) {
+        job(i, arg);
+    }
+}
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef AUDIO_JOBS_H
+#define AUDIO_JOBS_H
+
+// Worker threads that synthesis_process_notes renders notes on, when built with
+// AUDIO_PARALLEL_NOTES.
+//
+// A batch of jobs is split through a shared atomic index: the thread that runs the batch and
+// every worker keep claiming the next job until none are left, so threads that finish early take
+// over the jobs the others haven't reached. Each thread renders with its own emulated RSPA.
+
+// Starts num_threads - 1 workers, next to the thread that runs batches. 0 starts one per core,
+// 1 runs every job on the calling thread, as do builds without AUDIO_PARALLEL_NOTES.
+void audio_jobs_init(int num_threads);
+int audio_jobs_num_threads(void);
+
+// Runs job(index, arg) for every index below count, and returns once they are all done
+void audio_jobs_run(void (*job)(int index, void *arg), void *arg, int count);
+
+#endif // AUDIO_JOBS_H
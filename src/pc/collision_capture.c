@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "collision_capture.h"
+
+static struct {
+    bool initialized;
+    FILE *file;
+    bool limited;
+    uint32_t queries_left;
+} capture;
+
+static void collision_capture_close(void) {
+    if (capture.file != NULL) {
+        fclose(capture.file);
+        capture.file = NULL;
+    }
+}
+
+s32 collision_capture_open(const char *path) {
+    uint32_t header[2] = { COLLISION_CAPTURE_VERSION, sizeof(struct CollisionCaptureRecord) };
+
+    if (!capture.initialized) {
+        atexit(collision_capture_close);
+    }
+    capture.initialized = true;
+    collision_capture_close();
+
+    capture.file = fopen(path, "wb");
+    if (capture.file == NULL) {
+        fprintf(stderr, "collision_capture: could not open %s\n", path);
+        return false;
+    }
+    fwrite(COLLISION_CAPTURE_MAGIC, 1, 8, capture.file);
+    fwrite(header, sizeof(uint32_t), 2, capture.file);
+    return true;
+}
+
+static void collision_capture_init(void) {
+    const char *path = getenv("SM64_COLLISION_CAPTURE");
+    const char *queries = getenv("SM64_COLLISION_CAPTURE_QUERIES");
+
+    if (path == NULL) {
+        capture.initialized = true;
+        return;
+    }
+    capture.limited = queries != NULL && atoi(queries) > 0;
+    capture.queries_left = capture.limited ? (uint32_t) atoi(queries) : 0;
+    collision_capture_open(path);
+}
+
+static void collision_capture_write(const struct CollisionCaptureRecord *record) {
+    if (fwrite(record, sizeof(*record), 1, capture.file) != 1) {
+        fprintf(stderr, "collision_capture: write failed, stopping\n");
+        collision_capture_close();
+    }
+}
+
+void collision_capture_area(s16 level, s16 area) {
+    struct CollisionCaptureRecord record;
+
+    if (!capture.initialized) {
+        collision_capture_init();
+    }
+    if (capture.file == NULL) {
+        return;
+    }
+    memset(&record, 0, sizeof(record));
+    record.kind = COLLISION_CAPTURE_AREA;
+    record.level = level;
+    record.area = area;
+    collision_capture_write(&record);
+}
+
+void collision_capture_query(u8 kind, u8 flags, f32 x, f32 y, f32 z, f32 offsetY, f32 radius) {
+    struct CollisionCaptureRecord record;
+
+    if (!capture.initialized) {
+        collision_capture_init();
+    }
+    if (capture.file == NULL) {
+        return;
+    }
+    memset(&record, 0, sizeof(record));
+    record.kind = kind;
+    record.flags = flags;
+    record.x = x;
+    record.y = y;
+    record.z = z;
+    record.offsetY = offsetY;
+    record.radius = radius;
+    collision_capture_write(&record);
+
+    if (capture.limited && --capture.queries_left == 0) {
+        collision_capture_close();
+    }
+}
+
+u32 collision_capture_load(const char *path, struct CollisionCaptureRecord **records) {
+    FILE *f = fopen(path, "rb");
+    char magic[8];
+    uint32_t header[2];
+    long size;
+    u32 count;
+
+    if (f == NULL) {
+        return 0;
+    }
+    if (fread(magic, 1, 8, f) != 8 || memcmp(magic, COLLISION_CAPTURE_MAGIC, 8) != 0
+        || fread(header, sizeof(uint32_t), 2, f) != 2 || header[0] != COLLISION_CAPTURE_VERSION
+        || header[1] != sizeof(struct CollisionCaptureRecord)) {
+        fclose(f);
+        return 0;
+    }
+
+    // A capture cut short by the game exiting can end with part of a record, which is dropped
+    fseek(f, 0, SEEK_END);
+    size = ftell(f) - (long) (8 + sizeof(header));
+    fseek(f, 8 + sizeof(header), SEEK_SET);
+    count = size > 0 ? (u32) (size / sizeof(struct CollisionCaptureRecord)) : 0;
+
+    *records = malloc((count > 0 ? count : 1) * sizeof(struct CollisionCaptureRecord));
+    if (*records == NULL || fread(*records, sizeof(struct CollisionCaptureRecord), count, f) != count) {
+        free(*records);
+        *records = NULL;
+        count = 0;
+    }
+    fclose(f);
+    return count;
+}
@@ -0,0 +1,62 @@
+#ifndef COLLISION_CAPTURE_H
+#define COLLISION_CAPTURE_H
+
+#include <PR/ultratypes.h>
+
+// Collision query capture, replayed by tools/collision_bench.c.
+//
+// A capture file is a header followed by fixed-size records, until the end of the file.
+// An area record says which level area was loaded through load_area_terrain, and every query
+// record after it was made against that area's collision.
+//
+// Layout (native endianness):
+//   header:  char magic[8] "SM64COLC", u32 version, u32 record size
+//   record:  struct CollisionCaptureRecord
+
+#define COLLISION_CAPTURE_MAGIC "SM64COLC"
+#define COLLISION_CAPTURE_VERSION 1
+
+enum CollisionCaptureKind {
+    COLLISION_CAPTURE_FLOOR,
+    COLLISION_CAPTURE_CEIL,
+    COLLISION_CAPTURE_WALL,
+    COLLISION_CAPTURE_WATER,
+    COLLISION_CAPTURE_AREA
+};
+
+// State the query depended on besides its arguments
+#define COLLISION_CAPTURE_CAMERA               (1 << 0) // gCheckingSurfaceCollisionsForCamera
+#define COLLISION_CAPTURE_INCLUDE_INTANGIBLE   (1 << 1) // gFindFloorIncludeSurfaceIntangible
+#define COLLISION_CAPTURE_THROUGH_VANISH_WALLS (1 << 2) // The current object passes vanish cap walls
+
+struct CollisionCaptureRecord {
+    u8 kind;
+    u8 flags;
+    s16 level; // Area records only
+    s16 area;  // Area records only
+    s16 unused;
+    f32 x, y, z;
+    f32 offsetY, radius; // Wall records only
+};
+
+// Recording side, driven by surface_collision.c and surface_load.c. Configured through the environment:
+//   SM64_COLLISION_CAPTURE         output file; nothing is recorded if unset
+//   SM64_COLLISION_CAPTURE_QUERIES number of queries to record (default: until the game exits)
+// collision_capture_open starts recording to a file without looking at the environment.
+s32 collision_capture_open(const char *path);
+void collision_capture_area(s16 level, s16 area);
+void collision_capture_query(u8 kind, u8 flags, f32 x, f32 y, f32 z, f32 offsetY, f32 radius);
+
+// Replay side. Returns the number of records loaded, or 0 on failure.
+u32 collision_capture_load(const char *path, struct CollisionCaptureRecord **records);
+
+#ifdef ENABLE_COLLISION_CAPTURE
+#define COLLISION_CAPTURE_AREA_LOADED(level, area) collision_capture_area(level, area)
+#define COLLISION_CAPTURE_QUERY(kind, flags, x, y, z, offsetY, radius) \
+    collision_capture_query(kind, flags, x, y, z, offsetY, radius)
+#else
+#define COLLISION_CAPTURE_AREA_LOADED(level, area) do {} while (0)
+#define COLLISION_CAPTURE_QUERY(kind, flags, x, y, z, offsetY, radius) do {} while (0)
+#endif
+
+#endif
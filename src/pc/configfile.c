@@ -34,6 +34,17 @@ struct ConfigOption {
  *Config options and default values
  */
 bool configFullscreen            = false;
+#ifdef TARGET_N3DS
+unsigned int configTextureCacheKb = 8 * 1024;
+unsigned int configAdpcmCacheKb = 1024; // ADPCM decoding is expensive on 3DS
+#else
+unsigned int configTextureCacheKb = 64 * 1024;
+unsigned int configAdpcmCacheKb = 0;
+#endif
+unsigned int configAudioThreads = 1; // 0 is one per core
+bool configAudioThread = false;
+unsigned int configAudioOutputRate = 32000; // 0 is the device's native rate where the backend can tell, else 48 kHz
+bool configAudioSincResampler = true;
 
 #ifndef TARGET_N3DS
 // Keyboard mappings (scancode values)
@@ -79,6 +90,12 @@ unsigned int configKeyDRight     = 0;
 
 static const struct ConfigOption options[] = {
     {.name = "fullscreen",     .type = CONFIG_TYPE_BOOL, .boolValue = &configFullscreen},
+    {.name = "texture_cache_kb", .type = CONFIG_TYPE_UINT, .uintValue = &configTextureCacheKb},
+    {.name = "adpcm_cache_kb", .type = CONFIG_TYPE_UINT, .uintValue = &configAdpcmCacheKb},
+    {.name = "audio_threads",  .type = CONFIG_TYPE_UINT, .uintValue = &configAudioThreads},
+    {.name = "audio_thread",   .type = CONFIG_TYPE_BOOL, .boolValue = &configAudioThread},
+    {.name = "audio_output_rate", .type = CONFIG_TYPE_UINT, .uintValue = &configAudioOutputRate},
+    {.name = "audio_sinc_resampler", .type = CONFIG_TYPE_BOOL, .boolValue = &configAudioSincResampler},
     {.name = "key_a",          .type = CONFIG_TYPE_UINT, .uintValue = &configKeyA},
     {.name = "key_b",          .type = CONFIG_TYPE_UINT, .uintValue = &configKeyB},
     {.name = "key_start",      .type = CONFIG_TYPE_UINT, .uintValue = &configKeyStart},
@@ -2,6 +2,12 @@
 #define CONFIGFILE_H
 
 extern bool         configFullscreen;
+extern unsigned int configTextureCacheKb;
+extern unsigned int configAdpcmCacheKb;
+extern unsigned int configAudioThreads;
+extern bool         configAudioThread;
+extern unsigned int configAudioOutputRate;
+extern bool         configAudioSincResampler;
 extern unsigned int configKeyA;
 extern unsigned int configKeyB;
 extern unsigned int configKeyStart;
@@ -0,0 +1,375 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "gfx_capture.h"
+
+#define BLOB_ALIGNMENT 16
+
+#ifdef ENABLE_GFX_CAPTURE
+
+static const uint8_t zero_padding[8];
+
+struct CaptureRange {
+    uintptr_t start, end;
+};
+
+static struct {
+    bool initialized;
+    bool recording;
+    FILE *file;
+    uint32_t frame_index;
+    uint32_t first_frame;
+    uint32_t num_frames;
+    uint32_t frames_written;
+    const Gfx *root;
+
+    struct CaptureRange *ranges;
+    size_t num_ranges, ranges_capacity;
+
+    // Addresses of command words that hold pointers
+    const uintptr_t **pointers;
+    size_t num_pointers, pointers_capacity;
+} capture;
+
+static void *grow(void *buf, size_t *capacity, size_t count, size_t elem_size) {
+    if (count < *capacity) {
+        return buf;
+    }
+    *capacity = *capacity == 0 ? 1024 : *capacity * 2;
+    buf = realloc(buf, *capacity * elem_size);
+    if (buf == NULL) {
+        fprintf(stderr, "gfx_capture: out of memory\n");
+        abort();
+    }
+    return buf;
+}
+
+static void gfx_capture_init(void) {
+    const char *path = getenv("SM64_GFX_CAPTURE");
+    const char *start = getenv("SM64_GFX_CAPTURE_START");
+    const char *frames = getenv("SM64_GFX_CAPTURE_FRAMES");
+
+    capture.initialized = true;
+    if (path == NULL) {
+        return;
+    }
+
+    capture.first_frame = start != NULL ? (uint32_t) atoi(start) : 0;
+    capture.num_frames = frames != NULL && atoi(frames) > 0 ? (uint32_t) atoi(frames) : 1;
+
+    capture.file = fopen(path, "wb");
+    if (capture.file == NULL) {
+        fprintf(stderr, "gfx_capture: could not open %s\n", path);
+        return;
+    }
+
+    uint32_t header[3] = { GFX_CAPTURE_VERSION, sizeof(uintptr_t), 0 };
+    fwrite(GFX_CAPTURE_MAGIC, 1, 8, capture.file);
+    fwrite(header, sizeof(uint32_t), 3, capture.file);
+}
+
+void gfx_capture_range(const void *addr, size_t size) {
+    if (!capture.recording || addr == NULL || size == 0) {
+        return;
+    }
+    capture.ranges = grow(capture.ranges, &capture.ranges_capacity, capture.num_ranges, sizeof(struct CaptureRange));
+    capture.ranges[capture.num_ranges].start = (uintptr_t) addr;
+    capture.ranges[capture.num_ranges].end = (uintptr_t) addr + size;
+    capture.num_ranges++;
+}
+
+static void gfx_capture_pointer(const uintptr_t *word) {
+    capture.pointers = grow(capture.pointers, &capture.pointers_capacity, capture.num_pointers, sizeof(uintptr_t *));
+    capture.pointers[capture.num_pointers++] = word;
+}
+
+#define C0(pos, width) ((cmd->words.w0 >> (pos)) & ((1U << width) - 1))
+
+void gfx_capture_command(const Gfx *cmd) {
+    if (!capture.recording) {
+        return;
+    }
+
+    size_t num_words = 1;
+    uint8_t opcode = cmd->words.w0 >> 24;
+    const void *data = (const void *) cmd->words.w1;
+
+    switch (opcode) {
+        case G_MTX:
+            gfx_capture_pointer(&cmd->words.w1);
+            gfx_capture_range(data, sizeof(Mtx));
+            break;
+        case G_MOVEMEM:
+            gfx_capture_pointer(&cmd->words.w1);
+#ifdef F3DEX_GBI_2
+            gfx_capture_range(data, C0(0, 8) == G_MV_VIEWPORT ? sizeof(Vp_t) : sizeof(Light_t));
+#else
+            gfx_capture_range(data, C0(16, 8) == G_MV_VIEWPORT ? sizeof(Vp_t) : sizeof(Light_t));
+#endif
+            break;
+        case G_VTX:
+            gfx_capture_pointer(&cmd->words.w1);
+#ifdef F3DEX_GBI_2
+            gfx_capture_range(data, C0(12, 8) * sizeof(Vtx));
+#elif defined(F3DEX_GBI) || defined(F3DLP_GBI)
+            gfx_capture_range(data, C0(10, 6) * sizeof(Vtx));
+#else
+            gfx_capture_range(data, C0(0, 16));
+#endif
+            break;
+        case G_DL:
+        case G_SETTIMG:
+        case G_SETZIMG:
+        case G_SETCIMG:
+            // Targets are captured when they are actually read
+            gfx_capture_pointer(&cmd->words.w1);
+            break;
+        case G_TEXRECT:
+        case G_TEXRECTFLIP:
+            num_words = 3;
+            break;
+#ifdef F3DEX_GBI_2E
+        case G_FILLRECT:
+            num_words = 2;
+            break;
+#endif
+    }
+
+    gfx_capture_range(cmd, num_words * sizeof(Gfx));
+}
+
+#undef C0
+
+void gfx_capture_begin_frame(const Gfx *root) {
+    if (!capture.initialized) {
+        gfx_capture_init();
+    }
+
+    capture.recording = capture.file != NULL &&
+                        capture.frame_index >= capture.first_frame &&
+                        capture.frames_written < capture.num_frames;
+    capture.root = root;
+    capture.num_ranges = 0;
+    capture.num_pointers = 0;
+    capture.frame_index++;
+}
+
+static int compare_ranges(const void *a, const void *b) {
+    const struct CaptureRange *ra = a, *rb = b;
+    return ra->start < rb->start ? -1 : ra->start > rb->start;
+}
+
+static int compare_pointers(const void *a, const void *b) {
+    uintptr_t pa = (uintptr_t) *(const uintptr_t *const *) a;
+    uintptr_t pb = (uintptr_t) *(const uintptr_t *const *) b;
+    return pa < pb ? -1 : pa > pb;
+}
+
+// Binary search over the merged, sorted ranges
+static uint32_t find_blob(uintptr_t addr, uint32_t *offset) {
+    size_t lo = 0, hi = capture.num_ranges;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (capture.ranges[mid].end <= addr) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo < capture.num_ranges && capture.ranges[lo].start <= addr) {
+        *offset = addr - capture.ranges[lo].start;
+        return lo;
+    }
+    *offset = 0;
+    return GFX_CAPTURE_NO_BLOB;
+}
+
+void gfx_capture_end_frame(void) {
+    if (!capture.recording) {
+        return;
+    }
+    capture.recording = false;
+
+    // Merge overlapping ranges into blobs
+    qsort(capture.ranges, capture.num_ranges, sizeof(struct CaptureRange), compare_ranges);
+    size_t num_blobs = 0;
+    for (size_t i = 0; i < capture.num_ranges; i++) {
+        if (num_blobs > 0 && capture.ranges[i].start <= capture.ranges[num_blobs - 1].end) {
+            if (capture.ranges[i].end > capture.ranges[num_blobs - 1].end) {
+                capture.ranges[num_blobs - 1].end = capture.ranges[i].end;
+            }
+        } else {
+            capture.ranges[num_blobs++] = capture.ranges[i];
+        }
+    }
+    capture.num_ranges = num_blobs;
+
+    // The same command may run many times per frame
+    qsort(capture.pointers, capture.num_pointers, sizeof(uintptr_t *), compare_pointers);
+    size_t num_fixups = 0;
+    for (size_t i = 0; i < capture.num_pointers; i++) {
+        if (num_fixups == 0 || capture.pointers[i] != capture.pointers[num_fixups - 1]) {
+            capture.pointers[num_fixups++] = capture.pointers[i];
+        }
+    }
+    capture.num_pointers = num_fixups;
+
+    uint32_t frame_header[4];
+    frame_header[0] = num_blobs;
+    frame_header[1] = num_fixups;
+    frame_header[2] = find_blob((uintptr_t) capture.root, &frame_header[3]);
+    fwrite(frame_header, sizeof(uint32_t), 4, capture.file);
+
+    for (size_t i = 0; i < num_blobs; i++) {
+        uint32_t size = capture.ranges[i].end - capture.ranges[i].start;
+        uint32_t blob_header[2] = { size, capture.ranges[i].start % BLOB_ALIGNMENT };
+        fwrite(blob_header, sizeof(uint32_t), 2, capture.file);
+        fwrite((const void *) capture.ranges[i].start, 1, size, capture.file);
+        fwrite(zero_padding, 1, (8 - size % 8) % 8, capture.file);
+    }
+
+    for (size_t i = 0; i < num_fixups; i++) {
+        uint32_t fixup[4];
+        fixup[0] = find_blob((uintptr_t) capture.pointers[i], &fixup[1]);
+        fixup[2] = find_blob(*capture.pointers[i], &fixup[3]);
+        fwrite(fixup, sizeof(uint32_t), 4, capture.file);
+    }
+
+    capture.frames_written++;
+
+    // Keep the frame count in the header up to date so an interrupted run still leaves a valid file
+    long end = ftell(capture.file);
+    fseek(capture.file, 8 + 2 * sizeof(uint32_t), SEEK_SET);
+    fwrite(&capture.frames_written, sizeof(uint32_t), 1, capture.file);
+    fseek(capture.file, end, SEEK_SET);
+
+    if (capture.frames_written == capture.num_frames) {
+        fclose(capture.file);
+        capture.file = NULL;
+        printf("gfx_capture: wrote %u frames\n", capture.frames_written);
+    }
+}
+
+#endif
+
+static bool read_u32s(FILE *f, uint32_t *out, size_t count) {
+    return fread(out, sizeof(uint32_t), count, f) == count;
+}
+
+static bool skip_padding(FILE *f, uint32_t size) {
+    return fseek(f, (8 - size % 8) % 8, SEEK_CUR) == 0;
+}
+
+// A truncated or corrupt frame fails to load instead of replaying whatever was read
+static bool gfx_capture_load_frame(FILE *f, struct GfxCaptureFrame *frame) {
+    uint32_t frame_header[4];
+    if (!read_u32s(f, frame_header, 4)) {
+        return false;
+    }
+    uint32_t num_blobs = frame_header[0];
+    uint32_t num_fixups = frame_header[1];
+
+    size_t *offsets = malloc((num_blobs + 1) * sizeof(size_t));
+    uint32_t *sizes = malloc((num_blobs + 1) * sizeof(uint32_t));
+    long blobs_start = ftell(f);
+    if (offsets == NULL || sizes == NULL || blobs_start < 0) {
+        goto fail;
+    }
+
+    // First pass over the blobs to lay out the arena, keeping each blob's original alignment
+    size_t arena_size = 0;
+    for (uint32_t i = 0; i < num_blobs; i++) {
+        uint32_t blob_header[2];
+        if (!read_u32s(f, blob_header, 2) || blob_header[1] >= BLOB_ALIGNMENT
+            || fseek(f, blob_header[0], SEEK_CUR) != 0 || !skip_padding(f, blob_header[0])) {
+            goto fail;
+        }
+        arena_size = (arena_size + BLOB_ALIGNMENT - 1) & ~(size_t)(BLOB_ALIGNMENT - 1);
+        offsets[i] = arena_size + blob_header[1];
+        sizes[i] = blob_header[0];
+        arena_size = offsets[i] + blob_header[0];
+    }
+
+    // Rounded up past arena_size, so that a frame of empty blobs still gets an arena
+    frame->arena_size = arena_size;
+    frame->arena = aligned_alloc(BLOB_ALIGNMENT, (arena_size + BLOB_ALIGNMENT) & ~(size_t)(BLOB_ALIGNMENT - 1));
+    if (frame->arena == NULL || fseek(f, blobs_start, SEEK_SET) != 0) {
+        goto fail;
+    }
+    for (uint32_t i = 0; i < num_blobs; i++) {
+        uint32_t blob_header[2];
+        if (!read_u32s(f, blob_header, 2) || blob_header[0] != sizes[i]
+            || fread(frame->arena + offsets[i], 1, sizes[i], f) != sizes[i] || !skip_padding(f, sizes[i])) {
+            goto fail;
+        }
+    }
+
+    for (uint32_t i = 0; i < num_fixups; i++) {
+        uint32_t fixup[4];
+        if (!read_u32s(f, fixup, 4) || fixup[0] >= num_blobs || fixup[1] > sizes[fixup[0]]
+            || sizes[fixup[0]] - fixup[1] < sizeof(uintptr_t)
+            || (fixup[2] < num_blobs && fixup[3] > sizes[fixup[2]])) {
+            goto fail;
+        }
+        uintptr_t target = fixup[2] < num_blobs ? (uintptr_t)(frame->arena + offsets[fixup[2]] + fixup[3]) : 0;
+        memcpy(frame->arena + offsets[fixup[0]] + fixup[1], &target, sizeof(uintptr_t));
+    }
+
+    if (frame_header[2] >= num_blobs || frame_header[3] >= sizes[frame_header[2]]) {
+        goto fail;
+    }
+    frame->root = (Gfx *)(frame->arena + offsets[frame_header[2]] + frame_header[3]);
+    free(offsets);
+    free(sizes);
+    return true;
+
+fail:
+    free(offsets);
+    free(sizes);
+    free(frame->arena);
+    frame->arena = NULL;
+    frame->root = NULL;
+    return false;
+}
+
+uint32_t gfx_capture_load(const char *path, struct GfxCaptureFrame **frames) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return 0;
+    }
+
+    char magic[8];
+    uint32_t header[3];
+    if (fread(magic, 1, 8, f) != 8 || memcmp(magic, GFX_CAPTURE_MAGIC, 8) != 0 || !read_u32s(f, header, 3) ||
+        header[0] != GFX_CAPTURE_VERSION || header[1] != sizeof(uintptr_t)) {
+        fclose(f);
+        return 0;
+    }
+
+    uint32_t num_frames = header[2];
+    *frames = calloc(num_frames, sizeof(struct GfxCaptureFrame));
+    if (*frames == NULL) {
+        fclose(f);
+        return 0;
+    }
+    for (uint32_t i = 0; i < num_frames; i++) {
+        if (!gfx_capture_load_frame(f, &(*frames)[i])) {
+            gfx_capture_free(*frames, i + 1);
+            fclose(f);
+            return 0;
+        }
+    }
+
+    fclose(f);
+    return num_frames;
+}
+
+void gfx_capture_free(struct GfxCaptureFrame *frames, uint32_t num_frames) {
+    for (uint32_t i = 0; i < num_frames; i++) {
+        free(frames[i].arena);
+    }
+    free(frames);
+}
@@ -0,0 +1,73 @@
+#ifndef GFX_CAPTURE_H
+#define GFX_CAPTURE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef _LANGUAGE_C
+#define _LANGUAGE_C
+#endif
+#include <PR/gbi.h>
+
+// Display list capture and replay.
+//
+// A capture file holds one or more frames. Each frame is a self-contained snapshot of every
+// memory range the interpreter read while running that frame's display list: the commands
+// themselves, vertices, matrices, lights, viewports, textures and palettes. Pointers inside
+// commands are stored as (blob, offset) pairs so that a frame can be loaded anywhere.
+//
+// Layout (native endianness, all fields 32-bit unless noted):
+//   header:  char magic[8] "SM64GFXC", version, pointer size, num_frames
+//   frame:   num_blobs, num_fixups, root_blob, root_offset
+//            num_blobs x { size, alignment offset, data padded to 8 bytes }
+//            num_fixups x { blob, offset, target_blob, target_offset }
+// The alignment offset is the blob's start address modulo 16. The loader puts the blob at the
+// same offset from a 16-byte boundary, so it keeps its original alignment.
+// A fixup says that the pointer-sized word at (blob, offset) points to (target_blob, target_offset).
+// target_blob is GFX_CAPTURE_NO_BLOB for pointers to memory the interpreter never read,
+// such as the color and depth buffer addresses; these are replayed as NULL.
+
+#define GFX_CAPTURE_MAGIC "SM64GFXC"
+#define GFX_CAPTURE_VERSION 1
+#define GFX_CAPTURE_NO_BLOB 0xFFFFFFFF
+
+struct GfxCaptureFrame {
+    Gfx *root;
+    uint8_t *arena;
+    size_t arena_size;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Recording side, driven by gfx_pc.c. Configured through the environment:
+//   SM64_GFX_CAPTURE        output file; nothing is recorded if unset
+//   SM64_GFX_CAPTURE_START  index of the first frame to record (default 0)
+//   SM64_GFX_CAPTURE_FRAMES number of consecutive frames to record (default 1)
+void gfx_capture_begin_frame(const Gfx *root);
+void gfx_capture_command(const Gfx *cmd);
+void gfx_capture_range(const void *addr, size_t size);
+void gfx_capture_end_frame(void);
+
+// Replay side. Returns the number of frames loaded, or 0 on failure.
+uint32_t gfx_capture_load(const char *path, struct GfxCaptureFrame **frames);
+void gfx_capture_free(struct GfxCaptureFrame *frames, uint32_t num_frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef ENABLE_GFX_CAPTURE
+#define GFX_CAPTURE_BEGIN_FRAME(root) gfx_capture_begin_frame(root)
+#define GFX_CAPTURE_COMMAND(cmd) gfx_capture_command(cmd)
+#define GFX_CAPTURE_RANGE(addr, size) gfx_capture_range(addr, size)
+#define GFX_CAPTURE_END_FRAME() gfx_capture_end_frame()
+#else
+#define GFX_CAPTURE_BEGIN_FRAME(root) do {} while (0)
+#define GFX_CAPTURE_COMMAND(cmd) do {} while (0)
+#define GFX_CAPTURE_RANGE(addr, size) do {} while (0)
+#define GFX_CAPTURE_END_FRAME() do {} while (0)
+#endif
+
+#endif
@@ -11,12 +11,14 @@
 
 #include "gfx_cc.h"
 #include "gfx_rendering_api.h"
+#include "gfx_texture_pack.h"
 
 #include "gfx_citro3d.h"
 #include "color_conversion.h"
 
 #define TEXTURE_POOL_SIZE 4096
 #define FOG_LUT_SIZE 32
+#define IBO_SIZE (64 * 1024) // indices
 
 #define NTSC_FRAMERATE(fps) ((float) fps * (1000.0f / 1001.0f))
 
@@ -25,6 +27,7 @@ static Gfx3DSMode sCurrentGfx3DSMode = GFX_3DS_MODE_NORMAL;
 static DVLB_s* sVShaderDvlb;
 static shaderProgram_s sShaderProgram;
 static float* sVboBuffer;
+static u16* sIboBuffer;
 
 extern const u8 shader_shbin[];
 extern const u32 shader_shbin_size;
@@ -57,6 +60,8 @@ static C3D_Tex sTexturePool[TEXTURE_POOL_SIZE];
 static float sTexturePoolScaleS[TEXTURE_POOL_SIZE];
 static float sTexturePoolScaleT[TEXTURE_POOL_SIZE];
 static u32 sTextureIndex;
+static u32 sFreeTextures[TEXTURE_POOL_SIZE]; // Deleted ids, handed out again before new ones
+static u32 sFreeTextureCount;
 static int sTexUnits[2];
 
 static int sCurTex = 0;
@@ -64,6 +69,7 @@ static int sCurShader = 0;
 
 static int sVtxUnitSize = 0;
 static int sBufIdx = 0;
+static int sIboIdx = 0;
 
 static bool sDepthTestOn = false;
 static bool sDepthUpdateOn = true;
@@ -428,6 +434,8 @@ static void gfx_citro3d_shader_get_info(struct ShaderProgram *prg, uint8_t *num_
 
 static uint32_t gfx_citro3d_new_texture(void)
 {
+    if (sFreeTextureCount > 0)
+        return sFreeTextures[--sFreeTextureCount];
     if (sTextureIndex == TEXTURE_POOL_SIZE)
     {
         printf("Out of textures!\n");
@@ -436,6 +444,14 @@ static uint32_t gfx_citro3d_new_texture(void)
     return sTextureIndex++;
 }
 
+static void gfx_citro3d_delete_texture(uint32_t texture_id)
+{
+    if (sTexturePool[texture_id].data != NULL)
+        C3D_TexDelete(&sTexturePool[texture_id]);
+    sTexturePool[texture_id].data = NULL;
+    sFreeTextures[sFreeTextureCount++] = texture_id;
+}
+
 static void gfx_citro3d_select_texture(int tile, uint32_t texture_id)
 {
     C3D_TexBind(tile, &sTexturePool[texture_id]);
@@ -443,85 +459,31 @@ static void gfx_citro3d_select_texture(int tile, uint32_t texture_id)
     sTexUnits[tile] = texture_id;
 }
 
-static int sTileOrder[] =
+// Uploads a texture already in the GPU's layout, see gfx_texture_pack_tile
+static void gfx_citro3d_upload_tiled_texture(const uint8_t *tiled_buf, int width, int height)
 {
-    0,  1,   4,  5,
-    2,  3,   6,  7,
-
-    8,  9,  12, 13,
-    10, 11, 14, 15
-};
+    u32 tiledWidth, tiledHeight;
+    gfx_texture_pack_tiled_size(width, height, &tiledWidth, &tiledHeight);
+    sTexturePoolScaleS[sCurTex] = width / (float)tiledWidth;
+    sTexturePoolScaleT[sCurTex] = height / (float)tiledHeight;
 
-static void performTexSwizzle(const u8* src, u32* dst, u32 w, u32 h)
-{
-    int offs = 0;
-    for (u32 y = 0; y < h; y += 8)
-    {
-        for (u32 x = 0; x < w; x += 8)
-        {
-            for (int i = 0; i < 64; i++)
-            {
-                int x2 = i & 7;
-                int y2 = i >> 3;
-                int pos = sTileOrder[(x2 & 3) + ((y2 & 3) << 2)] + ((x2 >> 2) << 4) + ((y2 >> 2) << 5);
-                u32 c = ((const u32*)src)[(y + y2) * w + x + x2];
-                dst[offs + pos] = ((c & 0xFF) << 24) | (((c >> 8) & 0xFF) << 16) | (((c >> 16) & 0xFF) << 8) | (c >> 24);
-            }
-            dst += 64;
-        }
-    }
+    // Texture ids are recycled when the texture cache evicts, so free the previous contents
+    if (sTexturePool[sCurTex].data != NULL)
+        C3D_TexDelete(&sTexturePool[sCurTex]);
+    C3D_TexInit(&sTexturePool[sCurTex], tiledWidth, tiledHeight, GPU_RGBA8);
+    C3D_TexUpload(&sTexturePool[sCurTex], tiled_buf);
+    C3D_TexFlush(&sTexturePool[sCurTex]);
 }
 
 static void gfx_citro3d_upload_texture(const uint8_t *rgba32_buf, int width, int height)
 {
-    if (width < 8 || height < 8 || (width & (width - 1)) || (height & (height - 1)))
+    if (gfx_texture_pack_texels_size(GFX_TEXTURE_PACK_TILED, width, height) > sizeof(sTexBuf))
     {
-        u32 newWidth = width < 8 ? 8 : (1 << (32 - __builtin_clz(width - 1)));
-        u32 newHeight = height < 8 ? 8 : (1 << (32 - __builtin_clz(height - 1)));
-        if (newWidth * newHeight * 4 > sizeof(sTexBuf))
-        {
-            printf("Tex buffer overflow!\n");
-            return;
-        }
-        int offs = 0;
-        for (u32 y = 0; y < newHeight; y += 8)
-        {
-            for (u32 x = 0; x < newWidth; x += 8)
-            {
-                for (int i = 0; i < 64; i++)
-                {
-                    int x2 = i % 8;
-                    int y2 = i / 8;
-
-                    int realX = x + x2;
-                    if (realX >= width)
-                        realX -= width;
-
-                    int realY = y + y2;
-                    if (realY >= height)
-                        realY -= height;
-
-                    int pos = sTileOrder[x2 % 4 + y2 % 4 * 4] + 16 * (x2 / 4) + 32 * (y2 / 4);
-                    u32 c = ((u32*)rgba32_buf)[realY * width + realX];
-                    ((u32*)sTexBuf)[offs + pos] = ((c & 0xFF) << 24) | (((c >> 8) & 0xFF) << 16) | (((c >> 16) & 0xFF) << 8) | (c >> 24);
-                }
-                offs += 64;
-            }
-        }
-        sTexturePoolScaleS[sCurTex] = width / (float)newWidth;
-        sTexturePoolScaleT[sCurTex] = height / (float)newHeight;
-        width = newWidth;
-        height = newHeight;
-    }
-    else
-    {
-        sTexturePoolScaleS[sCurTex] = 1.f;
-        sTexturePoolScaleT[sCurTex] = 1.f;
-        performTexSwizzle(rgba32_buf, sTexBuf, width, height);
+        printf("Tex buffer overflow!\n");
+        return;
     }
-    C3D_TexInit(&sTexturePool[sCurTex], width, height, GPU_RGBA8);
-    C3D_TexUpload(&sTexturePool[sCurTex], sTexBuf);
-    C3D_TexFlush(&sTexturePool[sCurTex]);
+    gfx_texture_pack_tile(sTexBuf, rgba32_buf, width, height);
+    gfx_citro3d_upload_tiled_texture((const uint8_t *)sTexBuf, width, height);
 }
 
 static uint32_t gfx_cm_to_opengl(uint32_t val)
@@ -653,7 +615,7 @@ static u32 vec4ToU32Color(float r, float g, float b, float a)
 
 
 
-static void renderTwoColorTris(float buf_vbo[], size_t buf_vbo_len, size_t buf_vbo_num_tris)
+static void uploadTwoColorVertices(float buf_vbo[], size_t num_verts)
 {
     int offset = 0;
     float* dst = &((float*)sVboBuffer)[sBufIdx * VERTEX_SHADER_SIZE];
@@ -666,7 +628,7 @@ static void renderTwoColorTris(float buf_vbo[], size_t buf_vbo_len, size_t buf_v
     bool color0Constant = true;
     bool color1Constant = true;
     //determine which color is constant over all vertices
-    for (u32 i = 0; i < buf_vbo_num_tris * 3 && color0Constant && color1Constant; i++)
+    for (u32 i = 0; i < num_verts && color0Constant && color1Constant; i++)
     {
         int vtxOffs = 4;
         if (hasTex)
@@ -699,7 +661,7 @@ static void renderTwoColorTris(float buf_vbo[], size_t buf_vbo_len, size_t buf_v
     offset = 0;
     update_shader(!color1Constant);
     C3D_TexEnvColor(C3D_GetTexEnv(0), color1Constant ? firstColor1 : firstColor0);
-    for (u32 i = 0; i < 3 * buf_vbo_num_tris; i++)
+    for (u32 i = 0; i < num_verts; i++)
     {
         *dst++ = buf_vbo[offset + 0];
         *dst++ = buf_vbo[offset + 1];
@@ -735,22 +697,13 @@ static void renderTwoColorTris(float buf_vbo[], size_t buf_vbo_len, size_t buf_v
 
         offset += sVtxUnitSize;
     }
-
-    C3D_DrawArrays(GPU_TRIANGLES, sBufIdx, buf_vbo_num_tris * 3);
-    sBufIdx += buf_vbo_num_tris * 3;
 }
 
-static void gfx_citro3d_draw_triangles(float buf_vbo[], size_t buf_vbo_len, size_t buf_vbo_num_tris)
+static void uploadVertices(float buf_vbo[], size_t num_verts)
 {
-    if (sBufIdx * VERTEX_SHADER_SIZE > 1 * 1024 * 1024 / 4)
-    {
-        printf("Vertex buffer full!\n");
-        return;
-    }
-
     if (sShaderProgramPool[sCurShader].cc_features.num_inputs > 1)
     {
-        renderTwoColorTris(buf_vbo, buf_vbo_len, buf_vbo_num_tris);
+        uploadTwoColorVertices(buf_vbo, num_verts);
         return;
     }
 
@@ -759,7 +712,7 @@ static void gfx_citro3d_draw_triangles(float buf_vbo[], size_t buf_vbo_len, size
     bool hasTex = sShaderProgramPool[sCurShader].cc_features.used_textures[0] || sShaderProgramPool[sCurShader].cc_features.used_textures[1];
     bool hasColor = sShaderProgramPool[sCurShader].cc_features.num_inputs > 0;
     bool hasAlpha = sShaderProgramPool[sCurShader].cc_features.opt_alpha;
-    for (u32 i = 0; i < 3 * buf_vbo_num_tris; i++)
+    for (u32 i = 0; i < num_verts; i++)
     {
         *dst++ = buf_vbo[offset + 0];
         *dst++ = buf_vbo[offset + 1];
@@ -793,7 +746,17 @@ static void gfx_citro3d_draw_triangles(float buf_vbo[], size_t buf_vbo_len, size
 
         offset += sVtxUnitSize;
     }
+}
 
+static void gfx_citro3d_draw_triangles(float buf_vbo[], size_t buf_vbo_len, size_t buf_vbo_num_tris)
+{
+    if (sBufIdx * VERTEX_SHADER_SIZE > 1 * 1024 * 1024 / 4)
+    {
+        printf("Vertex buffer full!\n");
+        return;
+    }
+
+    uploadVertices(buf_vbo, buf_vbo_num_tris * 3);
     C3D_DrawArrays(GPU_TRIANGLES, sBufIdx, buf_vbo_num_tris * 3);
     sBufIdx += buf_vbo_num_tris * 3;
 }
@@ -828,6 +791,48 @@ static void gfx_citro3d_draw_triangles_helper(float buf_vbo[], size_t buf_vbo_le
     gfx_citro3d_draw_triangles(buf_vbo, buf_vbo_len, buf_vbo_num_tris);
 }
 
+static void gfx_citro3d_draw_indexed(float buf_vbo[], size_t buf_vbo_len, size_t buf_vbo_num_verts, const uint16_t buf_ibo[], size_t buf_vbo_num_tris)
+{
+    if (sBufIdx * VERTEX_SHADER_SIZE > 1 * 1024 * 1024 / 4)
+    {
+        printf("Vertex buffer full!\n");
+        return;
+    }
+    if (sIboIdx + buf_vbo_num_tris * 3 > IBO_SIZE)
+    {
+        printf("Index buffer full!\n");
+        return;
+    }
+
+    // Indices are relative to the start of the VBO
+    uploadVertices(buf_vbo, buf_vbo_num_verts);
+    u16* indices = &sIboBuffer[sIboIdx];
+    for (u32 i = 0; i < buf_vbo_num_tris * 3; i++)
+        indices[i] = sBufIdx + buf_ibo[i];
+
+    // Unlike draw_triangles, the vertices are uploaded once and drawn for both eyes
+    if (gGfx3DEnabled)
+    {
+        // left screen
+        stereoTilt(&projection, -iodZ, -iodW);
+        gfx_citro3d_frame_draw_on(gTarget);
+        C3D_DrawElements(GPU_TRIANGLES, buf_vbo_num_tris * 3, C3D_UNSIGNED_SHORT, indices);
+
+        // right screen
+        stereoTilt(&projection, iodZ, iodW);
+        gfx_citro3d_frame_draw_on(gTargetRight);
+        C3D_DrawElements(GPU_TRIANGLES, buf_vbo_num_tris * 3, C3D_UNSIGNED_SHORT, indices);
+    }
+    else
+    {
+        gfx_citro3d_frame_draw_on(gTarget);
+        C3D_DrawElements(GPU_TRIANGLES, buf_vbo_num_tris * 3, C3D_UNSIGNED_SHORT, indices);
+    }
+
+    sBufIdx += buf_vbo_num_verts;
+    sIboIdx += buf_vbo_num_tris * 3;
+}
+
 static void gfx_citro3d_init(void)
 {
     sVShaderDvlb = DVLB_ParseFile((__3ds_u32*)shader_shbin, shader_shbin_size);
@@ -848,6 +853,9 @@ static void gfx_citro3d_init(void)
     // Create 1MB VBO (vertex buffer object)
     sVboBuffer = linearAlloc(1 * 1024 * 1024);
 
+    // Index buffer for draw_indexed
+    sIboBuffer = linearAlloc(IBO_SIZE * sizeof(u16));
+
     // Configure buffers
     C3D_BufInfo* bufInfo = C3D_GetBufInfo();
     BufInfo_Init(bufInfo);
@@ -870,6 +878,7 @@ static void gfx_citro3d_start_frame(void)
     C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
 
     sBufIdx = 0;
+    sIboIdx = 0;
     scissor = false;
     // reset viewport if video mode changed
     if (gGfx3DSMode != sCurrentGfx3DSMode)
@@ -980,6 +989,8 @@ struct GfxRenderingAPI gfx_citro3d_api = {
     gfx_citro3d_new_texture,
     gfx_citro3d_select_texture,
     gfx_citro3d_upload_texture,
+    gfx_citro3d_delete_texture,
+    gfx_citro3d_upload_tiled_texture,
     gfx_citro3d_set_sampler_parameters,
     gfx_citro3d_set_depth_test,
     gfx_citro3d_set_depth_mask,
@@ -988,6 +999,7 @@ struct GfxRenderingAPI gfx_citro3d_api = {
     gfx_citro3d_set_scissor,
     gfx_citro3d_set_use_alpha,
     gfx_citro3d_draw_triangles_helper,
+    gfx_citro3d_draw_indexed,
     gfx_citro3d_init,
     gfx_citro3d_on_resize,
     gfx_citro3d_start_frame,
@@ -948,6 +948,8 @@ struct GfxRenderingAPI gfx_direct3d12_api = {
     gfx_direct3d12_new_texture,
     gfx_direct3d12_select_texture,
     gfx_direct3d12_upload_texture,
+    nullptr,
+    nullptr,
     gfx_direct3d12_set_sampler_parameters,
     gfx_direct3d12_set_depth_test,
     gfx_direct3d12_set_depth_mask,
@@ -956,6 +958,7 @@ struct GfxRenderingAPI gfx_direct3d12_api = {
     gfx_direct3d12_set_scissor,
     gfx_direct3d12_set_use_alpha,
     gfx_direct3d12_draw_triangles,
+    nullptr,
     gfx_direct3d12_init,
     gfx_direct3d12_on_resize,
     gfx_direct3d12_start_frame,
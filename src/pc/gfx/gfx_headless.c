@@ -0,0 +1,186 @@
+#ifdef ENABLE_HEADLESS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include <PR/gbi.h>
+
+#include "macros.h"
+#include "gfx_headless.h"
+#include "gfx_null.h"
+#include "gfx_pc.h"
+#include "gfx_screen_config.h"
+#include "../audio/audio_pacing.h"
+#include "../../game/area.h"
+#include "level_table.h"
+#ifdef PERSISTENT_DYNAMIC_SURFACES
+#include "../../engine/surface_load.h"
+#endif
+#ifdef OBJECT_COLLISION_GRID
+#include "../../game/object_collision.h"
+#endif
+
+// A window manager without a window. The main loop runs a fixed number of frames
+// as fast as possible and then reports what the null renderer saw.
+// With no controller input the game falls through to its attract-mode demos;
+// a cont.m64 next to the executable is picked up by controller_recorded_tas instead.
+
+#ifndef HEADLESS_FRAMES
+#define HEADLESS_FRAMES 1800
+#endif
+
+static uint32_t num_frames;
+
+// Texture dedup by the level it happened in, since the cache carries textures over between levels
+struct LevelDedupStats {
+    uint64_t misses;
+    uint64_t content_hits;
+    uint64_t hit_bytes;
+    uint64_t content_hit_bytes;
+};
+static struct LevelDedupStats level_dedup_stats[LEVEL_COUNT];
+static struct GfxTextureCacheStats level_start_stats;
+static s16 level_num;
+
+// Adds what the texture cache did since the last level change to the level it happened in
+static void gfx_headless_end_level(void) {
+    const struct GfxTextureCacheStats *tc = &gfx_texture_cache_stats;
+    if (level_num >= LEVEL_MIN && level_num < LEVEL_COUNT) {
+        struct LevelDedupStats *ls = &level_dedup_stats[level_num];
+        ls->misses += tc->misses - level_start_stats.misses;
+        ls->content_hits += tc->content_hits - level_start_stats.content_hits;
+        ls->hit_bytes += tc->hit_bytes - level_start_stats.hit_bytes;
+        ls->content_hit_bytes += tc->content_hit_bytes - level_start_stats.content_hit_bytes;
+    }
+    level_start_stats = *tc;
+    level_num = gCurrLevelNum;
+}
+
+static void gfx_headless_print_dedup(const char *label, uint64_t misses, uint64_t content_hits, uint64_t hit_bytes, uint64_t content_hit_bytes) {
+    printf("%s%llu content hits (%.1f%% of misses), saved %llu bytes by address, %llu by content\n", label,
+           (unsigned long long) content_hits, misses > 0 ? 100.0 * content_hits / misses : 0.0,
+           (unsigned long long) hit_bytes, (unsigned long long) content_hit_bytes);
+}
+
+static void gfx_headless_init(UNUSED const char *game_name, UNUSED bool start_in_fullscreen) {
+    const char *frames_env = getenv("SM64_HEADLESS_FRAMES");
+
+    num_frames = HEADLESS_FRAMES;
+    if (frames_env != NULL && atoi(frames_env) > 0) {
+        num_frames = atoi(frames_env);
+    }
+}
+
+static void gfx_headless_set_keyboard_callbacks(UNUSED bool (*on_key_down)(int scancode), UNUSED bool (*on_key_up)(int scancode), UNUSED void (*on_all_keys_up)(void)) {
+}
+
+static void gfx_headless_set_fullscreen_changed_callback(UNUSED void (*on_fullscreen_changed)(bool is_now_fullscreen)) {
+}
+
+static void gfx_headless_set_fullscreen(UNUSED bool enable) {
+}
+
+static double gfx_headless_get_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void gfx_headless_main_loop(void (*run_one_game_iter)(void)) {
+    double start = gfx_headless_get_time();
+
+    for (uint32_t i = 0; i < num_frames; i++) {
+        run_one_game_iter();
+        if (gCurrLevelNum != level_num) {
+            gfx_headless_end_level();
+        }
+    }
+    gfx_headless_end_level();
+
+    gfx_null_print_stats(gfx_headless_get_time() - start);
+
+    const struct GfxTextureCacheStats *tc = &gfx_texture_cache_stats;
+    printf("texture cache:    %llu hits, %llu misses, %llu evictions, %u entries, %u textures, %zu/%zu bytes\n",
+           (unsigned long long) tc->hits, (unsigned long long) tc->misses, (unsigned long long) tc->evictions,
+           tc->entries, tc->textures, tc->bytes, tc->budget);
+    gfx_headless_print_dedup("texture dedup:    ", tc->misses, tc->content_hits, tc->hit_bytes, tc->content_hit_bytes);
+    for (int i = LEVEL_MIN; i < LEVEL_COUNT; i++) {
+        const struct LevelDedupStats *ls = &level_dedup_stats[i];
+        if (ls->misses > 0 || ls->hit_bytes > 0) {
+            char label[32];
+            snprintf(label, sizeof(label), "  level %-10d", i);
+            gfx_headless_print_dedup(label, ls->misses, ls->content_hits, ls->hit_bytes, ls->content_hit_bytes);
+        }
+    }
+    printf("texture pack:     %llu hits\n", (unsigned long long) tc->pack_hits);
+
+    const struct GfxDrawStats *ds = &gfx_draw_stats;
+    uint64_t frames = gfx_null_stats.frames > 0 ? gfx_null_stats.frames : 1;
+    printf("draw merging:     %.1f batches merged into %.1f draws per frame\n",
+           (double) ds->batches / frames, (double) ds->draws / frames);
+
+    const struct AudioPacingStats *ap = &gAudioPacingStats;
+    printf("audio pacing:     %.1f ms queued (target %.1f ms), %llu underruns (%llu reported by the device), %llu overruns, "
+           "last buffers %u samples\n", ap->latencyMs, ap->target * 1000.0 / 32000, (unsigned long long) ap->underruns,
+           (unsigned long long) ap->xruns, (unsigned long long) ap->overruns, ap->bufferLen);
+    printf("audio queue:     ");
+    for (int i = 0; i < AUDIO_PACING_HISTOGRAM_BINS; i++) {
+        printf(" %llu", (unsigned long long) ap->histogram[i]);
+    }
+    printf(" frames by %d samples queued\n", AUDIO_PACING_HISTOGRAM_STEP);
+
+#ifdef PERSISTENT_DYNAMIC_SURFACES
+    const struct DynamicSurfaceStats *dss = &gDynamicSurfaceStats;
+    uint32_t surface_frames = dss->frames > 0 ? dss->frames : 1;
+    printf("object surfaces:  %.1f rebuilt, %.1f reused per frame\n",
+           (double) dss->totalRebuilt / surface_frames, (double) dss->totalReused / surface_frames);
+#ifdef CHECK_PERSISTENT_DYNAMIC_SURFACES
+    printf("                  %u of %u loads differ from a full rebuild\n", dss->mismatchedLoads, dss->checkedLoads);
+#endif
+#endif
+
+#ifdef OBJECT_COLLISION_GRID
+    const struct ObjectCollisionStats *ocs = &gObjectCollisionStats;
+    uint32_t collision_frames = ocs->frames > 0 ? ocs->frames : 1;
+    printf("object pairs:     %.1f in lists, %.1f tested, %.1f overlapping per frame, grid used %.1f%% of frames\n",
+           (double) ocs->totalListPairs / collision_frames, (double) ocs->totalCandidatePairs / collision_frames,
+           (double) ocs->totalOverlaps / collision_frames, 100.0 * ocs->gridFrames / collision_frames);
+#endif
+}
+
+static void gfx_headless_get_dimensions(uint32_t *width, uint32_t *height) {
+    *width = DESIRED_SCREEN_WIDTH;
+    *height = DESIRED_SCREEN_HEIGHT;
+}
+
+static void gfx_headless_handle_events(void) {
+}
+
+static bool gfx_headless_start_frame(void) {
+    return true;
+}
+
+static void gfx_headless_swap_buffers_begin(void) {
+}
+
+static void gfx_headless_swap_buffers_end(void) {
+}
+
+struct GfxWindowManagerAPI gfx_headless = {
+    gfx_headless_init,
+    gfx_headless_set_keyboard_callbacks,
+    gfx_headless_set_fullscreen_changed_callback,
+    gfx_headless_set_fullscreen,
+    gfx_headless_main_loop,
+    gfx_headless_get_dimensions,
+    gfx_headless_handle_events,
+    gfx_headless_start_frame,
+    gfx_headless_swap_buffers_begin,
+    gfx_headless_swap_buffers_end,
+    gfx_headless_get_time
+};
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef GFX_HEADLESS_H
+#define GFX_HEADLESS_H
+
+#include "gfx_window_manager_api.h"
+
+extern struct GfxWindowManagerAPI gfx_headless;
+
+#endif
@@ -0,0 +1,214 @@
+#ifdef ENABLE_HEADLESS
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "macros.h"
+#include "gfx_cc.h"
+#include "gfx_null.h"
+
+// A rendering backend that draws nothing. Every call is reduced to a counter, and all
+// vertex and texture data is folded into a checksum so that two runs can be compared
+// for identical output without a GPU.
+
+struct ShaderProgram {
+    uint32_t shader_id;
+    uint8_t num_inputs;
+    bool used_textures[2];
+};
+
+static struct ShaderProgram shader_program_pool[64];
+static uint8_t shader_program_pool_size;
+static uint32_t texture_count;
+
+struct GfxNullStats gfx_null_stats;
+
+#define FNV_PRIME 16777619U
+#define FNV_OFFSET_BASIS 2166136261U
+
+static uint32_t gfx_null_hash(uint32_t hash, const void *data, size_t len) {
+    const uint8_t *bytes = (const uint8_t *) data;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+static bool gfx_null_z_is_from_0_to_1(void) {
+    return false;
+}
+
+static void gfx_null_unload_shader(UNUSED struct ShaderProgram *old_prg) {
+}
+
+static void gfx_null_load_shader(UNUSED struct ShaderProgram *new_prg) {
+    gfx_null_stats.shader_loads++;
+}
+
+static struct ShaderProgram *gfx_null_create_and_load_new_shader(uint32_t shader_id) {
+    struct CCFeatures cc_features;
+    gfx_cc_get_features(shader_id, &cc_features);
+
+    struct ShaderProgram *prg = &shader_program_pool[shader_program_pool_size++];
+    prg->shader_id = shader_id;
+    prg->num_inputs = cc_features.num_inputs;
+    prg->used_textures[0] = cc_features.used_textures[0];
+    prg->used_textures[1] = cc_features.used_textures[1];
+
+    gfx_null_stats.shaders_created++;
+    gfx_null_load_shader(prg);
+    return prg;
+}
+
+static struct ShaderProgram *gfx_null_lookup_shader(uint32_t shader_id) {
+    for (size_t i = 0; i < shader_program_pool_size; i++) {
+        if (shader_program_pool[i].shader_id == shader_id) {
+            return &shader_program_pool[i];
+        }
+    }
+    return NULL;
+}
+
+static void gfx_null_shader_get_info(struct ShaderProgram *prg, uint8_t *num_inputs, bool used_textures[2]) {
+    *num_inputs = prg->num_inputs;
+    used_textures[0] = prg->used_textures[0];
+    used_textures[1] = prg->used_textures[1];
+}
+
+static uint32_t gfx_null_new_texture(void) {
+    gfx_null_stats.textures_created++;
+    return texture_count++;
+}
+
+static void gfx_null_delete_texture(UNUSED uint32_t texture_id) {
+    gfx_null_stats.textures_deleted++;
+}
+
+static void gfx_null_select_texture(UNUSED int tile, UNUSED uint32_t texture_id) {
+}
+
+static void gfx_null_upload_texture(const uint8_t *rgba32_buf, int width, int height) {
+    size_t size = (size_t) width * height * 4;
+    gfx_null_stats.texture_uploads++;
+    gfx_null_stats.texture_bytes += size;
+    gfx_null_stats.texture_checksum = gfx_null_hash(gfx_null_stats.texture_checksum, rgba32_buf, size);
+}
+
+static void gfx_null_set_sampler_parameters(UNUSED int tile, UNUSED bool linear_filter, UNUSED uint32_t cms, UNUSED uint32_t cmt) {
+    gfx_null_stats.state_changes++;
+}
+
+static void gfx_null_set_depth_test(UNUSED bool depth_test) {
+    gfx_null_stats.state_changes++;
+}
+
+static void gfx_null_set_depth_mask(UNUSED bool z_upd) {
+    gfx_null_stats.state_changes++;
+}
+
+static void gfx_null_set_zmode_decal(UNUSED bool zmode_decal) {
+    gfx_null_stats.state_changes++;
+}
+
+static void gfx_null_set_viewport(UNUSED int x, UNUSED int y, UNUSED int width, UNUSED int height) {
+    gfx_null_stats.state_changes++;
+}
+
+static void gfx_null_set_scissor(UNUSED int x, UNUSED int y, UNUSED int width, UNUSED int height) {
+    gfx_null_stats.state_changes++;
+}
+
+static void gfx_null_set_use_alpha(UNUSED bool use_alpha) {
+    gfx_null_stats.state_changes++;
+}
+
+static void gfx_null_draw_triangles(float buf_vbo[], size_t buf_vbo_len, size_t buf_vbo_num_tris) {
+    gfx_null_stats.draw_calls++;
+    gfx_null_stats.triangles += buf_vbo_num_tris;
+    gfx_null_stats.vbo_floats += buf_vbo_len;
+    gfx_null_stats.vbo_checksum = gfx_null_hash(gfx_null_stats.vbo_checksum, buf_vbo, buf_vbo_len * sizeof(float));
+}
+
+static void gfx_null_draw_indexed(float buf_vbo[], size_t buf_vbo_len, size_t buf_vbo_num_verts, const uint16_t buf_ibo[], size_t buf_vbo_num_tris) {
+    gfx_null_stats.draw_calls++;
+    gfx_null_stats.triangles += buf_vbo_num_tris;
+    gfx_null_stats.vbo_floats += buf_vbo_len;
+    gfx_null_stats.indices += 3 * buf_vbo_num_tris;
+
+    // Hash the vertices as draw_triangles would have seen them, so both paths give the same checksum
+    size_t num_floats = buf_vbo_len / buf_vbo_num_verts;
+    for (size_t i = 0; i < 3 * buf_vbo_num_tris; i++) {
+        gfx_null_stats.vbo_checksum = gfx_null_hash(gfx_null_stats.vbo_checksum, &buf_vbo[buf_ibo[i] * num_floats], num_floats * sizeof(float));
+    }
+}
+
+static void gfx_null_init(void) {
+    memset(&gfx_null_stats, 0, sizeof(gfx_null_stats));
+    gfx_null_stats.vbo_checksum = FNV_OFFSET_BASIS;
+    gfx_null_stats.texture_checksum = FNV_OFFSET_BASIS;
+}
+
+static void gfx_null_on_resize(void) {
+}
+
+static void gfx_null_start_frame(void) {
+    gfx_null_stats.frames++;
+}
+
+static void gfx_null_end_frame(void) {
+}
+
+static void gfx_null_finish_render(void) {
+}
+
+void gfx_null_print_stats(double elapsed_seconds) {
+    const struct GfxNullStats *s = &gfx_null_stats;
+    double fps = elapsed_seconds > 0.0 ? s->frames / elapsed_seconds : 0.0;
+
+    printf("frames:           %llu\n", (unsigned long long) s->frames);
+    printf("elapsed:          %.3f s (%.1f fps)\n", elapsed_seconds, fps);
+    printf("shaders created:  %llu\n", (unsigned long long) s->shaders_created);
+    printf("shader loads:     %llu\n", (unsigned long long) s->shader_loads);
+    printf("textures created: %llu\n", (unsigned long long) s->textures_created);
+    printf("textures deleted: %llu\n", (unsigned long long) s->textures_deleted);
+    printf("texture uploads:  %llu (%llu bytes)\n", (unsigned long long) s->texture_uploads, (unsigned long long) s->texture_bytes);
+    printf("state changes:    %llu\n", (unsigned long long) s->state_changes);
+    printf("draw calls:       %llu\n", (unsigned long long) s->draw_calls);
+    printf("triangles:        %llu\n", (unsigned long long) s->triangles);
+    printf("vbo floats:       %llu\n", (unsigned long long) s->vbo_floats);
+    printf("indices:          %llu\n", (unsigned long long) s->indices);
+    printf("vbo checksum:     %08x\n", s->vbo_checksum);
+    printf("texture checksum: %08x\n", s->texture_checksum);
+}
+
+struct GfxRenderingAPI gfx_null_api = {
+    gfx_null_z_is_from_0_to_1,
+    gfx_null_unload_shader,
+    gfx_null_load_shader,
+    gfx_null_create_and_load_new_shader,
+    gfx_null_lookup_shader,
+    gfx_null_shader_get_info,
+    gfx_null_new_texture,
+    gfx_null_select_texture,
+    gfx_null_upload_texture,
+    gfx_null_delete_texture,
+    NULL,
+    gfx_null_set_sampler_parameters,
+    gfx_null_set_depth_test,
+    gfx_null_set_depth_mask,
+    gfx_null_set_zmode_decal,
+    gfx_null_set_viewport,
+    gfx_null_set_scissor,
+    gfx_null_set_use_alpha,
+    gfx_null_draw_triangles,
+    gfx_null_draw_indexed,
+    gfx_null_init,
+    gfx_null_on_resize,
+    gfx_null_start_frame,
+    gfx_null_end_frame,
+    gfx_null_finish_render
+};
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef GFX_NULL_H
+#define GFX_NULL_H
+
+#include <stdint.h>
+
+#include "gfx_rendering_api.h"
+
+// Everything the null renderer was asked to do, for throughput measurements and determinism checks.
+struct GfxNullStats {
+    uint64_t frames;
+    uint64_t shaders_created;
+    uint64_t shader_loads;
+    uint64_t textures_created;
+    uint64_t textures_deleted;
+    uint64_t texture_uploads;
+    uint64_t texture_bytes;
+    uint64_t state_changes;
+    uint64_t draw_calls;
+    uint64_t triangles;
+    uint64_t vbo_floats;
+    uint64_t indices;
+    uint32_t vbo_checksum;
+    uint32_t texture_checksum;
+};
+
+extern struct GfxRenderingAPI gfx_null_api;
+extern struct GfxNullStats gfx_null_stats;
+
+void gfx_null_print_stats(double elapsed_seconds);
+
+#endif
@@ -45,6 +45,7 @@ struct ShaderProgram {
 static struct ShaderProgram shader_program_pool[64];
 static uint8_t shader_program_pool_size;
 static GLuint opengl_vbo;
+static GLuint opengl_ibo;
 
 static uint32_t frame_count;
 static uint32_t current_height;
@@ -402,6 +403,11 @@ static GLuint gfx_opengl_new_texture(void) {
     return ret;
 }
 
+static void gfx_opengl_delete_texture(uint32_t texture_id) {
+    GLuint id = texture_id;
+    glDeleteTextures(1, &id);
+}
+
 static void gfx_opengl_select_texture(int tile, GLuint texture_id) {
     glActiveTexture(GL_TEXTURE0 + tile);
     glBindTexture(GL_TEXTURE_2D, texture_id);
@@ -471,6 +477,12 @@ static void gfx_opengl_draw_triangles(float buf_vbo[], size_t buf_vbo_len, size_
     glDrawArrays(GL_TRIANGLES, 0, 3 * buf_vbo_num_tris);
 }
 
+static void gfx_opengl_draw_indexed(float buf_vbo[], size_t buf_vbo_len, size_t buf_vbo_num_verts, const uint16_t buf_ibo[], size_t buf_vbo_num_tris) {
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * buf_vbo_len, buf_vbo, GL_STREAM_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint16_t) * 3 * buf_vbo_num_tris, buf_ibo, GL_STREAM_DRAW);
+    glDrawElements(GL_TRIANGLES, 3 * buf_vbo_num_tris, GL_UNSIGNED_SHORT, NULL);
+}
+
 static void gfx_opengl_init(void) {
 #if FOR_WINDOWS
     glewInit();
@@ -479,6 +491,10 @@ static void gfx_opengl_init(void) {
     glGenBuffers(1, &opengl_vbo);
     
     glBindBuffer(GL_ARRAY_BUFFER, opengl_vbo);
+
+    glGenBuffers(1, &opengl_ibo);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, opengl_ibo);
     
     glDepthFunc(GL_LEQUAL);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -513,6 +529,8 @@ struct GfxRenderingAPI gfx_opengl_api = {
     gfx_opengl_new_texture,
     gfx_opengl_select_texture,
     gfx_opengl_upload_texture,
+    gfx_opengl_delete_texture,
+    NULL,
     gfx_opengl_set_sampler_parameters,
     gfx_opengl_set_depth_test,
     gfx_opengl_set_depth_mask,
@@ -521,6 +539,7 @@ struct GfxRenderingAPI gfx_opengl_api = {
     gfx_opengl_set_scissor,
     gfx_opengl_set_use_alpha,
     gfx_opengl_draw_triangles,
+    gfx_opengl_draw_indexed,
     gfx_opengl_init,
     gfx_opengl_on_resize,
     gfx_opengl_start_frame,
@@ -10,11 +10,14 @@
 #endif
 #include <PR/gbi.h>
 
+#include "macros.h"
 #include "gfx_pc.h"
 #include "gfx_cc.h"
 #include "gfx_window_manager_api.h"
 #include "gfx_rendering_api.h"
 #include "gfx_screen_config.h"
+#include "gfx_capture.h"
+#include "gfx_texture_pack.h"
 
 #ifdef TARGET_N3DS
 #include "gfx_3ds.h"
@@ -23,6 +26,10 @@
 #define profiler_3ds_log_time(id) do {} while (0)
 #endif
 
+#ifdef GFX_OPCODE_PROFILING
+#include <time.h>
+#endif
+
 #define SUPPORT_CHECK(x) assert(x)
 
 // SCALE_M_N: upscale/downscale M-bit integer to N-bit
@@ -42,6 +49,15 @@
 #define RATIO_Y (gfx_current_dimensions.height / (2.0f * HALF_SCREEN_HEIGHT))
 
 #define MAX_BUFFERED 256
+// Triangles and batches that can be held back for merging before they have to be drawn
+#define MAX_DEFERRED_TRIS 2048
+#define MAX_DEFERRED_BATCHES 256
+
+#ifdef TARGET_N3DS
+#define TEXTURE_CACHE_DEFAULT_BUDGET (8 * 1024 * 1024)
+#else
+#define TEXTURE_CACHE_DEFAULT_BUDGET (64 * 1024 * 1024)
+#endif
 #define MAX_LIGHTS 2
 #define MAX_VERTICES 64
 
@@ -62,26 +78,76 @@ struct LoadedVertex {
     uint8_t clip_rej;
 };
 
-struct TextureHashmapNode {
-    struct TextureHashmapNode *next;
+// A texture uploaded to the backend. Cached addresses whose texels decode to the same image share one.
+struct TextureContentNode {
+    struct TextureContentNode *next;
+    struct TextureContentNode *lru_prev, *lru_next; // Only linked while no address refers to it
 
-    const uint8_t *texture_addr;
+    uint64_t hash;
+    uint32_t tmem_size, line_size;
     uint8_t fmt, siz;
+    uint32_t refcount;
 
     uint32_t texture_id;
+    bool has_texture; // Cleared once the backend frees texture_id
+    uint32_t size_bytes; // Decoded to RGBA32
     uint8_t cms, cmt;
     bool linear_filter;
 };
+struct TextureHashmapNode {
+    struct TextureHashmapNode *next;
+    struct TextureHashmapNode *lru_prev, *lru_next; // Towards the most and least recently used
+
+    const uint8_t *texture_addr;
+    uint8_t fmt, siz;
+
+    struct TextureContentNode *content;
+};
 static struct {
     struct TextureHashmapNode *hashmap[1024];
     struct TextureHashmapNode pool[512];
     uint32_t pool_pos;
+    struct TextureHashmapNode *free_list;
+    struct TextureHashmapNode lru; // Sentinel: lru.lru_next is the most recently used node
+
+    // Second level, keyed by a hash of the loaded texels
+    struct TextureContentNode *content_hashmap[1024];
+    struct TextureContentNode content_pool[512];
+    uint32_t content_pool_pos;
+    struct TextureContentNode *content_free_list; // Reclaimed nodes, with their texture only if the backend can't delete it
+    struct TextureContentNode unreferenced; // Sentinel: unreferenced.lru_prev is reclaimed first
 } gfx_texture_cache;
 
+struct GfxTextureCacheStats gfx_texture_cache_stats = { .budget = TEXTURE_CACHE_DEFAULT_BUDGET };
+struct GfxDrawStats gfx_draw_stats;
+
+// Where each group of floats in a vertex's color inputs comes from
+enum CCEmitSource {
+    CC_EMIT_ZERO,
+    CC_EMIT_ONE,
+    CC_EMIT_PRIM,
+    CC_EMIT_SHADE,
+    CC_EMIT_ENV,
+    CC_EMIT_LOD,
+    CC_EMIT_NUM_SOURCES
+};
+
+// Copies count floats starting at channel first of an RGBA source into the VBO
+struct CCEmitOp {
+    uint8_t source, first, count;
+};
+
 struct ColorCombiner {
     uint32_t cc_id;
     struct ShaderProgram *prg;
     uint8_t shader_input_mapping[2][4];
+
+    // Precomputed by gfx_generate_cc so gfx_sp_tri1 doesn't have to decode the mapping per vertex
+    uint8_t num_inputs;
+    bool used_textures[2];
+    bool uses_shade, uses_lod;
+    uint8_t num_emit_ops;
+    struct CCEmitOp emit_ops[8];
 };
 
 static struct ColorCombiner color_combiner_pool[64];
@@ -113,6 +179,7 @@ static struct RSP {
 
 static struct RDP {
     const uint8_t *palette;
+    uint32_t palette_size_bytes;
     struct {
         const uint8_t *addr;
         uint8_t siz;
@@ -135,6 +202,7 @@ static struct RDP {
     uint32_t combine_mode;
 
     struct RGBA env_color, prim_color, fog_color, fill_color;
+    float env_color_f[4], prim_color_f[4], fog_color_f[3]; // Divided by 255, updated by the setters
     struct XYWidthHeight viewport, scissor;
     bool viewport_or_scissor_changed;
     void *z_buf_address;
@@ -149,22 +217,210 @@ static struct RenderingState {
     struct XYWidthHeight viewport, scissor;
     struct ShaderProgram *shader_program;
     struct TextureHashmapNode *textures[2];
+    struct TextureContentNode *bound_textures[2];
 } rendering_state;
 
+// Backend state that a batch of triangles is drawn with, other than the depth, blending, viewport
+// and scissor state in rendering_state, which every deferred batch shares
+struct BatchState {
+    struct ShaderProgram *shader_program;
+    struct TextureContentNode *textures[2]; // NULL if the combiner doesn't use the texture
+    bool linear_filter;
+    uint8_t cms, cmt;
+};
+
+// A finished batch whose vertices and indices are still in buf_vbo and buf_ibo
+struct DeferredBatch {
+    struct BatchState state;
+    uint32_t vbo_start, vbo_len;
+    uint32_t ibo_start;
+    uint16_t num_verts, num_tris;
+    bool drawn;
+};
+
 struct GfxDimensions gfx_current_dimensions;
 
 static bool dropped_frame;
 
-static float buf_vbo[MAX_BUFFERED * (26 * 3)]; // 3 vertices in a triangle and 26 floats per vtx
+// Holds the deferred batches followed by the current one, which starts at buf_vbo_batch_start
+static float buf_vbo[MAX_DEFERRED_TRIS * (26 * 3)]; // 3 vertices in a triangle and 26 floats per vtx
 static size_t buf_vbo_len;
-static size_t buf_vbo_num_tris;
+static size_t buf_vbo_batch_start;
+static size_t buf_vbo_num_tris; // In the current batch
+static size_t buf_vbo_num_verts;
+static uint16_t buf_ibo[MAX_DEFERRED_TRIS * 3]; // Indices are relative to the start of their batch
+static size_t buf_ibo_len;
+static size_t buf_ibo_batch_start;
+static struct BatchState buf_batch_state;
+
+static struct DeferredBatch deferred_batches[MAX_DEFERRED_BATCHES];
+static size_t num_deferred_batches;
+
+// Batches with the same state are copied together here
+static float merge_vbo[MAX_BUFFERED * (26 * 3)];
+static uint16_t merge_ibo[MAX_BUFFERED * 3];
+
+// Where each loaded vertex was emitted in buf_vbo, for renderers with draw_indexed.
+// An entry is valid while its generation matches buf_vbo_generation, which is bumped when a batch ends
+// and whenever state that gets baked into the emitted vertices changes.
+static struct {
+    uint32_t generation;
+    uint16_t index;
+} buf_vbo_vertex_cache[MAX_VERTICES + 4];
+static uint32_t buf_vbo_generation = 1;
+static struct ColorCombiner *buf_vbo_combiner;
 
 static struct GfxWindowManagerAPI *gfx_wapi;
 static struct GfxRenderingAPI *gfx_rapi;
 
+static void gfx_invalidate_vertex_cache(void) {
+    if (++buf_vbo_generation == 0) {
+        // Wrapped around, so stale entries could match again
+        memset(buf_vbo_vertex_cache, 0, sizeof(buf_vbo_vertex_cache));
+        buf_vbo_generation = 1;
+    }
+}
+
+#ifdef GFX_OPCODE_PROFILING
+bool gfx_draw_force_unsorted;
+#endif
+
+static bool gfx_batch_state_equal(const struct BatchState *a, const struct BatchState *b) {
+    return a->shader_program == b->shader_program && a->textures[0] == b->textures[0] && a->textures[1] == b->textures[1] &&
+           a->linear_filter == b->linear_filter && a->cms == b->cms && a->cmt == b->cmt;
+}
+
+static void gfx_select_texture(int tile, struct TextureContentNode *texture) {
+    gfx_rapi->select_texture(tile, texture->texture_id);
+    rendering_state.bound_textures[tile] = texture;
+}
+
+static void gfx_draw_batch(const struct BatchState *state, float vbo[], size_t vbo_len, size_t num_verts, const uint16_t ibo[], size_t num_tris) {
+    if (state->shader_program != rendering_state.shader_program) {
+        gfx_rapi->unload_shader(rendering_state.shader_program);
+        gfx_rapi->load_shader(state->shader_program);
+        rendering_state.shader_program = state->shader_program;
+    }
+    for (int i = 0; i < 2; i++) {
+        struct TextureContentNode *texture = state->textures[i];
+        if (texture == NULL) {
+            continue;
+        }
+        if (texture != rendering_state.bound_textures[i]) {
+            gfx_select_texture(i, texture);
+        }
+        if (state->linear_filter != texture->linear_filter || state->cms != texture->cms || state->cmt != texture->cmt) {
+            gfx_rapi->set_sampler_parameters(i, state->linear_filter, state->cms, state->cmt);
+            texture->linear_filter = state->linear_filter;
+            texture->cms = state->cms;
+            texture->cmt = state->cmt;
+        }
+    }
+
+    if (gfx_rapi->draw_indexed != NULL) {
+        gfx_rapi->draw_indexed(vbo, vbo_len, num_verts, ibo, num_tris);
+    } else {
+        gfx_rapi->draw_triangles(vbo, vbo_len, num_tris);
+    }
+    gfx_draw_stats.draws++;
+}
+
+// Draws the deferred batches, each state where it first appeared and its batches in their original order
+static void gfx_draw_deferred_batches(void) {
+    for (size_t i = 0; i < num_deferred_batches; i++) {
+        struct DeferredBatch *first = &deferred_batches[i];
+        if (first->drawn) {
+            continue;
+        }
+
+        size_t next = i + 1;
+#ifdef GFX_OPCODE_PROFILING
+        if (gfx_draw_force_unsorted) {
+            next = num_deferred_batches;
+        }
+#endif
+        while (next < num_deferred_batches && (deferred_batches[next].drawn || !gfx_batch_state_equal(&deferred_batches[next].state, &first->state))) {
+            next++;
+        }
+        if (next == num_deferred_batches) {
+            // Nothing to merge with, so draw it in place
+            gfx_draw_batch(&first->state, &buf_vbo[first->vbo_start], first->vbo_len, first->num_verts,
+                           &buf_ibo[first->ibo_start], first->num_tris);
+            continue;
+        }
+
+        size_t vbo_len = 0, num_verts = 0, num_tris = 0;
+        for (size_t j = i; j < num_deferred_batches; j++) {
+            struct DeferredBatch *batch = &deferred_batches[j];
+            if (batch->drawn || !gfx_batch_state_equal(&batch->state, &first->state)) {
+                continue;
+            }
+            if (num_tris + batch->num_tris > MAX_BUFFERED) {
+                gfx_draw_batch(&first->state, merge_vbo, vbo_len, num_verts, merge_ibo, num_tris);
+                vbo_len = num_verts = num_tris = 0;
+            }
+            memcpy(&merge_vbo[vbo_len], &buf_vbo[batch->vbo_start], batch->vbo_len * sizeof(float));
+            if (gfx_rapi->draw_indexed != NULL) {
+                for (size_t k = 0; k < 3U * batch->num_tris; k++) {
+                    merge_ibo[3 * num_tris + k] = buf_ibo[batch->ibo_start + k] + num_verts;
+                }
+            }
+            vbo_len += batch->vbo_len;
+            num_verts += batch->num_verts;
+            num_tris += batch->num_tris;
+            batch->drawn = true;
+        }
+        gfx_draw_batch(&first->state, merge_vbo, vbo_len, num_verts, merge_ibo, num_tris);
+    }
+
+    num_deferred_batches = 0;
+    buf_vbo_len = buf_vbo_batch_start = 0;
+    buf_ibo_len = buf_ibo_batch_start = 0;
+}
+
+// Batches of opaque geometry that is depth tested and writes depth look the same in any order.
+// Anything else keeps its display list order, which the master list's layers rely on.
+static bool gfx_batches_can_be_reordered(void) {
+    return rendering_state.depth_test && rendering_state.depth_mask && !rendering_state.decal_mode && !rendering_state.alpha_blend;
+}
+
+// Ends the current batch, which is held back if later batches may be merged with it
+static void gfx_end_batch(void) {
+    if (buf_vbo_num_tris == 0) {
+        return;
+    }
+
+    struct DeferredBatch *batch = &deferred_batches[num_deferred_batches++];
+    batch->state = buf_batch_state;
+    batch->vbo_start = buf_vbo_batch_start;
+    batch->vbo_len = buf_vbo_len - buf_vbo_batch_start;
+    batch->ibo_start = buf_ibo_batch_start;
+    batch->num_verts = buf_vbo_num_verts;
+    batch->num_tris = buf_vbo_num_tris;
+    batch->drawn = false;
+    gfx_draw_stats.batches++;
+
+    buf_vbo_batch_start = buf_vbo_len;
+    buf_ibo_batch_start = buf_ibo_len;
+    buf_vbo_num_tris = 0;
+    buf_vbo_num_verts = 0;
+    gfx_invalidate_vertex_cache();
+
+    if (!gfx_batches_can_be_reordered() || num_deferred_batches == MAX_DEFERRED_BATCHES) {
+        gfx_draw_deferred_batches();
+    }
+}
+
+// Draws everything buffered, before state that every batch shares changes
+static void gfx_flush(void) {
+    gfx_end_batch();
+    gfx_draw_deferred_batches();
+}
+
 #ifdef TARGET_N3DS
 static void gfx_set_2d(int mode_2d)
 {
+    gfx_flush();
     gfx_rapi->set_2d(mode_2d);
 }
 
@@ -193,18 +449,11 @@ static void gfx_set_iod(unsigned int iod)
             w = -128.0f;
             break;
     }
+    gfx_flush();
     gfx_rapi->set_iod(z, w);
 }
 #endif
 
-static void gfx_flush(void) {
-    if (buf_vbo_len > 0) {
-        gfx_rapi->draw_triangles(buf_vbo, buf_vbo_len, buf_vbo_num_tris);
-        buf_vbo_len = 0;
-        buf_vbo_num_tris = 0;
-    }
-}
-
 static struct ShaderProgram *gfx_lookup_or_create_shader_program(uint32_t shader_id) {
     struct ShaderProgram *prg = gfx_rapi->lookup_shader(shader_id);
     if (prg == NULL) {
@@ -215,6 +464,50 @@ static struct ShaderProgram *gfx_lookup_or_create_shader_program(uint32_t shader
     return prg;
 }
 
+static uint8_t gfx_cc_emit_source(uint8_t input) {
+    switch (input) {
+        case CC_PRIM:
+            return CC_EMIT_PRIM;
+        case CC_SHADE:
+            return CC_EMIT_SHADE;
+        case CC_ENV:
+            return CC_EMIT_ENV;
+        case CC_LOD:
+            return CC_EMIT_LOD;
+        default:
+            return CC_EMIT_ZERO;
+    }
+}
+
+// Flattens the shader input mapping into the list of copies gfx_sp_tri1 performs per vertex.
+// Each input is rgb from row 0 followed by alpha from row 1 when alpha is used;
+// adjacent copies from the same source are merged into one.
+static void gfx_generate_cc_emitter(struct ColorCombiner *comb, bool use_alpha, bool use_fog) {
+    comb->num_emit_ops = 0;
+    comb->uses_shade = false;
+    comb->uses_lod = false;
+    for (int j = 0; j < comb->num_inputs; j++) {
+        for (int k = 0; k < 1 + (use_alpha ? 1 : 0); k++) {
+            uint8_t source = gfx_cc_emit_source(comb->shader_input_mapping[k][j]);
+            if (k == 1 && use_fog && source == CC_EMIT_SHADE) {
+                // Shade alpha is 100% for fog
+                source = CC_EMIT_ONE;
+            }
+            comb->uses_shade |= source == CC_EMIT_SHADE;
+            comb->uses_lod |= source == CC_EMIT_LOD;
+
+            uint8_t first = k == 0 ? 0 : 3;
+            uint8_t count = k == 0 ? 3 : 1;
+            struct CCEmitOp *prev = comb->num_emit_ops > 0 ? &comb->emit_ops[comb->num_emit_ops - 1] : NULL;
+            if (prev != NULL && prev->source == source && prev->first + prev->count == first) {
+                prev->count += count;
+            } else {
+                comb->emit_ops[comb->num_emit_ops++] = (struct CCEmitOp) { source, first, count };
+            }
+        }
+    }
+}
+
 static void gfx_generate_cc(struct ColorCombiner *comb, uint32_t cc_id) {
     uint8_t c[2][4];
     uint32_t shader_id = (cc_id >> 24) << 24;
@@ -260,6 +553,8 @@ static void gfx_generate_cc(struct ColorCombiner *comb, uint32_t cc_id) {
     comb->cc_id = cc_id;
     comb->prg = gfx_lookup_or_create_shader_program(shader_id);
     memcpy(comb->shader_input_mapping, shader_input_mapping, sizeof(shader_input_mapping));
+    gfx_rapi->shader_get_info(comb->prg, &comb->num_inputs, comb->used_textures);
+    gfx_generate_cc_emitter(comb, (cc_id & SHADER_OPT_ALPHA) != 0, (cc_id & SHADER_OPT_FOG) != 0);
 }
 
 static struct ColorCombiner *gfx_lookup_or_create_color_combiner(uint32_t cc_id) {
@@ -279,55 +574,257 @@ static struct ColorCombiner *gfx_lookup_or_create_color_combiner(uint32_t cc_id)
     return prev_combiner = comb;
 }
 
+static size_t gfx_texture_cache_hash(const uint8_t *orig_addr) {
+    return ((uintptr_t)orig_addr >> 5) & 0x3ff;
+}
+
+static void gfx_texture_cache_lru_unlink(struct TextureHashmapNode *node) {
+    node->lru_prev->lru_next = node->lru_next;
+    node->lru_next->lru_prev = node->lru_prev;
+}
+
+static void gfx_texture_cache_lru_push_front(struct TextureHashmapNode *node) {
+    node->lru_prev = &gfx_texture_cache.lru;
+    node->lru_next = gfx_texture_cache.lru.lru_next;
+    node->lru_next->lru_prev = node;
+    gfx_texture_cache.lru.lru_next = node;
+}
+
+static void gfx_texture_content_lru_unlink(struct TextureContentNode *content) {
+    content->lru_prev->lru_next = content->lru_next;
+    content->lru_next->lru_prev = content->lru_prev;
+}
+
+static void gfx_texture_content_lru_push_front(struct TextureContentNode *content) {
+    content->lru_prev = &gfx_texture_cache.unreferenced;
+    content->lru_next = gfx_texture_cache.unreferenced.lru_next;
+    content->lru_next->lru_prev = content;
+    gfx_texture_cache.unreferenced.lru_next = content;
+}
+
+// Unreferenced textures stay uploaded so that their texels can be matched again later
+static void gfx_texture_content_release(struct TextureContentNode *content) {
+    if (--content->refcount == 0) {
+        gfx_texture_content_lru_push_front(content);
+    }
+}
+
+// Drops the unreferenced texture that has been unused the longest and frees its backend texture.
+// Backends that can't delete textures have it overwritten by whichever texture reuses the node.
+static bool gfx_texture_cache_reclaim_one(void) {
+    struct TextureContentNode *content = gfx_texture_cache.unreferenced.lru_prev;
+    if (content == &gfx_texture_cache.unreferenced) {
+        return false;
+    }
+
+    // Deferred batches may still draw with it
+    gfx_flush();
+    if (gfx_rapi->delete_texture != NULL) {
+        gfx_rapi->delete_texture(content->texture_id);
+        content->has_texture = false;
+    }
+    for (int i = 0; i < 2; i++) {
+        if (rendering_state.bound_textures[i] == content) {
+            rendering_state.bound_textures[i] = NULL;
+        }
+    }
+
+    struct TextureContentNode **link = &gfx_texture_cache.content_hashmap[content->hash & 0x3ff];
+    while (*link != content) {
+        link = &(*link)->next;
+    }
+    *link = content->next;
+    gfx_texture_content_lru_unlink(content);
+
+    content->next = gfx_texture_cache.content_free_list;
+    gfx_texture_cache.content_free_list = content;
+
+    gfx_texture_cache_stats.textures--;
+    gfx_texture_cache_stats.bytes -= content->size_bytes;
+    gfx_texture_cache_stats.evictions++;
+    return true;
+}
+
+// Drops the least recently used address, other than the ones bound for the current draw
+static bool gfx_texture_cache_evict_one(void) {
+    struct TextureHashmapNode *node = gfx_texture_cache.lru.lru_prev;
+    while (node != &gfx_texture_cache.lru && (node == rendering_state.textures[0] || node == rendering_state.textures[1])) {
+        node = node->lru_prev;
+    }
+    if (node == &gfx_texture_cache.lru) {
+        return false;
+    }
+
+    struct TextureHashmapNode **link = &gfx_texture_cache.hashmap[gfx_texture_cache_hash(node->texture_addr)];
+    while (*link != node) {
+        link = &(*link)->next;
+    }
+    *link = node->next;
+    gfx_texture_cache_lru_unlink(node);
+
+    node->next = gfx_texture_cache.free_list;
+    gfx_texture_cache.free_list = node;
+
+    gfx_texture_content_release(node->content);
+    gfx_texture_cache_stats.entries--;
+    return true;
+}
+
+static void gfx_texture_cache_enforce_budget(void) {
+    while (gfx_texture_cache_stats.bytes > gfx_texture_cache_stats.budget && (gfx_texture_cache_reclaim_one() || gfx_texture_cache_evict_one())) {
+    }
+}
+
+void gfx_texture_cache_set_budget(size_t bytes) {
+    gfx_flush();
+    gfx_texture_cache_stats.budget = bytes;
+    gfx_texture_cache_enforce_budget();
+}
+
+// Returns false if the texture still has to be converted and uploaded to the selected backend texture
 static bool gfx_texture_cache_lookup(int tile, struct TextureHashmapNode **n, const uint8_t *orig_addr, uint32_t fmt, uint32_t siz) {
-    size_t hash = (uintptr_t)orig_addr;
-    hash = (hash >> 5) & 0x3ff;
-    struct TextureHashmapNode **node = &gfx_texture_cache.hashmap[hash];
-    while (*node != NULL && *node - gfx_texture_cache.pool < (int)gfx_texture_cache.pool_pos) {
-        if ((*node)->texture_addr == orig_addr && (*node)->fmt == fmt && (*node)->siz == siz) {
-            gfx_rapi->select_texture(tile, (*node)->texture_id);
-            *n = *node;
+    size_t hash = gfx_texture_cache_hash(orig_addr);
+    struct TextureHashmapNode *node = gfx_texture_cache.hashmap[hash];
+    while (node != NULL) {
+        if (node->texture_addr == orig_addr && node->fmt == fmt && node->siz == siz) {
+            gfx_select_texture(tile, node->content);
+            gfx_texture_cache_lru_unlink(node);
+            gfx_texture_cache_lru_push_front(node);
+            gfx_texture_cache_stats.hits++;
+            gfx_texture_cache_stats.hit_bytes += node->content->size_bytes;
+            *n = node;
             return true;
         }
-        node = &(*node)->next;
-    }
-    if (gfx_texture_cache.pool_pos == sizeof(gfx_texture_cache.pool) / sizeof(struct TextureHashmapNode)) {
-        // Pool is full. We just invalidate everything and start over.
-        gfx_texture_cache.pool_pos = 0;
-        node = &gfx_texture_cache.hashmap[hash];
-        //puts("Clearing texture cache");
-    }
-    *node = &gfx_texture_cache.pool[gfx_texture_cache.pool_pos++];
-    if ((*node)->texture_addr == NULL) {
-        (*node)->texture_id = gfx_rapi->new_texture();
-    }
-    gfx_rapi->select_texture(tile, (*node)->texture_id);
-    gfx_rapi->set_sampler_parameters(tile, false, 0, 0);
-    (*node)->cms = 0;
-    (*node)->cmt = 0;
-    (*node)->linear_filter = false;
-    (*node)->next = NULL;
-    (*node)->texture_addr = orig_addr;
-    (*node)->fmt = fmt;
-    (*node)->siz = siz;
-    *n = *node;
-    return false;
+        node = node->next;
+    }
+    gfx_texture_cache_stats.misses++;
+
+    // The address is new, but the same texels may have been uploaded before
+    uint32_t tmem_size = rdp.loaded_texture[tile].size_bytes;
+    uint32_t line_size = rdp.texture_tile.line_size_bytes;
+    uint64_t content_hash = gfx_texture_pack_key(rdp.loaded_texture[tile].addr, tmem_size, fmt, siz, rdp.palette, rdp.palette_size_bytes);
+    struct TextureContentNode *content = gfx_texture_cache.content_hashmap[content_hash & 0x3ff];
+    while (content != NULL && !(content->hash == content_hash && content->fmt == fmt && content->siz == siz &&
+                                content->tmem_size == tmem_size && content->line_size == line_size)) {
+        content = content->next;
+    }
+
+    bool found = content != NULL;
+    if (found) {
+        if (content->refcount++ == 0) {
+            gfx_texture_content_lru_unlink(content);
+        }
+        gfx_select_texture(tile, content);
+        gfx_texture_cache_stats.content_hits++;
+        gfx_texture_cache_stats.content_hit_bytes += content->size_bytes;
+    } else {
+        while (gfx_texture_cache.content_free_list == NULL) {
+            if (gfx_texture_cache.content_pool_pos < sizeof(gfx_texture_cache.content_pool) / sizeof(struct TextureContentNode)) {
+                content = &gfx_texture_cache.content_pool[gfx_texture_cache.content_pool_pos++];
+                content->has_texture = false;
+                content->next = gfx_texture_cache.content_free_list;
+                gfx_texture_cache.content_free_list = content;
+            } else if (!gfx_texture_cache_reclaim_one()) {
+                // Every texture is in use, dropping an address releases one
+                gfx_texture_cache_evict_one();
+            }
+        }
+        content = gfx_texture_cache.content_free_list;
+        gfx_texture_cache.content_free_list = content->next;
+        if (!content->has_texture) {
+            content->texture_id = gfx_rapi->new_texture();
+            content->has_texture = true;
+        }
+
+        gfx_select_texture(tile, content);
+        gfx_rapi->set_sampler_parameters(tile, false, 0, 0);
+        content->cms = 0;
+        content->cmt = 0;
+        content->linear_filter = false;
+        content->hash = content_hash;
+        content->fmt = fmt;
+        content->siz = siz;
+        content->tmem_size = tmem_size;
+        content->line_size = line_size;
+        content->refcount = 1;
+        // Texels are 4 << siz bits wide and get decoded to 4 bytes each
+        content->size_bytes = (tmem_size * 2 >> siz) * 4;
+        content->next = gfx_texture_cache.content_hashmap[content_hash & 0x3ff];
+        gfx_texture_cache.content_hashmap[content_hash & 0x3ff] = content;
+        gfx_texture_cache_stats.textures++;
+        gfx_texture_cache_stats.bytes += content->size_bytes;
+    }
+
+    if (gfx_texture_cache.free_list == NULL) {
+        if (gfx_texture_cache.pool_pos < sizeof(gfx_texture_cache.pool) / sizeof(struct TextureHashmapNode)) {
+            node = &gfx_texture_cache.pool[gfx_texture_cache.pool_pos++];
+            node->next = gfx_texture_cache.free_list;
+            gfx_texture_cache.free_list = node;
+        } else {
+            // Pool is full, make room by dropping the coldest address
+            gfx_texture_cache_evict_one();
+        }
+    }
+    node = gfx_texture_cache.free_list;
+    gfx_texture_cache.free_list = node->next;
+
+    node->next = gfx_texture_cache.hashmap[hash];
+    gfx_texture_cache.hashmap[hash] = node;
+    gfx_texture_cache_lru_push_front(node);
+    node->texture_addr = orig_addr;
+    node->fmt = fmt;
+    node->siz = siz;
+    node->content = content;
+    gfx_texture_cache_stats.entries++;
+    *n = node;
+    return found;
 }
 
 static uint8_t rgba32_buf[32768] __attribute__((aligned(32)));
 
+// Texel format converters, selected like the mixer implementations in mixer.c.
+// The reference converters are always present, as the others use them for leftover texels.
+#include "src/pc/gfx/texture_implementations/texture_reference.c"
+
+#if defined GFX_FORCE_REFERENCE_TEXTURE
+#define GFX_TEXTURE_CONVERTER(fmt) gfx_convert_##fmt##_reference
+#define GFX_TEXTURE_KERNEL_NAME "reference"
+
+// x86 SSE4.1 support
+#elif defined __SSE4_1__
+#include "src/pc/gfx/texture_implementations/texture_sse41.c"
+#define GFX_TEXTURE_CONVERTER(fmt) gfx_convert_##fmt##_sse41
+#define GFX_TEXTURE_KERNEL_NAME "sse41"
+
+// ARM Neon support
+#elif defined __ARM_NEON
+#include "src/pc/gfx/texture_implementations/texture_neon.c"
+#define GFX_TEXTURE_CONVERTER(fmt) gfx_convert_##fmt##_neon
+#define GFX_TEXTURE_KERNEL_NAME "neon"
+
+#else
+#define GFX_TEXTURE_CONVERTER(fmt) gfx_convert_##fmt##_reference
+#define GFX_TEXTURE_KERNEL_NAME "reference"
+#endif
+
+#ifdef GFX_OPCODE_PROFILING
+#define GFX_TEXTURE_FORMAT(fmt, siz, name) { #name, fmt, siz, GFX_TEXTURE_CONVERTER(name), gfx_convert_##name##_reference }
+
+const char *gfx_texture_kernel_name = GFX_TEXTURE_KERNEL_NAME;
+const struct GfxTextureConverter gfx_texture_converters[GFX_NUM_TEXTURE_CONVERTERS] = {
+    GFX_TEXTURE_FORMAT(G_IM_FMT_RGBA, G_IM_SIZ_16b, rgba16),
+    GFX_TEXTURE_FORMAT(G_IM_FMT_IA, G_IM_SIZ_4b, ia4),
+    GFX_TEXTURE_FORMAT(G_IM_FMT_IA, G_IM_SIZ_8b, ia8),
+    GFX_TEXTURE_FORMAT(G_IM_FMT_IA, G_IM_SIZ_16b, ia16),
+    GFX_TEXTURE_FORMAT(G_IM_FMT_I, G_IM_SIZ_4b, i4),
+    GFX_TEXTURE_FORMAT(G_IM_FMT_I, G_IM_SIZ_8b, i8),
+    GFX_TEXTURE_FORMAT(G_IM_FMT_CI, G_IM_SIZ_4b, ci4),
+    GFX_TEXTURE_FORMAT(G_IM_FMT_CI, G_IM_SIZ_8b, ci8),
+};
+#endif
+
 static void import_texture_rgba16(int tile) {
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes / 2; i++) {
-        uint16_t col16 = (rdp.loaded_texture[tile].addr[2 * i] << 8) | rdp.loaded_texture[tile].addr[2 * i + 1];
-        uint8_t a = col16 & 1;
-        uint8_t r = col16 >> 11;
-        uint8_t g = (col16 >> 6) & 0x1f;
-        uint8_t b = (col16 >> 1) & 0x1f;
-        rgba32_buf[4*i + 0] = SCALE_5_8(r);
-        rgba32_buf[4*i + 1] = SCALE_5_8(g);
-        rgba32_buf[4*i + 2] = SCALE_5_8(b);
-        rgba32_buf[4*i + 3] = a ? 255 : 0;
-    }
+    GFX_TEXTURE_CONVERTER(rgba16)(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes, rdp.palette);
 
     uint32_t width = rdp.texture_tile.line_size_bytes / 2;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -342,19 +839,7 @@ static void import_texture_rgba32(int tile) {
 }
 
 static void import_texture_ia4(int tile) {
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes * 2; i++) {
-        uint8_t byte = rdp.loaded_texture[tile].addr[i / 2];
-        uint8_t part = (byte >> (4 - (i % 2) * 4)) & 0xf;
-        uint8_t intensity = part >> 1;
-        uint8_t alpha = part & 1;
-        uint8_t r = intensity;
-        uint8_t g = intensity;
-        uint8_t b = intensity;
-        rgba32_buf[4*i + 0] = SCALE_3_8(r);
-        rgba32_buf[4*i + 1] = SCALE_3_8(g);
-        rgba32_buf[4*i + 2] = SCALE_3_8(b);
-        rgba32_buf[4*i + 3] = alpha ? 255 : 0;
-    }
+    GFX_TEXTURE_CONVERTER(ia4)(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes, rdp.palette);
 
     uint32_t width = rdp.texture_tile.line_size_bytes * 2;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -363,17 +848,7 @@ static void import_texture_ia4(int tile) {
 }
 
 static void import_texture_ia8(int tile) {
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes; i++) {
-        uint8_t intensity = rdp.loaded_texture[tile].addr[i] >> 4;
-        uint8_t alpha = rdp.loaded_texture[tile].addr[i] & 0xf;
-        uint8_t r = intensity;
-        uint8_t g = intensity;
-        uint8_t b = intensity;
-        rgba32_buf[4*i + 0] = SCALE_4_8(r);
-        rgba32_buf[4*i + 1] = SCALE_4_8(g);
-        rgba32_buf[4*i + 2] = SCALE_4_8(b);
-        rgba32_buf[4*i + 3] = SCALE_4_8(alpha);
-    }
+    GFX_TEXTURE_CONVERTER(ia8)(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes, rdp.palette);
 
     uint32_t width = rdp.texture_tile.line_size_bytes;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -382,17 +857,7 @@ static void import_texture_ia8(int tile) {
 }
 
 static void import_texture_ia16(int tile) {
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes / 2; i++) {
-        uint8_t intensity = rdp.loaded_texture[tile].addr[2 * i];
-        uint8_t alpha = rdp.loaded_texture[tile].addr[2 * i + 1];
-        uint8_t r = intensity;
-        uint8_t g = intensity;
-        uint8_t b = intensity;
-        rgba32_buf[4*i + 0] = r;
-        rgba32_buf[4*i + 1] = g;
-        rgba32_buf[4*i + 2] = b;
-        rgba32_buf[4*i + 3] = alpha;
-    }
+    GFX_TEXTURE_CONVERTER(ia16)(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes, rdp.palette);
 
     uint32_t width = rdp.texture_tile.line_size_bytes / 2;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -401,18 +866,7 @@ static void import_texture_ia16(int tile) {
 }
 
 static void import_texture_i4(int tile) {
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes * 2; i++) {
-        uint8_t byte = rdp.loaded_texture[tile].addr[i / 2];
-        uint8_t part = (byte >> (4 - (i % 2) * 4)) & 0xf;
-        uint8_t intensity = part;
-        uint8_t r = intensity;
-        uint8_t g = intensity;
-        uint8_t b = intensity;
-        rgba32_buf[4*i + 0] = SCALE_4_8(r);
-        rgba32_buf[4*i + 1] = SCALE_4_8(g);
-        rgba32_buf[4*i + 2] = SCALE_4_8(b);
-        rgba32_buf[4*i + 3] = 255;
-    }
+    GFX_TEXTURE_CONVERTER(i4)(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes, rdp.palette);
 
     uint32_t width = rdp.texture_tile.line_size_bytes * 2;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -421,16 +875,7 @@ static void import_texture_i4(int tile) {
 }
 
 static void import_texture_i8(int tile) {
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes; i++) {
-        uint8_t intensity = rdp.loaded_texture[tile].addr[i];
-        uint8_t r = intensity;
-        uint8_t g = intensity;
-        uint8_t b = intensity;
-        rgba32_buf[4*i + 0] = r;
-        rgba32_buf[4*i + 1] = g;
-        rgba32_buf[4*i + 2] = b;
-        rgba32_buf[4*i + 3] = 255;
-    }
+    GFX_TEXTURE_CONVERTER(i8)(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes, rdp.palette);
 
     uint32_t width = rdp.texture_tile.line_size_bytes;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -438,21 +883,8 @@ static void import_texture_i8(int tile) {
     gfx_rapi->upload_texture(rgba32_buf, width, height);
 }
 
-
 static void import_texture_ci4(int tile) {
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes * 2; i++) {
-        uint8_t byte = rdp.loaded_texture[tile].addr[i / 2];
-        uint8_t idx = (byte >> (4 - (i % 2) * 4)) & 0xf;
-        uint16_t col16 = (rdp.palette[idx * 2] << 8) | rdp.palette[idx * 2 + 1]; // Big endian load
-        uint8_t a = col16 & 1;
-        uint8_t r = col16 >> 11;
-        uint8_t g = (col16 >> 6) & 0x1f;
-        uint8_t b = (col16 >> 1) & 0x1f;
-        rgba32_buf[4*i + 0] = SCALE_5_8(r);
-        rgba32_buf[4*i + 1] = SCALE_5_8(g);
-        rgba32_buf[4*i + 2] = SCALE_5_8(b);
-        rgba32_buf[4*i + 3] = a ? 255 : 0;
-    }
+    GFX_TEXTURE_CONVERTER(ci4)(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes, rdp.palette);
 
     uint32_t width = rdp.texture_tile.line_size_bytes * 2;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -461,18 +893,7 @@ static void import_texture_ci4(int tile) {
 }
 
 static void import_texture_ci8(int tile) {
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes; i++) {
-        uint8_t idx = rdp.loaded_texture[tile].addr[i];
-        uint16_t col16 = (rdp.palette[idx * 2] << 8) | rdp.palette[idx * 2 + 1]; // Big endian load
-        uint8_t a = col16 & 1;
-        uint8_t r = col16 >> 11;
-        uint8_t g = (col16 >> 6) & 0x1f;
-        uint8_t b = (col16 >> 1) & 0x1f;
-        rgba32_buf[4*i + 0] = SCALE_5_8(r);
-        rgba32_buf[4*i + 1] = SCALE_5_8(g);
-        rgba32_buf[4*i + 2] = SCALE_5_8(b);
-        rgba32_buf[4*i + 3] = a ? 255 : 0;
-    }
+    GFX_TEXTURE_CONVERTER(ci8)(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes, rdp.palette);
 
     uint32_t width = rdp.texture_tile.line_size_bytes;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -480,6 +901,38 @@ static void import_texture_ci8(int tile) {
     gfx_rapi->upload_texture(rgba32_buf, width, height);
 }
 
+static struct GfxTexturePack texture_pack;
+
+void gfx_load_texture_pack(const char *path) {
+    gfx_texture_pack_close(&texture_pack);
+    if (gfx_texture_pack_open(&texture_pack, path) && texture_pack.layout == GFX_TEXTURE_PACK_TILED &&
+        gfx_rapi->upload_tiled_texture == NULL) {
+        // Built for another rendering API
+        gfx_texture_pack_close(&texture_pack);
+    }
+}
+
+// Uploads the texture straight from the pack if it was pre-converted
+static bool import_texture_from_pack(int tile) {
+    const struct TextureContentNode *content = rendering_state.textures[tile]->content;
+    uint32_t width = (rdp.texture_tile.line_size_bytes * 2) >> content->siz;
+    uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
+
+    const struct GfxTexturePackEntry *entry = gfx_texture_pack_find(&texture_pack, content->hash, content->fmt, content->siz,
+                                                                    content->tmem_size, width, height);
+    if (entry == NULL) {
+        return false;
+    }
+
+    if (texture_pack.layout == GFX_TEXTURE_PACK_TILED) {
+        gfx_rapi->upload_tiled_texture(gfx_texture_pack_texels(&texture_pack, entry), width, height);
+    } else {
+        gfx_rapi->upload_texture(gfx_texture_pack_texels(&texture_pack, entry), width, height);
+    }
+    gfx_texture_cache_stats.pack_hits++;
+    return true;
+}
+
 static void import_texture(int tile) {
     uint8_t fmt = rdp.texture_tile.fmt;
     uint8_t siz = rdp.texture_tile.siz;
@@ -488,6 +941,11 @@ static void import_texture(int tile) {
         return;
     }
 
+    if (texture_pack.num_entries > 0 && import_texture_from_pack(tile)) {
+        gfx_texture_cache_enforce_budget();
+        return;
+    }
+
     if (fmt == G_IM_FMT_RGBA) {
         if (siz == G_IM_SIZ_16b) {
             import_texture_rgba16(tile);
@@ -525,6 +983,8 @@ static void import_texture(int tile) {
     } else {
         abort();
     }
+
+    gfx_texture_cache_enforce_budget();
 }
 
 static void gfx_normalize_vector(float v[3]) {
@@ -623,127 +1083,66 @@ static float gfx_adjust_x_for_aspect_ratio(float x) {
 #endif
 }
 
-static void gfx_sp_vertex(size_t n_vertices, size_t dest_index, const Vtx *vertices) {
-    profiler_3ds_log_time(0);
-
-    for (size_t i = 0; i < n_vertices; i++, dest_index++) {
-        const Vtx_t *v = &vertices[i].v;
-        const Vtx_tn *vn = &vertices[i].n;
-        struct LoadedVertex *d = &rsp.loaded_vertices[dest_index];
+static void gfx_update_light_coeffs(void) {
+    for (int i = 0; i < rsp.current_num_lights - 1; i++) {
+        calculate_normal_dir(&rsp.current_lights[i], rsp.current_lights_coeffs[i]);
+    }
+    static const Light_t lookat_x = {{0, 0, 0}, 0, {0, 0, 0}, 0, {127, 0, 0}, 0};
+    static const Light_t lookat_y = {{0, 0, 0}, 0, {0, 0, 0}, 0, {0, 127, 0}, 0};
+    calculate_normal_dir(&lookat_x, rsp.current_lookat_coeffs[0]);
+    calculate_normal_dir(&lookat_y, rsp.current_lookat_coeffs[1]);
+    rsp.lights_changed = false;
+}
 
-        float x = v->ob[0] * rsp.MP_matrix[0][0] + v->ob[1] * rsp.MP_matrix[1][0] + v->ob[2] * rsp.MP_matrix[2][0] + rsp.MP_matrix[3][0];
-        float y = v->ob[0] * rsp.MP_matrix[0][1] + v->ob[1] * rsp.MP_matrix[1][1] + v->ob[2] * rsp.MP_matrix[2][1] + rsp.MP_matrix[3][1];
-        float z = v->ob[0] * rsp.MP_matrix[0][2] + v->ob[1] * rsp.MP_matrix[1][2] + v->ob[2] * rsp.MP_matrix[2][2] + rsp.MP_matrix[3][2];
-        float w = v->ob[0] * rsp.MP_matrix[0][3] + v->ob[1] * rsp.MP_matrix[1][3] + v->ob[2] * rsp.MP_matrix[2][3] + rsp.MP_matrix[3][3];
+// Batch vertex kernels, selected like the mixer implementations in mixer.c.
+// The reference implementation is always present, as the others use it for leftover vertices.
+#include "src/pc/gfx/vertex_implementations/vertex_reference.c"
 
-        x = gfx_adjust_x_for_aspect_ratio(x);
+#if defined GFX_FORCE_REFERENCE_VERTEX
+#define gfx_transform_vertices gfx_transform_vertices_reference
+#define GFX_VERTEX_KERNEL_NAME "reference"
 
-        short U = v->tc[0] * rsp.texture_scaling_factor.s >> 16;
-        short V = v->tc[1] * rsp.texture_scaling_factor.t >> 16;
+// x86 SSE4.1 support
+#elif defined __SSE4_1__
+#include "src/pc/gfx/vertex_implementations/vertex_sse41.c"
+#define gfx_transform_vertices gfx_transform_vertices_sse41
+#define GFX_VERTEX_KERNEL_NAME "sse41"
 
-        if (rsp.geometry_mode & G_LIGHTING) {
-            if (rsp.lights_changed) {
-                for (int i = 0; i < rsp.current_num_lights - 1; i++) {
-                    calculate_normal_dir(&rsp.current_lights[i], rsp.current_lights_coeffs[i]);
-                }
-                static const Light_t lookat_x = {{0, 0, 0}, 0, {0, 0, 0}, 0, {127, 0, 0}, 0};
-                static const Light_t lookat_y = {{0, 0, 0}, 0, {0, 0, 0}, 0, {0, 127, 0}, 0};
-                calculate_normal_dir(&lookat_x, rsp.current_lookat_coeffs[0]);
-                calculate_normal_dir(&lookat_y, rsp.current_lookat_coeffs[1]);
-                rsp.lights_changed = false;
-            }
+// AArch64 NEON support (ARMv7 NEON lacks vector division)
+#elif defined __ARM_NEON && defined __aarch64__
+#include "src/pc/gfx/vertex_implementations/vertex_neon.c"
+#define gfx_transform_vertices gfx_transform_vertices_neon
+#define GFX_VERTEX_KERNEL_NAME "neon"
 
-            int r = rsp.current_lights[rsp.current_num_lights - 1].col[0];
-            int g = rsp.current_lights[rsp.current_num_lights - 1].col[1];
-            int b = rsp.current_lights[rsp.current_num_lights - 1].col[2];
-
-            for (int i = 0; i < rsp.current_num_lights - 1; i++) {
-                float intensity = 0;
-                intensity += vn->n[0] * rsp.current_lights_coeffs[i][0];
-                intensity += vn->n[1] * rsp.current_lights_coeffs[i][1];
-                intensity += vn->n[2] * rsp.current_lights_coeffs[i][2];
-                intensity /= 127.0f;
-                if (intensity > 0.0f) {
-                    r += intensity * rsp.current_lights[i].col[0];
-                    g += intensity * rsp.current_lights[i].col[1];
-                    b += intensity * rsp.current_lights[i].col[2];
-                }
-            }
+#else
+#define gfx_transform_vertices gfx_transform_vertices_reference
+#define GFX_VERTEX_KERNEL_NAME "reference"
+#endif
 
-            d->color.r = r > 255 ? 255 : r;
-            d->color.g = g > 255 ? 255 : g;
-            d->color.b = b > 255 ? 255 : b;
-
-            if (rsp.geometry_mode & G_TEXTURE_GEN) {
-                float dotx = 0, doty = 0;
-                dotx += vn->n[0] * rsp.current_lookat_coeffs[0][0];
-                dotx += vn->n[1] * rsp.current_lookat_coeffs[0][1];
-                dotx += vn->n[2] * rsp.current_lookat_coeffs[0][2];
-                doty += vn->n[0] * rsp.current_lookat_coeffs[1][0];
-                doty += vn->n[1] * rsp.current_lookat_coeffs[1][1];
-                doty += vn->n[2] * rsp.current_lookat_coeffs[1][2];
-
-                U = (int32_t)((dotx / 127.0f + 1.0f) / 4.0f * rsp.texture_scaling_factor.s);
-                V = (int32_t)((doty / 127.0f + 1.0f) / 4.0f * rsp.texture_scaling_factor.t);
-            }
-        } else {
-            d->color.r = v->cn[0];
-            d->color.g = v->cn[1];
-            d->color.b = v->cn[2];
-        }
+#ifdef GFX_OPCODE_PROFILING
+const char *gfx_vertex_kernel_name = GFX_VERTEX_KERNEL_NAME;
+bool gfx_vertex_force_reference;
+#endif
 
-        d->u = U;
-        d->v = V;
+static void gfx_sp_vertex(size_t n_vertices, size_t dest_index, const Vtx *vertices) {
+    profiler_3ds_log_time(0);
 
-        // trivial clip rejection
-        d->clip_rej = 0;
-#ifdef TARGET_N3DS
-    if (gGfx3DEnabled) {
-        float wMod = w * 1.2f; // expanded w-range for testing clip rejection
-        if (x < -wMod) d->clip_rej |= 1;
-        if (x > wMod) d->clip_rej |= 2;
-        if (y < -wMod) d->clip_rej |= 4;
-        if (y > wMod) d->clip_rej |= 8;
-    }
-    else {
-        if (x < -w) d->clip_rej |= 1;
-        if (x > w) d->clip_rej |= 2;
-        if (y < -w) d->clip_rej |= 4;
-        if (y > w) d->clip_rej |= 8;
+    if ((rsp.geometry_mode & G_LIGHTING) && rsp.lights_changed) {
+        gfx_update_light_coeffs();
     }
-#else
-        if (x < -w) d->clip_rej |= 1;
-        if (x > w) d->clip_rej |= 2;
-        if (y < -w) d->clip_rej |= 4;
-        if (y > w) d->clip_rej |= 8;
-#endif
-        if (z < -w) d->clip_rej |= 16;
-        if (z > w) d->clip_rej |= 32;
-
-        d->x = x;
-        d->y = y;
-        d->z = z;
-        d->w = w;
-
-        if (rsp.geometry_mode & G_FOG) {
-            if (fabsf(w) < 0.001f) {
-                // To avoid division by zero
-                w = 0.001f;
-            }
 
-            float winv = 1.0f / w;
-            if (winv < 0.0f) {
-                winv = 32767.0f;
-            }
+#ifdef GFX_OPCODE_PROFILING
+    gfx_opcode_profile.vertices += n_vertices;
+    if (gfx_vertex_force_reference) {
+        gfx_transform_vertices_reference(n_vertices, dest_index, vertices);
+    } else
+#endif
+    gfx_transform_vertices(n_vertices, dest_index, vertices);
 
-            float fog_z = z * winv * rsp.fog_mul + rsp.fog_offset;
-            if (fog_z < 0) fog_z = 0;
-            if (fog_z > 255) fog_z = 255;
-            d->color.a = fog_z; // Use alpha variable to store fog factor
-        } else {
-            d->color.a = v->cn[3];
-        }
+    for (size_t i = 0; i < n_vertices; i++) {
+        buf_vbo_vertex_cache[dest_index + i].generation = 0;
     }
+
     profiler_3ds_log_time(6); // gfx_sp_vertex
 }
 
@@ -753,6 +1152,7 @@ static void gfx_sp_tri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t vtx3_idx) {
     struct LoadedVertex *v2 = &rsp.loaded_vertices[vtx2_idx];
     struct LoadedVertex *v3 = &rsp.loaded_vertices[vtx3_idx];
     struct LoadedVertex *v_arr[3] = {v1, v2, v3};
+    uint8_t vtx_idx[3] = {vtx1_idx, vtx2_idx, vtx3_idx};
 
     //if (rand()%2) return;
 
@@ -774,7 +1174,7 @@ static void gfx_sp_tri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t vtx3_idx) {
         const float dx2 = v3->x * recip3 - v2->x * recip2;
         const float dy2 = v3->y * recip3 - v2->y * recip2;
 
-        const float cross = dx1 * dy2 - dy1 * dx2;
+        float cross = dx1 * dy2 - dy1 * dx2;
 
 #ifdef TARGET_N3DS
         // Quick maffs
@@ -863,41 +1263,37 @@ static void gfx_sp_tri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t vtx3_idx) {
     }
 
     struct ColorCombiner *comb = gfx_lookup_or_create_color_combiner(cc_id);
-    struct ShaderProgram *prg = comb->prg;
-    if (prg != rendering_state.shader_program) {
-        gfx_flush();
-        gfx_rapi->unload_shader(rendering_state.shader_program);
-        gfx_rapi->load_shader(prg);
-        rendering_state.shader_program = prg;
-    }
     if (use_alpha != rendering_state.alpha_blend) {
         gfx_flush();
         gfx_rapi->set_use_alpha(use_alpha);
         rendering_state.alpha_blend = use_alpha;
     }
-    uint8_t num_inputs;
-    bool used_textures[2];
-    gfx_rapi->shader_get_info(prg, &num_inputs, used_textures);
+    const bool *used_textures = comb->used_textures;
 
+    // Shader, textures and sampler are only applied when the batch is drawn
+    struct BatchState state = { comb->prg, { NULL, NULL }, false, 0, 0 };
     for (int i = 0; i < 2; i++) {
         if (used_textures[i]) {
             if (rdp.textures_changed[i]) {
-                gfx_flush();
                 import_texture(i);
                 rdp.textures_changed[i] = false;
+                // The tile size is baked into the texture coordinates of emitted vertices
+                gfx_invalidate_vertex_cache();
             }
-            bool linear_filter = (rdp.other_mode_h & (3U << G_MDSFT_TEXTFILT)) != G_TF_POINT;
-            if (linear_filter != rendering_state.textures[i]->linear_filter || rdp.texture_tile.cms != rendering_state.textures[i]->cms || rdp.texture_tile.cmt != rendering_state.textures[i]->cmt) {
-                gfx_flush();
-                gfx_rapi->set_sampler_parameters(i, linear_filter, rdp.texture_tile.cms, rdp.texture_tile.cmt);
-                rendering_state.textures[i]->linear_filter = linear_filter;
-                rendering_state.textures[i]->cms = rdp.texture_tile.cms;
-                rendering_state.textures[i]->cmt = rdp.texture_tile.cmt;
-            }
+            state.textures[i] = rendering_state.textures[i]->content;
         }
     }
 
     bool use_texture = used_textures[0] || used_textures[1];
+    if (use_texture) {
+        state.linear_filter = (rdp.other_mode_h & (3U << G_MDSFT_TEXTFILT)) != G_TF_POINT;
+        state.cms = rdp.texture_tile.cms;
+        state.cmt = rdp.texture_tile.cmt;
+    }
+    if (!gfx_batch_state_equal(&state, &buf_batch_state)) {
+        gfx_end_batch();
+        buf_batch_state = state;
+    }
     uint32_t tex_width = (rdp.texture_tile.lrs - rdp.texture_tile.uls + 4)  >> 2; // Shift-right is actually slightly faster on 3DS.
     uint32_t tex_height = (rdp.texture_tile.lrt - rdp.texture_tile.ult + 4) >> 2;
 
@@ -905,7 +1301,45 @@ static void gfx_sp_tri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t vtx3_idx) {
     bool z_is_from_0_to_1 = gfx_rapi->z_is_from_0_to_1(); // 3DS is always 0 to 1
 #endif
 
+    static const float zero_f[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    static const float one_f[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    float lod_f[4];
+    const float *emit_sources[CC_EMIT_NUM_SOURCES] = {
+        [CC_EMIT_ZERO] = zero_f,
+        [CC_EMIT_ONE] = one_f,
+        [CC_EMIT_PRIM] = rdp.prim_color_f,
+        [CC_EMIT_ENV] = rdp.env_color_f,
+        [CC_EMIT_LOD] = lod_f,
+    };
+    bool indexed = gfx_rapi->draw_indexed != NULL;
+    if (comb != buf_vbo_combiner || comb->uses_lod) {
+        // The LOD input depends on the triangle's first vertex, so such vertices are never shared
+        gfx_invalidate_vertex_cache();
+        buf_vbo_combiner = comb;
+    }
+    if (comb->uses_lod) {
+        float distance_frac = (v1->w - 3000.0f) / 3000.0f;
+        if (distance_frac < 0.0f) distance_frac = 0.0f;
+        if (distance_frac > 1.0f) distance_frac = 1.0f;
+        uint8_t lod = distance_frac * 255.0f;
+        lod_f[0] = lod_f[1] = lod_f[2] = lod_f[3] = lod / 255.0f;
+    }
+
+    if (buf_vbo_len + 3 * 26 > sizeof(buf_vbo) / sizeof(float) || buf_ibo_len + 3 > sizeof(buf_ibo) / sizeof(uint16_t)) {
+        // No room to defer any more batches
+        gfx_flush();
+    }
+
     for (int i = 0; i < 3; i++) {
+        if (indexed) {
+            if (buf_vbo_vertex_cache[vtx_idx[i]].generation == buf_vbo_generation) {
+                buf_ibo[buf_ibo_len + i] = buf_vbo_vertex_cache[vtx_idx[i]].index;
+                continue;
+            }
+            buf_vbo_vertex_cache[vtx_idx[i]].generation = buf_vbo_generation;
+            buf_vbo_vertex_cache[vtx_idx[i]].index = buf_vbo_num_verts;
+            buf_ibo[buf_ibo_len + i] = buf_vbo_num_verts++;
+        }
 
 #ifdef TARGET_N3DS
         float w = v_arr[i]->w, z = (v_arr[i]->z + w) / -2.0f; // 3DS is always 0 to 1
@@ -934,62 +1368,34 @@ static void gfx_sp_tri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t vtx3_idx) {
         }
 #ifndef TARGET_N3DS
         if (use_fog) {
-            buf_vbo[buf_vbo_len++] = rdp.fog_color.r / 255.0f;
-            buf_vbo[buf_vbo_len++] = rdp.fog_color.g / 255.0f;
-            buf_vbo[buf_vbo_len++] = rdp.fog_color.b / 255.0f;
+            buf_vbo[buf_vbo_len++] = rdp.fog_color_f[0];
+            buf_vbo[buf_vbo_len++] = rdp.fog_color_f[1];
+            buf_vbo[buf_vbo_len++] = rdp.fog_color_f[2];
             buf_vbo[buf_vbo_len++] = v_arr[i]->color.a / 255.0f; // fog factor (not alpha)
         }
 #endif
-        for (int j = 0; j < num_inputs; j++) {
-            struct RGBA *color;
-            struct RGBA tmp;
-            for (int k = 0; k < 1 + (use_alpha ? 1 : 0); k++) {
-                switch (comb->shader_input_mapping[k][j]) {
-                    case CC_PRIM:
-                        color = &rdp.prim_color;
-                        break;
-                    case CC_SHADE:
-                        color = &v_arr[i]->color;
-                        break;
-                    case CC_ENV:
-                        color = &rdp.env_color;
-                        break;
-                    case CC_LOD:
-                    {
-                        float distance_frac = (v1->w - 3000.0f) / 3000.0f;
-                        if (distance_frac < 0.0f) distance_frac = 0.0f;
-                        if (distance_frac > 1.0f) distance_frac = 1.0f;
-                        tmp.r = tmp.g = tmp.b = tmp.a = distance_frac * 255.0f;
-                        color = &tmp;
-                        break;
-                    }
-                    default:
-                        memset(&tmp, 0, sizeof(tmp));
-                        color = &tmp;
-                        break;
+        for (int j = 0; j < comb->num_emit_ops; j++) {
+            const struct CCEmitOp *op = &comb->emit_ops[j];
+            int end = op->first + op->count;
+            if (op->source == CC_EMIT_SHADE) {
+                // Read straight from the vertex; staging it in a float array stalls store forwarding
+                const uint8_t *color = (const uint8_t *) &v_arr[i]->color;
+                for (int c = op->first; c < end; c++) {
+                    buf_vbo[buf_vbo_len++] = color[c] / 255.0f;
                 }
-                if (k == 0) {
-                    buf_vbo[buf_vbo_len++] = color->r / 255.0f;
-                    buf_vbo[buf_vbo_len++] = color->g / 255.0f;
-                    buf_vbo[buf_vbo_len++] = color->b / 255.0f;
-                } else {
-                    if (use_fog && color == &v_arr[i]->color) {
-                        // Shade alpha is 100% for fog
-                        buf_vbo[buf_vbo_len++] = 1.0f;
-                    } else {
-                        buf_vbo[buf_vbo_len++] = color->a / 255.0f;
-                    }
+            } else {
+                const float *src = emit_sources[op->source];
+                for (int c = op->first; c < end; c++) {
+                    buf_vbo[buf_vbo_len++] = src[c];
                 }
             }
         }
-        /*struct RGBA *color = &v_arr[i]->color;
-        buf_vbo[buf_vbo_len++] = color->r / 255.0f;
-        buf_vbo[buf_vbo_len++] = color->g / 255.0f;
-        buf_vbo[buf_vbo_len++] = color->b / 255.0f;
-        buf_vbo[buf_vbo_len++] = color->a / 255.0f;*/
+    }
+    if (indexed) {
+        buf_ibo_len += 3;
     }
     if (++buf_vbo_num_tris == MAX_BUFFERED) {
-        gfx_flush();
+        gfx_end_batch();
     }
     
     profiler_3ds_log_time(7); // gfx_sp_tri1
@@ -1068,6 +1474,8 @@ static void gfx_sp_moveword(uint8_t index, uint16_t offset, uint32_t data) {
             rsp.fog_mul = (int16_t)(data >> 16);
             rsp.fog_offset = (int16_t)data;
 #ifdef TARGET_N3DS
+            // Fog is applied when drawing, so batches that were fogged the old way go first
+            gfx_flush();
             gfx_rapi->set_fog(rsp.fog_mul, rsp.fog_offset);
 #endif
             break;
@@ -1123,6 +1531,7 @@ static void gfx_dp_set_tile_size(uint8_t tile, uint16_t uls, uint16_t ult, uint1
         rdp.texture_tile.lrt = lrt;
         rdp.textures_changed[0] = true;
         rdp.textures_changed[1] = true;
+        gfx_invalidate_vertex_cache();
     }
 }
 
@@ -1130,6 +1539,8 @@ static void gfx_dp_load_tlut(uint8_t tile, uint32_t high_index) {
     SUPPORT_CHECK(tile == G_TX_LOADTILE);
     SUPPORT_CHECK(rdp.texture_to_load.siz == G_IM_SIZ_16b);
     rdp.palette = rdp.texture_to_load.addr;
+    rdp.palette_size_bytes = (high_index + 1) * sizeof(uint16_t);
+    GFX_CAPTURE_RANGE(rdp.palette, rdp.palette_size_bytes);
 }
 
 static void gfx_dp_load_block(uint8_t tile, uint32_t uls, uint32_t ult, uint32_t lrs, uint32_t dxt) {
@@ -1158,6 +1569,7 @@ static void gfx_dp_load_block(uint8_t tile, uint32_t uls, uint32_t ult, uint32_t
     rdp.loaded_texture[rdp.texture_to_load.tile_number].size_bytes = size_bytes;
     assert(size_bytes <= 4096 && "bug: too big texture");
     rdp.loaded_texture[rdp.texture_to_load.tile_number].addr = rdp.texture_to_load.addr;
+    GFX_CAPTURE_RANGE(rdp.texture_to_load.addr, size_bytes);
 
     rdp.textures_changed[rdp.texture_to_load.tile_number] = true;
 }
@@ -1189,12 +1601,14 @@ static void gfx_dp_load_tile(uint8_t tile, uint32_t uls, uint32_t ult, uint32_t
 
     assert(size_bytes <= 4096 && "bug: too big texture");
     rdp.loaded_texture[rdp.texture_to_load.tile_number].addr = rdp.texture_to_load.addr;
+    GFX_CAPTURE_RANGE(rdp.texture_to_load.addr, size_bytes);
     rdp.texture_tile.uls = uls;
     rdp.texture_tile.ult = ult;
     rdp.texture_tile.lrs = lrs;
     rdp.texture_tile.lrt = lrt;
 
     rdp.textures_changed[rdp.texture_to_load.tile_number] = true;
+    gfx_invalidate_vertex_cache();
 }
 
 
@@ -1235,6 +1649,11 @@ static void gfx_dp_set_env_color(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
     rdp.env_color.g = g;
     rdp.env_color.b = b;
     rdp.env_color.a = a;
+    rdp.env_color_f[0] = r / 255.0f;
+    rdp.env_color_f[1] = g / 255.0f;
+    rdp.env_color_f[2] = b / 255.0f;
+    rdp.env_color_f[3] = a / 255.0f;
+    gfx_invalidate_vertex_cache();
 }
 
 static void gfx_dp_set_prim_color(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
@@ -1242,16 +1661,26 @@ static void gfx_dp_set_prim_color(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
     rdp.prim_color.g = g;
     rdp.prim_color.b = b;
     rdp.prim_color.a = a;
+    rdp.prim_color_f[0] = r / 255.0f;
+    rdp.prim_color_f[1] = g / 255.0f;
+    rdp.prim_color_f[2] = b / 255.0f;
+    rdp.prim_color_f[3] = a / 255.0f;
+    gfx_invalidate_vertex_cache();
 }
 
 static void gfx_dp_set_fog_color(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
 #ifdef TARGET_N3DS
+    gfx_flush();
     gfx_rapi->set_fog_color(r, g, b, a);
 #endif
     rdp.fog_color.r = r;
     rdp.fog_color.g = g;
     rdp.fog_color.b = b;
     rdp.fog_color.a = a;
+    rdp.fog_color_f[0] = r / 255.0f;
+    rdp.fog_color_f[1] = g / 255.0f;
+    rdp.fog_color_f[2] = b / 255.0f;
+    gfx_invalidate_vertex_cache();
 }
 
 static void gfx_dp_set_fill_color(uint32_t packed_color) {
@@ -1322,6 +1751,10 @@ static void gfx_draw_rectangle(int32_t ulx, int32_t uly, int32_t lrx, int32_t lr
     rdp.viewport_or_scissor_changed = true;
     rsp.geometry_mode = 0;
 
+    for (int i = MAX_VERTICES; i < MAX_VERTICES + 4; i++) {
+        buf_vbo_vertex_cache[i].generation = 0;
+    }
+
     gfx_sp_tri1(MAX_VERTICES + 0, MAX_VERTICES + 1, MAX_VERTICES + 3);
     gfx_sp_tri1(MAX_VERTICES + 1, MAX_VERTICES + 2, MAX_VERTICES + 3);
 
@@ -1422,10 +1855,42 @@ static void gfx_sp_set_other_mode(uint32_t shift, uint32_t num_bits, uint64_t mo
     uint64_t mask = (((uint64_t)1 << num_bits) - 1) << shift;
     uint64_t om = rdp.other_mode_l | ((uint64_t)rdp.other_mode_h << 32);
     om = (om & ~mask) | mode;
+    if (((uint32_t)(om >> 32) ^ rdp.other_mode_h) & (3U << G_MDSFT_TEXTFILT)) {
+        // The filter mode offsets the emitted texture coordinates
+        gfx_invalidate_vertex_cache();
+    }
     rdp.other_mode_l = (uint32_t)om;
     rdp.other_mode_h = (uint32_t)(om >> 32);
 }
 
+#ifdef GFX_OPCODE_PROFILING
+bool gfx_opcode_profiling_enabled;
+struct GfxOpcodeProfile gfx_opcode_profile;
+static uint32_t profiled_opcode = GFX_OPCODE_PROFILE_SLOTS;
+static uint64_t profiled_opcode_start;
+
+// Charges the time since the previous call to the previous opcode. Nested display lists
+// are not included in the time of the G_DL that called them.
+static void gfx_profile_opcode(uint32_t opcode) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t now = (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+
+    if (profiled_opcode < GFX_OPCODE_PROFILE_SLOTS) {
+        gfx_opcode_profile.nanoseconds[profiled_opcode] += now - profiled_opcode_start;
+    }
+    if (opcode < GFX_OPCODE_PROFILE_SLOTS) {
+        gfx_opcode_profile.count[opcode]++;
+    }
+    profiled_opcode = opcode;
+    profiled_opcode_start = now;
+}
+
+#define GFX_PROFILE_OPCODE(opcode) do { if (gfx_opcode_profiling_enabled) gfx_profile_opcode(opcode); } while (0)
+#else
+#define GFX_PROFILE_OPCODE(opcode) do {} while (0)
+#endif
+
 static inline void *seg_addr(uintptr_t w1) {
     return (void *) w1;
 }
@@ -1436,6 +1901,8 @@ static inline void *seg_addr(uintptr_t w1) {
 static void gfx_run_dl(Gfx* cmd) {
     for (;;) {
         uint32_t opcode = cmd->words.w0 >> 24;
+        GFX_PROFILE_OPCODE(opcode);
+        GFX_CAPTURE_COMMAND(cmd);
 
         switch (opcode) {
             // RSP commands:
@@ -1666,6 +2133,9 @@ void gfx_init(struct GfxWindowManagerAPI *wapi, struct GfxRenderingAPI *rapi, co
     gfx_wapi->init(game_name, start_in_fullscreen);
     gfx_rapi->init();
 
+    gfx_texture_cache.lru.lru_next = gfx_texture_cache.lru.lru_prev = &gfx_texture_cache.lru;
+    gfx_texture_cache.unreferenced.lru_next = gfx_texture_cache.unreferenced.lru_prev = &gfx_texture_cache.unreferenced;
+
 #ifdef TARGET_N3DS
     // dimensions won't change on 3DS, so just do this once
     gfx_wapi->get_dimensions(&gfx_current_dimensions.width, &gfx_current_dimensions.height);
@@ -1742,11 +2212,15 @@ void gfx_run(Gfx *commands) {
     profiler_3ds_log_time(4); // GFX RAPI Start Frame
 
     // profiler_3ds_log_time(0);
+    GFX_CAPTURE_BEGIN_FRAME(commands);
     gfx_run_dl(commands);
+    GFX_CAPTURE_END_FRAME();
     // profiler_3ds_log_time(5); // GFX Run DL
 
+    GFX_PROFILE_OPCODE(GFX_OPCODE_PROFILE_FLUSH);
     gfx_flush();
     gfx_rapi->end_frame();
+    GFX_PROFILE_OPCODE(GFX_OPCODE_PROFILE_SLOTS);
     gfx_wapi->swap_buffers_begin();
 }
 
@@ -1,6 +1,8 @@
 #ifndef GFX_PC_H
 #define GFX_PC_H
 
+#include <stddef.h>
+#include <stdint.h>
 #include <stdbool.h>
 
 struct GfxRenderingAPI;
@@ -14,11 +16,80 @@ struct GfxDimensions {
 
 extern struct GfxDimensions gfx_current_dimensions;
 
+// Texture cache activity. Sizes count textures decoded to RGBA32.
+// Textures are looked up by address first, then by a hash of their texels, so that
+// identical texels loaded from elsewhere share one backend texture.
+struct GfxTextureCacheStats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t content_hits; // Misses that matched the texels of an uploaded texture
+    uint64_t pack_hits; // Remaining misses uploaded from the texture pack without conversion
+    uint64_t evictions;
+    uint64_t hit_bytes; // Conversions and uploads skipped since startup; the headless build splits them by level
+    uint64_t content_hit_bytes;
+    uint32_t entries; // Addresses
+    uint32_t textures; // Backend textures
+    size_t bytes;
+    size_t budget;
+};
+
+extern struct GfxTextureCacheStats gfx_texture_cache_stats;
+
+// Triangles are batched until the state they are drawn with changes. Batches of opaque geometry
+// that is depth tested and writes depth are held back until that run ends, then the ones with
+// the same shader, textures and sampler are merged into one draw.
+struct GfxDrawStats {
+    uint64_t batches; // Draws before merging
+    uint64_t draws; // Draws issued to the rendering API
+};
+
+extern struct GfxDrawStats gfx_draw_stats;
+
+#ifdef GFX_OPCODE_PROFILING
+// Exclusive time spent in each display list opcode, including any flushes it triggers.
+// The extra slot holds the flush at the end of each frame.
+#define GFX_OPCODE_PROFILE_FLUSH 256
+#define GFX_OPCODE_PROFILE_SLOTS 257
+
+struct GfxOpcodeProfile {
+    uint64_t count[GFX_OPCODE_PROFILE_SLOTS];
+    uint64_t nanoseconds[GFX_OPCODE_PROFILE_SLOTS];
+    uint64_t vertices;
+};
+
+extern bool gfx_opcode_profiling_enabled;
+extern struct GfxOpcodeProfile gfx_opcode_profile;
+
+// Name of the batch vertex kernel selected at build time, and a switch back to the scalar one
+extern const char *gfx_vertex_kernel_name;
+extern bool gfx_vertex_force_reference;
+
+// Draws every batch in display list order, as if nothing could be merged
+extern bool gfx_draw_force_unsorted;
+
+// Texel format converters selected at build time, each paired with its scalar reference.
+// Both decode size_bytes of texture data at src to RGBA32 at dst; palette is only read for CI formats.
+#define GFX_NUM_TEXTURE_CONVERTERS 8
+
+struct GfxTextureConverter {
+    const char *name;
+    uint8_t fmt, siz;
+    void (*convert)(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette);
+    void (*reference)(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette);
+};
+
+extern const char *gfx_texture_kernel_name;
+extern const struct GfxTextureConverter gfx_texture_converters[GFX_NUM_TEXTURE_CONVERTERS];
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 void gfx_init(struct GfxWindowManagerAPI *wapi, struct GfxRenderingAPI *rapi, const char *game_name, bool start_in_fullscreen);
+void gfx_texture_cache_set_budget(size_t bytes);
+// Serves texture cache misses from a pack made by tools/texture_pack.c, see gfx_texture_pack.h
+void gfx_load_texture_pack(const char *path);
 struct GfxRenderingAPI *gfx_get_current_rendering_api(void);
 void gfx_start_frame(void);
 void gfx_run(Gfx *commands);
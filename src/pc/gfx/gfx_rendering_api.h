@@ -17,6 +17,12 @@ struct GfxRenderingAPI {
     uint32_t (*new_texture)(void);
     void (*select_texture)(int tile, uint32_t texture_id);
     void (*upload_texture)(const uint8_t *rgba32_buf, int width, int height);
+    // Optional, may be NULL. Frees a texture that is no longer drawn with, its id may be returned
+    // by new_texture again. Without it, texture ids are reused by uploading over them.
+    void (*delete_texture)(uint32_t texture_id);
+    // Optional, may be NULL. Uploads a texture from a GFX_TEXTURE_PACK_TILED texture pack (see
+    // gfx_texture_pack.h) as is. width and height are the texture's own, before rounding up.
+    void (*upload_tiled_texture)(const uint8_t *tiled_buf, int width, int height);
     void (*set_sampler_parameters)(int sampler, bool linear_filter, uint32_t cms, uint32_t cmt);
     void (*set_depth_test)(bool depth_test);
     void (*set_depth_mask)(bool z_upd);
@@ -25,6 +31,9 @@ struct GfxRenderingAPI {
     void (*set_scissor)(int x, int y, int width, int height);
     void (*set_use_alpha)(bool use_alpha);
     void (*draw_triangles)(float buf_vbo[], size_t buf_vbo_len, size_t buf_vbo_num_tris);
+    // Optional, may be NULL. buf_vbo holds buf_vbo_num_verts unique vertices and buf_ibo
+    // holds 3 indices into them per triangle.
+    void (*draw_indexed)(float buf_vbo[], size_t buf_vbo_len, size_t buf_vbo_num_verts, const uint16_t buf_ibo[], size_t buf_vbo_num_tris);
     void (*init)(void);
     void (*on_resize)(void);
     void (*start_frame)(void);
@@ -0,0 +1,221 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#ifndef _LANGUAGE_C
+#define _LANGUAGE_C
+#endif
+#include <PR/gbi.h>
+
+#include "gfx_texture_pack.h"
+
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+static inline uint64_t gfx_xxh64_rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t gfx_xxh64_read64(const uint8_t *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t gfx_xxh64_round(uint64_t acc, uint64_t input) {
+    acc += input * XXH_PRIME64_2;
+    return gfx_xxh64_rotl(acc, 31) * XXH_PRIME64_1;
+}
+
+static inline uint64_t gfx_xxh64_merge(uint64_t acc, uint64_t val) {
+    acc ^= gfx_xxh64_round(0, val);
+    return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+// XXH64, reading words in native byte order
+static uint64_t gfx_xxh64(const uint8_t *p, size_t len, uint64_t seed) {
+    const uint8_t *end = p + len;
+    uint64_t h;
+
+    if (len >= 32) {
+        uint64_t v1 = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+        uint64_t v2 = seed + XXH_PRIME64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - XXH_PRIME64_1;
+        do {
+            v1 = gfx_xxh64_round(v1, gfx_xxh64_read64(p));
+            v2 = gfx_xxh64_round(v2, gfx_xxh64_read64(p + 8));
+            v3 = gfx_xxh64_round(v3, gfx_xxh64_read64(p + 16));
+            v4 = gfx_xxh64_round(v4, gfx_xxh64_read64(p + 24));
+            p += 32;
+        } while (end - p >= 32);
+        h = gfx_xxh64_rotl(v1, 1) + gfx_xxh64_rotl(v2, 7) + gfx_xxh64_rotl(v3, 12) + gfx_xxh64_rotl(v4, 18);
+        h = gfx_xxh64_merge(h, v1);
+        h = gfx_xxh64_merge(h, v2);
+        h = gfx_xxh64_merge(h, v3);
+        h = gfx_xxh64_merge(h, v4);
+    } else {
+        h = seed + XXH_PRIME64_5;
+    }
+    h += len;
+
+    for (; end - p >= 8; p += 8) {
+        h ^= gfx_xxh64_round(0, gfx_xxh64_read64(p));
+        h = gfx_xxh64_rotl(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+    }
+    if (end - p >= 4) {
+        uint32_t v;
+        memcpy(&v, p, sizeof(v));
+        h ^= v * XXH_PRIME64_1;
+        h = gfx_xxh64_rotl(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= *p * XXH_PRIME64_5;
+        h = gfx_xxh64_rotl(h, 11) * XXH_PRIME64_1;
+    }
+
+    h ^= h >> 33;
+    h *= XXH_PRIME64_2;
+    h ^= h >> 29;
+    h *= XXH_PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+uint64_t gfx_texture_pack_key(const uint8_t *texels, uint32_t size_bytes, uint8_t fmt, uint8_t siz,
+                              const uint8_t *palette, uint32_t palette_size_bytes) {
+    uint64_t key = gfx_xxh64(texels, size_bytes, fmt | (siz << 8));
+    if (fmt == G_IM_FMT_CI) {
+        key = gfx_xxh64(palette, palette_size_bytes, key);
+    }
+    return key;
+}
+
+bool gfx_texture_pack_open(struct GfxTexturePack *pack, const char *path) {
+    memset(pack, 0, sizeof(*pack));
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return false;
+    }
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = size > 0 ? malloc(size) : NULL;
+    if (data == NULL || fread(data, 1, size, f) != (size_t) size) {
+        free(data);
+        fclose(f);
+        return false;
+    }
+    fclose(f);
+
+    // header: magic, version, layout, num_entries, padding
+    uint32_t header[4];
+    const size_t header_size = 8 + sizeof(header);
+    if ((size_t) size < header_size || memcmp(data, GFX_TEXTURE_PACK_MAGIC, 8) != 0) {
+        free(data);
+        return false;
+    }
+    memcpy(header, data + 8, sizeof(header));
+    const struct GfxTexturePackEntry *entries = (const struct GfxTexturePackEntry *) (data + header_size);
+    if (header[0] != GFX_TEXTURE_PACK_VERSION || header[1] > GFX_TEXTURE_PACK_TILED ||
+        header[2] > ((size_t) size - header_size) / sizeof(struct GfxTexturePackEntry)) {
+        free(data);
+        return false;
+    }
+    for (uint32_t i = 0; i < header[2]; i++) {
+        if (entries[i].offset > (size_t) size ||
+            gfx_texture_pack_texels_size(header[1], entries[i].width, entries[i].height) > (size_t) size - entries[i].offset) {
+            free(data);
+            return false;
+        }
+    }
+
+    pack->data = data;
+    pack->entries = entries;
+    pack->num_entries = header[2];
+    pack->layout = header[1];
+    return true;
+}
+
+void gfx_texture_pack_close(struct GfxTexturePack *pack) {
+    free(pack->data);
+    memset(pack, 0, sizeof(*pack));
+}
+
+const struct GfxTexturePackEntry *gfx_texture_pack_find(const struct GfxTexturePack *pack, uint64_t key, uint8_t fmt,
+                                                        uint8_t siz, uint32_t size_bytes, uint32_t width, uint32_t height) {
+    uint32_t lo = 0, hi = pack->num_entries;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (pack->entries[mid].key < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    for (; lo < pack->num_entries && pack->entries[lo].key == key; lo++) {
+        const struct GfxTexturePackEntry *entry = &pack->entries[lo];
+        // RGBA32 rows of the same texels can be uploaded at any width
+        if (entry->fmt == fmt && entry->siz == siz && entry->size_bytes == size_bytes &&
+            (pack->layout != GFX_TEXTURE_PACK_TILED || (entry->width == width && entry->height == height))) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+void gfx_texture_pack_tiled_size(uint32_t width, uint32_t height, uint32_t *tiled_width, uint32_t *tiled_height) {
+    *tiled_width = width <= 8 ? 8 : 1u << (32 - __builtin_clz(width - 1));
+    *tiled_height = height <= 8 ? 8 : 1u << (32 - __builtin_clz(height - 1));
+}
+
+// Position of each texel of a 4x4 block within it
+static const uint8_t sTileOrder[16] = {
+    0,  1,  4,  5,
+    2,  3,  6,  7,
+    8,  9, 12, 13,
+    10, 11, 14, 15
+};
+
+void gfx_texture_pack_tile(uint32_t *dst, const uint8_t *rgba32_buf, uint32_t width, uint32_t height) {
+    const uint32_t *src = (const uint32_t *) rgba32_buf;
+    uint32_t tiled_width, tiled_height;
+    gfx_texture_pack_tiled_size(width, height, &tiled_width, &tiled_height);
+
+    for (uint32_t y = 0; y < tiled_height; y += 8) {
+        for (uint32_t x = 0; x < tiled_width; x += 8) {
+            for (int i = 0; i < 64; i++) {
+                uint32_t x2 = i & 7;
+                uint32_t y2 = i >> 3;
+                // Sides that were rounded up repeat the texture. The 3DS has no divide instruction,
+                // so only those pay for the modulo.
+                uint32_t src_x = x + x2;
+                uint32_t src_y = y + y2;
+                if (src_x >= width) {
+                    src_x %= width;
+                }
+                if (src_y >= height) {
+                    src_y %= height;
+                }
+                int pos = sTileOrder[(x2 & 3) + ((y2 & 3) << 2)] + ((x2 >> 2) << 4) + ((y2 >> 2) << 5);
+                uint32_t c = src[src_y * width + src_x];
+                dst[pos] = ((c & 0xFF) << 24) | (((c >> 8) & 0xFF) << 16) | (((c >> 16) & 0xFF) << 8) | (c >> 24);
+            }
+            dst += 64;
+        }
+    }
+}
+
+uint32_t gfx_texture_pack_texels_size(uint32_t layout, uint32_t width, uint32_t height) {
+    if (layout == GFX_TEXTURE_PACK_TILED) {
+        gfx_texture_pack_tiled_size(width, height, &width, &height);
+    }
+    return width * height * 4;
+}
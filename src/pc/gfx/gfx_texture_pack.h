@@ -0,0 +1,82 @@
+#ifndef GFX_TEXTURE_PACK_H
+#define GFX_TEXTURE_PACK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Pre-converted texture pack.
+//
+// Built from the extracted texture assets by tools/texture_pack.c ('make texture-pack'), it holds
+// every texture already decoded to the layout the rendering API uploads, so that a texture cache
+// miss on a packed texture skips the import_texture_* conversion entirely:
+// - GFX_TEXTURE_PACK_RGBA32, the RGBA32 rows that upload_texture takes, for the PC rendering APIs.
+// - GFX_TEXTURE_PACK_TILED, the 3DS GPU's own RGBA8 layout, built for TARGET_N3DS. gfx_citro3d.c
+//   uploads it with no conversion at all, skipping the swizzle that upload_texture does.
+//
+// Entries are keyed the same way as the texture cache's content level: a hash of the loaded
+// texels (and the loaded TLUT for CI formats), plus the format, size and number of texel bytes.
+// This keeps a pack valid for any build of the same assets, wherever they end up in memory.
+// Tiled texels depend on the width a texture is loaded at, so in that layout an entry also has to
+// match the width and height of the load; any other load of the same texels is converted as before.
+//
+// The whole file is read into memory when it is opened, so that a miss costs no file access.
+//
+// Layout (native endianness):
+//   header:  char magic[8] "SM64TPAK", u32 version, u32 layout, u32 num_entries, u32 0
+//   entries: num_entries x GfxTexturePackEntry, sorted by key
+//   data:    each entry's texels at its offset from the start of the file
+
+#define GFX_TEXTURE_PACK_MAGIC "SM64TPAK"
+#define GFX_TEXTURE_PACK_VERSION 2
+
+enum GfxTexturePackLayout {
+    GFX_TEXTURE_PACK_RGBA32,
+    // 8x8 tiles of byte-swapped RGBA32 texels in Morton order, with the texture repeated up to sides
+    // that are powers of two of at least 8, see gfx_texture_pack_tile
+    GFX_TEXTURE_PACK_TILED
+};
+
+struct GfxTexturePackEntry {
+    uint64_t key;
+    uint32_t offset;
+    uint16_t size_bytes;
+    uint8_t fmt, siz;
+    uint16_t width, height;
+};
+
+struct GfxTexturePack {
+    uint8_t *data; // The whole file
+    const struct GfxTexturePackEntry *entries;
+    uint32_t num_entries;
+    uint32_t layout;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint64_t gfx_texture_pack_key(const uint8_t *texels, uint32_t size_bytes, uint8_t fmt, uint8_t siz,
+                              const uint8_t *palette, uint32_t palette_size_bytes);
+
+bool gfx_texture_pack_open(struct GfxTexturePack *pack, const char *path);
+void gfx_texture_pack_close(struct GfxTexturePack *pack);
+const struct GfxTexturePackEntry *gfx_texture_pack_find(const struct GfxTexturePack *pack, uint64_t key, uint8_t fmt,
+                                                        uint8_t siz, uint32_t size_bytes, uint32_t width, uint32_t height);
+static inline const uint8_t *gfx_texture_pack_texels(const struct GfxTexturePack *pack, const struct GfxTexturePackEntry *entry) {
+    return pack->data + entry->offset;
+}
+
+// Rounds a texture's sides up to the ones it has in GFX_TEXTURE_PACK_TILED
+void gfx_texture_pack_tiled_size(uint32_t width, uint32_t height, uint32_t *tiled_width, uint32_t *tiled_height);
+// Converts RGBA32 rows to GFX_TEXTURE_PACK_TILED. Shared by gfx_citro3d.c and tools/texture_pack.c,
+// so that packed textures are uploaded exactly as converted ones are.
+void gfx_texture_pack_tile(uint32_t *dst, const uint8_t *rgba32_buf, uint32_t width, uint32_t height);
+// Bytes of texels an entry holds in the given layout
+uint32_t gfx_texture_pack_texels_size(uint32_t layout, uint32_t width, uint32_t height);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
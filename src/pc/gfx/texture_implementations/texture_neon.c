@@ -0,0 +1,151 @@
+/*
+ * NEON texel converters. Decode 16 or 32 texels at a time, using table lookups
+ * so that every SCALE_* result matches texture_reference.c exactly.
+ * Only uses instructions that ARMv7 NEON also has.
+ */
+
+#include <arm_neon.h>
+
+#include "src/pc/gfx/texture_implementations/texture_tables.c"
+
+static inline uint8x16_t gfx_neon_lookup16(uint8x8x2_t table, uint8x16_t idx) {
+    return vcombine_u8(vtbl2_u8(table, vget_low_u8(idx)), vtbl2_u8(table, vget_high_u8(idx)));
+}
+
+static inline uint8x16_t gfx_neon_lookup32(uint8x8x4_t table, uint8x16_t idx) {
+    return vcombine_u8(vtbl4_u8(table, vget_low_u8(idx)), vtbl4_u8(table, vget_high_u8(idx)));
+}
+
+static inline uint8x8x2_t gfx_neon_load_table16(const uint8_t table[16]) {
+    uint8x8x2_t t = { { vld1_u8(table), vld1_u8(table + 8) } };
+    return t;
+}
+
+static inline void gfx_neon_store_rgba(uint8_t *dst, uint8x16_t r, uint8x16_t g, uint8x16_t b, uint8x16_t a) {
+    uint8x16x4_t rgba = { { r, g, b, a } };
+    vst4q_u8(dst, rgba);
+}
+
+// Splits 16 bytes into 32 4-bit texels, high nibble first
+static inline uint8x16x2_t gfx_neon_load_nibbles(const uint8_t *src) {
+    uint8x16_t p = vld1q_u8(src);
+    return vzipq_u8(vshrq_n_u8(p, 4), vandq_u8(p, vdupq_n_u8(0x0f)));
+}
+
+static void gfx_convert_rgba16_neon(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    const uint8x8x4_t scale5 = { { vld1_u8(gfx_texel_scale_5_8), vld1_u8(gfx_texel_scale_5_8 + 8),
+                                   vld1_u8(gfx_texel_scale_5_8 + 16), vld1_u8(gfx_texel_scale_5_8 + 24) } };
+    uint32_t i = 0;
+    for (; i + 32 <= size_bytes; i += 32, dst += 64) {
+        // Big endian texels: val[0] holds the high bytes
+        uint8x16x2_t p = vld2q_u8(src + i);
+        uint8x16_t r = vshrq_n_u8(p.val[0], 3);
+        uint8x16_t g = vorrq_u8(vshlq_n_u8(vandq_u8(p.val[0], vdupq_n_u8(7)), 2), vshrq_n_u8(p.val[1], 6));
+        uint8x16_t b = vandq_u8(vshrq_n_u8(p.val[1], 1), vdupq_n_u8(0x1f));
+        uint8x16_t a = vtstq_u8(p.val[1], vdupq_n_u8(1));
+        gfx_neon_store_rgba(dst, gfx_neon_lookup32(scale5, r), gfx_neon_lookup32(scale5, g), gfx_neon_lookup32(scale5, b), a);
+    }
+    gfx_convert_rgba16_reference(dst, src + i, size_bytes - i, palette);
+}
+
+static void gfx_convert_ia4_neon(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    const uint8x8x2_t intensity_table = gfx_neon_load_table16(gfx_texel_ia4_intensity);
+    const uint8x8x2_t alpha_table = gfx_neon_load_table16(gfx_texel_ia4_alpha);
+    uint32_t i = 0;
+    for (; i + 16 <= size_bytes; i += 16, dst += 128) {
+        uint8x16x2_t n = gfx_neon_load_nibbles(src + i);
+        for (int k = 0; k < 2; k++) {
+            uint8x16_t intensity = gfx_neon_lookup16(intensity_table, n.val[k]);
+            gfx_neon_store_rgba(dst + 64 * k, intensity, intensity, intensity, gfx_neon_lookup16(alpha_table, n.val[k]));
+        }
+    }
+    gfx_convert_ia4_reference(dst, src + i, size_bytes - i, palette);
+}
+
+static void gfx_convert_ia8_neon(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    const uint8x8x2_t scale4 = gfx_neon_load_table16(gfx_texel_scale_4_8);
+    uint32_t i = 0;
+    for (; i + 16 <= size_bytes; i += 16, dst += 64) {
+        uint8x16_t p = vld1q_u8(src + i);
+        uint8x16_t intensity = gfx_neon_lookup16(scale4, vshrq_n_u8(p, 4));
+        uint8x16_t alpha = gfx_neon_lookup16(scale4, vandq_u8(p, vdupq_n_u8(0x0f)));
+        gfx_neon_store_rgba(dst, intensity, intensity, intensity, alpha);
+    }
+    gfx_convert_ia8_reference(dst, src + i, size_bytes - i, palette);
+}
+
+static void gfx_convert_ia16_neon(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    uint32_t i = 0;
+    for (; i + 32 <= size_bytes; i += 32, dst += 64) {
+        uint8x16x2_t p = vld2q_u8(src + i);
+        gfx_neon_store_rgba(dst, p.val[0], p.val[0], p.val[0], p.val[1]);
+    }
+    gfx_convert_ia16_reference(dst, src + i, size_bytes - i, palette);
+}
+
+static void gfx_convert_i4_neon(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    const uint8x8x2_t scale4 = gfx_neon_load_table16(gfx_texel_scale_4_8);
+    const uint8x16_t opaque = vdupq_n_u8(255);
+    uint32_t i = 0;
+    for (; i + 16 <= size_bytes; i += 16, dst += 128) {
+        uint8x16x2_t n = gfx_neon_load_nibbles(src + i);
+        for (int k = 0; k < 2; k++) {
+            uint8x16_t intensity = gfx_neon_lookup16(scale4, n.val[k]);
+            gfx_neon_store_rgba(dst + 64 * k, intensity, intensity, intensity, opaque);
+        }
+    }
+    gfx_convert_i4_reference(dst, src + i, size_bytes - i, palette);
+}
+
+static void gfx_convert_i8_neon(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    const uint8x16_t opaque = vdupq_n_u8(255);
+    uint32_t i = 0;
+    for (; i + 16 <= size_bytes; i += 16, dst += 64) {
+        uint8x16_t intensity = vld1q_u8(src + i);
+        gfx_neon_store_rgba(dst, intensity, intensity, intensity, opaque);
+    }
+    gfx_convert_i8_reference(dst, src + i, size_bytes - i, palette);
+}
+
+static void gfx_convert_ci4_neon(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    // Decode the used palette entries once, then look texels up by channel
+    uint8_t colors[16 * 4];
+    uint8_t channels[4][16] = { { 0 } };
+    uint32_t num_colors = gfx_texel_max_index(src, size_bytes, true) + 1;
+    gfx_convert_rgba16_reference(colors, palette, num_colors * 2, NULL);
+    for (uint32_t c = 0; c < num_colors; c++) {
+        for (int k = 0; k < 4; k++) {
+            channels[k][c] = colors[4 * c + k];
+        }
+    }
+    uint8x8x2_t tables[4];
+    for (int k = 0; k < 4; k++) {
+        tables[k] = gfx_neon_load_table16(channels[k]);
+    }
+
+    uint32_t i = 0;
+    for (; i + 16 <= size_bytes; i += 16, dst += 128) {
+        uint8x16x2_t n = gfx_neon_load_nibbles(src + i);
+        for (int k = 0; k < 2; k++) {
+            gfx_neon_store_rgba(dst + 64 * k, gfx_neon_lookup16(tables[0], n.val[k]), gfx_neon_lookup16(tables[1], n.val[k]),
+                                gfx_neon_lookup16(tables[2], n.val[k]), gfx_neon_lookup16(tables[3], n.val[k]));
+        }
+    }
+    gfx_convert_ci4_reference(dst, src + i, size_bytes - i, palette);
+}
+
+static void gfx_convert_ci8_neon(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    // A 256 entry table is too big for vtbl, so this only decodes each used
+    // palette entry once and copies whole texels
+    uint32_t colors[256];
+    uint32_t num_colors = gfx_texel_max_index(src, size_bytes, false) + 1;
+    if (num_colors > size_bytes) {
+        gfx_convert_ci8_reference(dst, src, size_bytes, palette);
+        return;
+    }
+    gfx_convert_rgba16_reference((uint8_t *) colors, palette, num_colors * 2, NULL);
+
+    for (uint32_t i = 0; i < size_bytes; i++) {
+        memcpy(dst + 4 * i, &colors[src[i]], sizeof(uint32_t));
+    }
+}
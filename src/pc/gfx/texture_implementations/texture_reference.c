@@ -0,0 +1,125 @@
+/*
+ * Scalar texel format converters, decoding size_bytes of texture data at src to RGBA32 at dst.
+ * This is included directly by gfx_pc.c, which selects between the files in
+ * this directory the same way mixer.c does; it must not be in the build path.
+ *
+ * Every other implementation falls back to these for texels that do not fill a
+ * whole SIMD batch, and must produce byte-identical output.
+ */
+
+static void gfx_convert_rgba16_reference(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, UNUSED const uint8_t *palette) {
+    for (uint32_t i = 0; i < size_bytes / 2; i++) {
+        uint16_t col16 = (src[2 * i] << 8) | src[2 * i + 1];
+        uint8_t a = col16 & 1;
+        uint8_t r = col16 >> 11;
+        uint8_t g = (col16 >> 6) & 0x1f;
+        uint8_t b = (col16 >> 1) & 0x1f;
+        dst[4*i + 0] = SCALE_5_8(r);
+        dst[4*i + 1] = SCALE_5_8(g);
+        dst[4*i + 2] = SCALE_5_8(b);
+        dst[4*i + 3] = a ? 255 : 0;
+    }
+}
+
+static void gfx_convert_ia4_reference(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, UNUSED const uint8_t *palette) {
+    for (uint32_t i = 0; i < size_bytes * 2; i++) {
+        uint8_t byte = src[i / 2];
+        uint8_t part = (byte >> (4 - (i % 2) * 4)) & 0xf;
+        uint8_t intensity = part >> 1;
+        uint8_t alpha = part & 1;
+        uint8_t r = intensity;
+        uint8_t g = intensity;
+        uint8_t b = intensity;
+        dst[4*i + 0] = SCALE_3_8(r);
+        dst[4*i + 1] = SCALE_3_8(g);
+        dst[4*i + 2] = SCALE_3_8(b);
+        dst[4*i + 3] = alpha ? 255 : 0;
+    }
+}
+
+static void gfx_convert_ia8_reference(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, UNUSED const uint8_t *palette) {
+    for (uint32_t i = 0; i < size_bytes; i++) {
+        uint8_t intensity = src[i] >> 4;
+        uint8_t alpha = src[i] & 0xf;
+        uint8_t r = intensity;
+        uint8_t g = intensity;
+        uint8_t b = intensity;
+        dst[4*i + 0] = SCALE_4_8(r);
+        dst[4*i + 1] = SCALE_4_8(g);
+        dst[4*i + 2] = SCALE_4_8(b);
+        dst[4*i + 3] = SCALE_4_8(alpha);
+    }
+}
+
+static void gfx_convert_ia16_reference(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, UNUSED const uint8_t *palette) {
+    for (uint32_t i = 0; i < size_bytes / 2; i++) {
+        uint8_t intensity = src[2 * i];
+        uint8_t alpha = src[2 * i + 1];
+        uint8_t r = intensity;
+        uint8_t g = intensity;
+        uint8_t b = intensity;
+        dst[4*i + 0] = r;
+        dst[4*i + 1] = g;
+        dst[4*i + 2] = b;
+        dst[4*i + 3] = alpha;
+    }
+}
+
+static void gfx_convert_i4_reference(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, UNUSED const uint8_t *palette) {
+    for (uint32_t i = 0; i < size_bytes * 2; i++) {
+        uint8_t byte = src[i / 2];
+        uint8_t part = (byte >> (4 - (i % 2) * 4)) & 0xf;
+        uint8_t intensity = part;
+        uint8_t r = intensity;
+        uint8_t g = intensity;
+        uint8_t b = intensity;
+        dst[4*i + 0] = SCALE_4_8(r);
+        dst[4*i + 1] = SCALE_4_8(g);
+        dst[4*i + 2] = SCALE_4_8(b);
+        dst[4*i + 3] = 255;
+    }
+}
+
+static void gfx_convert_i8_reference(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, UNUSED const uint8_t *palette) {
+    for (uint32_t i = 0; i < size_bytes; i++) {
+        uint8_t intensity = src[i];
+        uint8_t r = intensity;
+        uint8_t g = intensity;
+        uint8_t b = intensity;
+        dst[4*i + 0] = r;
+        dst[4*i + 1] = g;
+        dst[4*i + 2] = b;
+        dst[4*i + 3] = 255;
+    }
+}
+
+static void gfx_convert_ci4_reference(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    for (uint32_t i = 0; i < size_bytes * 2; i++) {
+        uint8_t byte = src[i / 2];
+        uint8_t idx = (byte >> (4 - (i % 2) * 4)) & 0xf;
+        uint16_t col16 = (palette[idx * 2] << 8) | palette[idx * 2 + 1]; // Big endian load
+        uint8_t a = col16 & 1;
+        uint8_t r = col16 >> 11;
+        uint8_t g = (col16 >> 6) & 0x1f;
+        uint8_t b = (col16 >> 1) & 0x1f;
+        dst[4*i + 0] = SCALE_5_8(r);
+        dst[4*i + 1] = SCALE_5_8(g);
+        dst[4*i + 2] = SCALE_5_8(b);
+        dst[4*i + 3] = a ? 255 : 0;
+    }
+}
+
+static void gfx_convert_ci8_reference(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    for (uint32_t i = 0; i < size_bytes; i++) {
+        uint8_t idx = src[i];
+        uint16_t col16 = (palette[idx * 2] << 8) | palette[idx * 2 + 1]; // Big endian load
+        uint8_t a = col16 & 1;
+        uint8_t r = col16 >> 11;
+        uint8_t g = (col16 >> 6) & 0x1f;
+        uint8_t b = (col16 >> 1) & 0x1f;
+        dst[4*i + 0] = SCALE_5_8(r);
+        dst[4*i + 1] = SCALE_5_8(g);
+        dst[4*i + 2] = SCALE_5_8(b);
+        dst[4*i + 3] = a ? 255 : 0;
+    }
+}
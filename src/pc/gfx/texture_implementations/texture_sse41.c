@@ -0,0 +1,178 @@
+/*
+ * SSE4.1 texel converters. Decode 16 or 32 texels at a time, using byte shuffles
+ * as lookup tables so that every SCALE_* result matches texture_reference.c exactly.
+ */
+
+#include <smmintrin.h>
+
+#include "src/pc/gfx/texture_implementations/texture_tables.c"
+
+static inline __m128i gfx_sse41_lookup16(const uint8_t table[16], __m128i idx) {
+    return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) table), idx);
+}
+
+// Indices must be below 32; bit 4 picks the table half
+static inline __m128i gfx_sse41_lookup32(const uint8_t table[32], __m128i idx) {
+    __m128i lo = gfx_sse41_lookup16(table, idx);
+    __m128i hi = gfx_sse41_lookup16(table + 16, idx);
+    return _mm_blendv_epi8(lo, hi, _mm_slli_epi16(idx, 3));
+}
+
+static inline void gfx_sse41_store_rgba(uint8_t *dst, __m128i r, __m128i g, __m128i b, __m128i a) {
+    __m128i rg_lo = _mm_unpacklo_epi8(r, g);
+    __m128i rg_hi = _mm_unpackhi_epi8(r, g);
+    __m128i ba_lo = _mm_unpacklo_epi8(b, a);
+    __m128i ba_hi = _mm_unpackhi_epi8(b, a);
+    _mm_storeu_si128((__m128i *) dst, _mm_unpacklo_epi16(rg_lo, ba_lo));
+    _mm_storeu_si128((__m128i *) (dst + 16), _mm_unpackhi_epi16(rg_lo, ba_lo));
+    _mm_storeu_si128((__m128i *) (dst + 32), _mm_unpacklo_epi16(rg_hi, ba_hi));
+    _mm_storeu_si128((__m128i *) (dst + 48), _mm_unpackhi_epi16(rg_hi, ba_hi));
+}
+
+// Splits 16 big endian 16-bit texels into their first and second bytes
+static inline void gfx_sse41_load_pairs(const uint8_t *src, __m128i *first, __m128i *second) {
+    const __m128i split = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+    __m128i p0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) src), split);
+    __m128i p1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (src + 16)), split);
+    *first = _mm_unpacklo_epi64(p0, p1);
+    *second = _mm_unpackhi_epi64(p0, p1);
+}
+
+// Splits 16 bytes into 32 4-bit texels, high nibble first
+static inline void gfx_sse41_load_nibbles(const uint8_t *src, __m128i *n0, __m128i *n1) {
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    __m128i p = _mm_loadu_si128((const __m128i *) src);
+    __m128i hi = _mm_and_si128(_mm_srli_epi16(p, 4), mask);
+    __m128i lo = _mm_and_si128(p, mask);
+    *n0 = _mm_unpacklo_epi8(hi, lo);
+    *n1 = _mm_unpackhi_epi8(hi, lo);
+}
+
+static void gfx_convert_rgba16_sse41(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    const __m128i mask5 = _mm_set1_epi8(0x1f);
+    const __m128i one = _mm_set1_epi8(1);
+    uint32_t i = 0;
+    for (; i + 32 <= size_bytes; i += 32, dst += 64) {
+        __m128i hi, lo;
+        gfx_sse41_load_pairs(src + i, &hi, &lo);
+        __m128i r = _mm_and_si128(_mm_srli_epi16(hi, 3), mask5);
+        __m128i g = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(hi, _mm_set1_epi8(7)), 2),
+                                 _mm_and_si128(_mm_srli_epi16(lo, 6), _mm_set1_epi8(3)));
+        __m128i b = _mm_and_si128(_mm_srli_epi16(lo, 1), mask5);
+        __m128i a = _mm_cmpeq_epi8(_mm_and_si128(lo, one), one);
+        gfx_sse41_store_rgba(dst, gfx_sse41_lookup32(gfx_texel_scale_5_8, r), gfx_sse41_lookup32(gfx_texel_scale_5_8, g),
+                             gfx_sse41_lookup32(gfx_texel_scale_5_8, b), a);
+    }
+    gfx_convert_rgba16_reference(dst, src + i, size_bytes - i, palette);
+}
+
+static void gfx_convert_ia4_sse41(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    uint32_t i = 0;
+    for (; i + 16 <= size_bytes; i += 16, dst += 128) {
+        __m128i n[2];
+        gfx_sse41_load_nibbles(src + i, &n[0], &n[1]);
+        for (int k = 0; k < 2; k++) {
+            __m128i intensity = gfx_sse41_lookup16(gfx_texel_ia4_intensity, n[k]);
+            __m128i alpha = gfx_sse41_lookup16(gfx_texel_ia4_alpha, n[k]);
+            gfx_sse41_store_rgba(dst + 64 * k, intensity, intensity, intensity, alpha);
+        }
+    }
+    gfx_convert_ia4_reference(dst, src + i, size_bytes - i, palette);
+}
+
+static void gfx_convert_ia8_sse41(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    uint32_t i = 0;
+    for (; i + 16 <= size_bytes; i += 16, dst += 64) {
+        __m128i p = _mm_loadu_si128((const __m128i *) (src + i));
+        __m128i intensity = gfx_sse41_lookup16(gfx_texel_scale_4_8, _mm_and_si128(_mm_srli_epi16(p, 4), mask));
+        __m128i alpha = gfx_sse41_lookup16(gfx_texel_scale_4_8, _mm_and_si128(p, mask));
+        gfx_sse41_store_rgba(dst, intensity, intensity, intensity, alpha);
+    }
+    gfx_convert_ia8_reference(dst, src + i, size_bytes - i, palette);
+}
+
+static void gfx_convert_ia16_sse41(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    const __m128i lo = _mm_setr_epi8(0, 0, 0, 1, 2, 2, 2, 3, 4, 4, 4, 5, 6, 6, 6, 7);
+    const __m128i hi = _mm_setr_epi8(8, 8, 8, 9, 10, 10, 10, 11, 12, 12, 12, 13, 14, 14, 14, 15);
+    uint32_t i = 0;
+    for (; i + 16 <= size_bytes; i += 16, dst += 32) {
+        __m128i p = _mm_loadu_si128((const __m128i *) (src + i));
+        _mm_storeu_si128((__m128i *) dst, _mm_shuffle_epi8(p, lo));
+        _mm_storeu_si128((__m128i *) (dst + 16), _mm_shuffle_epi8(p, hi));
+    }
+    gfx_convert_ia16_reference(dst, src + i, size_bytes - i, palette);
+}
+
+static void gfx_convert_i4_sse41(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    const __m128i opaque = _mm_set1_epi8(-1);
+    uint32_t i = 0;
+    for (; i + 16 <= size_bytes; i += 16, dst += 128) {
+        __m128i n[2];
+        gfx_sse41_load_nibbles(src + i, &n[0], &n[1]);
+        for (int k = 0; k < 2; k++) {
+            __m128i intensity = gfx_sse41_lookup16(gfx_texel_scale_4_8, n[k]);
+            gfx_sse41_store_rgba(dst + 64 * k, intensity, intensity, intensity, opaque);
+        }
+    }
+    gfx_convert_i4_reference(dst, src + i, size_bytes - i, palette);
+}
+
+static void gfx_convert_i8_sse41(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    // Replicates each byte into r, g and b; the zeroed alpha byte is then set
+    const __m128i spread[4] = {
+        _mm_setr_epi8(0, 0, 0, -1, 1, 1, 1, -1, 2, 2, 2, -1, 3, 3, 3, -1),
+        _mm_setr_epi8(4, 4, 4, -1, 5, 5, 5, -1, 6, 6, 6, -1, 7, 7, 7, -1),
+        _mm_setr_epi8(8, 8, 8, -1, 9, 9, 9, -1, 10, 10, 10, -1, 11, 11, 11, -1),
+        _mm_setr_epi8(12, 12, 12, -1, 13, 13, 13, -1, 14, 14, 14, -1, 15, 15, 15, -1),
+    };
+    const __m128i alpha = _mm_set1_epi32(0xff000000);
+    uint32_t i = 0;
+    for (; i + 16 <= size_bytes; i += 16, dst += 64) {
+        __m128i p = _mm_loadu_si128((const __m128i *) (src + i));
+        for (int k = 0; k < 4; k++) {
+            _mm_storeu_si128((__m128i *) (dst + 16 * k), _mm_or_si128(_mm_shuffle_epi8(p, spread[k]), alpha));
+        }
+    }
+    gfx_convert_i8_reference(dst, src + i, size_bytes - i, palette);
+}
+
+static void gfx_convert_ci4_sse41(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    // Decode the used palette entries once, then look texels up by channel
+    uint8_t colors[16 * 4];
+    uint8_t channels[4][16] = { { 0 } };
+    uint32_t num_colors = gfx_texel_max_index(src, size_bytes, true) + 1;
+    gfx_convert_rgba16_reference(colors, palette, num_colors * 2, NULL);
+    for (uint32_t c = 0; c < num_colors; c++) {
+        for (int k = 0; k < 4; k++) {
+            channels[k][c] = colors[4 * c + k];
+        }
+    }
+
+    uint32_t i = 0;
+    for (; i + 16 <= size_bytes; i += 16, dst += 128) {
+        __m128i n[2];
+        gfx_sse41_load_nibbles(src + i, &n[0], &n[1]);
+        for (int k = 0; k < 2; k++) {
+            gfx_sse41_store_rgba(dst + 64 * k, gfx_sse41_lookup16(channels[0], n[k]), gfx_sse41_lookup16(channels[1], n[k]),
+                                 gfx_sse41_lookup16(channels[2], n[k]), gfx_sse41_lookup16(channels[3], n[k]));
+        }
+    }
+    gfx_convert_ci4_reference(dst, src + i, size_bytes - i, palette);
+}
+
+static void gfx_convert_ci8_sse41(uint8_t *dst, const uint8_t *src, uint32_t size_bytes, const uint8_t *palette) {
+    // A 256 entry table is too big for shuffles, and SSE4.1 has no gather, so this only
+    // decodes each used palette entry once and copies whole texels
+    uint32_t colors[256];
+    uint32_t num_colors = gfx_texel_max_index(src, size_bytes, false) + 1;
+    if (num_colors > size_bytes) {
+        gfx_convert_ci8_reference(dst, src, size_bytes, palette);
+        return;
+    }
+    gfx_convert_rgba16_reference((uint8_t *) colors, palette, num_colors * 2, NULL);
+
+    for (uint32_t i = 0; i < size_bytes; i++) {
+        memcpy(dst + 4 * i, &colors[src[i]], sizeof(uint32_t));
+    }
+}
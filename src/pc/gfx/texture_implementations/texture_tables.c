@@ -0,0 +1,34 @@
+/*
+ * Lookup tables and helpers shared by the SIMD texel converters, which include this file.
+ * Entries are computed with the same SCALE_* macros as texture_reference.c.
+ */
+
+// The SCALE_* conversions for every possible input, for table lookups
+static const uint8_t gfx_texel_scale_5_8[32] = {
+    SCALE_5_8(0),  SCALE_5_8(1),  SCALE_5_8(2),  SCALE_5_8(3),  SCALE_5_8(4),  SCALE_5_8(5),  SCALE_5_8(6),  SCALE_5_8(7),
+    SCALE_5_8(8),  SCALE_5_8(9),  SCALE_5_8(10), SCALE_5_8(11), SCALE_5_8(12), SCALE_5_8(13), SCALE_5_8(14), SCALE_5_8(15),
+    SCALE_5_8(16), SCALE_5_8(17), SCALE_5_8(18), SCALE_5_8(19), SCALE_5_8(20), SCALE_5_8(21), SCALE_5_8(22), SCALE_5_8(23),
+    SCALE_5_8(24), SCALE_5_8(25), SCALE_5_8(26), SCALE_5_8(27), SCALE_5_8(28), SCALE_5_8(29), SCALE_5_8(30), SCALE_5_8(31),
+};
+static const uint8_t gfx_texel_scale_4_8[16] = {
+    SCALE_4_8(0),  SCALE_4_8(1),  SCALE_4_8(2),  SCALE_4_8(3),  SCALE_4_8(4),  SCALE_4_8(5),  SCALE_4_8(6),  SCALE_4_8(7),
+    SCALE_4_8(8),  SCALE_4_8(9),  SCALE_4_8(10), SCALE_4_8(11), SCALE_4_8(12), SCALE_4_8(13), SCALE_4_8(14), SCALE_4_8(15),
+};
+// IA4 texels, indexed by the whole nibble
+static const uint8_t gfx_texel_ia4_intensity[16] = {
+    SCALE_3_8(0), SCALE_3_8(0), SCALE_3_8(1), SCALE_3_8(1), SCALE_3_8(2), SCALE_3_8(2), SCALE_3_8(3), SCALE_3_8(3),
+    SCALE_3_8(4), SCALE_3_8(4), SCALE_3_8(5), SCALE_3_8(5), SCALE_3_8(6), SCALE_3_8(6), SCALE_3_8(7), SCALE_3_8(7),
+};
+static const uint8_t gfx_texel_ia4_alpha[16] = {
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+};
+
+// Highest color index used by a CI texture, so that only the loaded part of the palette is read
+static uint32_t gfx_texel_max_index(const uint8_t *src, uint32_t size_bytes, bool nibbles) {
+    uint8_t max_byte = 0, max_low = 0;
+    for (uint32_t i = 0; i < size_bytes; i++) {
+        max_byte = src[i] > max_byte ? src[i] : max_byte;
+        max_low = (src[i] & 0xf) > max_low ? (src[i] & 0xf) : max_low;
+    }
+    return nibbles ? (max_byte >> 4 > max_low ? max_byte >> 4 : max_low) : max_byte;
+}
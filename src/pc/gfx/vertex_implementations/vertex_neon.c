@@ -0,0 +1,169 @@
+/*
+ * AArch64 NEON vertex kernel. Processes four vertices at a time in SoA lanes,
+ * performing the same float operations in the same order as vertex_reference.c.
+ */
+
+#include <arm_neon.h>
+
+static inline float32x4_t gfx_neon_set_f32(float a, float b, float c, float d) {
+    const float tmp[4] = { a, b, c, d };
+    return vld1q_f32(tmp);
+}
+
+static inline int32x4_t gfx_neon_set_s32(int32_t a, int32_t b, int32_t c, int32_t d) {
+    const int32_t tmp[4] = { a, b, c, d };
+    return vld1q_s32(tmp);
+}
+
+// Sign-extends the low 16 bits of each lane, like storing an int into a short
+static inline int32x4_t gfx_neon_to_short(int32x4_t v) {
+    return vshrq_n_s32(vshlq_n_s32(v, 16), 16);
+}
+
+static inline uint32x4_t gfx_neon_clip_bit(uint32x4_t mask, uint32_t bit) {
+    return vandq_u32(mask, vdupq_n_u32(bit));
+}
+
+static void gfx_transform_vertices_neon(size_t n_vertices, size_t dest_index, const Vtx *vertices) {
+    const bool lighting = (rsp.geometry_mode & G_LIGHTING) != 0;
+    const bool texture_gen = lighting && (rsp.geometry_mode & G_TEXTURE_GEN) != 0;
+    const bool fog = (rsp.geometry_mode & G_FOG) != 0;
+    const int num_dir_lights = rsp.current_num_lights - 1;
+    const Light_t *ambient = &rsp.current_lights[num_dir_lights];
+
+    const float32x4_t aspect = vdupq_n_f32(gfx_adjust_x_for_aspect_ratio(1.0f));
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const int32x4_t scale_s = vdupq_n_s32(rsp.texture_scaling_factor.s);
+    const int32x4_t scale_t = vdupq_n_s32(rsp.texture_scaling_factor.t);
+
+    size_t i = 0;
+    for (; i + 4 <= n_vertices; i += 4, dest_index += 4) {
+        const Vtx *src = &vertices[i];
+        struct LoadedVertex *d = &rsp.loaded_vertices[dest_index];
+
+        float32x4_t ox = gfx_neon_set_f32(src[0].v.ob[0], src[1].v.ob[0], src[2].v.ob[0], src[3].v.ob[0]);
+        float32x4_t oy = gfx_neon_set_f32(src[0].v.ob[1], src[1].v.ob[1], src[2].v.ob[1], src[3].v.ob[1]);
+        float32x4_t oz = gfx_neon_set_f32(src[0].v.ob[2], src[1].v.ob[2], src[2].v.ob[2], src[3].v.ob[2]);
+
+        float32x4x4_t pos;
+        for (int c = 0; c < 4; c++) {
+            pos.val[c] = vaddq_f32(vaddq_f32(vaddq_f32(
+                vmulq_f32(ox, vdupq_n_f32(rsp.MP_matrix[0][c])),
+                vmulq_f32(oy, vdupq_n_f32(rsp.MP_matrix[1][c]))),
+                vmulq_f32(oz, vdupq_n_f32(rsp.MP_matrix[2][c]))),
+                vdupq_n_f32(rsp.MP_matrix[3][c]));
+        }
+        pos.val[0] = vmulq_f32(pos.val[0], aspect);
+
+        // Trivial clip rejection
+        float32x4_t w = pos.val[3];
+        float32x4_t neg_w = vnegq_f32(w);
+        uint32x4_t clip = gfx_neon_clip_bit(vcltq_f32(pos.val[0], neg_w), 1);
+        clip = vorrq_u32(clip, gfx_neon_clip_bit(vcgtq_f32(pos.val[0], w), 2));
+        clip = vorrq_u32(clip, gfx_neon_clip_bit(vcltq_f32(pos.val[1], neg_w), 4));
+        clip = vorrq_u32(clip, gfx_neon_clip_bit(vcgtq_f32(pos.val[1], w), 8));
+        clip = vorrq_u32(clip, gfx_neon_clip_bit(vcltq_f32(pos.val[2], neg_w), 16));
+        clip = vorrq_u32(clip, gfx_neon_clip_bit(vcgtq_f32(pos.val[2], w), 32));
+
+        int32x4_t tc_s = gfx_neon_set_s32(src[0].v.tc[0], src[1].v.tc[0], src[2].v.tc[0], src[3].v.tc[0]);
+        int32x4_t tc_t = gfx_neon_set_s32(src[0].v.tc[1], src[1].v.tc[1], src[2].v.tc[1], src[3].v.tc[1]);
+        int32x4_t u = vshrq_n_s32(vmulq_s32(tc_s, scale_s), 16);
+        int32x4_t v = vshrq_n_s32(vmulq_s32(tc_t, scale_t), 16);
+
+        int32x4_t r, g, b;
+        if (lighting) {
+            float32x4_t nx = gfx_neon_set_f32(src[0].n.n[0], src[1].n.n[0], src[2].n.n[0], src[3].n.n[0]);
+            float32x4_t ny = gfx_neon_set_f32(src[0].n.n[1], src[1].n.n[1], src[2].n.n[1], src[3].n.n[1]);
+            float32x4_t nz = gfx_neon_set_f32(src[0].n.n[2], src[1].n.n[2], src[2].n.n[2], src[3].n.n[2]);
+
+            float32x4_t rf = vdupq_n_f32(ambient->col[0]);
+            float32x4_t gf = vdupq_n_f32(ambient->col[1]);
+            float32x4_t bf = vdupq_n_f32(ambient->col[2]);
+
+            for (int l = 0; l < num_dir_lights; l++) {
+                const float *coeffs = rsp.current_lights_coeffs[l];
+                const uint8_t *col = rsp.current_lights[l].col;
+                float32x4_t intensity = vaddq_f32(vaddq_f32(
+                    vmulq_f32(nx, vdupq_n_f32(coeffs[0])),
+                    vmulq_f32(ny, vdupq_n_f32(coeffs[1]))),
+                    vmulq_f32(nz, vdupq_n_f32(coeffs[2])));
+                intensity = vdivq_f32(intensity, vdupq_n_f32(127.0f));
+                uint32x4_t lit = vcgtq_f32(intensity, zero);
+
+                // The reference accumulates into an int, truncating after every light
+                rf = vbslq_f32(lit, vrndq_f32(vaddq_f32(rf, vmulq_f32(intensity, vdupq_n_f32(col[0])))), rf);
+                gf = vbslq_f32(lit, vrndq_f32(vaddq_f32(gf, vmulq_f32(intensity, vdupq_n_f32(col[1])))), gf);
+                bf = vbslq_f32(lit, vrndq_f32(vaddq_f32(bf, vmulq_f32(intensity, vdupq_n_f32(col[2])))), bf);
+            }
+
+            int32x4_t max_color = vdupq_n_s32(255);
+            r = vminq_s32(vcvtq_s32_f32(rf), max_color);
+            g = vminq_s32(vcvtq_s32_f32(gf), max_color);
+            b = vminq_s32(vcvtq_s32_f32(bf), max_color);
+
+            if (texture_gen) {
+                float32x4_t dotx = vaddq_f32(vaddq_f32(
+                    vmulq_f32(nx, vdupq_n_f32(rsp.current_lookat_coeffs[0][0])),
+                    vmulq_f32(ny, vdupq_n_f32(rsp.current_lookat_coeffs[0][1]))),
+                    vmulq_f32(nz, vdupq_n_f32(rsp.current_lookat_coeffs[0][2])));
+                float32x4_t doty = vaddq_f32(vaddq_f32(
+                    vmulq_f32(nx, vdupq_n_f32(rsp.current_lookat_coeffs[1][0])),
+                    vmulq_f32(ny, vdupq_n_f32(rsp.current_lookat_coeffs[1][1]))),
+                    vmulq_f32(nz, vdupq_n_f32(rsp.current_lookat_coeffs[1][2])));
+                const float32x4_t n127 = vdupq_n_f32(127.0f);
+                const float32x4_t one = vdupq_n_f32(1.0f);
+                const float32x4_t four = vdupq_n_f32(4.0f);
+                u = vcvtq_s32_f32(vmulq_f32(vdivq_f32(vaddq_f32(vdivq_f32(dotx, n127), one), four),
+                                            vdupq_n_f32(rsp.texture_scaling_factor.s)));
+                v = vcvtq_s32_f32(vmulq_f32(vdivq_f32(vaddq_f32(vdivq_f32(doty, n127), one), four),
+                                            vdupq_n_f32(rsp.texture_scaling_factor.t)));
+            }
+        } else {
+            r = gfx_neon_set_s32(src[0].v.cn[0], src[1].v.cn[0], src[2].v.cn[0], src[3].v.cn[0]);
+            g = gfx_neon_set_s32(src[0].v.cn[1], src[1].v.cn[1], src[2].v.cn[1], src[3].v.cn[1]);
+            b = gfx_neon_set_s32(src[0].v.cn[2], src[1].v.cn[2], src[2].v.cn[2], src[3].v.cn[2]);
+        }
+
+        int32x4_t a;
+        if (fog) {
+            // Avoid division by zero
+            uint32x4_t tiny = vcltq_f32(vabsq_f32(w), vdupq_n_f32(0.001f));
+            float32x4_t fog_w = vbslq_f32(tiny, vdupq_n_f32(0.001f), w);
+            float32x4_t winv = vdivq_f32(vdupq_n_f32(1.0f), fog_w);
+            winv = vbslq_f32(vcltq_f32(winv, zero), vdupq_n_f32(32767.0f), winv);
+
+            float32x4_t fog_z = vaddq_f32(vmulq_f32(vmulq_f32(pos.val[2], winv), vdupq_n_f32(rsp.fog_mul)), vdupq_n_f32(rsp.fog_offset));
+            fog_z = vbslq_f32(vcltq_f32(fog_z, zero), zero, fog_z);
+            fog_z = vbslq_f32(vcgtq_f32(fog_z, vdupq_n_f32(255.0f)), vdupq_n_f32(255.0f), fog_z);
+            a = vcvtq_s32_f32(fog_z);
+        } else {
+            a = gfx_neon_set_s32(src[0].v.cn[3], src[1].v.cn[3], src[2].v.cn[3], src[3].v.cn[3]);
+        }
+
+        float u_out[4], v_out[4], xyzw_out[16];
+        uint32_t clip_out[4];
+        uint8_t rgba_out[16];
+        vst1q_f32(u_out, vcvtq_f32_s32(gfx_neon_to_short(u)));
+        vst1q_f32(v_out, vcvtq_f32_s32(gfx_neon_to_short(v)));
+        vst1q_u32(clip_out, clip);
+
+        // Back to AoS
+        vst4q_f32(xyzw_out, pos);
+
+        // Interleave the channels into r, g, b, a bytes per lane
+        uint32x4_t rgba = vorrq_u32(vorrq_u32(vreinterpretq_u32_s32(r), vshlq_n_u32(vreinterpretq_u32_s32(g), 8)),
+                                    vorrq_u32(vshlq_n_u32(vreinterpretq_u32_s32(b), 16),
+                                              vshlq_n_u32(vandq_u32(vreinterpretq_u32_s32(a), vdupq_n_u32(0xFF)), 24)));
+        vst1q_u8(rgba_out, vreinterpretq_u8_u32(rgba));
+
+        for (int k = 0; k < 4; k++) {
+            memcpy(&d[k].x, &xyzw_out[k * 4], 4 * sizeof(float));
+            d[k].u = u_out[k];
+            d[k].v = v_out[k];
+            memcpy(&d[k].color, &rgba_out[k * 4], sizeof(struct RGBA));
+            d[k].clip_rej = clip_out[k];
+        }
+    }
+
+    gfx_transform_vertices_reference(n_vertices - i, dest_index, vertices + i);
+}
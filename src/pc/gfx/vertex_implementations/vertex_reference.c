@@ -0,0 +1,118 @@
+/*
+ * Scalar vertex transform, lighting, texgen, clip rejection and fog.
+ * This is included directly by gfx_pc.c, which selects between the files in
+ * this directory the same way mixer.c does; it must not be in the build path.
+ *
+ * Every other implementation falls back to this one for vertices that do not
+ * fill a whole SIMD batch, and must produce the same results.
+ */
+
+static void gfx_transform_vertices_reference(size_t n_vertices, size_t dest_index, const Vtx *vertices) {
+    for (size_t i = 0; i < n_vertices; i++, dest_index++) {
+        const Vtx_t *v = &vertices[i].v;
+        const Vtx_tn *vn = &vertices[i].n;
+        struct LoadedVertex *d = &rsp.loaded_vertices[dest_index];
+
+        float x = v->ob[0] * rsp.MP_matrix[0][0] + v->ob[1] * rsp.MP_matrix[1][0] + v->ob[2] * rsp.MP_matrix[2][0] + rsp.MP_matrix[3][0];
+        float y = v->ob[0] * rsp.MP_matrix[0][1] + v->ob[1] * rsp.MP_matrix[1][1] + v->ob[2] * rsp.MP_matrix[2][1] + rsp.MP_matrix[3][1];
+        float z = v->ob[0] * rsp.MP_matrix[0][2] + v->ob[1] * rsp.MP_matrix[1][2] + v->ob[2] * rsp.MP_matrix[2][2] + rsp.MP_matrix[3][2];
+        float w = v->ob[0] * rsp.MP_matrix[0][3] + v->ob[1] * rsp.MP_matrix[1][3] + v->ob[2] * rsp.MP_matrix[2][3] + rsp.MP_matrix[3][3];
+
+        x = gfx_adjust_x_for_aspect_ratio(x);
+
+        short U = v->tc[0] * rsp.texture_scaling_factor.s >> 16;
+        short V = v->tc[1] * rsp.texture_scaling_factor.t >> 16;
+
+        if (rsp.geometry_mode & G_LIGHTING) {
+            int r = rsp.current_lights[rsp.current_num_lights - 1].col[0];
+            int g = rsp.current_lights[rsp.current_num_lights - 1].col[1];
+            int b = rsp.current_lights[rsp.current_num_lights - 1].col[2];
+
+            for (int i = 0; i < rsp.current_num_lights - 1; i++) {
+                float intensity = 0;
+                intensity += vn->n[0] * rsp.current_lights_coeffs[i][0];
+                intensity += vn->n[1] * rsp.current_lights_coeffs[i][1];
+                intensity += vn->n[2] * rsp.current_lights_coeffs[i][2];
+                intensity /= 127.0f;
+                if (intensity > 0.0f) {
+                    r += intensity * rsp.current_lights[i].col[0];
+                    g += intensity * rsp.current_lights[i].col[1];
+                    b += intensity * rsp.current_lights[i].col[2];
+                }
+            }
+
+            d->color.r = r > 255 ? 255 : r;
+            d->color.g = g > 255 ? 255 : g;
+            d->color.b = b > 255 ? 255 : b;
+
+            if (rsp.geometry_mode & G_TEXTURE_GEN) {
+                float dotx = 0, doty = 0;
+                dotx += vn->n[0] * rsp.current_lookat_coeffs[0][0];
+                dotx += vn->n[1] * rsp.current_lookat_coeffs[0][1];
+                dotx += vn->n[2] * rsp.current_lookat_coeffs[0][2];
+                doty += vn->n[0] * rsp.current_lookat_coeffs[1][0];
+                doty += vn->n[1] * rsp.current_lookat_coeffs[1][1];
+                doty += vn->n[2] * rsp.current_lookat_coeffs[1][2];
+
+                U = (int32_t)((dotx / 127.0f + 1.0f) / 4.0f * rsp.texture_scaling_factor.s);
+                V = (int32_t)((doty / 127.0f + 1.0f) / 4.0f * rsp.texture_scaling_factor.t);
+            }
+        } else {
+            d->color.r = v->cn[0];
+            d->color.g = v->cn[1];
+            d->color.b = v->cn[2];
+        }
+
+        d->u = U;
+        d->v = V;
+
+        // trivial clip rejection
+        d->clip_rej = 0;
+#ifdef TARGET_N3DS
+    if (gGfx3DEnabled) {
+        float wMod = w * 1.2f; // expanded w-range for testing clip rejection
+        if (x < -wMod) d->clip_rej |= 1;
+        if (x > wMod) d->clip_rej |= 2;
+        if (y < -wMod) d->clip_rej |= 4;
+        if (y > wMod) d->clip_rej |= 8;
+    }
+    else {
+        if (x < -w) d->clip_rej |= 1;
+        if (x > w) d->clip_rej |= 2;
+        if (y < -w) d->clip_rej |= 4;
+        if (y > w) d->clip_rej |= 8;
+    }
+#else
+        if (x < -w) d->clip_rej |= 1;
+        if (x > w) d->clip_rej |= 2;
+        if (y < -w) d->clip_rej |= 4;
+        if (y > w) d->clip_rej |= 8;
+#endif
+        if (z < -w) d->clip_rej |= 16;
+        if (z > w) d->clip_rej |= 32;
+
+        d->x = x;
+        d->y = y;
+        d->z = z;
+        d->w = w;
+
+        if (rsp.geometry_mode & G_FOG) {
+            if (fabsf(w) < 0.001f) {
+                // To avoid division by zero
+                w = 0.001f;
+            }
+
+            float winv = 1.0f / w;
+            if (winv < 0.0f) {
+                winv = 32767.0f;
+            }
+
+            float fog_z = z * winv * rsp.fog_mul + rsp.fog_offset;
+            if (fog_z < 0) fog_z = 0;
+            if (fog_z > 255) fog_z = 255;
+            d->color.a = fog_z; // Use alpha variable to store fog factor
+        } else {
+            d->color.a = v->cn[3];
+        }
+    }
+}
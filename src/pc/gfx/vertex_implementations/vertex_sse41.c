@@ -0,0 +1,161 @@
+/*
+ * SSE4.1 vertex kernel. Processes four vertices at a time in SoA lanes,
+ * performing the same float operations in the same order as vertex_reference.c.
+ */
+
+#include <smmintrin.h>
+
+// Sign-extends the low 16 bits of each lane, like storing an int into a short
+static inline __m128i gfx_sse41_to_short(__m128i v) {
+    return _mm_srai_epi32(_mm_slli_epi32(v, 16), 16);
+}
+
+static void gfx_transform_vertices_sse41(size_t n_vertices, size_t dest_index, const Vtx *vertices) {
+    const bool lighting = (rsp.geometry_mode & G_LIGHTING) != 0;
+    const bool texture_gen = lighting && (rsp.geometry_mode & G_TEXTURE_GEN) != 0;
+    const bool fog = (rsp.geometry_mode & G_FOG) != 0;
+    const int num_dir_lights = rsp.current_num_lights - 1;
+    const Light_t *ambient = &rsp.current_lights[num_dir_lights];
+
+    const __m128 aspect = _mm_set1_ps(gfx_adjust_x_for_aspect_ratio(1.0f));
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128i scale_s = _mm_set1_epi32(rsp.texture_scaling_factor.s);
+    const __m128i scale_t = _mm_set1_epi32(rsp.texture_scaling_factor.t);
+
+    size_t i = 0;
+    for (; i + 4 <= n_vertices; i += 4, dest_index += 4) {
+        const Vtx *src = &vertices[i];
+        struct LoadedVertex *d = &rsp.loaded_vertices[dest_index];
+
+        __m128 ox = _mm_setr_ps(src[0].v.ob[0], src[1].v.ob[0], src[2].v.ob[0], src[3].v.ob[0]);
+        __m128 oy = _mm_setr_ps(src[0].v.ob[1], src[1].v.ob[1], src[2].v.ob[1], src[3].v.ob[1]);
+        __m128 oz = _mm_setr_ps(src[0].v.ob[2], src[1].v.ob[2], src[2].v.ob[2], src[3].v.ob[2]);
+
+        __m128 pos[4];
+        for (int c = 0; c < 4; c++) {
+            pos[c] = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(ox, _mm_set1_ps(rsp.MP_matrix[0][c])),
+                _mm_mul_ps(oy, _mm_set1_ps(rsp.MP_matrix[1][c]))),
+                _mm_mul_ps(oz, _mm_set1_ps(rsp.MP_matrix[2][c]))),
+                _mm_set1_ps(rsp.MP_matrix[3][c]));
+        }
+        pos[0] = _mm_mul_ps(pos[0], aspect);
+
+        // Trivial clip rejection
+        __m128 w = pos[3];
+        __m128 neg_w = _mm_xor_ps(w, sign_mask);
+        __m128i clip = _mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(pos[0], neg_w)), _mm_set1_epi32(1));
+        clip = _mm_or_si128(clip, _mm_and_si128(_mm_castps_si128(_mm_cmpgt_ps(pos[0], w)), _mm_set1_epi32(2)));
+        clip = _mm_or_si128(clip, _mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(pos[1], neg_w)), _mm_set1_epi32(4)));
+        clip = _mm_or_si128(clip, _mm_and_si128(_mm_castps_si128(_mm_cmpgt_ps(pos[1], w)), _mm_set1_epi32(8)));
+        clip = _mm_or_si128(clip, _mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(pos[2], neg_w)), _mm_set1_epi32(16)));
+        clip = _mm_or_si128(clip, _mm_and_si128(_mm_castps_si128(_mm_cmpgt_ps(pos[2], w)), _mm_set1_epi32(32)));
+
+        __m128i tc_s = _mm_setr_epi32(src[0].v.tc[0], src[1].v.tc[0], src[2].v.tc[0], src[3].v.tc[0]);
+        __m128i tc_t = _mm_setr_epi32(src[0].v.tc[1], src[1].v.tc[1], src[2].v.tc[1], src[3].v.tc[1]);
+        __m128i u = _mm_srai_epi32(_mm_mullo_epi32(tc_s, scale_s), 16);
+        __m128i v = _mm_srai_epi32(_mm_mullo_epi32(tc_t, scale_t), 16);
+
+        __m128i r, g, b;
+        if (lighting) {
+            __m128 nx = _mm_setr_ps(src[0].n.n[0], src[1].n.n[0], src[2].n.n[0], src[3].n.n[0]);
+            __m128 ny = _mm_setr_ps(src[0].n.n[1], src[1].n.n[1], src[2].n.n[1], src[3].n.n[1]);
+            __m128 nz = _mm_setr_ps(src[0].n.n[2], src[1].n.n[2], src[2].n.n[2], src[3].n.n[2]);
+
+            __m128 rf = _mm_set1_ps(ambient->col[0]);
+            __m128 gf = _mm_set1_ps(ambient->col[1]);
+            __m128 bf = _mm_set1_ps(ambient->col[2]);
+
+            for (int l = 0; l < num_dir_lights; l++) {
+                const float *coeffs = rsp.current_lights_coeffs[l];
+                const uint8_t *col = rsp.current_lights[l].col;
+                __m128 intensity = _mm_add_ps(_mm_add_ps(
+                    _mm_mul_ps(nx, _mm_set1_ps(coeffs[0])),
+                    _mm_mul_ps(ny, _mm_set1_ps(coeffs[1]))),
+                    _mm_mul_ps(nz, _mm_set1_ps(coeffs[2])));
+                intensity = _mm_div_ps(intensity, _mm_set1_ps(127.0f));
+                __m128 lit = _mm_cmpgt_ps(intensity, zero);
+
+                // The reference accumulates into an int, truncating after every light
+                __m128 rl = _mm_round_ps(_mm_add_ps(rf, _mm_mul_ps(intensity, _mm_set1_ps(col[0]))), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                __m128 gl = _mm_round_ps(_mm_add_ps(gf, _mm_mul_ps(intensity, _mm_set1_ps(col[1]))), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                __m128 bl = _mm_round_ps(_mm_add_ps(bf, _mm_mul_ps(intensity, _mm_set1_ps(col[2]))), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                rf = _mm_blendv_ps(rf, rl, lit);
+                gf = _mm_blendv_ps(gf, gl, lit);
+                bf = _mm_blendv_ps(bf, bl, lit);
+            }
+
+            __m128i max_color = _mm_set1_epi32(255);
+            r = _mm_min_epi32(_mm_cvttps_epi32(rf), max_color);
+            g = _mm_min_epi32(_mm_cvttps_epi32(gf), max_color);
+            b = _mm_min_epi32(_mm_cvttps_epi32(bf), max_color);
+
+            if (texture_gen) {
+                __m128 dotx = _mm_add_ps(_mm_add_ps(
+                    _mm_mul_ps(nx, _mm_set1_ps(rsp.current_lookat_coeffs[0][0])),
+                    _mm_mul_ps(ny, _mm_set1_ps(rsp.current_lookat_coeffs[0][1]))),
+                    _mm_mul_ps(nz, _mm_set1_ps(rsp.current_lookat_coeffs[0][2])));
+                __m128 doty = _mm_add_ps(_mm_add_ps(
+                    _mm_mul_ps(nx, _mm_set1_ps(rsp.current_lookat_coeffs[1][0])),
+                    _mm_mul_ps(ny, _mm_set1_ps(rsp.current_lookat_coeffs[1][1]))),
+                    _mm_mul_ps(nz, _mm_set1_ps(rsp.current_lookat_coeffs[1][2])));
+                const __m128 n127 = _mm_set1_ps(127.0f);
+                const __m128 one = _mm_set1_ps(1.0f);
+                const __m128 four = _mm_set1_ps(4.0f);
+                u = _mm_cvttps_epi32(_mm_mul_ps(_mm_div_ps(_mm_add_ps(_mm_div_ps(dotx, n127), one), four),
+                                                _mm_set1_ps(rsp.texture_scaling_factor.s)));
+                v = _mm_cvttps_epi32(_mm_mul_ps(_mm_div_ps(_mm_add_ps(_mm_div_ps(doty, n127), one), four),
+                                                _mm_set1_ps(rsp.texture_scaling_factor.t)));
+            }
+        } else {
+            r = _mm_setr_epi32(src[0].v.cn[0], src[1].v.cn[0], src[2].v.cn[0], src[3].v.cn[0]);
+            g = _mm_setr_epi32(src[0].v.cn[1], src[1].v.cn[1], src[2].v.cn[1], src[3].v.cn[1]);
+            b = _mm_setr_epi32(src[0].v.cn[2], src[1].v.cn[2], src[2].v.cn[2], src[3].v.cn[2]);
+        }
+
+        __m128i a;
+        if (fog) {
+            // Avoid division by zero
+            __m128 tiny = _mm_cmplt_ps(_mm_andnot_ps(sign_mask, w), _mm_set1_ps(0.001f));
+            __m128 fog_w = _mm_blendv_ps(w, _mm_set1_ps(0.001f), tiny);
+            __m128 winv = _mm_div_ps(_mm_set1_ps(1.0f), fog_w);
+            winv = _mm_blendv_ps(winv, _mm_set1_ps(32767.0f), _mm_cmplt_ps(winv, zero));
+
+            __m128 fog_z = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(pos[2], winv), _mm_set1_ps(rsp.fog_mul)), _mm_set1_ps(rsp.fog_offset));
+            fog_z = _mm_blendv_ps(fog_z, zero, _mm_cmplt_ps(fog_z, zero));
+            fog_z = _mm_blendv_ps(fog_z, _mm_set1_ps(255.0f), _mm_cmpgt_ps(fog_z, _mm_set1_ps(255.0f)));
+            a = _mm_cvttps_epi32(fog_z);
+        } else {
+            a = _mm_setr_epi32(src[0].v.cn[3], src[1].v.cn[3], src[2].v.cn[3], src[3].v.cn[3]);
+        }
+
+        __m128 uf = _mm_cvtepi32_ps(gfx_sse41_to_short(u));
+        __m128 vf = _mm_cvtepi32_ps(gfx_sse41_to_short(v));
+
+        // Back to AoS
+        _MM_TRANSPOSE4_PS(pos[0], pos[1], pos[2], pos[3]);
+
+        float u_out[4], v_out[4];
+        int32_t clip_out[4];
+        uint8_t rgba_out[16];
+        _mm_storeu_ps(u_out, uf);
+        _mm_storeu_ps(v_out, vf);
+        _mm_storeu_si128((__m128i *) clip_out, clip);
+
+        // Interleave the channels into r, g, b, a bytes per lane
+        __m128i rgba = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)),
+                                    _mm_or_si128(_mm_slli_epi32(b, 16), _mm_slli_epi32(_mm_and_si128(a, _mm_set1_epi32(0xFF)), 24)));
+        _mm_storeu_si128((__m128i *) rgba_out, rgba);
+
+        for (int k = 0; k < 4; k++) {
+            _mm_storeu_ps(&d[k].x, pos[k]);
+            d[k].u = u_out[k];
+            d[k].v = v_out[k];
+            memcpy(&d[k].color, &rgba_out[k * 4], sizeof(struct RGBA));
+            d[k].clip_rej = clip_out[k];
+        }
+    }
+
+    gfx_transform_vertices_reference(n_vertices - i, dest_index, vertices + i);
+}
@@ -32,10 +32,54 @@ void aInterleaveImpl(uint16_t left, uint16_t right);
 void aDMEMMoveImpl(uint16_t in_addr, uint16_t out_addr, int nbytes);
 void aSetLoopImpl(ADPCM_STATE *adpcm_loop_state);
 void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state);
+void aADPCMdecDirectImpl(uint8_t flags, ADPCM_STATE state, uint8_t* source);
 void aResampleImpl(uint8_t flags, uint16_t pitch, RESAMPLE_STATE state);
 void aEnvMixerImpl(uint8_t flags, ENVMIX_STATE state);
 void aMixImpl(int16_t gain, uint16_t in_addr, uint16_t out_addr);
 
+// Copies nbytes of a reverb ring buffer channel to dry_addr and, mixed with gain
+// like aMix(gain, wet_addr, wet_addr) would, to wet_addr. Stands in for the aLoadBuffer, aDMEMMove
+// and aMix that start each audio update, reading the ring buffer once instead of DMEM three times.
+void aLoadReverbImpl(int16_t gain, const int16_t *source_addr, uint16_t dry_addr, uint16_t wet_addr, int nbytes);
+
+// Storage that every thread rendering notes needs its own copy of, see audio_jobs.h
+#ifdef AUDIO_PARALLEL_NOTES
+#define AUDIO_THREAD_LOCAL _Thread_local
+#else
+#define AUDIO_THREAD_LOCAL
+#endif
+
+// Per-stage synthesis timing for tools/audio_bench.c. Time is exclusive: a stage pushed while
+// another one runs is not counted towards the outer one.
+#ifdef AUDIO_STAGE_PROFILING
+enum AudioStage {
+    AUDIO_STAGE_OTHER,
+    AUDIO_STAGE_SEQUENCES, // process_sequences
+    AUDIO_STAGE_NOTES, // synthesis_process_notes, minus the stages below
+    AUDIO_STAGE_ADPCM,
+    AUDIO_STAGE_RESAMPLE,
+    AUDIO_STAGE_ENVMIXER,
+    AUDIO_STAGE_REVERB, // Including the mixer commands it issues
+    AUDIO_STAGE_COUNT
+};
+
+struct AudioStageProfile {
+    uint64_t calls[AUDIO_STAGE_COUNT];
+    uint64_t nanoseconds[AUDIO_STAGE_COUNT];
+};
+
+extern struct AudioStageProfile gAudioStageProfile;
+
+void audio_stage_push(enum AudioStage stage);
+void audio_stage_pop(void);
+
+#define AUDIO_STAGE_PUSH(stage) audio_stage_push(stage)
+#define AUDIO_STAGE_POP() audio_stage_pop()
+#define AUDIO_STAGE_CALL(stage, call) do { audio_stage_push(stage); call; audio_stage_pop(); } while(0)
+#else
+#define AUDIO_STAGE_CALL(stage, call) call
+#endif
+
 // Redirects to the native versions of these functions.
 // The command increment is completely removed.
 
@@ -50,9 +94,10 @@ void aMixImpl(int16_t gain, uint16_t in_addr, uint16_t out_addr);
 #define aInterleave(pkt, l, r) aInterleaveImpl(l, r)
 #define aDMEMMove(pkt, i, o, c) aDMEMMoveImpl(i, o, c)
 #define aSetLoop(pkt, a) aSetLoopImpl(a)
-#define aADPCMdec(pkt, f, s) aADPCMdecImpl(f, s)
-#define aResample(pkt, f, p, s) aResampleImpl(f, p, s)
-#define aEnvMixer(pkt, f, s) aEnvMixerImpl(f, s)
+#define aADPCMdec(pkt, f, s) AUDIO_STAGE_CALL(AUDIO_STAGE_ADPCM, aADPCMdecImpl(f, s))
+#define aADPCMdecDirect(pkt, f, s, src) AUDIO_STAGE_CALL(AUDIO_STAGE_ADPCM, aADPCMdecDirectImpl(f, s, src)) // ADPCM Decode directly from external address
+#define aResample(pkt, f, p, s) AUDIO_STAGE_CALL(AUDIO_STAGE_RESAMPLE, aResampleImpl(f, p, s))
+#define aEnvMixer(pkt, f, s) AUDIO_STAGE_CALL(AUDIO_STAGE_ENVMIXER, aEnvMixerImpl(f, s))
 #define aMix(pkt, f, g, i, o) aMixImpl(g, i, o)
 
 // Enhanced RSPA emulation allows us to break the rules of
@@ -66,10 +111,8 @@ void aMixImpl(int16_t gain, uint16_t in_addr, uint16_t out_addr);
 // Snoop contents of the emulated RSPA for debugging.
 void aSnoop(volatile int snoopTag);
 
-void aADPCMdecDirectImpl(uint8_t flags, ADPCM_STATE state, uint8_t* source);
 void aInterleaveAndCopyImpl(uint16_t left, uint16_t right, int16_t *dest_addr);
 
-#define aADPCMdecDirect(pkt, f, s, src) aADPCMdecDirectImpl(f, s, src) // ADPCM Decode directly from external address
 #define aInterleaveAndCopy(pkt, l, r, dest) aInterleaveAndCopyImpl(l, r, dest) // Interleave directly to external address
 
 #endif
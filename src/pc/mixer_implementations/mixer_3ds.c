@@ -2,6 +2,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <ultra64.h>
+#include "src/pc/mixer.h"
 #include "macros.h"
 
 /*
@@ -23,7 +24,7 @@
 #define ROUND_UP_16(v) (((v) + 15) & ~15)
 #define ROUND_UP_8(v) (((v) + 7) & ~7)
 
-static struct {
+static AUDIO_THREAD_LOCAL struct {
     uint16_t in;
     uint16_t out;
     uint16_t nbytes;
@@ -520,6 +521,8 @@ void aMixImpl(const int16_t gain, const uint16_t in_addr, const uint16_t out_add
             *out = (int16_t) clamp16(*out + ((*in * gain) >> 15));
 }
 
+#include "src/pc/mixer_implementations/mixer_3ds_reverb.inc.c"
+
 // Enables one to inspect the contents of the Emulated RSPA via debugger.
 // Use the Snoop Tag to differentiate different calls for breakpoints.
 void aSnoop(volatile int snoopTag) {
@@ -0,0 +1,19 @@
+// aLoadReverbImpl for mixer_3ds.c and mixer_3ds_simd32.c, whose aMix rounds the same way.
+// Included by both after rspa and clamp16 are defined.
+
+void aLoadReverbImpl(const int16_t gain, const int16_t *source_addr, const uint16_t dry_addr, const uint16_t wet_addr, const int nbytes) {
+    int16_t *dry = rspa.buf.as_s16 + dry_addr / sizeof(int16_t);
+    int16_t *wet = rspa.buf.as_s16 + wet_addr / sizeof(int16_t);
+
+    // Same as aMix with the wet copy as both input and output
+    if (gain == -0x8000)
+        for (int nsamples = nbytes >> 1; nsamples != 0; nsamples--, source_addr++, dry++, wet++) {
+            *dry = *source_addr;
+            *wet = 0;
+        }
+    else
+        for (int nsamples = nbytes >> 1; nsamples != 0; nsamples--, source_addr++, dry++, wet++) {
+            *dry = *source_addr;
+            *wet = (int16_t) clamp16(*source_addr + ((*source_addr * gain) >> 15));
+        }
+}
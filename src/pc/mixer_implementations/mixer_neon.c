@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <ultra64.h>
+#include "src/pc/mixer.h"
 #include <arm_neon.h>
 
 /*
@@ -17,7 +18,7 @@
 #define ROUND_UP_16(v) (((v) + 15) & ~15)
 #define ROUND_UP_8(v)  (((v) +  7) &  ~7)
 
-static struct {
+static AUDIO_THREAD_LOCAL struct {
     uint16_t in;
     uint16_t out;
     uint16_t nbytes;
@@ -198,8 +199,8 @@ void aSetLoopImpl(ADPCM_STATE *adpcm_loop_state) {
     rspa.adpcm_loop_state = adpcm_loop_state;
 }
 
-// Decompresses ADPCM data
-void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state) {
+// Decompresses ADPCM data from in
+static void aADPCMdecInternal(uint8_t flags, ADPCM_STATE state, uint8_t *in) {
     static const int8_t pos0_data[] = {-1, 0, -1, 0, -1, 1, -1, 1, -1, 2, -1, 2, -1, 3, -1, 3};
     static const int8_t pos1_data[] = {-1, 4, -1, 4, -1, 5, -1, 5, -1, 6, -1, 6, -1, 7, -1, 7};
     static const int16_t mult_data[] = {0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10};
@@ -210,7 +211,6 @@ void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state) {
     const int16x8_t mask = vdupq_n_s16((int16_t)0xf000);
     const int16x8_t table_prefix = vld1q_s16(table_prefix_data);
     
-    uint8_t *in = rspa.buf.as_u8 + rspa.in;
     int16_t *out = rspa.buf.as_s16 + rspa.out / sizeof(int16_t);
     int nbytes = ROUND_UP_32(rspa.nbytes);
     if (flags & A_INIT) {
@@ -286,6 +286,16 @@ void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state) {
     memcpy(state, out - 16, 16 * sizeof(int16_t));
 }
 
+// Decodes ADPCM data directly from a given source
+void aADPCMdecDirectImpl(uint8_t flags, ADPCM_STATE state, uint8_t *source) {
+    aADPCMdecInternal(flags, state, source);
+}
+
+// Decompresses ADPCM data
+void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state) {
+    aADPCMdecInternal(flags, state, rspa.buf.as_u8 + rspa.in);
+}
+
 void aResampleImpl(uint8_t flags, uint16_t pitch, RESAMPLE_STATE state) {
     int16_t tmp[16];
     int16_t *in_initial = rspa.buf.as_s16 + rspa.in / sizeof(int16_t);
@@ -480,4 +490,30 @@ void aMixImpl(int16_t gain, uint16_t in_addr, uint16_t out_addr) {
     }
 }
 
+void aLoadReverbImpl(int16_t gain, const int16_t *source_addr, uint16_t dry_addr, uint16_t wet_addr, int nbytes) {
+    int16_t *dry = rspa.buf.as_s16 + dry_addr / sizeof(int16_t);
+    int16_t *wet = rspa.buf.as_s16 + wet_addr / sizeof(int16_t);
+
+    while (nbytes >= 8 * (int) sizeof(int16_t)) {
+        int16x8_t in = vld1q_s16(source_addr);
+
+        vst1q_s16(dry, in);
+        // Same as aMix with the wet copy as both input and output
+        vst1q_s16(wet, vqaddq_s16(in, vqrdmulhq_n_s16(in, gain)));
+
+        source_addr += 8;
+        dry += 8;
+        wet += 8;
+
+        nbytes -= 8 * sizeof(int16_t);
+    }
+
+    // The ring buffer may wrap anywhere, so the stretch before the wrap can end mid vector
+    for (; nbytes > 0; nbytes -= sizeof(int16_t)) {
+        int16_t in = *source_addr++;
+        *dry++ = in;
+        *wet++ = clamp16(in + clamp16((in * gain + 0x4000) >> 15));
+    }
+}
+
 #endif
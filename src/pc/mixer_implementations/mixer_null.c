@@ -38,6 +38,9 @@ void aSetLoopImpl(UNUSED ADPCM_STATE *adpcm_loop_state) {
 void aADPCMdecImpl(UNUSED uint8_t flags, UNUSED ADPCM_STATE state) {
 }
 
+void aADPCMdecDirectImpl(UNUSED uint8_t flags, UNUSED ADPCM_STATE state, UNUSED uint8_t *source) {
+}
+
 void aResampleImpl(UNUSED uint8_t flags, UNUSED uint16_t pitch, UNUSED RESAMPLE_STATE state) {
 }
 
@@ -47,3 +50,6 @@ void aEnvMixerImpl(UNUSED uint8_t flags, UNUSED ENVMIX_STATE state) {
 
 void aMixImpl(UNUSED int16_t gain, UNUSED uint16_t in_addr, UNUSED uint16_t out_addr) {
 }
+
+void aLoadReverbImpl(UNUSED int16_t gain, UNUSED const int16_t *source_addr, UNUSED uint16_t dry_addr, UNUSED uint16_t wet_addr, UNUSED int nbytes) {
+}
@@ -2,6 +2,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <ultra64.h>
+#include "src/pc/mixer.h"
 
 /*
  * Reference mixer.c software implementation, originally written for the PC port.
@@ -14,7 +15,7 @@
 #define ROUND_UP_16(v) (((v) + 15) & ~15)
 #define ROUND_UP_8(v)  (((v) +  7) &  ~7)
 
-static struct {
+static AUDIO_THREAD_LOCAL struct {
     uint16_t in;
     uint16_t out;
     uint16_t nbytes;
@@ -194,9 +195,8 @@ void aSetLoopImpl(ADPCM_STATE *adpcm_loop_state) {
     rspa.adpcm_loop_state = adpcm_loop_state;
 }
 
-// Decompresses ADPCM data
-void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state) {
-    uint8_t *in = rspa.buf.as_u8 + rspa.in;
+// Decompresses ADPCM data from in
+static void aADPCMdecInternal(uint8_t flags, ADPCM_STATE state, uint8_t *in) {
     int16_t *out = rspa.buf.as_s16 + rspa.out / sizeof(int16_t);
     int nbytes = ROUND_UP_32(rspa.nbytes);
 
@@ -239,6 +239,16 @@ void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state) {
     memcpy(state, out - 16, 16 * sizeof(int16_t));
 }
 
+// Decodes ADPCM data directly from a given source
+void aADPCMdecDirectImpl(uint8_t flags, ADPCM_STATE state, uint8_t *source) {
+    aADPCMdecInternal(flags, state, source);
+}
+
+// Decompresses ADPCM data
+void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state) {
+    aADPCMdecInternal(flags, state, rspa.buf.as_u8 + rspa.in);
+}
+
 void aResampleImpl(uint8_t flags, uint16_t pitch, RESAMPLE_STATE state) {
     int16_t tmp[16];
     int16_t *in_initial = rspa.buf.as_s16 + rspa.in / sizeof(int16_t);
@@ -402,3 +412,23 @@ void aMixImpl(int16_t gain, uint16_t in_addr, uint16_t out_addr) {
         nbytes -= 16 * sizeof(int16_t);
     }
 }
+
+void aLoadReverbImpl(int16_t gain, const int16_t *source_addr, uint16_t dry_addr, uint16_t wet_addr, int nbytes) {
+    int16_t *dry = rspa.buf.as_s16 + dry_addr / sizeof(int16_t);
+    int16_t *wet = rspa.buf.as_s16 + wet_addr / sizeof(int16_t);
+    int i;
+
+    memcpy(dry, source_addr, nbytes);
+
+    // Same as aMix with the wet copy as both input and output
+    if (gain == -0x8000) {
+        memset(wet, 0, nbytes);
+        return;
+    }
+
+    // Unlike aMix, stops at nbytes, since the ring buffer may wrap mid vector
+    for (i = 0; i < nbytes / (int) sizeof(int16_t); i++) {
+        *wet++ = clamp16((*source_addr * 0x7fff + *source_addr * gain + 0x4000) >> 15);
+        source_addr++;
+    }
+}
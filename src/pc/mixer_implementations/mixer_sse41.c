@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <ultra64.h>
+#include "src/pc/mixer.h"
 #include <immintrin.h>
 
 /*
@@ -19,7 +20,7 @@
 #define ROUND_UP_16(v) (((v) + 15) & ~15)
 #define ROUND_UP_8(v)  (((v) +  7) &  ~7)
 
-static struct {
+static AUDIO_THREAD_LOCAL struct {
     uint16_t in;
     uint16_t out;
     uint16_t nbytes;
@@ -199,15 +200,14 @@ void aSetLoopImpl(ADPCM_STATE *adpcm_loop_state) {
     rspa.adpcm_loop_state = adpcm_loop_state;
 }
 
-// Decompresses ADPCM data
-void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state) {
+// Decompresses ADPCM data from in
+static void aADPCMdecInternal(uint8_t flags, ADPCM_STATE state, uint8_t *in) {
     const __m128i tblrev = _mm_setr_epi8(12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1, -1, -1);
     const __m128i pos0 = _mm_set_epi8(3, -1, 3, -1, 2, -1, 2, -1, 1, -1, 1, -1, 0, -1, 0, -1);
     const __m128i pos1 = _mm_set_epi8(7, -1, 7, -1, 6, -1, 6, -1, 5, -1, 5, -1, 4, -1, 4, -1);
     const __m128i mult = _mm_set_epi16(0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01);
     const __m128i mask = _mm_set1_epi16((int16_t)0xf000);
 
-    uint8_t *in = rspa.buf.as_u8 + rspa.in;
     int16_t *out = rspa.buf.as_s16 + rspa.out / sizeof(int16_t);
     int nbytes = ROUND_UP_32(rspa.nbytes);
 
@@ -288,6 +288,16 @@ void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state) {
     memcpy(state, out - 16, 16 * sizeof(int16_t));
 }
 
+// Decodes ADPCM data directly from a given source
+void aADPCMdecDirectImpl(uint8_t flags, ADPCM_STATE state, uint8_t *source) {
+    aADPCMdecInternal(flags, state, source);
+}
+
+// Decompresses ADPCM data
+void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state) {
+    aADPCMdecInternal(flags, state, rspa.buf.as_u8 + rspa.in);
+}
+
 void aResampleImpl(uint8_t flags, uint16_t pitch, RESAMPLE_STATE state) {
     int16_t tmp[16];
     int16_t *in_initial = rspa.buf.as_s16 + rspa.in / sizeof(int16_t);
@@ -320,7 +330,52 @@ void aResampleImpl(uint8_t flags, uint16_t pitch, RESAMPLE_STATE state) {
     __m128i acc_a = _mm_add_epi32(_mm_unpacklo_epi16(pl, ph), pitchacclo_vec);
     __m128i acc_b = _mm_add_epi32(_mm_unpackhi_epi16(pl, ph), pitchacclo_vec);
 
-    do {
+    // An empty buffer still produces 8 samples, like the RSP's do-while loop
+    if (nbytes == 0) {
+        nbytes = 8 * sizeof(int16_t);
+    }
+
+#ifdef __AVX2__
+    // 16 samples at a time, gathering each sample's 4 inputs and filter taps with one instruction
+    // per 4 samples. The accumulators are ordered so that the in-lane horizontal adds below leave
+    // the samples in order: the low lanes hold samples 0-7, the high lanes samples 8-15.
+    if (nbytes >= 16 * (int) sizeof(int16_t)) {
+        __m128i pitchvec_16_steps = _mm_set1_epi32((pitch << 1) * 16);
+        __m128i acc_a8 = _mm_add_epi32(acc_a, pitchvec_8_steps);
+        __m128i acc_b8 = _mm_add_epi32(acc_b, pitchvec_8_steps);
+        __m128i accs[4] = {
+            _mm_unpacklo_epi64(acc_a, acc_a8), _mm_unpackhi_epi64(acc_a, acc_a8),
+            _mm_unpacklo_epi64(acc_b, acc_b8), _mm_unpackhi_epi64(acc_b, acc_b8),
+        };
+
+        do {
+            __m256i samples[4];
+
+            for (i = 0; i < 4; i++) {
+                __m128i in_positions = _mm_srli_epi32(accs[i], 16);
+                __m128i tbl_positions = _mm_srli_epi32(_mm_and_si128(accs[i], _mm_set1_epi32(0xffff)), 10);
+
+                samples[i] = _mm256_mulhrs_epi16(
+                    _mm256_i32gather_epi64((const long long *)in, in_positions, sizeof(int16_t)),
+                    _mm256_i32gather_epi64((const long long *)resample_table, tbl_positions, sizeof(resample_table[0])));
+                accs[i] = _mm_add_epi32(accs[i], pitchvec_16_steps);
+            }
+
+            _mm256_storeu_si256((__m256i *)out, _mm256_hadds_epi16(_mm256_hadds_epi16(samples[0], samples[1]), _mm256_hadds_epi16(samples[2], samples[3])));
+
+            out += 16;
+            nbytes -= 16 * sizeof(int16_t);
+        } while (nbytes >= 16 * (int) sizeof(int16_t));
+
+        acc_a = _mm_unpacklo_epi64(accs[0], accs[1]);
+        acc_b = _mm_unpacklo_epi64(accs[2], accs[3]);
+    }
+#endif
+
+    // The pairwise saturating adds match the reference's 32-bit sum exactly: the first two and the
+    // last two taps of a resample_table row add up to at most 0x72e6 in magnitude, so only the
+    // final add can overflow
+    while (nbytes > 0) {
         __m128i tbl_positions = _mm_srli_epi16(_mm_packus_epi32(
             _mm_and_si128(acc_a, _mm_set1_epi32(0xffff)),
             _mm_and_si128(acc_b, _mm_set1_epi32(0xffff))), 10);
@@ -359,7 +414,7 @@ void aResampleImpl(uint8_t flags, uint16_t pitch, RESAMPLE_STATE state) {
         acc_b = _mm_add_epi32(acc_b, pitchvec_8_steps);
         out += 8;
         nbytes -= 8 * sizeof(int16_t);
-    } while (nbytes > 0);
+    }
     in += (uint16_t)_mm_extract_epi16(acc_a, 1);
     pitch_accumulator = (uint16_t)_mm_extract_epi16(acc_a, 0);
 
@@ -522,4 +577,32 @@ void aMixImpl(int16_t gain, uint16_t in_addr, uint16_t out_addr) {
     }
 }
 
+void aLoadReverbImpl(int16_t gain, const int16_t *source_addr, uint16_t dry_addr, uint16_t wet_addr, int nbytes) {
+    int16_t *dry = rspa.buf.as_s16 + dry_addr / sizeof(int16_t);
+    int16_t *wet = rspa.buf.as_s16 + wet_addr / sizeof(int16_t);
+    // Same as aMix with the wet copy as both input and output
+    __m128i gain_vec = gain == -0x8000 ? _mm_setzero_si128() : _mm_set1_epi16(gain);
+    __m128i keep_vec = gain == -0x8000 ? _mm_setzero_si128() : _mm_set1_epi16(-1);
+
+    while (nbytes >= 8 * (int) sizeof(int16_t)) {
+        __m128i in = _mm_loadu_si128((const __m128i *)source_addr);
+
+        _mm_storeu_si128((__m128i *)dry, in);
+        _mm_storeu_si128((__m128i *)wet, _mm_adds_epi16(_mm_and_si128(in, keep_vec), _mm_mulhrs_epi16(in, gain_vec)));
+
+        source_addr += 8;
+        dry += 8;
+        wet += 8;
+
+        nbytes -= 8 * sizeof(int16_t);
+    }
+
+    // The ring buffer may wrap anywhere, so the stretch before the wrap can end mid vector
+    for (; nbytes > 0; nbytes -= sizeof(int16_t)) {
+        int16_t in = *source_addr++;
+        *dry++ = in;
+        *wet++ = gain == -0x8000 ? 0 : clamp16(in + ((in * gain + 0x4000) >> 15));
+    }
+}
+
 #endif
@@ -1,5 +1,10 @@
 #include <stdlib.h>
 
+#ifdef TARGET_LINUX
+#include <pthread.h>
+#include <time.h>
+#endif
+
 #ifdef TARGET_WEB
 #include <emscripten.h>
 #include <emscripten/html5.h>
@@ -19,6 +24,8 @@
 #include "gfx/gfx_sdl.h"
 #include "gfx/gfx_3ds.h"
 #include "gfx/gfx_citro3d.h"
+#include "gfx/gfx_null.h"
+#include "gfx/gfx_headless.h"
 
 #include "audio/audio_api.h"
 #include "audio/audio_wasapi.h"
@@ -27,6 +34,11 @@
 #include "audio/audio_sdl.h"
 #include "audio/audio_null.h"
 #include "audio/audio_3ds.h"
+#include "audio/audio_pacing.h"
+#include "audio/audio_rate.h"
+#include "adpcm_cache.h"
+#include "audio_jobs.h"
+#include "audio_cmd_ring.h"
 
 #include "controller/controller_keyboard.h"
 
@@ -35,6 +47,7 @@
 #include "compat.h"
 
 #define CONFIG_FILE "sm64config.txt"
+#define TEXTURE_PACK_FILE "sm64textures.bin"
 
 OSMesg D_80339BEC;
 OSMesgQueue gSIEventMesgQueue;
@@ -72,12 +85,57 @@ void send_display_list(struct SPTask *spTask) {
 
 #define printf
 
-#ifdef VERSION_EU
-#define SAMPLES_HIGH 656
-#define SAMPLES_LOW 640
-#else
-#define SAMPLES_HIGH 544
-#define SAMPLES_LOW 528
+#ifndef TARGET_N3DS
+static void produce_audio(void) {
+    // Pacing works in samples at the game's rate, backends count them at the device's
+    u32 num_audio_samples = audio_pacing_next_buffer_len(audio_rate_to_game(audio_api->buffered()),
+                                                         audio_rate_to_game(audio_api->get_desired_buffered()));
+    s16 audio_buffer[AUDIO_PACING_MAX_BUFFER_LEN * 2 * 2];
+    for (int i = 0; i < 2; i++) {
+        create_next_audio_buffer(audio_buffer + i * (num_audio_samples * 2), num_audio_samples);
+    }
+    if (audio_rate_device() == AUDIO_RATE_GAME) {
+        audio_api->play((u8 *)audio_buffer, 2 * num_audio_samples * 4);
+        return;
+    }
+
+    static s16 converted[(AUDIO_PACING_MAX_BUFFER_LEN * 2 * AUDIO_RATE_MAX / AUDIO_RATE_GAME + 2) * 2];
+    size_t num_converted = audio_rate_convert(audio_buffer, 2 * num_audio_samples, converted);
+    audio_api->play((u8 *)converted, num_converted * 4);
+}
+#endif
+
+#if defined(TARGET_LINUX) && defined(AUDIO_CMD_RING)
+static bool audio_thread_started;
+
+// Synthesizes whenever the device is about to run short, independently of the game's frame rate.
+// The game's sound requests reach it through the audio command ring.
+static void *audio_thread(UNUSED void *arg) {
+    audio_cmd_ring_set_consumer();
+    audio_pacing_set_device_paced(true);
+    while (1) {
+        int buffered = audio_api->buffered();
+        int desired = audio_api->get_desired_buffered();
+        if (buffered < desired) {
+            produce_audio();
+        } else {
+            long nanoseconds = (long) (buffered - desired + 1) * 1000000000 / audio_rate_device();
+            struct timespec delay = { nanoseconds / 1000000000, nanoseconds % 1000000000 };
+            nanosleep(&delay, NULL);
+        }
+    }
+    return NULL;
+}
+
+static void start_audio_thread(void) {
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, audio_thread, NULL) != 0) {
+        return;
+    }
+    pthread_detach(thread);
+    audio_cmd_ring_enable();
+    audio_thread_started = true;
+}
 #endif
 
 void produce_one_frame(void) {
@@ -85,13 +143,10 @@ void produce_one_frame(void) {
     game_loop_one_iteration();
 
 #ifndef TARGET_N3DS
-    int samples_left = audio_api->buffered();
-    u32 num_audio_samples = samples_left < audio_api->get_desired_buffered() ? SAMPLES_HIGH : SAMPLES_LOW;
-    s16 audio_buffer[SAMPLES_HIGH * 2 * 2];
-    for (int i = 0; i < 2; i++) {
-        create_next_audio_buffer(audio_buffer + i * (num_audio_samples * 2), num_audio_samples);
-    }
-    audio_api->play((u8 *)audio_buffer, 2 * num_audio_samples * 4);
+#if defined(TARGET_LINUX) && defined(AUDIO_CMD_RING)
+    if (!audio_thread_started)
+#endif
+        produce_audio();
 #endif
 
     gfx_end_frame();
@@ -151,7 +206,10 @@ void main_func(void) {
     request_anim_frame(on_anim_frame);
 #endif
 
-#if defined(ENABLE_DX12)
+#if defined(ENABLE_HEADLESS)
+    rendering_api = &gfx_null_api;
+    wm_api = &gfx_headless;
+#elif defined(ENABLE_DX12)
     rendering_api = &gfx_direct3d12_api;
     wm_api = &gfx_dxgi_api;
 #elif defined(ENABLE_DX11)
@@ -170,10 +228,20 @@ void main_func(void) {
 #endif
 
     gfx_init(wm_api, rendering_api, "Super Mario 64 Port", configFullscreen);
+    gfx_texture_cache_set_budget((size_t) configTextureCacheKb * 1024);
+    gfx_load_texture_pack(TEXTURE_PACK_FILE);
 
     wm_api->set_fullscreen_changed_callback(on_fullscreen_changed);
     wm_api->set_keyboard_callbacks(keyboard_on_key_down, keyboard_on_key_up, keyboard_on_all_keys_up);
 
+#ifndef TARGET_N3DS
+    audio_rate_configure(configAudioOutputRate, configAudioSincResampler);
+#endif
+#ifdef ENABLE_HEADLESS
+    // Keep benchmark runs deterministic and independent of the host's sound setup
+    audio_api = &audio_null;
+    audio_rate_configure(AUDIO_RATE_GAME, false);
+#endif
 #if HAVE_WASAPI
     if (audio_api == NULL && audio_wasapi.init()) {
         audio_api = &audio_wasapi;
@@ -205,10 +273,21 @@ void main_func(void) {
         audio_api = &audio_null;
     }
 
+    adpcm_cache_set_budget((size_t) configAdpcmCacheKb * 1024);
+    audio_jobs_init(configAudioThreads);
     audio_init();
     sound_init();
 
     thread5_game_loop(NULL);
+#if defined(TARGET_LINUX) && defined(AUDIO_CMD_RING)
+    if (configAudioThread) {
+        start_audio_thread();
+    }
+#elif defined(TARGET_N3DS) && !defined(DISABLE_AUDIO)
+    if (audio_api == &audio_3ds) {
+        audio_3ds_start_synthesis();
+    }
+#endif
 #ifdef TARGET_WEB
     inited = 1;
 #elif defined(TARGET_N3DS)
@@ -216,6 +295,10 @@ void main_func(void) {
     //the 3ds version has its own main loop
     wm_api->main_loop(produce_one_frame);
     audio_api->stop();
+#elif defined(ENABLE_HEADLESS)
+    inited = 1;
+    // runs a fixed number of frames, then returns
+    wm_api->main_loop(produce_one_frame);
 #else
     inited = 1;
     while (1) {
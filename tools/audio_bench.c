@@ -0,0 +1,547 @@
+// Renders audio offline, as fast as possible, from a fixed script of background music and sound
+// effects started through the same entry points the game uses, and reports how much faster than
+// real time the synthesis runs, where the time goes, and a checksum of the rendered PCM.
+//
+// Usage: audio_bench [seconds] [--write <pcm file>] [--compare <pcm file>] [--tolerance <max error>]
+//                    [--adpcm-cache <kb>] [--threads <n>] [--audio-thread] [--check-resample] [--seq-hash]
+//
+// --write saves the rendered 16-bit stereo PCM, --compare checks it against a file saved by
+// another build and exits with status 1 if they differ. --tolerance lets --compare and
+// --check-resample pass with samples that differ by up to that much. --adpcm-cache enables the
+// decoded ADPCM cache with the given budget. --threads renders notes on n threads, 0 for one per core.
+// --audio-thread synthesizes on a second thread, which receives the script's sound requests
+// through the audio command ring. It renders each frame's buffers once that frame's requests are
+// posted, so the output is the same as without it.
+// --check-resample runs aResampleImpl on random input, pitches and states, and compares each
+// result with mixer_reference.c's instead of rendering anything.
+// --seq-hash plays every sequence in turn for the given number of seconds, with the script's sound
+// effects and some that rewrite their own scripts, and prints a checksum of the sequence players'
+// script state after every buffer, for checking changes to seqplayer.c against another build.
+// 'make TARGET_N3DS=0 ENABLE_HEADLESS=1 audio-bench' builds this once per mixer implementation
+// the host can run, and compares each one against mixer_reference.c.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include <ultra64.h>
+
+#include "audio_defines.h"
+#include "seq_ids.h"
+#include "sm64.h"
+#include "src/audio/external.h"
+#include "src/audio/load.h"
+#include "src/game/area.h"
+#include "src/game/level_update.h"
+#include "src/game/object_list_processor.h"
+#include "src/pc/mixer.h"
+#include "src/pc/adpcm_cache.h"
+#include "src/pc/audio_jobs.h"
+#include "src/pc/audio_cmd_ring.h"
+
+#ifndef AUDIO_BENCH_MIXER
+#define AUDIO_BENCH_MIXER "unknown"
+#endif
+
+// Same buffer sizes and frame rate as produce_one_frame in pc_main.c
+#ifdef VERSION_EU
+#define SAMPLES_HIGH 656
+#define SAMPLES_LOW 640
+#else
+#define SAMPLES_HIGH 544
+#define SAMPLES_LOW 528
+#endif
+#define SAMPLE_RATE 32000
+#define FRAMES_PER_SECOND 30
+
+#define FNV_OFFSET_BASIS 0x811c9dc5
+#define FNV_PRIME 0x01000193
+
+extern void create_next_audio_buffer(s16 *samples, u32 num_samples);
+
+// tools/audio_bench_reference.c
+void reference_aLoadBufferImpl(const void *source_addr);
+void reference_aSaveBufferImpl(int16_t *dest_addr);
+void reference_aSetBufferImpl(uint8_t flags, uint16_t in, uint16_t out, uint16_t nbytes);
+void reference_aResampleImpl(uint8_t flags, uint16_t pitch, RESAMPLE_STATE state);
+
+// Game state that the audio code reads
+s16 gCurrLevelNum = LEVEL_BOB;
+s16 gCurrAreaIndex = 1;
+s16 gMarioCurrentRoom;
+struct MarioState gMarioStates[1];
+
+// Background music changes every MUSIC_FRAMES, looping through this list
+#define MUSIC_FRAMES (20 * FRAMES_PER_SECOND)
+
+static const u8 sMusic[] = {
+    SEQ_LEVEL_GRASS, SEQ_LEVEL_WATER, SEQ_LEVEL_SPOOKY, SEQ_LEVEL_SNOW, SEQ_LEVEL_BOSS_KOOPA_FINAL, SEQ_LEVEL_INSIDE_CASTLE,
+};
+
+// One sound effect every SOUND_FRAMES, looping through this list
+#define SOUND_FRAMES 4
+
+static const s32 sSounds[] = {
+    SOUND_ACTION_TERRAIN_JUMP, SOUND_MARIO_YAH_WAH_HOO, SOUND_GENERAL_COIN, SOUND_OBJ_GOOMBA_WALK,
+    SOUND_ACTION_METAL_STEP, SOUND_GENERAL_BOING1, SOUND_MARIO_ATTACKED, SOUND_GENERAL_EXPLOSION6,
+    SOUND_GENERAL_CANNON_UP, SOUND_MARIO_WAAAOOOW, SOUND_AIR_BOWSER_SPIT_FIRE, SOUND_MENU_STAR_SOUND,
+};
+
+// Sound effects whose scripts rewrite themselves with chan_writeseq, with a different value each
+// time, which --seq-hash plays in between the others. The red coin's pitch goes up with the index
+// in the sound ID, as in red_coin.inc.c.
+static const s32 sRewritingSounds[] = {
+    SOUND_MENU_COLLECT_RED_COIN, SOUND_GENERAL2_SWITCH_TICK_FAST, SOUND_MENU_COLLECT_RED_COIN + (3 << 16),
+    SOUND_GENERAL2_SWITCH_TICK_SLOW, SOUND_MENU_COLLECT_RED_COIN + (6 << 16),
+};
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t fnv1a(uint32_t hash, const void *data, size_t size) {
+    const uint8_t *p = data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ p[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+static void run_sounds(u32 frame) {
+    if (frame % SOUND_FRAMES == 0) {
+        play_sound(sSounds[frame / SOUND_FRAMES % ARRAY_COUNT(sSounds)], gDefaultSoundArgs);
+    }
+    // Continuous sounds are requested every frame while they play
+    if (frame % MUSIC_FRAMES < MUSIC_FRAMES / 2) {
+        play_sound(SOUND_ENV_WATERFALL1, gDefaultSoundArgs);
+    }
+}
+
+static void run_script(u32 frame) {
+    if (frame % MUSIC_FRAMES == 0) {
+        u8 seqId = sMusic[frame / MUSIC_FRAMES % ARRAY_COUNT(sMusic)];
+        // Replace the previous track the way levels do, which goes through the background music
+        // queue on the calling thread
+        u16 current = get_current_background_music();
+        if (current != (u16) -1) {
+            stop_background_music(current);
+        }
+        play_music(SEQ_PLAYER_LEVEL, SEQUENCE_ARGS(4, seqId), 0);
+    }
+    run_sounds(frame);
+}
+
+static void render_frame(u32 frame, s16 *pcm, size_t *num_samples) {
+    // Two buffers per frame, sized to stay as close as possible to the sample rate
+    for (int i = 0; i < 2; i++) {
+        u64 expected = ((u64) frame * 2 + i + 1) * SAMPLE_RATE / (FRAMES_PER_SECOND * 2);
+        u32 n = *num_samples / 2 < expected ? SAMPLES_HIGH : SAMPLES_LOW;
+#ifdef AUDIO_STAGE_PROFILING
+        audio_stage_push(AUDIO_STAGE_OTHER);
+        create_next_audio_buffer(pcm + *num_samples, n);
+        audio_stage_pop();
+#else
+        create_next_audio_buffer(pcm + *num_samples, n);
+#endif
+        *num_samples += n * 2;
+    }
+}
+
+struct AudioThreadState {
+    u32 num_frames;
+    u32 frames_posted; // Written by the script, read by the audio thread
+    u32 frames_rendered; // Written by the audio thread, read by the script
+    s16 *pcm;
+    size_t num_samples;
+};
+
+static void wait_for_frames(u32 *frames, u32 count) {
+    while (__atomic_load_n(frames, __ATOMIC_ACQUIRE) < count) {
+        sched_yield();
+    }
+}
+
+static void *audio_thread(void *arg) {
+    struct AudioThreadState *state = arg;
+    audio_cmd_ring_set_consumer();
+    for (u32 frame = 0; frame < state->num_frames; frame++) {
+        wait_for_frames(&state->frames_posted, frame + 1);
+        render_frame(frame, state->pcm, &state->num_samples);
+        __atomic_store_n(&state->frames_rendered, frame + 1, __ATOMIC_RELEASE);
+    }
+    return NULL;
+}
+
+// Returns false if the files differ by more than tolerance in any sample
+static bool compare_pcm(const char *path, const s16 *pcm, size_t num_samples, s32 tolerance) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        printf("could not open %s\n", path);
+        return false;
+    }
+    size_t num_differing = 0, num_compared = 0;
+    s32 max_error = 0;
+    double squared_error = 0.0;
+    s16 expected[4096];
+    size_t n;
+    while (num_compared < num_samples && (n = fread(expected, sizeof(s16), ARRAY_COUNT(expected), f)) > 0) {
+        for (size_t i = 0; i < n && num_compared < num_samples; i++, num_compared++) {
+            s32 error = abs(pcm[num_compared] - expected[i]);
+            if (error != 0) {
+                num_differing++;
+                squared_error += (double) error * error;
+                max_error = error > max_error ? error : max_error;
+            }
+        }
+    }
+    fclose(f);
+
+    if (num_compared != num_samples) {
+        printf("compared to %s: lengths differ\n", path);
+        return false;
+    }
+    if (num_differing == 0) {
+        printf("compared to %s: bit-exact\n", path);
+        return true;
+    }
+    printf("compared to %s: %zu of %zu samples differ, max error %d, rms error %.3f\n", path, num_differing,
+           num_samples, max_error, sqrt(squared_error / num_samples));
+    return max_error <= tolerance;
+}
+
+// Where --check-resample puts its input and output in DMEM, with room for the history that
+// aResampleImpl copies in front of the input, and for reading ahead at the highest pitch
+#define CHECK_IN_ADDR 0x400
+#define CHECK_OUT_ADDR 0x20
+#define CHECK_MAX_NBYTES 0x180
+#define CHECK_CASES 200000
+
+static bool check_resample(s32 tolerance) {
+    static s16 input[(CHECK_IN_ADDR + CHECK_MAX_NBYTES * 2 + 0x40) / sizeof(s16)];
+    s16 expected[CHECK_MAX_NBYTES / sizeof(s16)];
+    s16 actual[CHECK_MAX_NBYTES / sizeof(s16)];
+    s16 expectedState[16] __attribute__((aligned(16)));
+    s16 actualState[16] __attribute__((aligned(16)));
+    u32 num_differing = 0;
+    s32 max_error = 0;
+
+    srand(1);
+    for (u32 i = 0; i < CHECK_CASES; i++) {
+        // Mostly full buffers of loud input, where the filter is most likely to overflow
+        for (size_t j = 0; j < ARRAY_COUNT(input); j++) {
+            input[j] = i % 2 == 0 ? rand() : (rand() & 1 ? 0x7fff : -0x8000);
+        }
+        for (int j = 0; j < 16; j++) {
+            expectedState[j] = actualState[j] = rand();
+        }
+        // The offset kept in the state is always 0 or between -15 and -9, see aResampleImpl
+        expectedState[5] = actualState[5] = rand() % 2 == 0 ? 0 : -(9 + rand() % 7);
+        u8 flags = (u8[]) { 0, A_INIT, 2 }[rand() % 3];
+        u16 pitch = rand() % 4 == 0 ? 0x8000 : rand();
+        u16 nbytes = rand() % 4 == 0 ? CHECK_MAX_NBYTES : (rand() % (CHECK_MAX_NBYTES / 2 + 1)) * 2;
+
+        reference_aSetBufferImpl(0, 0, 0, sizeof(input));
+        reference_aLoadBufferImpl(input);
+        reference_aSetBufferImpl(0, CHECK_IN_ADDR, CHECK_OUT_ADDR, nbytes);
+        reference_aResampleImpl(flags, pitch, expectedState);
+        reference_aSetBufferImpl(0, 0, CHECK_OUT_ADDR, CHECK_MAX_NBYTES);
+        reference_aSaveBufferImpl(expected);
+
+        aSetBufferImpl(0, 0, 0, sizeof(input));
+        aLoadBufferImpl(input);
+        aSetBufferImpl(0, CHECK_IN_ADDR, CHECK_OUT_ADDR, nbytes);
+        aResampleImpl(flags, pitch, actualState);
+        aSetBufferImpl(0, 0, CHECK_OUT_ADDR, CHECK_MAX_NBYTES);
+        aSaveBufferImpl(actual);
+
+        // An empty buffer still produces 8 samples
+        size_t outSamples = nbytes == 0 ? 8 : ((nbytes + 15) & ~15) / sizeof(s16);
+        s32 error = 0;
+        for (size_t j = 0; j < outSamples; j++) {
+            s32 e = abs(expected[j] - actual[j]);
+            error = e > error ? e : error;
+        }
+        for (size_t j = 0; j < ARRAY_COUNT(expectedState); j++) {
+            s32 e = abs(expectedState[j] - actualState[j]);
+            error = e > error ? e : error;
+        }
+        if (error != 0) {
+            if (num_differing++ == 0) {
+                printf("first difference: flags %d, pitch 0x%04x, %d bytes\n", flags, pitch, nbytes);
+            }
+            max_error = error > max_error ? error : max_error;
+        }
+    }
+
+    printf("mixer: %s, aResampleImpl: %u of %u random cases differ from mixer_reference.c, max error %d\n",
+           AUDIO_BENCH_MIXER, num_differing, CHECK_CASES, max_error);
+    return max_error <= tolerance;
+}
+
+#define HASH_VALUE(hash, value) do { __typeof__(value) v_ = (value); hash = fnv1a(hash, &v_, sizeof(v_)); } while (0)
+
+// Positions are hashed relative to the sequence, so that they don't depend on where it was loaded
+static uint32_t hash_script_state(uint32_t hash, const struct M64ScriptState *state, const u8 *seqData) {
+    HASH_VALUE(hash, (s32) (state->pc - seqData));
+    HASH_VALUE(hash, state->depth);
+    for (int i = 0; i < state->depth && i < 4; i++) {
+        HASH_VALUE(hash, (s32) (state->stack[i] - seqData));
+        HASH_VALUE(hash, state->remLoopIters[i]);
+    }
+    return hash;
+}
+
+static uint32_t hash_layer(uint32_t hash, const struct SequenceChannelLayer *layer, const u8 *seqData) {
+    HASH_VALUE(hash, (u8) layer->enabled);
+    HASH_VALUE(hash, (u8) layer->finished);
+    HASH_VALUE(hash, (u8) layer->stopSomething);
+    HASH_VALUE(hash, (u8) layer->continuousNotes);
+    HASH_VALUE(hash, layer->status);
+    HASH_VALUE(hash, layer->noteDuration);
+    HASH_VALUE(hash, layer->portamentoTargetNote);
+    HASH_VALUE(hash, layer->portamento.mode);
+    HASH_VALUE(hash, layer->portamentoTime);
+    HASH_VALUE(hash, layer->transposition);
+    HASH_VALUE(hash, layer->freqScale);
+    HASH_VALUE(hash, layer->velocitySquare);
+    HASH_VALUE(hash, layer->pan);
+    HASH_VALUE(hash, layer->noteVelocity);
+#ifndef VERSION_EU
+    HASH_VALUE(hash, layer->notePan);
+#endif
+    HASH_VALUE(hash, layer->noteFreqScale);
+    HASH_VALUE(hash, layer->shortNoteDefaultPlayPercentage);
+    HASH_VALUE(hash, layer->playPercentage);
+    HASH_VALUE(hash, layer->delay);
+    HASH_VALUE(hash, layer->duration);
+    HASH_VALUE(hash, layer->adsr.releaseRate);
+    HASH_VALUE(hash, layer->adsr.sustain);
+    return hash_script_state(hash, &layer->scriptState, seqData);
+}
+
+static uint32_t hash_channel(uint32_t hash, const struct SequenceChannel *seqChannel, const u8 *seqData) {
+    HASH_VALUE(hash, (u8) seqChannel->enabled);
+    HASH_VALUE(hash, (u8) seqChannel->finished);
+    HASH_VALUE(hash, (u8) seqChannel->stopScript);
+    HASH_VALUE(hash, (u8) seqChannel->hasInstrument);
+    HASH_VALUE(hash, (u8) seqChannel->largeNotes);
+    HASH_VALUE(hash, seqChannel->noteAllocPolicy);
+    HASH_VALUE(hash, seqChannel->muteBehavior);
+    HASH_VALUE(hash, seqChannel->reverb);
+    HASH_VALUE(hash, seqChannel->notePriority);
+    HASH_VALUE(hash, seqChannel->bankId);
+    HASH_VALUE(hash, seqChannel->vibratoRateTarget);
+    HASH_VALUE(hash, seqChannel->vibratoExtentTarget);
+    HASH_VALUE(hash, seqChannel->vibratoDelay);
+    HASH_VALUE(hash, seqChannel->delay);
+    HASH_VALUE(hash, seqChannel->instOrWave);
+    HASH_VALUE(hash, seqChannel->transposition);
+    HASH_VALUE(hash, seqChannel->volumeScale);
+    HASH_VALUE(hash, seqChannel->volume);
+    HASH_VALUE(hash, seqChannel->pan);
+    HASH_VALUE(hash, seqChannel->panChannelWeight);
+    HASH_VALUE(hash, seqChannel->freqScale);
+    HASH_VALUE(hash, seqChannel->adsr.releaseRate);
+    HASH_VALUE(hash, seqChannel->adsr.sustain);
+    hash = fnv1a(hash, seqChannel->soundScriptIO, sizeof(seqChannel->soundScriptIO));
+    hash = hash_script_state(hash, &seqChannel->scriptState, seqData);
+    for (int i = 0; i < LAYERS_MAX; i++) {
+        if (seqChannel->layers[i] != NULL) {
+            hash = hash_layer(hash, seqChannel->layers[i], seqData);
+        }
+    }
+    return hash;
+}
+
+static uint32_t hash_sequence_state(uint32_t hash) {
+    for (int i = 0; i < SEQUENCE_PLAYERS; i++) {
+        struct SequencePlayer *seqPlayer = &gSequencePlayers[i];
+        HASH_VALUE(hash, (u8) seqPlayer->enabled);
+        if (!seqPlayer->enabled) {
+            continue;
+        }
+        HASH_VALUE(hash, (u8) seqPlayer->muted);
+        HASH_VALUE(hash, seqPlayer->state);
+        HASH_VALUE(hash, seqPlayer->seqId);
+        HASH_VALUE(hash, seqPlayer->tempo);
+        HASH_VALUE(hash, seqPlayer->tempoAcc);
+        HASH_VALUE(hash, seqPlayer->transposition);
+        HASH_VALUE(hash, seqPlayer->delay);
+        HASH_VALUE(hash, seqPlayer->fadeTimer);
+        HASH_VALUE(hash, seqPlayer->fadeVolume);
+        HASH_VALUE(hash, seqPlayer->volume);
+        hash = hash_script_state(hash, &seqPlayer->scriptState, seqPlayer->seqData);
+        for (int j = 0; j < CHANNELS_MAX; j++) {
+            struct SequenceChannel *seqChannel = seqPlayer->channels[j];
+            if (IS_SEQUENCE_CHANNEL_VALID(seqChannel) && seqChannel->seqPlayer == seqPlayer) {
+                hash = hash_channel(hash, seqChannel, seqPlayer->seqData);
+            }
+        }
+    }
+    return hash;
+}
+
+// Plays every sequence for the given time and prints a checksum of its script state
+static void run_seq_hash(double seconds) {
+    static s16 pcm[SAMPLES_HIGH * 2 * 2];
+    u32 num_frames = (u32) (seconds * FRAMES_PER_SECOND);
+    uint32_t total = FNV_OFFSET_BASIS;
+    double start = now_seconds();
+
+    audio_init();
+    // Starts the sound player like a level load does, so that the sound effects' scripts run too,
+    // including the ones that rewrite themselves with chan_writeseq
+    sound_reset(0);
+    audio_set_sound_mode(SOUND_MODE_STEREO);
+
+    for (u8 seqId = SEQ_SOUND_PLAYER + 1; seqId < SEQ_COUNT; seqId++) {
+        uint32_t hash = FNV_OFFSET_BASIS;
+        play_music(SEQ_PLAYER_LEVEL, SEQUENCE_ARGS(4, seqId), 0);
+        for (u32 frame = 0; frame < num_frames; frame++) {
+            size_t num_samples = 0;
+            run_sounds(frame);
+            if (frame % SOUND_FRAMES == SOUND_FRAMES / 2) {
+                play_sound(sRewritingSounds[frame / SOUND_FRAMES % ARRAY_COUNT(sRewritingSounds)], gDefaultSoundArgs);
+            }
+            audio_signal_game_loop_tick();
+            render_frame(frame, pcm, &num_samples);
+            hash = hash_sequence_state(hash);
+        }
+        printf("sequence 0x%02x: %08x\n", seqId, hash);
+        total = fnv1a(total, &hash, sizeof(hash));
+    }
+    printf("\nplayed %d sequences for %.1f s each in %.3f s, %.1f ms of it in process_sequences\n", SEQ_COUNT - 1,
+           seconds, now_seconds() - start, gAudioStageProfile.nanoseconds[AUDIO_STAGE_SEQUENCES] / 1e6);
+    printf("sequence state checksum: %08x\n", total);
+}
+
+int main(int argc, char *argv[]) {
+    double seconds = 60.0;
+    const char *write_path = NULL;
+    const char *compare_path = NULL;
+    bool use_audio_thread = false;
+    bool resample_check = false;
+    bool seq_hash = false;
+    s32 tolerance = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--write") == 0 && i + 1 < argc) {
+            write_path = argv[++i];
+        } else if (strcmp(argv[i], "--compare") == 0 && i + 1 < argc) {
+            compare_path = argv[++i];
+        } else if (strcmp(argv[i], "--adpcm-cache") == 0 && i + 1 < argc) {
+            adpcm_cache_set_budget((size_t) atoi(argv[++i]) * 1024);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            audio_jobs_init(atoi(argv[++i]));
+        } else if (strcmp(argv[i], "--audio-thread") == 0) {
+            use_audio_thread = true;
+        } else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--check-resample") == 0) {
+            resample_check = true;
+        } else if (strcmp(argv[i], "--seq-hash") == 0) {
+            seq_hash = true;
+        } else if (atof(argv[i]) > 0) {
+            seconds = atof(argv[i]);
+        } else {
+            fprintf(stderr, "usage: %s [seconds] [--write <pcm file>] [--compare <pcm file>] [--tolerance <max error>] [--adpcm-cache <kb>] [--threads <n>] [--audio-thread] [--check-resample] [--seq-hash]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (resample_check) {
+        return check_resample(tolerance) ? 0 : 1;
+    }
+    if (seq_hash) {
+        run_seq_hash(seconds);
+        return 0;
+    }
+
+    u32 num_frames = (u32) (seconds * FRAMES_PER_SECOND);
+    size_t max_samples = (size_t) num_frames * SAMPLES_HIGH * 2 * 2;
+    s16 *pcm = malloc(max_samples * sizeof(s16));
+    size_t num_samples = 0;
+
+    audio_init();
+    sound_init();
+    audio_set_sound_mode(SOUND_MODE_STEREO);
+
+    double start = now_seconds();
+    if (use_audio_thread) {
+        struct AudioThreadState state = { num_frames, 0, 0, pcm, 0 };
+        pthread_t thread;
+        audio_cmd_ring_enable();
+        pthread_create(&thread, NULL, audio_thread, &state);
+        for (u32 frame = 0; frame < num_frames; frame++) {
+            // Requests for the next frame must not be drained with this one's
+            wait_for_frames(&state.frames_rendered, frame);
+            run_script(frame);
+            audio_signal_game_loop_tick();
+            __atomic_store_n(&state.frames_posted, frame + 1, __ATOMIC_RELEASE);
+        }
+        pthread_join(thread, NULL);
+        num_samples = state.num_samples;
+    } else {
+        for (u32 frame = 0; frame < num_frames; frame++) {
+            run_script(frame);
+            audio_signal_game_loop_tick();
+            render_frame(frame, pcm, &num_samples);
+        }
+    }
+    double elapsed = now_seconds() - start;
+    double audio_seconds = (double) num_samples / 2 / SAMPLE_RATE;
+
+    printf("mixer: %s, %d note threads\n", AUDIO_BENCH_MIXER, audio_jobs_num_threads());
+    printf("rendered %.1f s of audio in %.3f s: %.1fx real time\n\n", audio_seconds, elapsed, audio_seconds / elapsed);
+
+#ifdef AUDIO_STAGE_PROFILING
+    static const char *stageNames[AUDIO_STAGE_COUNT] = {
+        "other", "process_sequences", "synthesis_process_notes", "aADPCMdecImpl", "aResampleImpl", "aEnvMixerImpl", "reverb",
+    };
+    u64 total = 0;
+    for (int i = 0; i < AUDIO_STAGE_COUNT; i++) {
+        total += gAudioStageProfile.nanoseconds[i];
+    }
+    printf("%-24s %10s %7s %10s %12s\n", "stage", "ms", "share", "calls", "us/s audio");
+    for (int i = 0; i < AUDIO_STAGE_COUNT; i++) {
+        double ms = gAudioStageProfile.nanoseconds[i] / 1e6;
+        printf("%-24s %10.2f %6.1f%% %10llu %12.1f\n", stageNames[i], ms,
+               total != 0 ? 100.0 * gAudioStageProfile.nanoseconds[i] / total : 0.0,
+               (unsigned long long) gAudioStageProfile.calls[i], ms * 1000 / audio_seconds);
+    }
+    printf("\n");
+#endif
+
+    if (gAdpcmCacheStats.budget != 0) {
+        u64 packets = gAdpcmCacheStats.hits + gAdpcmCacheStats.misses;
+        printf("adpcm cache: %.1f%% of %llu packets hit, %llu evictions, %zu of %zu KB used\n\n",
+               packets != 0 ? 100.0 * gAdpcmCacheStats.hits / packets : 0.0, (unsigned long long) packets,
+               (unsigned long long) gAdpcmCacheStats.evictions, gAdpcmCacheStats.bytes / 1024, gAdpcmCacheStats.budget / 1024);
+    }
+
+    if (use_audio_thread) {
+        printf("audio command ring: %llu requests, %u pending at most, %llu stalls\n\n",
+               (unsigned long long) gAudioCmdRingStats.posted, gAudioCmdRingStats.maxPending,
+               (unsigned long long) gAudioCmdRingStats.stalls);
+    }
+
+    printf("pcm checksum: %08x\n", fnv1a(FNV_OFFSET_BASIS, pcm, num_samples * sizeof(s16)));
+
+    if (write_path != NULL) {
+        FILE *f = fopen(write_path, "wb");
+        if (f == NULL || fwrite(pcm, sizeof(s16), num_samples, f) != num_samples) {
+            printf("could not write %s\n", write_path);
+            return 1;
+        }
+        fclose(f);
+    }
+    bool ok = compare_path == NULL || compare_pcm(compare_path, pcm, num_samples, tolerance);
+    free(pcm);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,20 @@
+// mixer_reference.c with its entry points renamed, so that audio_bench can check the mixer it is
+// built with against the reference one command at a time
+
+#define aClearBufferImpl reference_aClearBufferImpl
+#define aLoadBufferImpl reference_aLoadBufferImpl
+#define aSaveBufferImpl reference_aSaveBufferImpl
+#define aLoadADPCMImpl reference_aLoadADPCMImpl
+#define aSetBufferImpl reference_aSetBufferImpl
+#define aSetVolumeImpl reference_aSetVolumeImpl
+#define aInterleaveImpl reference_aInterleaveImpl
+#define aDMEMMoveImpl reference_aDMEMMoveImpl
+#define aSetLoopImpl reference_aSetLoopImpl
+#define aADPCMdecImpl reference_aADPCMdecImpl
+#define aADPCMdecDirectImpl reference_aADPCMdecDirectImpl
+#define aResampleImpl reference_aResampleImpl
+#define aEnvMixerImpl reference_aEnvMixerImpl
+#define aMixImpl reference_aMixImpl
+#define aLoadReverbImpl reference_aLoadReverbImpl
+
+#include "src/pc/mixer_implementations/mixer_reference.c"
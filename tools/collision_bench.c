@@ -0,0 +1,950 @@
+// Loads the collision of every level area through load_area_terrain, and times find_floor,
+// find_ceil, find_wall_collisions and find_water_level on random points around its geometry, or
+// on the queries of a capture recorded in game (see src/pc/collision_capture.h). Reports queries
+// per second, latency percentiles of each function, the lengths of the partition lists, how many
+// surfaces each query visited, and a checksum of the results.
+//
+// Usage: collision_bench [queries per area] [--replay <capture>] [--record <capture>]
+//                        [--write-trace <file>] [--compare-trace <file>]
+//
+// --record saves the random queries as a capture, so that they can be replayed like one.
+// --write-trace saves the result of every query, and --compare-trace checks that each result
+// is bit for bit the same as in a saved trace, and stops at the first one that isn't.
+//
+// 'make TARGET_N3DS=0 ENABLE_HEADLESS=1 collision-bench' builds this without FINE_SURFACE_PARTITION,
+// with it, and with PACKED_SURFACE_PARTITION too, and runs each, so that their speed can be
+// compared. The first one writes a trace that the others are compared against.
+// A fourth build with PERSISTENT_DYNAMIC_SURFACES and CHECK_PERSISTENT_DYNAMIC_SURFACES first moves,
+// spawns and despawns platforms in each area for a few seconds of frames, and fails if any of
+// their loads leaves the object surfaces different from a full rebuild.
+// COLLISION_BENCH_REPLAY=<capture> makes them replay a capture instead.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include <ultra64.h>
+
+#include "sm64.h"
+#include "level_table.h"
+#include "types.h"
+#include "surface_terrains.h"
+#include "level_misc_macros.h"
+#include "special_preset_names.h"
+#include "src/engine/surface_collision.h"
+#include "src/engine/surface_load.h"
+#include "src/game/level_update.h"
+#include "src/game/object_list_processor.h"
+#include "src/pc/collision_capture.h"
+
+#define FNV_OFFSET_BASIS 0x811c9dc5
+#define FNV_PRIME 0x01000193
+
+#define DEFAULT_QUERIES 200000
+
+#define TRACE_MAGIC "SM64COLT"
+#define TRACE_VERSION 1
+// Every wall that find_wall_collisions can reference
+#define TRACE_MAX_WALLS ARRAY_COUNT(((struct WallCollisionData *) NULL)->walls)
+
+// Special objects would need the object system, so the areas are loaded without them. Every value
+// they would have taken is replaced by TERRAIN_LOAD_CONTINUE, which load_area_terrain skips.
+#undef COL_SPECIAL_INIT
+#define COL_SPECIAL_INIT(num) TERRAIN_LOAD_CONTINUE
+#undef SPECIAL_OBJECT
+#define SPECIAL_OBJECT(preset, posX, posY, posZ) TERRAIN_LOAD_CONTINUE
+#undef SPECIAL_OBJECT_WITH_YAW
+#define SPECIAL_OBJECT_WITH_YAW(preset, posX, posY, posZ, yaw) TERRAIN_LOAD_CONTINUE
+#undef SPECIAL_OBJECT_WITH_YAW_AND_PARAM
+#define SPECIAL_OBJECT_WITH_YAW_AND_PARAM(preset, posX, posY, posZ, yaw, param) TERRAIN_LOAD_CONTINUE
+
+#include "levels/bbh/areas/1/collision.inc.c"
+#include "levels/bitdw/areas/1/collision.inc.c"
+#include "levels/bitfs/areas/1/collision.inc.c"
+#include "levels/bits/areas/1/collision.inc.c"
+#include "levels/bob/areas/1/collision.inc.c"
+#include "levels/bowser_1/areas/1/collision.inc.c"
+#include "levels/bowser_2/areas/1/collision.inc.c"
+#include "levels/bowser_3/areas/1/collision.inc.c"
+#include "levels/castle_courtyard/areas/1/collision.inc.c"
+#include "levels/castle_grounds/areas/1/collision.inc.c"
+#include "levels/castle_inside/areas/1/collision.inc.c"
+#include "levels/castle_inside/areas/2/collision.inc.c"
+#include "levels/castle_inside/areas/3/collision.inc.c"
+#include "levels/ccm/areas/1/collision.inc.c"
+#include "levels/ccm/areas/2/collision.inc.c"
+#include "levels/cotmc/areas/1/collision.inc.c"
+#include "levels/ddd/areas/1/collision.inc.c"
+#include "levels/ddd/areas/2/collision.inc.c"
+#include "levels/hmc/areas/1/collision.inc.c"
+#include "levels/jrb/areas/1/collision.inc.c"
+#include "levels/jrb/areas/2/collision.inc.c"
+#include "levels/lll/areas/1/collision.inc.c"
+#include "levels/lll/areas/2/collision.inc.c"
+#include "levels/pss/areas/1/collision.inc.c"
+#include "levels/rr/areas/1/collision.inc.c"
+#include "levels/sa/areas/1/collision.inc.c"
+#include "levels/sl/areas/1/collision.inc.c"
+#include "levels/sl/areas/2/collision.inc.c"
+#include "levels/ssl/areas/1/collision.inc.c"
+#include "levels/ssl/areas/2/collision.inc.c"
+#include "levels/ssl/areas/3/collision.inc.c"
+#include "levels/thi/areas/1/collision.inc.c"
+#include "levels/thi/areas/2/collision.inc.c"
+#include "levels/thi/areas/3/collision.inc.c"
+#include "levels/totwc/areas/1/collision.inc.c"
+#include "levels/ttc/areas/1/collision.inc.c"
+#include "levels/ttm/areas/1/collision.inc.c"
+#include "levels/ttm/areas/2/collision.inc.c"
+#include "levels/ttm/areas/3/collision.inc.c"
+#include "levels/ttm/areas/4/collision.inc.c"
+#include "levels/vcutm/areas/1/collision.inc.c"
+#include "levels/wdw/areas/1/collision.inc.c"
+#include "levels/wdw/areas/2/collision.inc.c"
+#include "levels/wf/areas/1/collision.inc.c"
+#include "levels/wmotr/areas/1/collision.inc.c"
+#ifdef CHECK_PERSISTENT_DYNAMIC_SURFACES
+#include "actors/breakable_box/collision.inc.c"
+#include "actors/checkerboard_platform/collision.inc.c"
+#include "levels/wf/rotating_platform/collision.inc.c"
+#include "levels/wf/sliding_platform/collision.inc.c"
+#endif
+
+struct BenchArea {
+    const char *name;
+    s16 level, area;
+    const Collision *collision;
+};
+
+static const struct BenchArea sAreas[] = {
+    { "bbh", LEVEL_BBH, 1, bbh_seg7_collision_level },
+    { "bitdw", LEVEL_BITDW, 1, bitdw_seg7_collision_level },
+    { "bitfs", LEVEL_BITFS, 1, bitfs_seg7_collision_level },
+    { "bits", LEVEL_BITS, 1, bits_seg7_collision_level },
+    { "bob", LEVEL_BOB, 1, bob_seg7_collision_level },
+    { "bowser_1", LEVEL_BOWSER_1, 1, bowser_1_seg7_collision_level },
+    { "bowser_2", LEVEL_BOWSER_2, 1, bowser_2_seg7_collision_lava },
+    { "bowser_3", LEVEL_BOWSER_3, 1, bowser_3_seg7_collision_level },
+    { "castle_courtyard", LEVEL_CASTLE_COURTYARD, 1, castle_courtyard_seg7_collision },
+    { "castle_grounds", LEVEL_CASTLE_GROUNDS, 1, castle_grounds_seg7_collision_level },
+    { "castle_inside 1", LEVEL_CASTLE, 1, inside_castle_seg7_area_1_collision },
+    { "castle_inside 2", LEVEL_CASTLE, 2, inside_castle_seg7_area_2_collision },
+    { "castle_inside 3", LEVEL_CASTLE, 3, inside_castle_seg7_area_3_collision },
+    { "ccm 1", LEVEL_CCM, 1, ccm_seg7_area_1_collision },
+    { "ccm 2", LEVEL_CCM, 2, ccm_seg7_area_2_collision },
+    { "cotmc", LEVEL_COTMC, 1, cotmc_seg7_collision_level },
+    { "ddd 1", LEVEL_DDD, 1, ddd_seg7_area_1_collision },
+    { "ddd 2", LEVEL_DDD, 2, ddd_seg7_area_2_collision },
+    { "hmc", LEVEL_HMC, 1, hmc_seg7_collision_level },
+    { "jrb 1", LEVEL_JRB, 1, jrb_seg7_area_1_collision },
+    { "jrb 2", LEVEL_JRB, 2, jrb_seg7_area_2_collision },
+    { "lll 1", LEVEL_LLL, 1, lll_seg7_area_1_collision },
+    { "lll 2", LEVEL_LLL, 2, lll_seg7_area_2_collision },
+    { "pss", LEVEL_PSS, 1, pss_seg7_collision },
+    { "rr", LEVEL_RR, 1, rr_seg7_collision_level },
+    { "sa", LEVEL_SA, 1, sa_seg7_collision },
+    { "sl 1", LEVEL_SL, 1, sl_seg7_area_1_collision },
+    { "sl 2", LEVEL_SL, 2, sl_seg7_area_2_collision },
+    { "ssl 1", LEVEL_SSL, 1, ssl_seg7_area_1_collision },
+    { "ssl 2", LEVEL_SSL, 2, ssl_seg7_area_2_collision },
+    { "ssl 3", LEVEL_SSL, 3, ssl_seg7_area_3_collision },
+    { "thi 1", LEVEL_THI, 1, thi_seg7_area_1_collision },
+    { "thi 2", LEVEL_THI, 2, thi_seg7_area_2_collision },
+    { "thi 3", LEVEL_THI, 3, thi_seg7_area_3_collision },
+    { "totwc", LEVEL_TOTWC, 1, totwc_seg7_collision },
+    { "ttc", LEVEL_TTC, 1, ttc_seg7_collision_level },
+    { "ttm 1", LEVEL_TTM, 1, ttm_seg7_area_1_collision },
+    { "ttm 2", LEVEL_TTM, 2, ttm_seg7_area_2_collision },
+    { "ttm 3", LEVEL_TTM, 3, ttm_seg7_area_3_collision },
+    { "ttm 4", LEVEL_TTM, 4, ttm_seg7_area_4_collision },
+    { "vcutm", LEVEL_VCUTM, 1, vcutm_seg7_collision },
+    { "wdw 1", LEVEL_WDW, 1, wdw_seg7_area_1_collision },
+    { "wdw 2", LEVEL_WDW, 2, wdw_seg7_area_2_collision },
+    { "wf", LEVEL_WF, 1, wf_seg7_collision_070102D8 },
+    { "wmotr", LEVEL_WMOTR, 1, wmotr_seg7_collision },
+};
+
+// What surface_load.c and surface_collision.c use from the rest of the game
+struct Object *gMarioObject;
+struct Object *gCurrentObject;
+struct MarioState *gMarioState;
+u32 gTimeStopState;
+s32 gSurfaceNodesAllocated;
+s32 gSurfacesAllocated;
+s32 gNumStaticSurfaceNodes;
+s32 gNumStaticSurfaces;
+s16 gCheckingSurfaceCollisionsForCamera;
+s16 gFindFloorIncludeSurfaceIntangible;
+s16 *gEnvironmentRegions;
+s32 gEnvironmentLevels[20];
+s16 gCCMEnteredSlide;
+s32 gNumFindFloorMisses;
+struct NumTimesCalled gNumCalls;
+const BehaviorScript bhvDddWarp[1];
+
+void *main_pool_alloc(u32 size, UNUSED u32 side) {
+    return malloc(size);
+}
+
+void *segmented_to_virtual(const void *addr) {
+    return (void *) addr;
+}
+
+void reset_red_coins_collected(void) {
+}
+
+void spawn_special_objects(UNUSED s16 areaIndex, UNUSED s16 **specialObjList) {
+}
+
+void spawn_macro_objects(UNUSED s16 areaIndex, UNUSED s16 *macroObjList) {
+}
+
+void spawn_macro_objects_hardcoded(UNUSED s16 areaIndex, UNUSED s16 *macroObjList) {
+}
+
+u32 get_special_objects_size(UNUSED s16 *data) {
+    return 0;
+}
+
+// Only turns by the yaw, which is all the platforms of the dynamic surface check turn by
+void obj_build_transform_from_pos_and_angle(struct Object *obj, s16 posIndex, s16 angleIndex) {
+    f32 yaw = obj->rawData.asS32[angleIndex + 1] * (f32) (M_PI / 0x8000);
+    Mat4 *m = &obj->transform;
+
+    memset(*m, 0, sizeof(Mat4));
+    (*m)[0][0] = cosf(yaw);
+    (*m)[0][2] = -sinf(yaw);
+    (*m)[1][1] = 1.0f;
+    (*m)[2][0] = sinf(yaw);
+    (*m)[2][2] = cosf(yaw);
+    (*m)[3][0] = obj->rawData.asF32[posIndex + 0];
+    (*m)[3][1] = obj->rawData.asF32[posIndex + 1];
+    (*m)[3][2] = obj->rawData.asF32[posIndex + 2];
+    (*m)[3][3] = 1.0f;
+}
+
+void obj_apply_scale_to_matrix(struct Object *obj, Mat4 dst, Mat4 src) {
+    for (s32 i = 0; i < 4; i++) {
+        dst[0][i] = src[0][i] * (i < 3 ? obj->header.gfx.scale[0] : 1.0f);
+        dst[1][i] = src[1][i] * (i < 3 ? obj->header.gfx.scale[1] : 1.0f);
+        dst[2][i] = src[2][i] * (i < 3 ? obj->header.gfx.scale[2] : 1.0f);
+        dst[3][i] = src[3][i];
+    }
+}
+
+f32 dist_between_objects(UNUSED struct Object *obj1, UNUSED struct Object *obj2) {
+    return 0.0f;
+}
+
+void print_debug_top_down_mapinfo(UNUSED const char *str, UNUSED s32 number) {
+}
+
+void set_text_array_x_y(UNUSED s32 x, UNUSED s32 y) {
+}
+
+
+#define QUERY_KINDS (COLLISION_CAPTURE_WATER + 1)
+
+// In the order of the capture kinds, which start with the SPATIAL_PARTITION_ lists
+static const char *sQueryNames[QUERY_KINDS] = { "find_floor", "find_ceil", "find_wall_collisions", "find_water_level" };
+
+// Replayed queries whose current object passes vanish cap walls run with this one
+static struct Object sGrateObject;
+
+struct LatencySamples {
+    u32 *ticks;
+    size_t count, capacity;
+};
+
+static struct LatencySamples sLatency[QUERY_KINDS];
+
+struct ListLengths {
+    u64 lists, nodes;
+    s32 max;
+};
+
+static struct ListLengths sCoarseLengths[3];
+#ifdef FINE_SURFACE_PARTITION
+static struct ListLengths sFineLengths[3];
+#endif
+
+static s32 sMaxNodes;
+#ifdef FINE_SURFACE_PARTITION
+static s32 sMaxFineNodes;
+#endif
+#ifdef PACKED_SURFACE_PARTITION
+static s32 sMaxPackedBlocks;
+#endif
+
+static FILE *sTraceOut;
+static FILE *sTraceIn;
+static u64 sQueriesRun;
+static s32 sTraceMismatch;
+
+static u32 sRandomState = 1;
+
+static u32 random_u32(void) {
+    sRandomState = sRandomState * 1664525 + 1013904223;
+    return sRandomState >> 8;
+}
+
+static f32 random_range(f32 lo, f32 hi) {
+    return lo + (hi - lo) * (random_u32() & 0xffff) / 65536.0f;
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// The time stamp counter where there is one, which costs much less to read than the clock
+static inline u64 read_ticks(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64) ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+static uint32_t fnv1a(uint32_t hash, const void *data, size_t size) {
+    const uint8_t *p = data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ p[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+// Surfaces are hashed by their index in the pool, which doesn't depend on the partition
+static s32 surface_index(struct Surface *surface) {
+    return surface != NULL ? (s32) (surface - sSurfacePool) : -1;
+}
+
+static void add_latency(s32 kind, u32 ticks) {
+    struct LatencySamples *samples = &sLatency[kind];
+
+    if (samples->count == samples->capacity) {
+        samples->capacity = samples->capacity == 0 ? 65536 : samples->capacity * 2;
+        samples->ticks = realloc(samples->ticks, samples->capacity * sizeof(u32));
+        if (samples->ticks == NULL) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+    }
+    samples->ticks[samples->count++] = ticks;
+}
+
+static s32 list_length(struct SurfaceNode *node) {
+    s32 length = 0;
+
+    for (; node != NULL; node = node->next) {
+        length++;
+    }
+    return length;
+}
+
+static void add_list_length(struct ListLengths *lengths, s32 length) {
+    if (length > 0) {
+        lengths->lists++;
+        lengths->nodes += length;
+        lengths->max = length > lengths->max ? length : lengths->max;
+    }
+}
+
+// Adds the lengths of the loaded area's non-empty static lists
+static void count_list_lengths(void) {
+    for (s32 i = 0; i < 3; i++) {
+        for (s32 z = 0; z < 16; z++) {
+            for (s32 x = 0; x < 16; x++) {
+                add_list_length(&sCoarseLengths[i], list_length(gStaticSurfacePartition[z][x][i].next));
+            }
+        }
+#ifdef FINE_SURFACE_PARTITION
+        for (s32 z = 0; z < NUM_FINE_CELLS; z++) {
+            for (s32 x = 0; x < NUM_FINE_CELLS; x++) {
+                add_list_length(&sFineLengths[i], list_length(gStaticFineSurfacePartition[z][x][i].next));
+            }
+        }
+#endif
+    }
+}
+
+static const struct BenchArea *find_area(s16 level, s16 area) {
+    for (u32 i = 0; i < ARRAY_COUNT(sAreas); i++) {
+        if (sAreas[i].level == level && sAreas[i].area == area) {
+            return &sAreas[i];
+        }
+    }
+    return NULL;
+}
+
+#ifdef CHECK_PERSISTENT_DYNAMIC_SURFACES
+#define CHECK_OBJECTS 32
+#define CHECK_FRAMES  120
+// The most that one of the platforms can take of each pool
+#define CHECK_OBJECT_SURFACES 22
+#define CHECK_OBJECT_NODES    (CHECK_OBJECT_SURFACES * 4)
+
+// The object collision that the platforms of the dynamic surface check load
+static const Collision *sCheckCollision[] = {
+    checkerboard_platform_seg8_collision_0800D710,
+    wf_seg7_collision_rotating_platform,
+    wf_seg7_collision_sliding_brick_platform,
+    breakable_box_seg8_collision_08012D70,
+};
+static const BehaviorScript sCheckBehaviors[ARRAY_COUNT(sCheckCollision)][1];
+static struct Object sCheckObjects[CHECK_OBJECTS];
+static s32 sMinCheckObjects = CHECK_OBJECTS;
+
+/**
+ * Sets up a platform of the dynamic surface check for a frame, and returns whether it loads its
+ * collision then. Of every five, one sits still, one too apart from a few frames in a different
+ * room, one moves for eight frames then rests for eight, one moves every frame, and one spawns
+ * and moves, despawns, spawns again as another platform that sits still, and is then replaced
+ * by an object of another behavior with the same collision in the same place.
+ */
+static s32 update_check_object(struct Object *obj, s32 index, s32 frame, f32 centerX, f32 centerY, f32 centerZ) {
+    s32 platform = index / 5 % ARRAY_COUNT(sCheckCollision);
+    const BehaviorScript *behavior = sCheckBehaviors[platform];
+    s32 moves = 0;
+
+    switch (index % 5) {
+        case 1:
+            if (index % 10 == 1 && frame >= 20 && frame < 30) {
+                obj->activeFlags |= ACTIVE_FLAG_IN_DIFFERENT_ROOM;
+            } else {
+                obj->activeFlags &= ~ACTIVE_FLAG_IN_DIFFERENT_ROOM;
+            }
+            break;
+        case 2:
+            moves = frame / 16 * 8 + (frame % 16 < 8 ? frame % 16 : 8);
+            break;
+        case 3:
+            moves = frame;
+            break;
+        case 4:
+            if (frame < 5 + index || (frame >= 40 + index && frame < 60 + index)) {
+                return FALSE;
+            }
+            if (frame < 40 + index) {
+                moves = frame;
+            } else {
+                platform = (platform + 1) % ARRAY_COUNT(sCheckCollision);
+                behavior = frame < 80 + index ? sCheckBehaviors[platform] : bhvDddWarp;
+            }
+            break;
+    }
+
+    obj->behavior = behavior;
+    obj->collisionData = (void *) sCheckCollision[platform];
+    obj->oPosX = centerX + (index % 8 - 4) * 600.0f + moves * 13.0f;
+    obj->oPosY = centerY + (index / 8) * 250.0f;
+    obj->oPosZ = centerZ + (index / 8 - 2) * 900.0f;
+    obj->oFaceAngleYaw = moves * 0x180;
+    obj_build_transform_from_pos_and_angle(obj, O_POS_INDEX, O_FACE_ANGLE_INDEX);
+    return TRUE;
+}
+
+/**
+ * Loads platforms around the middle of the area for a few seconds of frames, with time stopped
+ * for some of them. check_object_surfaces compares what each load leaves in the pool and the
+ * partition with loading every platform again.
+ */
+static void check_dynamic_surfaces(void) {
+    f32 centerX = 0.0f, centerY = 0.0f, centerZ = 0.0f;
+    // As many as fit in the pools next to the area's surfaces
+    s32 numObjects = MIN(CHECK_OBJECTS, MIN((SURFACE_POOL_SIZE - gNumStaticSurfaces) / CHECK_OBJECT_SURFACES,
+                                            (SURFACE_NODE_POOL_SIZE - gNumStaticSurfaceNodes) / CHECK_OBJECT_NODES));
+
+    for (s32 i = 0; i < gNumStaticSurfaces; i++) {
+        centerX += sSurfacePool[i].vertex1[0];
+        centerY += sSurfacePool[i].vertex1[1];
+        centerZ += sSurfacePool[i].vertex1[2];
+    }
+    if (gNumStaticSurfaces > 0) {
+        centerX /= gNumStaticSurfaces;
+        centerY /= gNumStaticSurfaces;
+        centerZ /= gNumStaticSurfaces;
+    }
+
+    sMinCheckObjects = MIN(sMinCheckObjects, numObjects);
+    memset(sCheckObjects, 0, sizeof(sCheckObjects));
+    for (s32 i = 0; i < CHECK_OBJECTS; i++) {
+        struct Object *obj = &sCheckObjects[i];
+        obj->activeFlags = ACTIVE_FLAG_ACTIVE;
+        obj->oCollisionDistance = 20000.0f;
+        obj->header.gfx.throwMatrix = &obj->transform;
+        obj->header.gfx.scale[0] = obj->header.gfx.scale[2] = i % 3 == 0 ? 1.5f : 1.0f;
+        obj->header.gfx.scale[1] = 1.0f;
+    }
+
+    for (s32 frame = 0; frame < CHECK_FRAMES; frame++) {
+        gTimeStopState = frame >= 90 && frame < 93 ? TIME_STOP_ACTIVE : 0;
+        clear_dynamic_surfaces();
+        for (s32 i = 0; i < numObjects; i++) {
+            if (update_check_object(&sCheckObjects[i], i, frame, centerX, centerY, centerZ)) {
+                gCurrentObject = &sCheckObjects[i];
+                load_object_collision_model();
+            }
+        }
+    }
+
+    // The queries only see the area
+    gTimeStopState = 0;
+    clear_dynamic_surfaces();
+    gCurrentObject = NULL;
+}
+#endif
+
+static void load_bench_area(const struct BenchArea *area) {
+    load_area_terrain(area->area, (s16 *) area->collision, NULL, NULL);
+    count_list_lengths();
+
+    sMaxNodes = gSurfaceNodesAllocated > sMaxNodes ? gSurfaceNodesAllocated : sMaxNodes;
+#ifdef FINE_SURFACE_PARTITION
+    sMaxFineNodes = gFineSurfaceNodesAllocated > sMaxFineNodes ? gFineSurfaceNodesAllocated : sMaxFineNodes;
+#endif
+#ifdef PACKED_SURFACE_PARTITION
+    sMaxPackedBlocks = gPackedSurfaceBlocksAllocated > sMaxPackedBlocks ? gPackedSurfaceBlocksAllocated : sMaxPackedBlocks;
+#endif
+#ifdef CHECK_PERSISTENT_DYNAMIC_SURFACES
+    check_dynamic_surfaces();
+#endif
+}
+
+// Half of the points are above a random floor, where Mario and objects usually are, and the
+// other half anywhere around the area's geometry
+static void generate_queries(struct CollisionCaptureRecord *queries, s32 count) {
+    s16 minX = 0x7fff, minY = 0x7fff, minZ = 0x7fff;
+    s16 maxX = -0x8000, maxY = -0x8000, maxZ = -0x8000;
+    s32 numFloors = 0;
+    s32 *floors = malloc(gNumStaticSurfaces * sizeof(s32));
+
+    for (s32 i = 0; i < gNumStaticSurfaces; i++) {
+        struct Surface *surf = &sSurfacePool[i];
+        for (s32 j = 0; j < 3; j++) {
+            s16 *v = j == 0 ? surf->vertex1 : j == 1 ? surf->vertex2 : surf->vertex3;
+            minX = v[0] < minX ? v[0] : minX;
+            maxX = v[0] > maxX ? v[0] : maxX;
+            minY = v[1] < minY ? v[1] : minY;
+            maxY = v[1] > maxY ? v[1] : maxY;
+            minZ = v[2] < minZ ? v[2] : minZ;
+            maxZ = v[2] > maxZ ? v[2] : maxZ;
+        }
+        if (surf->normal.y > 0.01f) {
+            floors[numFloors++] = i;
+        }
+    }
+
+    memset(queries, 0, count * sizeof(struct CollisionCaptureRecord));
+    for (s32 i = 0; i < count; i++) {
+        struct CollisionCaptureRecord *q = &queries[i];
+        q->kind = i % QUERY_KINDS;
+        if ((i / QUERY_KINDS) % 2 == 0 && numFloors > 0) {
+            struct Surface *surf = &sSurfacePool[floors[random_u32() % numFloors]];
+            f32 a = random_range(0.0f, 1.0f);
+            f32 b = random_range(0.0f, 1.0f - a);
+            q->x = surf->vertex1[0] + a * (surf->vertex2[0] - surf->vertex1[0]) + b * (surf->vertex3[0] - surf->vertex1[0]);
+            q->y = surf->vertex1[1] + a * (surf->vertex2[1] - surf->vertex1[1]) + b * (surf->vertex3[1] - surf->vertex1[1]);
+            q->z = surf->vertex1[2] + a * (surf->vertex2[2] - surf->vertex1[2]) + b * (surf->vertex3[2] - surf->vertex1[2]);
+            q->y += random_range(0.0f, 300.0f);
+        } else {
+            q->x = random_range(minX, maxX);
+            q->y = random_range(minY - 500, maxY + 500);
+            q->z = random_range(minZ, maxZ);
+        }
+        // Mario's upper and lower wall checks, and the camera's
+        switch (random_u32() % 3) {
+            case 0:
+                q->offsetY = 60.0f;
+                q->radius = 50.0f;
+                break;
+            case 1:
+                q->offsetY = 30.0f;
+                q->radius = 24.0f;
+                break;
+            default:
+                q->offsetY = 0.0f;
+                q->radius = 150.0f;
+                q->flags = q->kind == COLLISION_CAPTURE_WALL ? COLLISION_CAPTURE_CAMERA : 0;
+                break;
+        }
+    }
+    free(floors);
+}
+
+static void print_trace_words(const char *label, const u8 *data, size_t size) {
+    printf("  %s", label);
+    for (size_t i = 0; i + sizeof(u32) <= size; i += sizeof(u32)) {
+        u32 word;
+        memcpy(&word, data + i, sizeof(u32));
+        printf(" %08x", word);
+    }
+    printf("\n");
+}
+
+// Compares a query's result with the trace, and reports the first one that differs
+static void compare_trace(const struct BenchArea *area, const struct CollisionCaptureRecord *q,
+                          const u8 *result, size_t size) {
+    u8 expected[sizeof(s32) * (4 + TRACE_MAX_WALLS)];
+
+    if (fread(expected, 1, size, sTraceIn) == size && memcmp(expected, result, size) == 0) {
+        return;
+    }
+    // The results that follow can't be lined up with the trace anymore
+    sTraceMismatch = TRUE;
+    printf("query %llu differs from the trace: %s in %s at (%.9g, %.9g, %.9g)", (unsigned long long) sQueriesRun,
+           sQueryNames[q->kind], area->name, q->x, q->y, q->z);
+    if (q->kind == COLLISION_CAPTURE_WALL) {
+        printf(" offset %.9g radius %.9g", q->offsetY, q->radius);
+    }
+    printf(" flags %x\n", q->flags);
+    print_trace_words("expected:", expected, size);
+    print_trace_words("result:  ", result, size);
+}
+
+// Runs the queries, and returns the checksum of their results. Each result is the returned
+// height and surface index, or for walls, the number of collisions, the pushed position and the
+// referenced walls.
+static uint32_t run_queries(const struct BenchArea *area, const struct CollisionCaptureRecord *queries, s32 count,
+                            uint32_t hash, double *seconds, u64 *ticks) {
+    double start = now_seconds();
+    u64 startTicks = read_ticks();
+
+    for (s32 i = 0; i < count; i++) {
+        const struct CollisionCaptureRecord *q = &queries[i];
+        struct Surface *surf = NULL;
+        struct WallCollisionData walls;
+        union { s32 i; f32 f; } result[4 + TRACE_MAX_WALLS];
+        size_t size;
+        u64 begin, end;
+
+        if (q->kind >= QUERY_KINDS) {
+            continue;
+        }
+        gCheckingSurfaceCollisionsForCamera = (q->flags & COLLISION_CAPTURE_CAMERA) != 0;
+        gFindFloorIncludeSurfaceIntangible = (q->flags & COLLISION_CAPTURE_INCLUDE_INTANGIBLE) != 0;
+        gCurrentObject = (q->flags & COLLISION_CAPTURE_THROUGH_VANISH_WALLS) ? &sGrateObject : NULL;
+
+        switch (q->kind) {
+            case COLLISION_CAPTURE_FLOOR:
+                begin = read_ticks();
+                result[0].f = find_floor(q->x, q->y, q->z, &surf);
+                end = read_ticks();
+                result[1].i = surface_index(surf);
+                size = 2;
+                break;
+            case COLLISION_CAPTURE_CEIL:
+                begin = read_ticks();
+                result[0].f = find_ceil(q->x, q->y, q->z, &surf);
+                end = read_ticks();
+                result[1].i = surface_index(surf);
+                size = 2;
+                break;
+            case COLLISION_CAPTURE_WALL:
+                walls.x = q->x;
+                walls.y = q->y;
+                walls.z = q->z;
+                walls.offsetY = q->offsetY;
+                walls.radius = q->radius;
+                begin = read_ticks();
+                result[0].i = find_wall_collisions(&walls);
+                end = read_ticks();
+                result[1].f = walls.x;
+                result[2].f = walls.z;
+                result[3].i = walls.numWalls;
+                for (s32 j = 0; j < walls.numWalls; j++) {
+                    result[4 + j].i = surface_index(walls.walls[j]);
+                }
+                size = 4 + walls.numWalls;
+                break;
+            default:
+                begin = read_ticks();
+                result[0].f = find_water_level(q->x, q->z);
+                end = read_ticks();
+                size = 1;
+                break;
+        }
+        add_latency(q->kind, (u32) (end - begin));
+        ticks[q->kind] += end - begin;
+
+        size *= sizeof(s32);
+        hash = fnv1a(hash, result, size);
+        if (sTraceOut != NULL) {
+            fwrite(result, 1, size, sTraceOut);
+        }
+        if (sTraceIn != NULL && !sTraceMismatch) {
+            compare_trace(area, q, (const u8 *) result, size);
+        }
+        sQueriesRun++;
+    }
+    gCurrentObject = NULL;
+    gCheckingSurfaceCollisionsForCamera = FALSE;
+
+    *seconds += now_seconds() - start;
+    ticks[QUERY_KINDS] += read_ticks() - startTicks;
+    return hash;
+}
+
+// The median cost of reading the tick counter twice, which is taken off each sample
+static u32 timer_overhead(void) {
+    u32 samples[1001];
+
+    for (s32 i = 0; i < 1001; i++) {
+        u64 begin = read_ticks();
+        u64 end = read_ticks();
+        samples[i] = (u32) (end - begin);
+    }
+    for (s32 i = 1; i < 1001; i++) {
+        u32 value = samples[i];
+        s32 j = i;
+        for (; j > 0 && samples[j - 1] > value; j--) {
+            samples[j] = samples[j - 1];
+        }
+        samples[j] = value;
+    }
+    return samples[500];
+}
+
+static int compare_u32(const void *a, const void *b) {
+    u32 x = *(const u32 *) a;
+    u32 y = *(const u32 *) b;
+    return x < y ? -1 : x > y;
+}
+
+static double percentile_ns(const struct LatencySamples *samples, double fraction, u32 overhead, double nsPerTick) {
+    size_t i = (size_t) (fraction * (samples->count - 1) + 0.5);
+    u32 ticks = samples->ticks[i];
+    return (ticks > overhead ? ticks - overhead : 0) * nsPerTick;
+}
+
+static void print_list_lengths(const char *partition, const struct ListLengths *lengths) {
+    printf("%-22s", partition);
+    for (s32 i = 0; i < 3; i++) {
+        printf(" %9.1f %6d", lengths[i].lists != 0 ? (double) lengths[i].nodes / lengths[i].lists : 0.0,
+               lengths[i].max);
+    }
+    printf("\n");
+}
+
+static FILE *open_trace(const char *path, const char *mode) {
+    FILE *f = fopen(path, mode);
+    uint32_t header[1] = { TRACE_VERSION };
+    char magic[8];
+
+    if (f == NULL) {
+        fprintf(stderr, "could not open %s\n", path);
+        exit(1);
+    }
+    if (mode[0] == 'w') {
+        fwrite(TRACE_MAGIC, 1, 8, f);
+        fwrite(header, sizeof(uint32_t), 1, f);
+    } else if (fread(magic, 1, 8, f) != 8 || memcmp(magic, TRACE_MAGIC, 8) != 0
+               || fread(header, sizeof(uint32_t), 1, f) != 1 || header[0] != TRACE_VERSION) {
+        fprintf(stderr, "%s is not a collision trace\n", path);
+        exit(1);
+    }
+    return f;
+}
+
+int main(int argc, char *argv[]) {
+    s32 count = DEFAULT_QUERIES;
+    const char *replayPath = NULL;
+    const char *recordPath = NULL;
+    struct CollisionCaptureRecord *queries;
+    uint32_t hash = FNV_OFFSET_BASIS;
+    double seconds = 0.0;
+    u64 ticks[QUERY_KINDS + 1] = { 0 };
+    u64 counts[QUERY_KINDS] = { 0 };
+    u32 numAreas = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (strcmp(argv[i], "--write-trace") == 0 && i + 1 < argc) {
+            sTraceOut = open_trace(argv[++i], "wb");
+        } else if (strcmp(argv[i], "--compare-trace") == 0 && i + 1 < argc) {
+            sTraceIn = open_trace(argv[++i], "rb");
+        } else if (atoi(argv[i]) > 0) {
+            count = atoi(argv[i]);
+        } else {
+            fprintf(stderr, "usage: %s [queries per area] [--replay <capture>] [--record <capture>] "
+                            "[--write-trace <file>] [--compare-trace <file>]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (recordPath != NULL && !collision_capture_open(recordPath)) {
+        return 1;
+    }
+    alloc_surface_pools();
+    sGrateObject.activeFlags = ACTIVE_FLAG_ACTIVE | ACTIVE_FLAG_MOVE_THROUGH_GRATE;
+
+#if defined(CHECK_PERSISTENT_DYNAMIC_SURFACES)
+    printf("partition: 16x16 cells, object surfaces reused and checked\n");
+#elif defined(PACKED_SURFACE_PARTITION)
+    printf("partition: %dx%d cells, packed\n", NUM_FINE_CELLS, NUM_FINE_CELLS);
+#elif defined(FINE_SURFACE_PARTITION)
+    printf("partition: %dx%d cells\n", NUM_FINE_CELLS, NUM_FINE_CELLS);
+#else
+    printf("partition: 16x16 cells\n");
+#endif
+
+    if (replayPath != NULL) {
+        u32 numRecords = collision_capture_load(replayPath, &queries);
+        const struct BenchArea *area = NULL;
+        u64 skipped = 0;
+
+        if (numRecords == 0) {
+            fprintf(stderr, "could not load %s\n", replayPath);
+            return 1;
+        }
+        // Queries before the first area, and in areas that the bench doesn't have, are skipped
+        for (u32 i = 0; i < numRecords;) {
+            u32 end = i;
+            if (queries[i].kind == COLLISION_CAPTURE_AREA) {
+                area = find_area(queries[i].level, queries[i].area);
+                if (area != NULL) {
+                    load_bench_area(area);
+                    numAreas++;
+                } else {
+                    printf("skipping level %d area %d, which has no collision here\n", queries[i].level,
+                           queries[i].area);
+                }
+                i++;
+                continue;
+            }
+            while (end < numRecords && queries[end].kind != COLLISION_CAPTURE_AREA) {
+                end++;
+            }
+            if (area != NULL) {
+                hash = run_queries(area, &queries[i], end - i, hash, &seconds, ticks);
+            } else {
+                skipped += end - i;
+            }
+            i = end;
+        }
+        printf("replayed %u records of %s, skipped %llu queries\n", numRecords, replayPath,
+               (unsigned long long) skipped);
+    } else {
+        queries = malloc(count * sizeof(struct CollisionCaptureRecord));
+        for (u32 i = 0; i < ARRAY_COUNT(sAreas); i++) {
+            load_bench_area(&sAreas[i]);
+            generate_queries(queries, count);
+            if (recordPath != NULL) {
+                collision_capture_area(sAreas[i].level, sAreas[i].area);
+                for (s32 j = 0; j < count; j++) {
+                    const struct CollisionCaptureRecord *q = &queries[j];
+                    collision_capture_query(q->kind, q->flags, q->x, q->y, q->z, q->offsetY, q->radius);
+                }
+            }
+            hash = run_queries(&sAreas[i], queries, count, hash, &seconds, ticks);
+            numAreas++;
+        }
+    }
+
+    u64 total = 0;
+    for (s32 i = 0; i < QUERY_KINDS; i++) {
+        counts[i] = sLatency[i].count;
+        total += counts[i];
+    }
+    if (total == 0) {
+        fprintf(stderr, "no queries were run\n");
+        return 1;
+    }
+
+    // The time stamp counter runs at a fixed rate, measured against the clock over the whole run
+    double nsPerTick = seconds * 1e9 / ticks[QUERY_KINDS];
+    u32 overhead = timer_overhead();
+    // Only the time spent in the queries themselves, without the trace and the bookkeeping around them
+    u64 queryTicks = 0;
+    for (s32 i = 0; i < QUERY_KINDS; i++) {
+        queryTicks += ticks[i] > counts[i] * overhead ? ticks[i] - counts[i] * overhead : 0;
+    }
+    printf("%u areas, %llu queries in %.3f s: %.2f M queries/s\n", numAreas, (unsigned long long) total,
+           queryTicks * nsPerTick * 1e-9, total / (queryTicks * nsPerTick * 1e-3));
+#if defined(PACKED_SURFACE_PARTITION)
+    printf("most surface nodes in an area: %d, fine partition: %d, packed blocks: %d\n\n", sMaxNodes,
+           sMaxFineNodes, sMaxPackedBlocks);
+#elif defined(FINE_SURFACE_PARTITION)
+    printf("most surface nodes in an area: %d, fine partition: %d\n\n", sMaxNodes, sMaxFineNodes);
+#else
+    printf("most surface nodes in an area: %d\n\n", sMaxNodes);
+#endif
+
+    printf("latency (ns)               mean      p50      p90      p99    p99.9        max\n");
+    for (s32 i = 0; i < QUERY_KINDS; i++) {
+        struct LatencySamples *samples = &sLatency[i];
+        if (samples->count == 0) {
+            continue;
+        }
+        qsort(samples->ticks, samples->count, sizeof(u32), compare_u32);
+        double mean = (double) ticks[i] / samples->count;
+        mean = mean > overhead ? mean - overhead : 0.0;
+        printf("%-22s %8.1f %8.1f %8.1f %8.1f %8.1f %10.1f\n", sQueryNames[i], mean * nsPerTick,
+               percentile_ns(samples, 0.5, overhead, nsPerTick), percentile_ns(samples, 0.9, overhead, nsPerTick),
+               percentile_ns(samples, 0.99, overhead, nsPerTick), percentile_ns(samples, 0.999, overhead, nsPerTick),
+               percentile_ns(samples, 1.0, overhead, nsPerTick));
+    }
+    printf("(timer overhead of %.1f ns taken off)\n\n", overhead * nsPerTick);
+
+    // Over the non-empty static lists of every area loaded
+    printf("list lengths           floors mean    max  ceils mean    max  walls mean    max\n");
+    print_list_lengths("16x16 partition", sCoarseLengths);
+#ifdef FINE_SURFACE_PARTITION
+    {
+        char name[32];
+        sprintf(name, "%dx%d partition", NUM_FINE_CELLS, NUM_FINE_CELLS);
+        print_list_lengths(name, sFineLengths);
+    }
+#endif
+    printf("\n");
+
+#ifdef SURFACE_QUERY_PROFILING
+    printf("%-22s %16s %16s\n", "query", "surfaces/query", "lists skipped");
+    for (s32 i = 0; i < 3; i++) {
+        printf("%-22s %16.2f %15.1f%%\n", sQueryNames[i],
+               counts[i] != 0 ? (double) gSurfaceQueryStats.surfacesVisited[i] / counts[i] : 0.0,
+               gSurfaceQueryStats.lists[i] != 0 ? 100.0 * gSurfaceQueryStats.listsSkipped[i] / gSurfaceQueryStats.lists[i] : 0.0);
+    }
+    printf("\n");
+#endif
+
+#ifdef CHECK_PERSISTENT_DYNAMIC_SURFACES
+    const struct DynamicSurfaceStats *dss = &gDynamicSurfaceStats;
+    printf("object surfaces: %llu rebuilt, %llu reused over %u frames with %d to %d platforms per area\n",
+           (unsigned long long) dss->totalRebuilt, (unsigned long long) dss->totalReused, dss->frames,
+           sMinCheckObjects, CHECK_OBJECTS);
+    printf("%u of %u loads differ from a full rebuild\n\n", dss->mismatchedLoads, dss->checkedLoads);
+#endif
+
+    printf("result checksum: %08x\n", hash);
+    free(queries);
+    if (sTraceOut != NULL) {
+        fclose(sTraceOut);
+    }
+    if (sTraceIn != NULL) {
+        u8 extra;
+        if (!sTraceMismatch && fread(&extra, 1, 1, sTraceIn) == 1) {
+            printf("the trace has more results than were run\n");
+            sTraceMismatch = TRUE;
+        } else if (!sTraceMismatch) {
+            printf("all %llu results match the trace\n", (unsigned long long) sQueriesRun);
+        }
+        fclose(sTraceIn);
+    }
+#ifdef CHECK_PERSISTENT_DYNAMIC_SURFACES
+    if (gDynamicSurfaceStats.mismatchedLoads != 0) {
+        return 1;
+    }
+#endif
+    return sTraceMismatch ? 1 : 0;
+}
@@ -0,0 +1,194 @@
+// Replays display lists recorded with ENABLE_GFX_CAPTURE=1 through the F3D interpreter
+// and the null renderer, and reports interpreter throughput.
+//
+// Usage: gfx_replay <capture file> [iterations]
+//
+// Built by 'make TARGET_N3DS=0 ENABLE_HEADLESS=1 gfx-replay'.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "src/pc/gfx/gfx_capture.h"
+#include "src/pc/gfx/gfx_pc.h"
+#include "src/pc/gfx/gfx_null.h"
+#include "src/pc/gfx/gfx_headless.h"
+
+// gfx_headless.c splits its report by level, a replay never leaves this one
+s16 gCurrLevelNum;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static const char *opcode_name(uint32_t opcode) {
+    switch (opcode) {
+        case G_MTX: return "G_MTX";
+        case (uint8_t)G_POPMTX: return "G_POPMTX";
+        case G_MOVEMEM: return "G_MOVEMEM";
+        case (uint8_t)G_MOVEWORD: return "G_MOVEWORD";
+        case (uint8_t)G_TEXTURE: return "G_TEXTURE";
+        case G_VTX: return "G_VTX";
+        case G_DL: return "G_DL";
+        case (uint8_t)G_ENDDL: return "G_ENDDL";
+#ifdef F3DEX_GBI_2
+        case G_GEOMETRYMODE: return "G_GEOMETRYMODE";
+#else
+        case (uint8_t)G_SETGEOMETRYMODE: return "G_SETGEOMETRYMODE";
+        case (uint8_t)G_CLEARGEOMETRYMODE: return "G_CLEARGEOMETRYMODE";
+#endif
+        case (uint8_t)G_TRI1: return "G_TRI1";
+#if defined(F3DEX_GBI) || defined(F3DLP_GBI)
+        case (uint8_t)G_TRI2: return "G_TRI2";
+#endif
+        case (uint8_t)G_SETOTHERMODE_L: return "G_SETOTHERMODE_L";
+        case (uint8_t)G_SETOTHERMODE_H: return "G_SETOTHERMODE_H";
+        case G_SETTIMG: return "G_SETTIMG";
+        case G_LOADBLOCK: return "G_LOADBLOCK";
+        case G_LOADTILE: return "G_LOADTILE";
+        case G_SETTILE: return "G_SETTILE";
+        case G_SETTILESIZE: return "G_SETTILESIZE";
+        case G_LOADTLUT: return "G_LOADTLUT";
+        case G_SETENVCOLOR: return "G_SETENVCOLOR";
+        case G_SETPRIMCOLOR: return "G_SETPRIMCOLOR";
+        case G_SETFOGCOLOR: return "G_SETFOGCOLOR";
+        case G_SETFILLCOLOR: return "G_SETFILLCOLOR";
+        case G_SETCOMBINE: return "G_SETCOMBINE";
+        case G_TEXRECT: return "G_TEXRECT";
+        case G_TEXRECTFLIP: return "G_TEXRECTFLIP";
+        case G_FILLRECT: return "G_FILLRECT";
+        case G_SETSCISSOR: return "G_SETSCISSOR";
+        case G_SETZIMG: return "G_SETZIMG";
+        case G_SETCIMG: return "G_SETCIMG";
+        case G_RDPLOADSYNC: return "G_RDPLOADSYNC";
+        case G_RDPPIPESYNC: return "G_RDPPIPESYNC";
+        case G_RDPTILESYNC: return "G_RDPTILESYNC";
+        case G_RDPFULLSYNC: return "G_RDPFULLSYNC";
+        case GFX_OPCODE_PROFILE_FLUSH: return "(end of frame flush)";
+        default: return "?";
+    }
+}
+
+static void run_frames(struct GfxCaptureFrame *frames, uint32_t num_frames) {
+    for (uint32_t i = 0; i < num_frames; i++) {
+        gfx_start_frame();
+        gfx_run(frames[i].root);
+        gfx_end_frame();
+    }
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <capture file> [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    uint32_t iterations = argc > 2 && atoi(argv[2]) > 0 ? (uint32_t) atoi(argv[2]) : 100;
+
+    struct GfxCaptureFrame *frames;
+    uint32_t num_frames = gfx_capture_load(argv[1], &frames);
+    if (num_frames == 0) {
+        fprintf(stderr, "could not load %s\n", argv[1]);
+        return 1;
+    }
+
+    gfx_init(&gfx_headless, &gfx_null_api, "gfx_replay", false);
+
+    // Warm up the texture cache and shader pool so only steady-state work is timed.
+    // When the capture starts at frame 0, this pass sees the same state as the live run,
+    // so its checksum should match the one printed by the headless build for those frames.
+    run_frames(frames, num_frames);
+    uint32_t first_pass_checksum = gfx_null_stats.vbo_checksum;
+
+    struct GfxNullStats before = gfx_null_stats;
+    struct GfxDrawStats before_draws = gfx_draw_stats;
+    double start = now_seconds();
+    for (uint32_t i = 0; i < iterations; i++) {
+        run_frames(frames, num_frames);
+    }
+    double elapsed = now_seconds() - start;
+
+    uint64_t total_frames = (uint64_t) iterations * num_frames;
+    uint64_t tris = gfx_null_stats.triangles - before.triangles;
+    uint64_t draw_calls = gfx_null_stats.draw_calls - before.draw_calls;
+    uint64_t vbo_floats = gfx_null_stats.vbo_floats - before.vbo_floats;
+    uint64_t batches = gfx_draw_stats.batches - before_draws.batches;
+
+    printf("%u captured frames x %u iterations in %.3f s\n", num_frames, iterations, elapsed);
+    printf("frames/sec:     %.1f\n", total_frames / elapsed);
+    printf("tris/sec:       %.0f\n", tris / elapsed);
+    printf("draw calls:     %.1f per frame, merged from %.1f batches\n", (double) draw_calls / total_frames, (double) batches / total_frames);
+    printf("vbo floats:     %.1f per triangle\n", tris > 0 ? (double) vbo_floats / tris : 0.0);
+    printf("vbo checksum:   %08x (first pass)\n", first_pass_checksum);
+    const struct GfxTextureCacheStats *tc = &gfx_texture_cache_stats;
+    printf("texture cache:  %llu hits, %llu misses, %llu evictions, %u textures, %zu bytes\n",
+           (unsigned long long) tc->hits, (unsigned long long) tc->misses,
+           (unsigned long long) tc->evictions, tc->textures, tc->bytes);
+    printf("texture dedup:  %llu content hits (%.1f%% of misses), saved %llu bytes by address, %llu by content\n",
+           (unsigned long long) tc->content_hits, tc->misses > 0 ? 100.0 * tc->content_hits / tc->misses : 0.0,
+           (unsigned long long) tc->hit_bytes, (unsigned long long) tc->content_hit_bytes);
+
+    // Per-opcode timing adds a clock read per command, so it gets a separate pass
+    gfx_opcode_profiling_enabled = true;
+    for (uint32_t i = 0; i < iterations; i++) {
+        run_frames(frames, num_frames);
+    }
+    gfx_opcode_profiling_enabled = false;
+
+    uint64_t total_ns = 0;
+    for (uint32_t op = 0; op < GFX_OPCODE_PROFILE_SLOTS; op++) {
+        total_ns += gfx_opcode_profile.nanoseconds[op];
+    }
+
+    printf("\n%-22s %12s %12s %10s %7s\n", "opcode", "count/frame", "us/frame", "ns/call", "share");
+    for (uint32_t op = 0; op < GFX_OPCODE_PROFILE_SLOTS; op++) {
+        uint64_t count = gfx_opcode_profile.count[op];
+        uint64_t ns = gfx_opcode_profile.nanoseconds[op];
+        if (count == 0) {
+            continue;
+        }
+        printf("%-22s %12.1f %12.2f %10.1f %6.1f%%\n", opcode_name(op),
+               (double) count / total_frames, ns / 1000.0 / total_frames,
+               (double) ns / count, total_ns > 0 ? 100.0 * ns / total_ns : 0.0);
+    }
+
+    // Vertex load throughput of the batch kernel chosen at build time versus the scalar reference
+    printf("\n%-22s %16s\n", "vertex kernel", "Mvertices/sec");
+    for (int pass = 0; pass < 2; pass++) {
+        gfx_vertex_force_reference = pass == 1;
+        memset(&gfx_opcode_profile, 0, sizeof(gfx_opcode_profile));
+        gfx_opcode_profiling_enabled = true;
+        for (uint32_t i = 0; i < iterations; i++) {
+            run_frames(frames, num_frames);
+        }
+        gfx_opcode_profiling_enabled = false;
+
+        uint64_t vtx_ns = gfx_opcode_profile.nanoseconds[G_VTX];
+        printf("%-22s %16.2f\n", pass == 0 ? gfx_vertex_kernel_name : "reference",
+               vtx_ns > 0 ? gfx_opcode_profile.vertices / (vtx_ns * 1e-9) / 1e6 : 0.0);
+    }
+    gfx_vertex_force_reference = false;
+
+    // Merged draws versus every batch drawn in display list order
+    printf("\n%-22s %12s %12s\n", "draw order", "draws/frame", "frames/sec");
+    for (int pass = 0; pass < 2; pass++) {
+        gfx_draw_force_unsorted = pass == 1;
+        uint64_t draws = gfx_draw_stats.draws;
+        double pass_start = now_seconds();
+        for (uint32_t i = 0; i < iterations; i++) {
+            run_frames(frames, num_frames);
+        }
+        double pass_elapsed = now_seconds() - pass_start;
+        printf("%-22s %12.1f %12.1f\n", pass == 0 ? "merged" : "display list",
+               (double) (gfx_draw_stats.draws - draws) / total_frames, total_frames / pass_elapsed);
+    }
+    gfx_draw_force_unsorted = false;
+
+    gfx_capture_free(frames, num_frames);
+    return 0;
+}
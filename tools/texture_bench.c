@@ -0,0 +1,115 @@
+// Checks that the texel format converters selected at build time produce exactly the same
+// RGBA32 output as the scalar reference converters, then compares their throughput.
+// Exits with status 1 if any converter differs.
+//
+// Usage: texture_bench [iterations]
+//
+// Built by 'make TARGET_N3DS=0 ENABLE_HEADLESS=1 texture-bench'.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include <PR/gbi.h>
+
+#include "src/pc/gfx/gfx_pc.h"
+
+// Largest texture a single load can hold
+#define TMEM_SIZE 4096
+
+static uint8_t src[TMEM_SIZE + 1];
+static uint8_t palette[512];
+static uint8_t out[TMEM_SIZE * 8 + 64];
+static uint8_t expected[TMEM_SIZE * 8 + 64];
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Decoded size in bytes of size_bytes of texels
+static size_t decoded_size(const struct GfxTextureConverter *conv, uint32_t size_bytes) {
+    return (size_t) (size_bytes * 2 >> conv->siz) * 4;
+}
+
+static bool check(const struct GfxTextureConverter *conv, const uint8_t *data, uint32_t size_bytes) {
+    size_t size = decoded_size(conv, size_bytes);
+    memset(out, 0xAA, size + 64);
+    memset(expected, 0xAA, size + 64);
+    conv->convert(out, data, size_bytes, palette);
+    conv->reference(expected, data, size_bytes, palette);
+
+    // Also catches writes past the end of the texture
+    if (memcmp(out, expected, size + 64) != 0) {
+        for (size_t i = 0; i < size + 64; i++) {
+            if (out[i] != expected[i]) {
+                printf("%s: mismatch for %u bytes at output byte %zu: %u instead of %u\n",
+                       conv->name, size_bytes, i, out[i], expected[i]);
+                break;
+            }
+        }
+        return false;
+    }
+    return true;
+}
+
+static bool check_converter(const struct GfxTextureConverter *conv) {
+    bool ok = true;
+
+    // Every 16-bit value, which covers every texel of every format
+    static uint8_t all_values[65536 * 2];
+    for (uint32_t v = 0; v < 65536; v++) {
+        all_values[2 * v] = v >> 8;
+        all_values[2 * v + 1] = v & 0xff;
+    }
+    for (uint32_t offset = 0; offset < sizeof(all_values); offset += TMEM_SIZE) {
+        ok &= check(conv, all_values + offset, TMEM_SIZE);
+    }
+
+    // Every size up to a full load, to exercise the leftover texels, from an unaligned source
+    for (uint32_t size_bytes = 0; size_bytes <= TMEM_SIZE; size_bytes += size_bytes < 256 ? 1 : 61) {
+        ok &= check(conv, src + 1, size_bytes);
+    }
+    return ok;
+}
+
+static double time_converter(void (*convert)(uint8_t *, const uint8_t *, uint32_t, const uint8_t *), uint32_t iterations) {
+    double start = now_seconds();
+    for (uint32_t i = 0; i < iterations; i++) {
+        convert(out, src, TMEM_SIZE, palette);
+    }
+    return now_seconds() - start;
+}
+
+int main(int argc, char *argv[]) {
+    uint32_t iterations = argc > 1 && atoi(argv[1]) > 0 ? (uint32_t) atoi(argv[1]) : 20000;
+
+    srand(1);
+    for (size_t i = 0; i < sizeof(src); i++) {
+        src[i] = rand();
+    }
+    for (size_t i = 0; i < sizeof(palette); i++) {
+        palette[i] = rand();
+    }
+
+    bool ok = true;
+    for (int i = 0; i < GFX_NUM_TEXTURE_CONVERTERS; i++) {
+        ok &= check_converter(&gfx_texture_converters[i]);
+    }
+    printf("%s converters: %s\n\n", gfx_texture_kernel_name, ok ? "bit-exact" : "MISMATCH");
+
+    printf("%-8s %16s %16s %9s\n", "format", "Mtexels/sec", "reference", "speedup");
+    for (int i = 0; i < GFX_NUM_TEXTURE_CONVERTERS; i++) {
+        const struct GfxTextureConverter *conv = &gfx_texture_converters[i];
+        double texels = (double) iterations * (TMEM_SIZE * 2 >> conv->siz);
+        double fast = time_converter(conv->convert, iterations);
+        double reference = time_converter(conv->reference, iterations);
+        printf("%-8s %16.1f %16.1f %8.2fx\n", conv->name, texels / fast / 1e6, texels / reference / 1e6, reference / fast);
+    }
+
+    return ok ? 0 : 1;
+}
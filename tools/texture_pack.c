@@ -0,0 +1,210 @@
+// Bakes extracted N64 textures into a pre-converted texture pack (see src/pc/gfx/gfx_texture_pack.h),
+// decoding them with the same scalar converters the game uses at runtime.
+//
+// Usage: texture_pack [--tiled] <output file> <build dir> <png files...>
+//
+// Each png is a texture asset, named after its format (foo.rgba16.png, foo.ia8.png, ...), whose
+// size is read from its header. Its texels are the raw ones n64graphics writes for it in the build
+// directory, without the .png. CI textures also need the palette n64graphics_ci writes next to
+// them (foo.ci4.pal). RGBA32 textures are uploaded without conversion and are skipped, as are
+// textures too big to be loaded at once.
+//
+// --tiled writes a GFX_TEXTURE_PACK_TILED pack for the 3DS instead of an RGBA32 one.
+//
+// Built and run by 'make texture-pack'.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <PR/gbi.h>
+
+#include "src/pc/gfx/gfx_pc.h"
+#include "src/pc/gfx/gfx_texture_pack.h"
+
+// Largest texture a single load can hold
+#define TMEM_SIZE 4096
+
+struct PackedTexture {
+    struct GfxTexturePackEntry entry;
+    uint8_t *texels;
+    size_t texels_size;
+};
+
+static struct PackedTexture *textures;
+static uint32_t num_textures;
+static uint32_t layout = GFX_TEXTURE_PACK_RGBA32;
+
+static uint8_t *read_file(const char *path, size_t *size) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = malloc(len > 0 ? len : 1);
+    if (len < 0 || fread(data, 1, len, f) != (size_t) len) {
+        free(data);
+        fclose(f);
+        return NULL;
+    }
+    fclose(f);
+    *size = len;
+    return data;
+}
+
+static const struct GfxTextureConverter *find_converter(const char *path) {
+    const char *ext = strrchr(path, '.');
+    if (ext == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < GFX_NUM_TEXTURE_CONVERTERS; i++) {
+        if (strcmp(ext + 1, gfx_texture_converters[i].name) == 0) {
+            return &gfx_texture_converters[i];
+        }
+    }
+    return NULL;
+}
+
+// Reads the size from a png's IHDR chunk
+static bool read_png_size(const char *path, uint32_t *width, uint32_t *height) {
+    uint8_t header[24];
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return false;
+    }
+    bool ok = fread(header, 1, sizeof(header), f) == sizeof(header) && memcmp(header + 12, "IHDR", 4) == 0;
+    fclose(f);
+    if (ok) {
+        *width = (header[16] << 24) | (header[17] << 16) | (header[18] << 8) | header[19];
+        *height = (header[20] << 24) | (header[21] << 16) | (header[22] << 8) | header[23];
+    }
+    return ok;
+}
+
+static bool is_packed(uint64_t key, const struct GfxTextureConverter *conv, uint32_t size_bytes, uint32_t width, uint32_t height) {
+    for (uint32_t i = 0; i < num_textures; i++) {
+        const struct GfxTexturePackEntry *e = &textures[i].entry;
+        if (e->key == key && e->fmt == conv->fmt && e->siz == conv->siz && e->size_bytes == size_bytes &&
+            e->width == width && e->height == height) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns false if the texture is skipped
+static bool add_texture(const char *build_dir, const char *png_path) {
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%.*s", build_dir, (int) strlen(png_path) - 4, png_path);
+    const struct GfxTextureConverter *conv = find_converter(path);
+    uint32_t width, height;
+    if (conv == NULL || !read_png_size(png_path, &width, &height)) {
+        return false;
+    }
+
+    size_t size, palette_size = 0;
+    uint8_t *texels = read_file(path, &size);
+    if (texels == NULL || size == 0 || size > TMEM_SIZE || width * height != (size * 2 >> conv->siz)) {
+        free(texels);
+        return false;
+    }
+
+    uint8_t *palette = NULL;
+    if (conv->fmt == G_IM_FMT_CI) {
+        char palette_path[4096];
+        snprintf(palette_path, sizeof(palette_path), "%s.pal", path);
+        palette = read_file(palette_path, &palette_size);
+        if (palette == NULL) {
+            free(texels);
+            return false;
+        }
+    }
+
+    uint64_t key = gfx_texture_pack_key(texels, size, conv->fmt, conv->siz, palette, palette_size);
+    if (!is_packed(key, conv, size, width, height)) {
+        // The converters read every palette entry that the texels index
+        uint8_t full_palette[512] = { 0 };
+        if (palette != NULL) {
+            memcpy(full_palette, palette, palette_size < sizeof(full_palette) ? palette_size : sizeof(full_palette));
+        }
+
+        textures = realloc(textures, (num_textures + 1) * sizeof(struct PackedTexture));
+        struct PackedTexture *t = &textures[num_textures++];
+        t->entry.key = key;
+        t->entry.size_bytes = size;
+        t->entry.fmt = conv->fmt;
+        t->entry.siz = conv->siz;
+        t->entry.width = width;
+        t->entry.height = height;
+        t->texels_size = gfx_texture_pack_texels_size(layout, width, height);
+        t->texels = malloc(t->texels_size);
+        conv->reference(t->texels, texels, size, full_palette);
+        if (layout == GFX_TEXTURE_PACK_TILED) {
+            uint8_t *tiled = malloc(t->texels_size);
+            gfx_texture_pack_tile((uint32_t *) tiled, t->texels, width, height);
+            free(t->texels);
+            t->texels = tiled;
+        }
+    }
+
+    free(texels);
+    free(palette);
+    return true;
+}
+
+static int compare_keys(const void *a, const void *b) {
+    uint64_t ka = ((const struct PackedTexture *) a)->entry.key;
+    uint64_t kb = ((const struct PackedTexture *) b)->entry.key;
+    return ka < kb ? -1 : ka > kb;
+}
+
+int main(int argc, char *argv[]) {
+    int arg = 1;
+    if (arg < argc && strcmp(argv[arg], "--tiled") == 0) {
+        layout = GFX_TEXTURE_PACK_TILED;
+        arg++;
+    }
+    if (argc - arg < 2) {
+        fprintf(stderr, "usage: %s [--tiled] <output file> <build dir> <png files...>\n", argv[0]);
+        return 1;
+    }
+    const char *output = argv[arg];
+    const char *build_dir = argv[arg + 1];
+
+    uint32_t skipped = 0;
+    for (int i = arg + 2; i < argc; i++) {
+        if (!add_texture(build_dir, argv[i])) {
+            skipped++;
+        }
+    }
+    qsort(textures, num_textures, sizeof(struct PackedTexture), compare_keys);
+
+    FILE *f = fopen(output, "wb");
+    if (f == NULL) {
+        fprintf(stderr, "could not open %s\n", output);
+        return 1;
+    }
+
+    // The last word keeps the entries 8-byte aligned
+    uint32_t header[4] = { GFX_TEXTURE_PACK_VERSION, layout, num_textures, 0 };
+    fwrite(GFX_TEXTURE_PACK_MAGIC, 1, 8, f);
+    fwrite(header, sizeof(uint32_t), 4, f);
+
+    uint32_t offset = 8 + sizeof(header) + num_textures * sizeof(struct GfxTexturePackEntry);
+    for (uint32_t i = 0; i < num_textures; i++) {
+        textures[i].entry.offset = offset;
+        offset += textures[i].texels_size;
+        fwrite(&textures[i].entry, sizeof(struct GfxTexturePackEntry), 1, f);
+    }
+    for (uint32_t i = 0; i < num_textures; i++) {
+        fwrite(textures[i].texels, 1, textures[i].texels_size, f);
+    }
+    fclose(f);
+
+    printf("%s: %u textures, %u bytes (%u files skipped)\n", output, num_textures, offset, skipped);
+    return 0;
+}